@@ -1,3 +1,4 @@
+import { router } from "expo-router";
 import React from "react";
 import { Button, View } from "react-native";
 import { AudioContext } from "react-native-audio-api";
@@ -22,6 +23,10 @@ export default function App() {
   return (
     <View style={{ flex: 1, justifyContent: "center", alignItems: "center" }}>
       <Button onPress={handlePlay} title="Play sound!" />
+      <Button
+        onPress={() => router.push("/jsi-benchmark")}
+        title="JSI benchmark"
+      />
     </View>
   );
 }
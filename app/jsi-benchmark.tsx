@@ -0,0 +1,106 @@
+import React, { useState } from 'react';
+import { Button, ScrollView, StyleSheet } from 'react-native';
+import { OfflineAudioContext } from 'react-native-audio-api';
+
+import { ThemedText } from '@/components/themed-text';
+import { ThemedView } from '@/components/themed-view';
+
+// Measures how many host object calls per second go through JSI. Run it on a release build,
+// once on the commit before a dispatch change and once after it, to compare the numbers.
+
+const SAMPLE_DURATION_MS = 500;
+const CALLS_PER_BATCH = 1000;
+
+type BenchmarkCase = {
+  name: string;
+  run: () => void;
+};
+
+type BenchmarkResult = {
+  name: string;
+  callsPerSecond: number;
+};
+
+function createCases(): BenchmarkCase[] {
+  const context = new OfflineAudioContext(2, 44100, 44100);
+  const gain = context.createGain();
+  const analyser = context.createAnalyser();
+  const frequencyData = new Uint8Array(analyser.frequencyBinCount);
+  let value = 0;
+
+  return [
+    { name: 'AudioParam.value (get)', run: () => (value += gain.gain.value) },
+    { name: 'AudioParam.value (set)', run: () => (gain.gain.value = 0.5) },
+    {
+      name: 'AudioParam.setValueAtTime',
+      run: () => gain.gain.setValueAtTime(0.5, 0),
+    },
+    {
+      name: 'AudioParam.linearRampToValueAtTime',
+      run: () => gain.gain.linearRampToValueAtTime(0.5, 1),
+    },
+    { name: 'AnalyserNode.fftSize (get)', run: () => (value += analyser.fftSize) },
+    {
+      name: 'AnalyserNode.getByteFrequencyData',
+      run: () => analyser.getByteFrequencyData(frequencyData),
+    },
+  ];
+}
+
+function measure(benchmarkCase: BenchmarkCase): BenchmarkResult {
+  // warms up the JIT and the per-object caches before measuring
+  for (let i = 0; i < CALLS_PER_BATCH; i++) {
+    benchmarkCase.run();
+  }
+
+  let calls = 0;
+  const start = performance.now();
+  let elapsed = 0;
+
+  while (elapsed < SAMPLE_DURATION_MS) {
+    for (let i = 0; i < CALLS_PER_BATCH; i++) {
+      benchmarkCase.run();
+    }
+    calls += CALLS_PER_BATCH;
+    elapsed = performance.now() - start;
+  }
+
+  return { name: benchmarkCase.name, callsPerSecond: (calls * 1000) / elapsed };
+}
+
+export default function JsiBenchmarkScreen() {
+  const [results, setResults] = useState<BenchmarkResult[]>([]);
+  const [isRunning, setIsRunning] = useState(false);
+
+  const handleRun = () => {
+    setIsRunning(true);
+    // lets the button render its disabled state before the JS thread is blocked
+    setTimeout(() => {
+      setResults(createCases().map(measure));
+      setIsRunning(false);
+    }, 50);
+  };
+
+  return (
+    <ThemedView style={styles.container}>
+      <Button onPress={handleRun} title="Run benchmark" disabled={isRunning} />
+      <ScrollView style={styles.results}>
+        {results.map(({ name, callsPerSecond }) => (
+          <ThemedText key={name}>
+            {name}: {Math.round(callsPerSecond).toLocaleString()} calls/s
+          </ThemedText>
+        ))}
+      </ScrollView>
+    </ThemedView>
+  );
+}
+
+const styles = StyleSheet.create({
+  container: {
+    flex: 1,
+    padding: 20,
+  },
+  results: {
+    marginTop: 15,
+  },
+});
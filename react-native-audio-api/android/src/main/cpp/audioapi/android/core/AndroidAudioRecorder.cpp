@@ -15,7 +15,6 @@
 #include <audioapi/utils/AudioBus.h>
 #include <audioapi/utils/AudioFileProperties.h>
 #include <audioapi/utils/CircularAudioArray.h>
-#include <audioapi/utils/CircularOverflowableAudioArray.h>
 
 #include <memory>
 #include <string>
@@ -141,8 +140,7 @@ Result<std::string, std::string> AndroidAudioRecorder::start(const std::string &
   }
 
   if (isConnected()) {
-    deinterleavingBuffer_ = std::make_shared<AudioArray>(streamMaxBufferSizeInFrames_);
-    adapterNode_->init(streamMaxBufferSizeInFrames_, streamChannelCount_);
+    adapterNode_->init(streamMaxBufferSizeInFrames_, streamChannelCount_, streamSampleRate_);
   }
 
   auto result = mStream_->requestStart();
@@ -284,15 +282,25 @@ void AndroidAudioRecorder::resume() {
 /// @param bufferLength Desired buffer length in frames for the callback audio data.
 /// @param channelCount Number of channels for the callback audio data.
 /// @param callbackId Identifier for the JS callback to be invoked.
+/// @param reuseBuffers Whether the callback buffers are recycled instead of allocated.
+/// @param batchSize Number of buffers delivered in a single event when buffers are recycled.
 /// @returns Success status or Error status with message.
 Result<NoneType, std::string> AndroidAudioRecorder::setOnAudioReadyCallback(
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId) {
+    uint64_t callbackId,
+    bool reuseBuffers,
+    size_t batchSize) {
   std::scoped_lock callbackLock(callbackMutex_);
   dataCallback_ = std::make_shared<AndroidRecorderCallback>(
-      audioEventHandlerRegistry_, sampleRate, bufferLength, channelCount, callbackId);
+      audioEventHandlerRegistry_,
+      sampleRate,
+      bufferLength,
+      channelCount,
+      callbackId,
+      reuseBuffers,
+      batchSize);
 
   if (!isIdle()) {
     std::static_pointer_cast<AndroidRecorderCallback>(dataCallback_)
@@ -322,8 +330,7 @@ void AndroidAudioRecorder::connect(const std::shared_ptr<RecorderAdapterNode> &n
   adapterNode_ = node;
 
   if (!isIdle()) {
-    deinterleavingBuffer_ = std::make_shared<AudioArray>(streamMaxBufferSizeInFrames_);
-    adapterNode_->init(streamMaxBufferSizeInFrames_, streamChannelCount_);
+    adapterNode_->init(streamMaxBufferSizeInFrames_, streamChannelCount_, streamSampleRate_);
   }
 
   isConnected_.store(true, std::memory_order_release);
@@ -335,7 +342,6 @@ void AndroidAudioRecorder::connect(const std::shared_ptr<RecorderAdapterNode> &n
 void AndroidAudioRecorder::disconnect() {
   std::scoped_lock adapterLock(adapterNodeMutex_);
   isConnected_.store(false, std::memory_order_release);
-  deinterleavingBuffer_ = nullptr;
   adapterNode_ = nullptr;
 }
 
@@ -372,14 +378,7 @@ oboe::DataCallbackResult AndroidAudioRecorder::onAudioReady(
 
   if (isConnected()) {
     if (auto adapterLock = Locker::tryLock(adapterNodeMutex_)) {
-      for (int channel = 0; channel < streamChannelCount_; ++channel) {
-        for (int frame = 0; frame < numFrames; ++frame) {
-          deinterleavingBuffer_->getData()[frame] =
-              static_cast<float *>(audioData)[frame * streamChannelCount_ + channel];
-        }
-
-        adapterNode_->buff_[channel]->write(deinterleavingBuffer_->getData(), numFrames);
-      }
+      adapterNode_->writeInterleaved(static_cast<float *>(audioData), numFrames);
     }
   }
 
@@ -38,7 +38,13 @@ class AndroidAudioRecorder : public oboe::AudioStreamCallback, public AudioRecor
   bool isPaused() const override;
   bool isIdle() const override;
 
-  Result<NoneType, std::string> setOnAudioReadyCallback(float sampleRate, size_t bufferLength, int channelCount, uint64_t callbackId)
+  Result<NoneType, std::string> setOnAudioReadyCallback(
+      float sampleRate,
+      size_t bufferLength,
+      int channelCount,
+      uint64_t callbackId,
+      bool reuseBuffers,
+      size_t batchSize)
       override;
   void clearOnAudioReadyCallback() override;
 
@@ -52,7 +58,6 @@ class AndroidAudioRecorder : public oboe::AudioStreamCallback, public AudioRecor
   void onErrorAfterClose(oboe::AudioStream *oboeStream, oboe::Result error) override;
 
  private:
-  std::shared_ptr<AudioArray> deinterleavingBuffer_;
 
   float streamSampleRate_;
   int32_t streamChannelCount_;
@@ -5,7 +5,7 @@
 #include <audioapi/libs/miniaudio/miniaudio.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
-#include <audioapi/utils/CircularAudioArray.h>
+#include <audioapi/utils/SpscAudioRing.h>
 
 #include <algorithm>
 #include <memory>
@@ -15,24 +15,29 @@
 namespace audioapi {
 
 /// @brief Constructor
-/// Allocates circular buffer (as every property to do so is already known at this point).
 /// @param audioEventHandlerRegistry The audio event handler registry
 /// @param sampleRate The user desired sample rate
 /// @param bufferLength The user desired buffer length
 /// @param channelCount The user desired channel count
 /// @param callbackId The callback identifier
+/// @param reuseBuffers Whether buffers are recycled instead of allocated for every chunk
+/// @param batchSize The number of chunks delivered in a single event when buffers are reused
 AndroidRecorderCallback::AndroidRecorderCallback(
     const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry,
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId)
+    uint64_t callbackId,
+    bool reuseBuffers,
+    size_t batchSize)
     : AudioRecorderCallback(
           audioEventHandlerRegistry,
           sampleRate,
           bufferLength,
           channelCount,
-          callbackId) {}
+          callbackId,
+          reuseBuffers,
+          batchSize) {}
 
 AndroidRecorderCallback::~AndroidRecorderCallback() {
   if (converter_ != nullptr) {
@@ -45,10 +50,6 @@ AndroidRecorderCallback::~AndroidRecorderCallback() {
     processingBuffer_ = nullptr;
     processingBufferLength_ = 0;
   }
-
-  for (size_t i = 0; i < circularBus_.size(); ++i) {
-    circularBus_[i]->zero();
-  }
 }
 
 /// @brief Prepares the recorder callback by initializing the data converter and allocating necessary buffers.
@@ -95,7 +96,6 @@ Result<NoneType, std::string> AndroidRecorderCallback::prepare(
 
   processingBufferLength_ = std::max(processingBufferLength_, (ma_uint64)maxInputBufferLength_);
 
-  deinterleavingArray_ = std::make_shared<AudioArray>(processingBufferLength_);
   processingBuffer_ = ma_malloc(
       processingBufferLength_ * channelCount_ * ma_get_bytes_per_sample(ma_format_f32), NULL);
 
@@ -103,7 +103,7 @@ Result<NoneType, std::string> AndroidRecorderCallback::prepare(
 }
 
 void AndroidRecorderCallback::cleanup() {
-  if (circularBus_[0]->getNumberOfAvailableFrames() > 0) {
+  if (ring_->getAvailableFrames() > 0) {
     emitAudioData(true);
   }
 
@@ -117,14 +117,10 @@ void AndroidRecorderCallback::cleanup() {
     processingBuffer_ = nullptr;
     processingBufferLength_ = 0;
   }
-
-  for (size_t i = 0; i < circularBus_.size(); ++i) {
-    circularBus_[i]->zero();
-  }
 }
 
 /// @brief Receives audio data from the recorder, processes it (resampling and deinterleaving if necessary),
-/// and pushes it into the circular buffer.
+/// and pushes it into the ring buffer.
 /// @param data Pointer to the incoming audio data.
 /// @param numFrames Number of frames in the incoming audio data.
 void AndroidRecorderCallback::receiveAudioData(void *data, int numFrames) {
@@ -137,9 +133,9 @@ void AndroidRecorderCallback::receiveAudioData(void *data, int numFrames) {
 
   if (static_cast<float>(streamSampleRate_) == sampleRate_ &&
       streamChannelCount_ == channelCount_) {
-    deinterleaveAndPushAudioData(data, numFrames);
+    ring_->writeInterleaved(static_cast<float *>(data), numFrames);
 
-    if (circularBus_[0]->getNumberOfAvailableFrames() >= bufferLength_) {
+    if (ring_->getAvailableFrames() >= bufferLength_) {
       emitAudioData();
     }
     return;
@@ -151,28 +147,11 @@ void AndroidRecorderCallback::receiveAudioData(void *data, int numFrames) {
   ma_data_converter_process_pcm_frames(
       converter_.get(), data, &inputFrameCount, processingBuffer_, &outputFrameCount);
 
-  deinterleaveAndPushAudioData(processingBuffer_, static_cast<int>(outputFrameCount));
+  ring_->writeInterleaved(static_cast<float *>(processingBuffer_), outputFrameCount);
 
-  if (circularBus_[0]->getNumberOfAvailableFrames() >= bufferLength_) {
+  if (ring_->getAvailableFrames() >= bufferLength_) {
     emitAudioData();
   }
 }
 
-/// @brief Deinterleaves the audio data and pushes it into the circular buffer.
-/// @param data Pointer to the interleaved audio data.
-/// @param numFrames Number of frames in the audio data.
-void AndroidRecorderCallback::deinterleaveAndPushAudioData(void *data, int numFrames) {
-  auto *inputData = static_cast<float *>(data);
-
-  for (int channel = 0; channel < channelCount_; ++channel) {
-    float *channelData = deinterleavingArray_->getData();
-
-    for (int frame = 0; frame < numFrames; ++frame) {
-      channelData[frame] = inputData[frame * channelCount_ + channel];
-    }
-
-    circularBus_[channel]->push_back(channelData, numFrames);
-  }
-}
-
 } // namespace audioapi
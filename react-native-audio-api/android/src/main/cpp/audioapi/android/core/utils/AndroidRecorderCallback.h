@@ -11,7 +11,6 @@ namespace audioapi {
 
 class AudioBus;
 class AudioArray;
-class CircularAudioArray;
 class AudioEventHandlerRegistry;
 
 class AndroidRecorderCallback : public AudioRecorderCallback {
@@ -21,7 +20,9 @@ class AndroidRecorderCallback : public AudioRecorderCallback {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId);
+      uint64_t callbackId,
+      bool reuseBuffers,
+      size_t batchSize);
   ~AndroidRecorderCallback();
 
   Result<NoneType, std::string> prepare(float streamSampleRate, int streamChannelCount, size_t maxInputBufferLength);
@@ -37,10 +38,6 @@ class AndroidRecorderCallback : public AudioRecorderCallback {
   void *processingBuffer_{nullptr};
   ma_uint64 processingBufferLength_{0};
   std::unique_ptr<ma_data_converter> converter_{nullptr};
-
-  std::shared_ptr<AudioArray> deinterleavingArray_;
-
-  void deinterleaveAndPushAudioData(void *data, int numFrames);
 };
 
 } // namespace audioapi
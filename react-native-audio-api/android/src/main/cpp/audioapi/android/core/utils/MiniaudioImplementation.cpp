@@ -6,3 +6,4 @@
 #define MINIAUDIO_IMPLEMENTATION
 #define MA_DEBUG_OUTPUT
 #include <audioapi/libs/miniaudio/miniaudio.h>
+#include <audioapi/core/utils/Mp3SeekTable.h>
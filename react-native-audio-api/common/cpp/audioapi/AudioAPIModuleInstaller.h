@@ -37,7 +37,8 @@ class AudioAPIModuleInstaller {
     auto createOfflineAudioContext = getCreateOfflineAudioContextFunction(
         jsiRuntime, jsCallInvoker, audioEventHandlerRegistry, uiRuntime);
     auto createAudioDecoder = getCreateAudioDecoderFunction(jsiRuntime, jsCallInvoker);
-    auto createAudioStretcher = getCreateAudioStretcherFunction(jsiRuntime, jsCallInvoker);
+    auto createAudioStretcher =
+        getCreateAudioStretcherFunction(jsiRuntime, jsCallInvoker, audioEventHandlerRegistry);
 
     jsiRuntime->global().setProperty(*jsiRuntime, "createAudioContext", createAudioContext);
     jsiRuntime->global().setProperty(*jsiRuntime, "createAudioRecorder", createAudioRecorder);
@@ -169,18 +170,19 @@ class AudioAPIModuleInstaller {
 
   static jsi::Function getCreateAudioStretcherFunction(
       jsi::Runtime *jsiRuntime,
-      const std::shared_ptr<react::CallInvoker> &jsCallInvoker) {
+      const std::shared_ptr<react::CallInvoker> &jsCallInvoker,
+      const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry) {
     return jsi::Function::createFromHostFunction(
         *jsiRuntime,
         jsi::PropNameID::forAscii(*jsiRuntime, "createAudioStretcher"),
         0,
-        [jsCallInvoker](
+        [jsCallInvoker, audioEventHandlerRegistry](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *args,
             size_t count) -> jsi::Value {
-          auto audioStretcherHostObject =
-              std::make_shared<AudioStretcherHostObject>(&runtime, jsCallInvoker);
+          auto audioStretcherHostObject = std::make_shared<AudioStretcherHostObject>(
+              &runtime, jsCallInvoker, audioEventHandlerRegistry);
           return jsi::Object::createFromHostObject(runtime, audioStretcherHostObject);
         });
   }
@@ -23,7 +23,9 @@ AudioNodeHostObject::AudioNodeHostObject(const std::shared_ptr<AudioNode> &node)
 // "key function" for the audio classes - this allow for RTTI to work
 // properly across dynamic library boundaries (i.e. dynamic_cast that is used by
 // isHostObject method), android specific issue
-AudioNodeHostObject::~AudioNodeHostObject() = default;
+AudioNodeHostObject::~AudioNodeHostObject() {
+  node_->release();
+}
 
 JSI_PROPERTY_GETTER_IMPL(AudioNodeHostObject, numberOfInputs) {
   return {node_->getNumberOfInputs()};
@@ -49,7 +51,8 @@ JSI_HOST_FUNCTION_IMPL(AudioNodeHostObject, connect) {
   auto obj = args[0].getObject(runtime);
   if (obj.isHostObject<AudioNodeHostObject>(runtime)) {
     auto node = obj.getHostObject<AudioNodeHostObject>(runtime);
-    node_->connect(std::shared_ptr<AudioNodeHostObject>(node)->node_);
+    auto input = count > 2 ? static_cast<int>(args[2].getNumber()) : 0;
+    node_->connect(std::shared_ptr<AudioNodeHostObject>(node)->node_, input);
   }
   if (obj.isHostObject<AudioParamHostObject>(runtime)) {
     auto param = obj.getHostObject<AudioParamHostObject>(runtime);
@@ -66,7 +69,12 @@ JSI_HOST_FUNCTION_IMPL(AudioNodeHostObject, disconnect) {
   auto obj = args[0].getObject(runtime);
   if (obj.isHostObject<AudioNodeHostObject>(runtime)) {
     auto node = obj.getHostObject<AudioNodeHostObject>(runtime);
-    node_->disconnect(std::shared_ptr<AudioNodeHostObject>(node)->node_);
+    auto destination = std::shared_ptr<AudioNodeHostObject>(node)->node_;
+    if (count > 2 && args[2].isNumber()) {
+      node_->disconnect(destination, static_cast<int>(args[2].getNumber()));
+    } else {
+      node_->disconnect(destination);
+    }
   }
 
   if (obj.isHostObject<AudioParamHostObject>(runtime)) {
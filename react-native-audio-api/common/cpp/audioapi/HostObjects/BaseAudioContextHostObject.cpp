@@ -9,20 +9,31 @@
 #include <audioapi/HostObjects/effects/DelayNodeHostObject.h>
 #include <audioapi/HostObjects/effects/GainNodeHostObject.h>
 #include <audioapi/HostObjects/effects/IIRFilterNodeHostObject.h>
+#include <audioapi/HostObjects/effects/MixerNodeHostObject.h>
 #include <audioapi/HostObjects/effects/PeriodicWaveHostObject.h>
 #include <audioapi/HostObjects/effects/StereoPannerNodeHostObject.h>
 #include <audioapi/HostObjects/effects/WaveShaperNodeHostObject.h>
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/HostObjects/sources/AudioBufferQueueSourceNodeHostObject.h>
 #include <audioapi/HostObjects/sources/AudioBufferSourceNodeHostObject.h>
+#include <audioapi/HostObjects/sources/AudioFileSourceNodeHostObject.h>
 #include <audioapi/HostObjects/sources/ConstantSourceNodeHostObject.h>
 #include <audioapi/HostObjects/sources/OscillatorNodeHostObject.h>
 #include <audioapi/HostObjects/sources/RecorderAdapterNodeHostObject.h>
+#include <audioapi/HostObjects/sources/SamplerNodeHostObject.h>
 #include <audioapi/HostObjects/sources/StreamerNodeHostObject.h>
 #include <audioapi/HostObjects/sources/WorkletSourceNodeHostObject.h>
 #include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/sources/AudioBufferBaseSourceNode.h>
+#include <audioapi/core/sources/AudioFileSourceNode.h>
+#include <audioapi/core/sources/SamplerNode.h>
+#include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/core/utils/MappedPcmStorage.h>
+#include <audioapi/core/utils/MiniaudioStreamReader.h>
 
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace audioapi {
@@ -47,8 +58,11 @@ BaseAudioContextHostObject::BaseAudioContextHostObject(
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createRecorderAdapter),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createOscillator),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createStreamer),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createFileSource),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createConstantSource),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createSampler),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createGain),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createMixer),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createDelay),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createStereoPanner),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createBiquadFilter),
@@ -56,10 +70,14 @@ BaseAudioContextHostObject::BaseAudioContextHostObject(
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createBufferSource),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createBufferQueueSource),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createBuffer),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createMappedBuffer),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createPeriodicWave),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createConvolver),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createAnalyser),
-      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createWaveShaper));
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createWaveShaper),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, beginTransaction),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, commitTransaction),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, prewarmNodes));
 }
 
 // Explicitly define destructors here, as they to exist in order to act as a
@@ -182,18 +200,57 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createStreamer) {
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 }
 
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createFileSource) {
+  auto path = args[0].getString(runtime).utf8(runtime);
+  auto readAhead = args[1].getNumber();
+
+  auto reader = MiniaudioStreamReader::open(path, context_->getSampleRate());
+  if (reader == nullptr) {
+    return jsi::Value::undefined();
+  }
+
+  auto channelCount = static_cast<size_t>(reader->getNumberOfChannels());
+  auto fileSource = context_->createFileSource(std::move(reader), readAhead);
+  auto fileSourceHostObject = std::make_shared<AudioFileSourceNodeHostObject>(fileSource);
+  auto object = jsi::Object::createFromHostObject(runtime, fileSourceHostObject);
+
+  // decoded chunks of the read-ahead window
+  auto readAheadFrames = static_cast<size_t>(readAhead * context_->getSampleRate());
+  object.setExternalMemoryPressure(
+      runtime,
+      (readAheadFrames + AUDIO_FILE_SOURCE_NODE_CHUNK_SIZE) * channelCount * sizeof(float));
+  return object;
+}
+
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createConstantSource) {
   auto constantSource = context_->createConstantSource();
   auto constantSourceHostObject = std::make_shared<ConstantSourceNodeHostObject>(constantSource);
   return jsi::Object::createFromHostObject(runtime, constantSourceHostObject);
 }
 
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createSampler) {
+  auto maxPolyphony = static_cast<size_t>(args[0].getNumber());
+  auto voiceStealing =
+      SamplerNode::voiceStealingFromString(args[1].getString(runtime).utf8(runtime));
+  auto sampler = context_->createSampler(maxPolyphony, voiceStealing);
+  auto samplerHostObject = std::make_shared<SamplerNodeHostObject>(sampler);
+  return jsi::Object::createFromHostObject(runtime, samplerHostObject);
+}
+
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createGain) {
   auto gain = context_->createGain();
   auto gainHostObject = std::make_shared<GainNodeHostObject>(gain);
   return jsi::Object::createFromHostObject(runtime, gainHostObject);
 }
 
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createMixer) {
+  auto numberOfInputs = static_cast<int>(args[0].getNumber());
+  auto numberOfOutputChannels = static_cast<int>(args[1].getNumber());
+  auto mixer = context_->createMixer(numberOfInputs, numberOfOutputChannels);
+  auto mixerHostObject = std::make_shared<MixerNodeHostObject>(mixer);
+  return jsi::Object::createFromHostObject(runtime, mixerHostObject);
+}
+
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createDelay) {
   auto maxDelayTime = static_cast<float>(args[0].getNumber());
   auto delayNode = context_->createDelay(maxDelayTime);
@@ -243,14 +300,18 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createIIRFilter) {
 
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createBufferSource) {
   auto pitchCorrection = args[0].asBool();
-  auto bufferSource = context_->createBufferSource(pitchCorrection);
+  auto pitchCorrectionQuality = AudioBufferBaseSourceNode::pitchCorrectionQualityFromString(
+      args[1].asString(runtime).utf8(runtime));
+  auto bufferSource = context_->createBufferSource(pitchCorrection, pitchCorrectionQuality);
   auto bufferSourceHostObject = std::make_shared<AudioBufferSourceNodeHostObject>(bufferSource);
   return jsi::Object::createFromHostObject(runtime, bufferSourceHostObject);
 }
 
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createBufferQueueSource) {
   auto pitchCorrection = args[0].asBool();
-  auto bufferSource = context_->createBufferQueueSource(pitchCorrection);
+  auto pitchCorrectionQuality = AudioBufferBaseSourceNode::pitchCorrectionQualityFromString(
+      args[1].asString(runtime).utf8(runtime));
+  auto bufferSource = context_->createBufferQueueSource(pitchCorrection, pitchCorrectionQuality);
   auto bufferStreamSourceHostObject =
       std::make_shared<AudioBufferQueueSourceNodeHostObject>(bufferSource);
   return jsi::Object::createFromHostObject(runtime, bufferStreamSourceHostObject);
@@ -269,6 +330,37 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createBuffer) {
   return jsiObject;
 }
 
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createMappedBuffer) {
+  auto path = args[0].getString(runtime).utf8(runtime);
+  std::shared_ptr<MappedPcmStorage> storage;
+
+  if (args[1].isString()) {
+    auto sampleFormat = args[1].getString(runtime).utf8(runtime);
+    auto numberOfChannels = static_cast<int>(args[2].getNumber());
+    auto format = PcmSampleFormat::FLOAT32;
+
+    if (sampleFormat == "int16") {
+      format = PcmSampleFormat::INT16;
+    } else if (sampleFormat == "int24") {
+      format = PcmSampleFormat::INT24;
+    }
+
+    storage =
+        MappedPcmStorage::openRaw(path, format, numberOfChannels, context_->getSampleRate());
+  } else {
+    storage = MappedPcmStorage::openWav(path);
+  }
+
+  // samples are played as they are stored, without resampling
+  if (storage == nullptr || storage->getSampleRate() != context_->getSampleRate()) {
+    return jsi::Value::undefined();
+  }
+
+  auto buffer = std::make_shared<AudioBuffer>(storage);
+  auto bufferHostObject = std::make_shared<AudioBufferHostObject>(buffer);
+  return jsi::Object::createFromHostObject(runtime, bufferHostObject);
+}
+
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createPeriodicWave) {
   auto arrayBufferReal =
       args[0].getObject(runtime).getPropertyAsObject(runtime, "buffer").getArrayBuffer(runtime);
@@ -322,4 +414,27 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createWaveShaper) {
   auto waveShaperHostObject = std::make_shared<WaveShaperNodeHostObject>(waveShaper);
   return jsi::Object::createFromHostObject(runtime, waveShaperHostObject);
 }
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, beginTransaction) {
+  context_->getNodeManager()->beginTransaction();
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, commitTransaction) {
+  context_->getNodeManager()->commitTransaction();
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, prewarmNodes) {
+  auto type = args[0].getString(runtime).utf8(runtime);
+  auto nodeCount = static_cast<size_t>(args[1].getNumber());
+
+  if (type == "bufferSource") {
+    context_->prewarmBufferSources(nodeCount);
+  } else if (type == "oscillator") {
+    context_->prewarmOscillators(nodeCount);
+  }
+
+  return jsi::Value::undefined();
+}
 } // namespace audioapi
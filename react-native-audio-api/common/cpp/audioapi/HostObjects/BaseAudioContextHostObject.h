@@ -34,19 +34,26 @@ class BaseAudioContextHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(createRecorderAdapter);
   JSI_HOST_FUNCTION_DECL(createOscillator);
   JSI_HOST_FUNCTION_DECL(createStreamer);
+  JSI_HOST_FUNCTION_DECL(createFileSource);
   JSI_HOST_FUNCTION_DECL(createConstantSource);
+  JSI_HOST_FUNCTION_DECL(createSampler);
   JSI_HOST_FUNCTION_DECL(createGain);
+  JSI_HOST_FUNCTION_DECL(createMixer);
   JSI_HOST_FUNCTION_DECL(createStereoPanner);
   JSI_HOST_FUNCTION_DECL(createBiquadFilter);
   JSI_HOST_FUNCTION_DECL(createIIRFilter);
   JSI_HOST_FUNCTION_DECL(createBufferSource);
   JSI_HOST_FUNCTION_DECL(createBufferQueueSource);
   JSI_HOST_FUNCTION_DECL(createBuffer);
+  JSI_HOST_FUNCTION_DECL(createMappedBuffer);
   JSI_HOST_FUNCTION_DECL(createPeriodicWave);
   JSI_HOST_FUNCTION_DECL(createAnalyser);
   JSI_HOST_FUNCTION_DECL(createConvolver);
   JSI_HOST_FUNCTION_DECL(createWaveShaper);
   JSI_HOST_FUNCTION_DECL(createDelay);
+  JSI_HOST_FUNCTION_DECL(beginTransaction);
+  JSI_HOST_FUNCTION_DECL(commitTransaction);
+  JSI_HOST_FUNCTION_DECL(prewarmNodes);
 
   std::shared_ptr<BaseAudioContext> context_;
 
@@ -0,0 +1,43 @@
+#include <audioapi/HostObjects/effects/MixerNodeHostObject.h>
+
+#include <audioapi/HostObjects/AudioParamHostObject.h>
+#include <audioapi/core/effects/MixerNode.h>
+#include <memory>
+
+namespace audioapi {
+
+MixerNodeHostObject::MixerNodeHostObject(const std::shared_ptr<MixerNode> &node)
+    : AudioNodeHostObject(node) {
+  addFunctions(
+      JSI_EXPORT_FUNCTION(MixerNodeHostObject, getGain),
+      JSI_EXPORT_FUNCTION(MixerNodeHostObject, getPan),
+      JSI_EXPORT_FUNCTION(MixerNodeHostObject, getMuted),
+      JSI_EXPORT_FUNCTION(MixerNodeHostObject, setMuted));
+}
+
+JSI_HOST_FUNCTION_IMPL(MixerNodeHostObject, getGain) {
+  auto mixerNode = std::static_pointer_cast<MixerNode>(node_);
+  auto input = static_cast<int>(args[0].getNumber());
+  auto gainParam = std::make_shared<AudioParamHostObject>(mixerNode->getGainParam(input));
+  return jsi::Object::createFromHostObject(runtime, gainParam);
+}
+
+JSI_HOST_FUNCTION_IMPL(MixerNodeHostObject, getPan) {
+  auto mixerNode = std::static_pointer_cast<MixerNode>(node_);
+  auto input = static_cast<int>(args[0].getNumber());
+  auto panParam = std::make_shared<AudioParamHostObject>(mixerNode->getPanParam(input));
+  return jsi::Object::createFromHostObject(runtime, panParam);
+}
+
+JSI_HOST_FUNCTION_IMPL(MixerNodeHostObject, getMuted) {
+  auto mixerNode = std::static_pointer_cast<MixerNode>(node_);
+  return {mixerNode->isMuted(static_cast<int>(args[0].getNumber()))};
+}
+
+JSI_HOST_FUNCTION_IMPL(MixerNodeHostObject, setMuted) {
+  auto mixerNode = std::static_pointer_cast<MixerNode>(node_);
+  mixerNode->setMuted(static_cast<int>(args[0].getNumber()), args[1].getBool());
+  return jsi::Value::undefined();
+}
+
+} // namespace audioapi
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <audioapi/HostObjects/AudioNodeHostObject.h>
+
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+using namespace facebook;
+
+class MixerNode;
+
+class MixerNodeHostObject : public AudioNodeHostObject {
+ public:
+  explicit MixerNodeHostObject(const std::shared_ptr<MixerNode> &node);
+
+  JSI_HOST_FUNCTION_DECL(getGain);
+  JSI_HOST_FUNCTION_DECL(getPan);
+  JSI_HOST_FUNCTION_DECL(getMuted);
+  JSI_HOST_FUNCTION_DECL(setMuted);
+};
+} // namespace audioapi
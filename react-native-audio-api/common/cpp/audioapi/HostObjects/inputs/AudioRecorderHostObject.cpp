@@ -36,6 +36,8 @@ AudioRecorderHostObject::AudioRecorderHostObject(
       JSI_EXPORT_FUNCTION(AudioRecorderHostObject, disconnect),
       JSI_EXPORT_FUNCTION(AudioRecorderHostObject, setOnAudioReady),
       JSI_EXPORT_FUNCTION(AudioRecorderHostObject, clearOnAudioReady),
+      JSI_EXPORT_FUNCTION(AudioRecorderHostObject, getAudioReadyBuffers),
+      JSI_EXPORT_FUNCTION(AudioRecorderHostObject, releaseAudioReadyBatch),
       JSI_EXPORT_FUNCTION(AudioRecorderHostObject, setOnError),
       JSI_EXPORT_FUNCTION(AudioRecorderHostObject, clearOnError),
       JSI_EXPORT_FUNCTION(AudioRecorderHostObject, getCurrentDuration));
@@ -152,9 +154,11 @@ JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, setOnAudioReady) {
   auto channelCount = static_cast<int>(options.getProperty(runtime, "channelCount").getNumber());
   uint64_t callbackId =
       std::stoull(options.getProperty(runtime, "callbackId").getString(runtime).utf8(runtime));
+  auto reuseBuffers = options.getProperty(runtime, "reuseBuffers").getBool();
+  auto batchSize = static_cast<size_t>(options.getProperty(runtime, "batchSize").getNumber());
 
-  auto result =
-      audioRecorder_->setOnAudioReadyCallback(sampleRate, bufferLength, channelCount, callbackId);
+  auto result = audioRecorder_->setOnAudioReadyCallback(
+      sampleRate, bufferLength, channelCount, callbackId, reuseBuffers, batchSize);
   auto jsResult = jsi::Object(runtime);
 
   jsResult.setProperty(
@@ -175,6 +179,28 @@ JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, clearOnAudioReady) {
   return jsi::Value::undefined();
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, getAudioReadyBuffers) {
+  auto buffers = audioRecorder_->getAudioReadyBuffers();
+  auto jsArray = jsi::Array(runtime, buffers.size());
+
+  for (size_t i = 0; i < buffers.size(); i++) {
+    auto bufferHostObject = std::make_shared<AudioBufferHostObject>(buffers[i]);
+    auto jsBuffer = jsi::Object::createFromHostObject(runtime, bufferHostObject);
+    jsBuffer.setExternalMemoryPressure(runtime, bufferHostObject->getSizeInBytes());
+    jsArray.setValueAtIndex(runtime, i, jsBuffer);
+  }
+
+  return jsArray;
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, releaseAudioReadyBatch) {
+  uint64_t callbackId = std::stoull(args[0].getString(runtime).utf8(runtime));
+  auto batchIndex = static_cast<size_t>(args[1].getNumber());
+
+  audioRecorder_->releaseAudioReadyBatch(callbackId, batchIndex);
+  return jsi::Value::undefined();
+}
+
 JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, setOnError) {
   auto options = args[0].getObject(runtime);
 
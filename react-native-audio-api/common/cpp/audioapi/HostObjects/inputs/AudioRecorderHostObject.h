@@ -35,6 +35,8 @@ class AudioRecorderHostObject : public JsiHostObject {
 
   JSI_HOST_FUNCTION_DECL(setOnAudioReady);
   JSI_HOST_FUNCTION_DECL(clearOnAudioReady);
+  JSI_HOST_FUNCTION_DECL(getAudioReadyBuffers);
+  JSI_HOST_FUNCTION_DECL(releaseAudioReadyBatch);
 
   JSI_HOST_FUNCTION_DECL(setOnError);
   JSI_HOST_FUNCTION_DECL(clearOnError);
@@ -1,9 +1,10 @@
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 
 #include <audioapi/jsi/AudioArrayBuffer.h>
-#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/AudioArray.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 
 namespace audioapi {
@@ -19,7 +20,8 @@ AudioBufferHostObject::AudioBufferHostObject(const std::shared_ptr<AudioBuffer>
   addFunctions(
       JSI_EXPORT_FUNCTION(AudioBufferHostObject, getChannelData),
       JSI_EXPORT_FUNCTION(AudioBufferHostObject, copyFromChannel),
-      JSI_EXPORT_FUNCTION(AudioBufferHostObject, copyToChannel));
+      JSI_EXPORT_FUNCTION(AudioBufferHostObject, copyToChannel),
+      JSI_EXPORT_FUNCTION(AudioBufferHostObject, compact));
 }
 
 AudioBufferHostObject::AudioBufferHostObject(AudioBufferHostObject &&other) noexcept
@@ -44,7 +46,7 @@ JSI_PROPERTY_GETTER_IMPL(AudioBufferHostObject, numberOfChannels) {
 JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, getChannelData) {
   auto channel = static_cast<int>(args[0].getNumber());
   auto audioArrayBuffer =
-      std::make_shared<AudioArrayBuffer>(audioBuffer_->bus_->getSharedChannel(channel));
+      std::make_shared<AudioArrayBuffer>(audioBuffer_->getSharedChannel(channel));
   auto arrayBuffer = jsi::ArrayBuffer(runtime, audioArrayBuffer);
 
   auto float32ArrayCtor = runtime.global().getPropertyAsFunction(runtime, "Float32Array");
@@ -81,4 +83,14 @@ JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, copyToChannel) {
   return jsi::Value::undefined();
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, compact) {
+  auto sampleFormat = args[0].getString(runtime).utf8(runtime);
+  audioBuffer_->compact(
+      sampleFormat == "float16" ? PcmSampleFormat::FLOAT16 : PcmSampleFormat::INT16);
+
+  thisValue.asObject(runtime).setExternalMemoryPressure(runtime, getSizeInBytes());
+
+  return jsi::Value::undefined();
+}
+
 } // namespace audioapi
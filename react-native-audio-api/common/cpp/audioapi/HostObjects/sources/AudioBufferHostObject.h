@@ -1,6 +1,7 @@
 #pragma once
 
 #include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/PcmStorage.h>
 #include <audioapi/jsi/JsiHostObject.h>
 
 #include <jsi/jsi.h>
@@ -29,6 +30,10 @@ class AudioBufferHostObject : public JsiHostObject {
   }
 
   [[nodiscard]] inline size_t getSizeInBytes() const {
+    if (auto storage = audioBuffer_->getPcmStorage()) {
+      return storage->getAllocatedSizeInBytes();
+    }
+
     return audioBuffer_->getLength() * audioBuffer_->getNumberOfChannels() * sizeof(float);
   }
 
@@ -40,5 +45,6 @@ class AudioBufferHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(getChannelData);
   JSI_HOST_FUNCTION_DECL(copyFromChannel);
   JSI_HOST_FUNCTION_DECL(copyToChannel);
+  JSI_HOST_FUNCTION_DECL(compact);
 };
 } // namespace audioapi
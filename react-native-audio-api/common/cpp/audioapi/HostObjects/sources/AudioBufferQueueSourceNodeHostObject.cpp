@@ -11,6 +11,12 @@ AudioBufferQueueSourceNodeHostObject::AudioBufferQueueSourceNodeHostObject(
     : AudioBufferBaseSourceNodeHostObject(node) {
   functions_->erase("start");
 
+  addGetters(JSI_EXPORT_PROPERTY_GETTER(AudioBufferQueueSourceNodeHostObject, lowWaterMark));
+
+  addSetters(
+      JSI_EXPORT_PROPERTY_SETTER(AudioBufferQueueSourceNodeHostObject, lowWaterMark),
+      JSI_EXPORT_PROPERTY_SETTER(AudioBufferQueueSourceNodeHostObject, onBufferQueueLow));
+
   addFunctions(
       JSI_EXPORT_FUNCTION(AudioBufferQueueSourceNodeHostObject, start),
       JSI_EXPORT_FUNCTION(AudioBufferQueueSourceNodeHostObject, enqueueBuffer),
@@ -19,6 +25,33 @@ AudioBufferQueueSourceNodeHostObject::AudioBufferQueueSourceNodeHostObject(
       JSI_EXPORT_FUNCTION(AudioBufferQueueSourceNodeHostObject, pause));
 }
 
+AudioBufferQueueSourceNodeHostObject::~AudioBufferQueueSourceNodeHostObject() {
+  auto audioBufferQueueSourceNode = std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
+
+  // When JSI object is garbage collected (together with the eventual callback),
+  // underlying source node might still be active and try to call the
+  // non-existing callback.
+  audioBufferQueueSourceNode->setOnBufferQueueLowCallbackId(0);
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioBufferQueueSourceNodeHostObject, lowWaterMark) {
+  auto audioBufferQueueSourceNode = std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
+  return {audioBufferQueueSourceNode->getLowWaterMark()};
+}
+
+JSI_PROPERTY_SETTER_IMPL(AudioBufferQueueSourceNodeHostObject, lowWaterMark) {
+  auto audioBufferQueueSourceNode = std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
+
+  audioBufferQueueSourceNode->setLowWaterMark(value.getNumber());
+}
+
+JSI_PROPERTY_SETTER_IMPL(AudioBufferQueueSourceNodeHostObject, onBufferQueueLow) {
+  auto audioBufferQueueSourceNode = std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
+
+  audioBufferQueueSourceNode->setOnBufferQueueLowCallbackId(
+      std::stoull(value.getString(runtime).utf8(runtime)));
+}
+
 JSI_HOST_FUNCTION_IMPL(AudioBufferQueueSourceNodeHostObject, start) {
   auto when = args[0].getNumber();
 
@@ -15,6 +15,13 @@ class AudioBufferQueueSourceNodeHostObject : public AudioBufferBaseSourceNodeHos
   explicit AudioBufferQueueSourceNodeHostObject(
       const std::shared_ptr<AudioBufferQueueSourceNode> &node);
 
+  ~AudioBufferQueueSourceNodeHostObject() override;
+
+  JSI_PROPERTY_GETTER_DECL(lowWaterMark);
+
+  JSI_PROPERTY_SETTER_DECL(lowWaterMark);
+  JSI_PROPERTY_SETTER_DECL(onBufferQueueLow);
+
   JSI_HOST_FUNCTION_DECL(start);
   JSI_HOST_FUNCTION_DECL(pause);
   JSI_HOST_FUNCTION_DECL(enqueueBuffer);
@@ -14,13 +14,15 @@ AudioBufferSourceNodeHostObject::AudioBufferSourceNodeHostObject(
       JSI_EXPORT_PROPERTY_GETTER(AudioBufferSourceNodeHostObject, loopSkip),
       JSI_EXPORT_PROPERTY_GETTER(AudioBufferSourceNodeHostObject, buffer),
       JSI_EXPORT_PROPERTY_GETTER(AudioBufferSourceNodeHostObject, loopStart),
-      JSI_EXPORT_PROPERTY_GETTER(AudioBufferSourceNodeHostObject, loopEnd));
+      JSI_EXPORT_PROPERTY_GETTER(AudioBufferSourceNodeHostObject, loopEnd),
+      JSI_EXPORT_PROPERTY_GETTER(AudioBufferSourceNodeHostObject, interpolation));
 
   addSetters(
       JSI_EXPORT_PROPERTY_SETTER(AudioBufferSourceNodeHostObject, loop),
       JSI_EXPORT_PROPERTY_SETTER(AudioBufferSourceNodeHostObject, loopSkip),
       JSI_EXPORT_PROPERTY_SETTER(AudioBufferSourceNodeHostObject, loopStart),
       JSI_EXPORT_PROPERTY_SETTER(AudioBufferSourceNodeHostObject, loopEnd),
+      JSI_EXPORT_PROPERTY_SETTER(AudioBufferSourceNodeHostObject, interpolation),
       JSI_EXPORT_PROPERTY_SETTER(AudioBufferSourceNodeHostObject, onLoopEnded));
 
   // start method is overridden in this class
@@ -78,6 +80,12 @@ JSI_PROPERTY_GETTER_IMPL(AudioBufferSourceNodeHostObject, loopEnd) {
   return {loopEnd};
 }
 
+JSI_PROPERTY_GETTER_IMPL(AudioBufferSourceNodeHostObject, interpolation) {
+  auto audioBufferSourceNode = std::static_pointer_cast<AudioBufferSourceNode>(node_);
+  auto interpolation = audioBufferSourceNode->getInterpolation();
+  return jsi::String::createFromUtf8(runtime, interpolation);
+}
+
 JSI_PROPERTY_SETTER_IMPL(AudioBufferSourceNodeHostObject, loop) {
   auto audioBufferSourceNode = std::static_pointer_cast<AudioBufferSourceNode>(node_);
   audioBufferSourceNode->setLoop(value.getBool());
@@ -98,6 +106,11 @@ JSI_PROPERTY_SETTER_IMPL(AudioBufferSourceNodeHostObject, loopEnd) {
   audioBufferSourceNode->setLoopEnd(value.getNumber());
 }
 
+JSI_PROPERTY_SETTER_IMPL(AudioBufferSourceNodeHostObject, interpolation) {
+  auto audioBufferSourceNode = std::static_pointer_cast<AudioBufferSourceNode>(node_);
+  audioBufferSourceNode->setInterpolation(value.getString(runtime).utf8(runtime));
+}
+
 JSI_PROPERTY_SETTER_IMPL(AudioBufferSourceNodeHostObject, onLoopEnded) {
   auto audioBufferSourceNode = std::static_pointer_cast<AudioBufferSourceNode>(node_);
 
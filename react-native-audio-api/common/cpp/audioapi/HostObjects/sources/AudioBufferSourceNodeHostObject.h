@@ -21,11 +21,13 @@ class AudioBufferSourceNodeHostObject : public AudioBufferBaseSourceNodeHostObje
   JSI_PROPERTY_GETTER_DECL(buffer);
   JSI_PROPERTY_GETTER_DECL(loopStart);
   JSI_PROPERTY_GETTER_DECL(loopEnd);
+  JSI_PROPERTY_GETTER_DECL(interpolation);
 
   JSI_PROPERTY_SETTER_DECL(loop);
   JSI_PROPERTY_SETTER_DECL(loopSkip);
   JSI_PROPERTY_SETTER_DECL(loopStart);
   JSI_PROPERTY_SETTER_DECL(loopEnd);
+  JSI_PROPERTY_SETTER_DECL(interpolation);
   JSI_PROPERTY_SETTER_DECL(onLoopEnded);
 
   JSI_HOST_FUNCTION_DECL(start);
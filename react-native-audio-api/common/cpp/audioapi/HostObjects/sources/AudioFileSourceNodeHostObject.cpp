@@ -0,0 +1,90 @@
+#include <audioapi/HostObjects/sources/AudioFileSourceNodeHostObject.h>
+
+#include <audioapi/core/sources/AudioFileSourceNode.h>
+#include <memory>
+
+namespace audioapi {
+
+AudioFileSourceNodeHostObject::AudioFileSourceNodeHostObject(
+    const std::shared_ptr<AudioFileSourceNode> &node)
+    : AudioScheduledSourceNodeHostObject(node) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(AudioFileSourceNodeHostObject, loop),
+      JSI_EXPORT_PROPERTY_GETTER(AudioFileSourceNodeHostObject, loopStart),
+      JSI_EXPORT_PROPERTY_GETTER(AudioFileSourceNodeHostObject, loopEnd),
+      JSI_EXPORT_PROPERTY_GETTER(AudioFileSourceNodeHostObject, duration),
+      JSI_EXPORT_PROPERTY_GETTER(AudioFileSourceNodeHostObject, position),
+      JSI_EXPORT_PROPERTY_GETTER(AudioFileSourceNodeHostObject, readAhead),
+      JSI_EXPORT_PROPERTY_GETTER(AudioFileSourceNodeHostObject, bufferedDuration),
+      JSI_EXPORT_PROPERTY_GETTER(AudioFileSourceNodeHostObject, underrunCount));
+
+  addSetters(
+      JSI_EXPORT_PROPERTY_SETTER(AudioFileSourceNodeHostObject, loop),
+      JSI_EXPORT_PROPERTY_SETTER(AudioFileSourceNodeHostObject, loopStart),
+      JSI_EXPORT_PROPERTY_SETTER(AudioFileSourceNodeHostObject, loopEnd));
+
+  addFunctions(JSI_EXPORT_FUNCTION(AudioFileSourceNodeHostObject, seek));
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioFileSourceNodeHostObject, loop) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  return {fileSourceNode->getLoop()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioFileSourceNodeHostObject, loopStart) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  return {fileSourceNode->getLoopStart()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioFileSourceNodeHostObject, loopEnd) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  return {fileSourceNode->getLoopEnd()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioFileSourceNodeHostObject, duration) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  return {fileSourceNode->getDuration()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioFileSourceNodeHostObject, position) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  return {fileSourceNode->getPosition()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioFileSourceNodeHostObject, readAhead) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  return {fileSourceNode->getReadAhead()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioFileSourceNodeHostObject, bufferedDuration) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  return {fileSourceNode->getBufferedDuration()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioFileSourceNodeHostObject, underrunCount) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  return {static_cast<double>(fileSourceNode->getUnderrunCount())};
+}
+
+JSI_PROPERTY_SETTER_IMPL(AudioFileSourceNodeHostObject, loop) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  fileSourceNode->setLoop(value.getBool());
+}
+
+JSI_PROPERTY_SETTER_IMPL(AudioFileSourceNodeHostObject, loopStart) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  fileSourceNode->setLoopStart(value.getNumber());
+}
+
+JSI_PROPERTY_SETTER_IMPL(AudioFileSourceNodeHostObject, loopEnd) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  fileSourceNode->setLoopEnd(value.getNumber());
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioFileSourceNodeHostObject, seek) {
+  auto fileSourceNode = std::static_pointer_cast<AudioFileSourceNode>(node_);
+  fileSourceNode->seek(args[0].getNumber());
+  return jsi::Value::undefined();
+}
+
+} // namespace audioapi
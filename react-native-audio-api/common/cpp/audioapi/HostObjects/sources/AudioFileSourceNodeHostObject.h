@@ -0,0 +1,31 @@
+#pragma once
+
+#include <audioapi/HostObjects/sources/AudioScheduledSourceNodeHostObject.h>
+
+#include <memory>
+
+namespace audioapi {
+using namespace facebook;
+
+class AudioFileSourceNode;
+
+class AudioFileSourceNodeHostObject : public AudioScheduledSourceNodeHostObject {
+ public:
+  explicit AudioFileSourceNodeHostObject(const std::shared_ptr<AudioFileSourceNode> &node);
+
+  JSI_PROPERTY_GETTER_DECL(loop);
+  JSI_PROPERTY_GETTER_DECL(loopStart);
+  JSI_PROPERTY_GETTER_DECL(loopEnd);
+  JSI_PROPERTY_GETTER_DECL(duration);
+  JSI_PROPERTY_GETTER_DECL(position);
+  JSI_PROPERTY_GETTER_DECL(readAhead);
+  JSI_PROPERTY_GETTER_DECL(bufferedDuration);
+  JSI_PROPERTY_GETTER_DECL(underrunCount);
+
+  JSI_PROPERTY_SETTER_DECL(loop);
+  JSI_PROPERTY_SETTER_DECL(loopStart);
+  JSI_PROPERTY_SETTER_DECL(loopEnd);
+
+  JSI_HOST_FUNCTION_DECL(seek);
+};
+} // namespace audioapi
@@ -2,12 +2,35 @@
 
 #include <audioapi/core/sources/AudioScheduledSourceNode.h>
 #include <memory>
+#include <string>
 
 namespace audioapi {
 
+namespace {
+
+std::string toString(AudioScheduledSourceNode::PlaybackState state) {
+  switch (state) {
+    case AudioScheduledSourceNode::PlaybackState::UNSCHEDULED:
+      return "unscheduled";
+    case AudioScheduledSourceNode::PlaybackState::SCHEDULED:
+      return "scheduled";
+    case AudioScheduledSourceNode::PlaybackState::PLAYING:
+      return "playing";
+    case AudioScheduledSourceNode::PlaybackState::STOP_SCHEDULED:
+      return "stopScheduled";
+    case AudioScheduledSourceNode::PlaybackState::FINISHED:
+      return "finished";
+  }
+
+  return "unscheduled";
+}
+
+} // namespace
+
 AudioScheduledSourceNodeHostObject::AudioScheduledSourceNodeHostObject(
     const std::shared_ptr<AudioScheduledSourceNode> &node)
     : AudioNodeHostObject(node) {
+  addGetters(JSI_EXPORT_PROPERTY_GETTER(AudioScheduledSourceNodeHostObject, playbackSnapshot));
   addSetters(JSI_EXPORT_PROPERTY_SETTER(AudioScheduledSourceNodeHostObject, onEnded));
 
   addFunctions(
@@ -24,6 +47,19 @@ AudioScheduledSourceNodeHostObject::~AudioScheduledSourceNodeHostObject() {
   audioScheduledSourceNode->setOnEndedCallbackId(0);
 }
 
+JSI_PROPERTY_GETTER_IMPL(AudioScheduledSourceNodeHostObject, playbackSnapshot) {
+  auto audioScheduledSourceNode = std::static_pointer_cast<AudioScheduledSourceNode>(node_);
+  auto snapshot = audioScheduledSourceNode->getPlaybackSnapshot();
+
+  auto jsSnapshot = jsi::Object(runtime);
+  jsSnapshot.setProperty(
+      runtime, "state", jsi::String::createFromUtf8(runtime, toString(snapshot.state)));
+  jsSnapshot.setProperty(runtime, "position", snapshot.position);
+  jsSnapshot.setProperty(runtime, "bufferedDuration", snapshot.bufferedDuration);
+  jsSnapshot.setProperty(runtime, "contextTime", snapshot.contextTime);
+  return jsSnapshot;
+}
+
 JSI_PROPERTY_SETTER_IMPL(AudioScheduledSourceNodeHostObject, onEnded) {
   auto audioScheduleSourceNode = std::static_pointer_cast<AudioScheduledSourceNode>(node_);
 
@@ -17,6 +17,8 @@ class AudioScheduledSourceNodeHostObject : public AudioNodeHostObject {
 
   ~AudioScheduledSourceNodeHostObject() override;
 
+  JSI_PROPERTY_GETTER_DECL(playbackSnapshot);
+
   JSI_PROPERTY_SETTER_DECL(onEnded);
 
   JSI_HOST_FUNCTION_DECL(start);
@@ -12,11 +12,14 @@ OscillatorNodeHostObject::OscillatorNodeHostObject(const std::shared_ptr<Oscilla
   addGetters(
       JSI_EXPORT_PROPERTY_GETTER(OscillatorNodeHostObject, frequency),
       JSI_EXPORT_PROPERTY_GETTER(OscillatorNodeHostObject, detune),
-      JSI_EXPORT_PROPERTY_GETTER(OscillatorNodeHostObject, type));
+      JSI_EXPORT_PROPERTY_GETTER(OscillatorNodeHostObject, type),
+      JSI_EXPORT_PROPERTY_GETTER(OscillatorNodeHostObject, mode));
 
   addFunctions(JSI_EXPORT_FUNCTION(OscillatorNodeHostObject, setPeriodicWave));
 
-  addSetters(JSI_EXPORT_PROPERTY_SETTER(OscillatorNodeHostObject, type));
+  addSetters(
+      JSI_EXPORT_PROPERTY_SETTER(OscillatorNodeHostObject, type),
+      JSI_EXPORT_PROPERTY_SETTER(OscillatorNodeHostObject, mode));
 }
 
 JSI_PROPERTY_GETTER_IMPL(OscillatorNodeHostObject, frequency) {
@@ -38,6 +41,12 @@ JSI_PROPERTY_GETTER_IMPL(OscillatorNodeHostObject, type) {
   return jsi::String::createFromUtf8(runtime, waveType);
 }
 
+JSI_PROPERTY_GETTER_IMPL(OscillatorNodeHostObject, mode) {
+  auto oscillatorNode = std::static_pointer_cast<OscillatorNode>(node_);
+  auto mode = oscillatorNode->getMode();
+  return jsi::String::createFromUtf8(runtime, mode);
+}
+
 JSI_HOST_FUNCTION_IMPL(OscillatorNodeHostObject, setPeriodicWave) {
   auto oscillatorNode = std::static_pointer_cast<OscillatorNode>(node_);
   auto periodicWave = args[0].getObject(runtime).getHostObject<PeriodicWaveHostObject>(runtime);
@@ -50,4 +59,9 @@ JSI_PROPERTY_SETTER_IMPL(OscillatorNodeHostObject, type) {
   oscillatorNode->setType(value.getString(runtime).utf8(runtime));
 }
 
+JSI_PROPERTY_SETTER_IMPL(OscillatorNodeHostObject, mode) {
+  auto oscillatorNode = std::static_pointer_cast<OscillatorNode>(node_);
+  oscillatorNode->setMode(value.getString(runtime).utf8(runtime));
+}
+
 } // namespace audioapi
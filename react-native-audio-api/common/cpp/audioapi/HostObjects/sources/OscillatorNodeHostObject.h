@@ -18,9 +18,11 @@ class OscillatorNodeHostObject : public AudioScheduledSourceNodeHostObject {
   JSI_PROPERTY_GETTER_DECL(frequency);
   JSI_PROPERTY_GETTER_DECL(detune);
   JSI_PROPERTY_GETTER_DECL(type);
+  JSI_PROPERTY_GETTER_DECL(mode);
 
   JSI_HOST_FUNCTION_DECL(setPeriodicWave);
 
   JSI_PROPERTY_SETTER_DECL(type);
+  JSI_PROPERTY_SETTER_DECL(mode);
 };
 } // namespace audioapi
@@ -0,0 +1,150 @@
+#include <audioapi/HostObjects/sources/SamplerNodeHostObject.h>
+
+#include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
+#include <audioapi/core/sources/SamplerNode.h>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+SamplerNodeHostObject::SamplerNodeHostObject(const std::shared_ptr<SamplerNode> &node)
+    : AudioNodeHostObject(node) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(SamplerNodeHostObject, maxPolyphony),
+      JSI_EXPORT_PROPERTY_GETTER(SamplerNodeHostObject, voiceStealing),
+      JSI_EXPORT_PROPERTY_GETTER(SamplerNodeHostObject, activeVoiceCount),
+      JSI_EXPORT_PROPERTY_GETTER(SamplerNodeHostObject, attack),
+      JSI_EXPORT_PROPERTY_GETTER(SamplerNodeHostObject, decay),
+      JSI_EXPORT_PROPERTY_GETTER(SamplerNodeHostObject, sustain),
+      JSI_EXPORT_PROPERTY_GETTER(SamplerNodeHostObject, release));
+
+  addSetters(
+      JSI_EXPORT_PROPERTY_SETTER(SamplerNodeHostObject, attack),
+      JSI_EXPORT_PROPERTY_SETTER(SamplerNodeHostObject, decay),
+      JSI_EXPORT_PROPERTY_SETTER(SamplerNodeHostObject, sustain),
+      JSI_EXPORT_PROPERTY_SETTER(SamplerNodeHostObject, release));
+
+  addFunctions(
+      JSI_EXPORT_FUNCTION(SamplerNodeHostObject, setRegions),
+      JSI_EXPORT_FUNCTION(SamplerNodeHostObject, noteOn),
+      JSI_EXPORT_FUNCTION(SamplerNodeHostObject, noteOff),
+      JSI_EXPORT_FUNCTION(SamplerNodeHostObject, allNotesOff));
+}
+
+JSI_PROPERTY_GETTER_IMPL(SamplerNodeHostObject, maxPolyphony) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  return {static_cast<double>(samplerNode->getMaxPolyphony())};
+}
+
+JSI_PROPERTY_GETTER_IMPL(SamplerNodeHostObject, voiceStealing) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  return jsi::String::createFromUtf8(runtime, samplerNode->getVoiceStealing());
+}
+
+JSI_PROPERTY_GETTER_IMPL(SamplerNodeHostObject, activeVoiceCount) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  return {static_cast<double>(samplerNode->getActiveVoiceCount())};
+}
+
+JSI_PROPERTY_GETTER_IMPL(SamplerNodeHostObject, attack) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  return {samplerNode->getAttack()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(SamplerNodeHostObject, decay) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  return {samplerNode->getDecay()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(SamplerNodeHostObject, sustain) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  return {samplerNode->getSustain()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(SamplerNodeHostObject, release) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  return {samplerNode->getRelease()};
+}
+
+JSI_PROPERTY_SETTER_IMPL(SamplerNodeHostObject, attack) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  samplerNode->setAttack(static_cast<float>(value.getNumber()));
+}
+
+JSI_PROPERTY_SETTER_IMPL(SamplerNodeHostObject, decay) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  samplerNode->setDecay(static_cast<float>(value.getNumber()));
+}
+
+JSI_PROPERTY_SETTER_IMPL(SamplerNodeHostObject, sustain) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  samplerNode->setSustain(static_cast<float>(value.getNumber()));
+}
+
+JSI_PROPERTY_SETTER_IMPL(SamplerNodeHostObject, release) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  samplerNode->setRelease(static_cast<float>(value.getNumber()));
+}
+
+JSI_HOST_FUNCTION_IMPL(SamplerNodeHostObject, setRegions) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  auto regionsArray = args[0].getObject(runtime).asArray(runtime);
+  auto regionCount = regionsArray.size(runtime);
+
+  std::vector<SamplerRegion> regions;
+  regions.reserve(regionCount);
+  size_t sizeInBytes = 0;
+
+  for (size_t i = 0; i < regionCount; i++) {
+    auto regionObject = regionsArray.getValueAtIndex(runtime, i).getObject(runtime);
+    auto bufferHostObject = regionObject.getProperty(runtime, "buffer")
+                                .getObject(runtime)
+                                .asHostObject<AudioBufferHostObject>(runtime);
+    sizeInBytes += bufferHostObject->getSizeInBytes();
+
+    SamplerRegion region;
+    region.buffer = bufferHostObject->audioBuffer_;
+    region.rootNote = static_cast<int>(regionObject.getProperty(runtime, "rootNote").getNumber());
+    region.lowNote = static_cast<int>(regionObject.getProperty(runtime, "lowNote").getNumber());
+    region.highNote = static_cast<int>(regionObject.getProperty(runtime, "highNote").getNumber());
+    region.lowVelocity =
+        static_cast<float>(regionObject.getProperty(runtime, "lowVelocity").getNumber());
+    region.highVelocity =
+        static_cast<float>(regionObject.getProperty(runtime, "highVelocity").getNumber());
+    region.gain = static_cast<float>(regionObject.getProperty(runtime, "gain").getNumber());
+    region.loop = regionObject.getProperty(runtime, "loop").getBool();
+    region.loopStart = regionObject.getProperty(runtime, "loopStart").getNumber();
+    region.loopEnd = regionObject.getProperty(runtime, "loopEnd").getNumber();
+    regions.push_back(std::move(region));
+  }
+
+  thisValue.asObject(runtime).setExternalMemoryPressure(runtime, sizeInBytes + 16);
+  samplerNode->setRegions(regions);
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(SamplerNodeHostObject, noteOn) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  auto note = static_cast<int>(args[0].getNumber());
+  auto velocity = static_cast<float>(args[1].getNumber());
+  auto when = args[2].getNumber();
+  auto detune = static_cast<float>(args[3].getNumber());
+  samplerNode->noteOn(note, velocity, when, detune);
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(SamplerNodeHostObject, noteOff) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  auto note = static_cast<int>(args[0].getNumber());
+  auto when = args[1].getNumber();
+  samplerNode->noteOff(note, when);
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(SamplerNodeHostObject, allNotesOff) {
+  auto samplerNode = std::static_pointer_cast<SamplerNode>(node_);
+  samplerNode->allNotesOff(args[0].getNumber());
+  return jsi::Value::undefined();
+}
+
+} // namespace audioapi
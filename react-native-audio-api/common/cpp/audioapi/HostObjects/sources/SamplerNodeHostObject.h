@@ -0,0 +1,36 @@
+#pragma once
+
+#include <audioapi/HostObjects/AudioNodeHostObject.h>
+
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+using namespace facebook;
+
+class SamplerNode;
+
+class SamplerNodeHostObject : public AudioNodeHostObject {
+ public:
+  explicit SamplerNodeHostObject(const std::shared_ptr<SamplerNode> &node);
+
+  JSI_PROPERTY_GETTER_DECL(maxPolyphony);
+  JSI_PROPERTY_GETTER_DECL(voiceStealing);
+  JSI_PROPERTY_GETTER_DECL(activeVoiceCount);
+  JSI_PROPERTY_GETTER_DECL(attack);
+  JSI_PROPERTY_GETTER_DECL(decay);
+  JSI_PROPERTY_GETTER_DECL(sustain);
+  JSI_PROPERTY_GETTER_DECL(release);
+
+  JSI_PROPERTY_SETTER_DECL(attack);
+  JSI_PROPERTY_SETTER_DECL(decay);
+  JSI_PROPERTY_SETTER_DECL(sustain);
+  JSI_PROPERTY_SETTER_DECL(release);
+
+  JSI_HOST_FUNCTION_DECL(setRegions);
+  JSI_HOST_FUNCTION_DECL(noteOn);
+  JSI_HOST_FUNCTION_DECL(noteOff);
+  JSI_HOST_FUNCTION_DECL(allNotesOff);
+};
+
+} // namespace audioapi
@@ -9,9 +9,36 @@ namespace audioapi {
 
 StreamerNodeHostObject::StreamerNodeHostObject(const std::shared_ptr<StreamerNode> &node)
     : AudioScheduledSourceNodeHostObject(node) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(StreamerNodeHostObject, prebufferDuration),
+      JSI_EXPORT_PROPERTY_GETTER(StreamerNodeHostObject, bufferedDuration),
+      JSI_EXPORT_PROPERTY_GETTER(StreamerNodeHostObject, underrunCount));
+
+  addSetters(JSI_EXPORT_PROPERTY_SETTER(StreamerNodeHostObject, prebufferDuration));
+
   addFunctions(JSI_EXPORT_FUNCTION(StreamerNodeHostObject, initialize));
 }
 
+JSI_PROPERTY_GETTER_IMPL(StreamerNodeHostObject, prebufferDuration) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  return {streamerNode->getPrebufferDuration()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamerNodeHostObject, bufferedDuration) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  return {streamerNode->getBufferedDuration()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamerNodeHostObject, underrunCount) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  return {static_cast<double>(streamerNode->getUnderrunCount())};
+}
+
+JSI_PROPERTY_SETTER_IMPL(StreamerNodeHostObject, prebufferDuration) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  streamerNode->setPrebufferDuration(value.getNumber());
+}
+
 JSI_HOST_FUNCTION_IMPL(StreamerNodeHostObject, initialize) {
 #if !RN_AUDIO_API_FFMPEG_DISABLED
   auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
@@ -19,6 +19,12 @@ class StreamerNodeHostObject : public AudioScheduledSourceNodeHostObject {
     return SIZE;
   }
 
+  JSI_PROPERTY_GETTER_DECL(prebufferDuration);
+  JSI_PROPERTY_GETTER_DECL(bufferedDuration);
+  JSI_PROPERTY_GETTER_DECL(underrunCount);
+
+  JSI_PROPERTY_SETTER_DECL(prebufferDuration);
+
   JSI_HOST_FUNCTION_DECL(initialize);
 
  private:
@@ -1,6 +1,7 @@
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/HostObjects/utils/AudioDecoderHostObject.h>
 #include <audioapi/core/utils/AudioDecoder.h>
+#include <audioapi/core/utils/DecodedAudioCache.h>
 #include <audioapi/jsi/JsiPromise.h>
 
 #include <jsi/jsi.h>
@@ -16,8 +17,12 @@ AudioDecoderHostObject::AudioDecoderHostObject(
   promiseVendor_ = std::make_shared<PromiseVendor>(runtime, callInvoker);
   addFunctions(
       JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithPCMInBase64),
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithPCMData),
       JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithFilePath),
-      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithMemoryBlock));
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithMemoryBlock),
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, prefetchWithFilePath),
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, setCacheBudget),
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, clearCache));
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithMemoryBlock) {
@@ -54,7 +59,9 @@ JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithFilePath) {
   auto sampleRate = args[1].getNumber();
 
   auto promise = promiseVendor_->createAsyncPromise([sourcePath, sampleRate]() -> PromiseResolver {
-    auto result = AudioDecoder::decodeWithFilePath(sourcePath, sampleRate);
+    auto result = DecodedAudioCache::shared().getOrDecode(sourcePath, sampleRate, [&]() {
+      return AudioDecoder::decodeWithFilePath(sourcePath, sampleRate);
+    });
 
     if (!result) {
       return [](jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
@@ -105,4 +112,81 @@ JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithPCMInBase64) {
   return promise;
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithPCMData) {
+  // samples are read in place, the view is kept alive by the awaiting caller
+  auto view = args[0].getObject(runtime);
+  auto arrayBuffer = view.getPropertyAsObject(runtime, "buffer").getArrayBuffer(runtime);
+  auto byteOffset = static_cast<size_t>(view.getProperty(runtime, "byteOffset").getNumber());
+  auto size = static_cast<size_t>(view.getProperty(runtime, "byteLength").getNumber());
+  auto data = arrayBuffer.data(runtime) + byteOffset;
+
+  auto format = args[1].getString(runtime).utf8(runtime) == "float32" ? PcmSampleFormat::FLOAT32
+                                                                       : PcmSampleFormat::INT16;
+  auto inputSampleRate = static_cast<float>(args[2].getNumber());
+  auto inputChannelCount = static_cast<int>(args[3].getNumber());
+  auto interleaved = args[4].getBool();
+  auto outputSampleRate = static_cast<float>(args[5].getNumber());
+
+  auto promise = promiseVendor_->createAsyncPromise(
+      [data, size, format, inputSampleRate, inputChannelCount, interleaved, outputSampleRate]()
+          -> PromiseResolver {
+        auto result = AudioDecoder::decodeWithPCMData(
+            data,
+            size,
+            format,
+            inputSampleRate,
+            inputChannelCount,
+            interleaved,
+            outputSampleRate);
+
+        if (!result) {
+          return [](jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
+            return std::string("Failed to convert PCM data.");
+          };
+        }
+
+        auto audioBufferHostObject = std::make_shared<AudioBufferHostObject>(result);
+
+        return [audioBufferHostObject = std::move(audioBufferHostObject)](
+                   jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
+          auto jsiObject = jsi::Object::createFromHostObject(runtime, audioBufferHostObject);
+          jsiObject.setExternalMemoryPressure(runtime, audioBufferHostObject->getSizeInBytes());
+          return jsiObject;
+        };
+      });
+
+  return promise;
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, prefetchWithFilePath) {
+  auto sourcePath = args[0].getString(runtime).utf8(runtime);
+  auto sampleRate = args[1].getNumber();
+
+  auto promise = promiseVendor_->createAsyncPromise([sourcePath, sampleRate]() -> PromiseResolver {
+    auto result = DecodedAudioCache::shared().getOrDecode(sourcePath, sampleRate, [&]() {
+      return AudioDecoder::decodeWithFilePath(sourcePath, sampleRate);
+    });
+
+    return [isDecoded = result != nullptr](
+               jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
+      return jsi::Value(isDecoded);
+    };
+  });
+
+  return promise;
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, setCacheBudget) {
+  auto budget = static_cast<size_t>(args[0].getNumber());
+  DecodedAudioCache::shared().setBudget(budget);
+
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, clearCache) {
+  DecodedAudioCache::shared().clear();
+
+  return jsi::Value::undefined();
+}
+
 } // namespace audioapi
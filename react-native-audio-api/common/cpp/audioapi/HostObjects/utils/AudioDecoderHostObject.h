@@ -21,6 +21,10 @@ class AudioDecoderHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(decodeWithMemoryBlock);
   JSI_HOST_FUNCTION_DECL(decodeWithFilePath);
   JSI_HOST_FUNCTION_DECL(decodeWithPCMInBase64);
+  JSI_HOST_FUNCTION_DECL(decodeWithPCMData);
+  JSI_HOST_FUNCTION_DECL(prefetchWithFilePath);
+  JSI_HOST_FUNCTION_DECL(setCacheBudget);
+  JSI_HOST_FUNCTION_DECL(clearCache);
 
  private:
   std::shared_ptr<PromiseVendor> promiseVendor_;
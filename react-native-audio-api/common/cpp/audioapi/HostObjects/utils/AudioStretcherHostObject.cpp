@@ -1,5 +1,6 @@
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/HostObjects/utils/AudioStretcherHostObject.h>
+#include <audioapi/core/sources/AudioBuffer.h>
 #include <audioapi/core/utils/AudioStretcher.h>
 #include <audioapi/jsi/JsiPromise.h>
 
@@ -7,13 +8,16 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 
 namespace audioapi {
 
 AudioStretcherHostObject::AudioStretcherHostObject(
     jsi::Runtime *runtime,
-    const std::shared_ptr<react::CallInvoker> &callInvoker) {
+    const std::shared_ptr<react::CallInvoker> &callInvoker,
+    const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry)
+    : audioEventHandlerRegistry_(audioEventHandlerRegistry) {
   promiseVendor_ = std::make_shared<PromiseVendor>(runtime, callInvoker);
   addFunctions(JSI_EXPORT_FUNCTION(AudioStretcherHostObject, changePlaybackSpeed));
 }
@@ -21,9 +25,28 @@ AudioStretcherHostObject::AudioStretcherHostObject(
 JSI_HOST_FUNCTION_IMPL(AudioStretcherHostObject, changePlaybackSpeed) {
   auto audioBuffer = args[0].getObject(runtime).asHostObject<AudioBufferHostObject>(runtime);
   auto playbackSpeed = static_cast<float>(args[1].asNumber());
+  auto algorithm = args[2].getString(runtime).utf8(runtime) == "signalsmith"
+      ? StretchAlgorithm::SIGNALSMITH
+      : StretchAlgorithm::TDHS;
+  auto progressCallbackId = std::stoull(args[3].getString(runtime).utf8(runtime));
+
+  auto audioEventHandlerRegistry = audioEventHandlerRegistry_;
+  // JS may keep using the buffer while it is stretched, so the worker reads its own copy,
+  // which shares the samples and is taken on the JS thread
+  auto input = std::make_shared<AudioBuffer>(*audioBuffer->audioBuffer_);
 
   auto promise = promiseVendor_->createAsyncPromise([=]() -> PromiseResolver {
-    auto result = AudioStretcher::changePlaybackSpeed(*audioBuffer->audioBuffer_, playbackSpeed);
+    AudioStretcher::ProgressCallback onProgress = nullptr;
+    if (progressCallbackId != 0) {
+      onProgress = [&](float progress) {
+        std::unordered_map<std::string, EventValue> body = {{"value", progress}};
+        audioEventHandlerRegistry->invokeHandlerWithEventBody(
+            "stretchProgress", progressCallbackId, body);
+      };
+    }
+
+    auto result =
+        AudioStretcher::changePlaybackSpeed(*input, playbackSpeed, algorithm, onProgress);
 
     if (result == nullptr) {
       return [](jsi::Runtime &runtime) {
@@ -2,6 +2,7 @@
 
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/core/utils/AudioStretcher.h>
+#include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/jsi/JsiPromise.h>
 
 #include <jsi/jsi.h>
@@ -17,10 +18,12 @@ class AudioStretcherHostObject : public JsiHostObject {
  public:
   explicit AudioStretcherHostObject(
       jsi::Runtime *runtime,
-      const std::shared_ptr<react::CallInvoker> &callInvoker);
+      const std::shared_ptr<react::CallInvoker> &callInvoker,
+      const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry);
   JSI_HOST_FUNCTION_DECL(changePlaybackSpeed);
 
  private:
   std::shared_ptr<PromiseVendor> promiseVendor_;
+  std::shared_ptr<AudioEventHandlerRegistry> audioEventHandlerRegistry_;
 };
 } // namespace audioapi
@@ -4,7 +4,9 @@
 #include <audioapi/core/utils/AudioNodeManager.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
+#include <algorithm>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
@@ -44,10 +46,14 @@ std::string AudioNode::getChannelInterpretation() const {
   return AudioNode::toString(channelInterpretation_);
 }
 
-void AudioNode::connect(const std::shared_ptr<AudioNode> &node) {
+void AudioNode::connect(const std::shared_ptr<AudioNode> &node, int input) {
+  if (input < 0 || input >= std::max(node->getNumberOfInputs(), 1)) {
+    throw std::out_of_range("The input index " + std::to_string(input) + " is out of range");
+  }
+
   if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
     context->getNodeManager()->addPendingNodeConnection(
-        shared_from_this(), node, AudioNodeManager::ConnectionType::CONNECT);
+        shared_from_this(), node, AudioNodeManager::ConnectionType::CONNECT, input);
   }
 }
 
@@ -68,7 +74,18 @@ void AudioNode::disconnect() {
 void AudioNode::disconnect(const std::shared_ptr<AudioNode> &node) {
   if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
     context->getNodeManager()->addPendingNodeConnection(
-        shared_from_this(), node, AudioNodeManager::ConnectionType::DISCONNECT);
+        shared_from_this(), node, AudioNodeManager::ConnectionType::DISCONNECT, ALL_INPUTS);
+  }
+}
+
+void AudioNode::disconnect(const std::shared_ptr<AudioNode> &node, int input) {
+  if (input < 0 || input >= std::max(node->getNumberOfInputs(), 1)) {
+    throw std::out_of_range("The input index " + std::to_string(input) + " is out of range");
+  }
+
+  if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    context->getNodeManager()->addPendingNodeConnection(
+        shared_from_this(), node, AudioNodeManager::ConnectionType::DISCONNECT, input);
   }
 }
 
@@ -79,6 +96,12 @@ void AudioNode::disconnect(const std::shared_ptr<AudioParam> &param) {
   }
 }
 
+void AudioNode::release() {
+  if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    context->getNodeManager()->addReleasedNode(shared_from_this());
+  }
+}
+
 bool AudioNode::isEnabled() const {
   return isEnabled_;
 }
@@ -190,7 +213,7 @@ std::shared_ptr<AudioBus> AudioNode::processInputs(
 
   int maxNumberOfChannels = 0;
   for (auto it = inputNodes_.begin(), end = inputNodes_.end(); it != end; ++it) {
-    auto inputNode = *it;
+    auto inputNode = it->first;
     assert(inputNode != nullptr);
 
     if (!inputNode->isEnabled()) {
@@ -237,12 +260,15 @@ void AudioNode::mixInputsBuses(const std::shared_ptr<AudioBus> &processingBus) {
   inputBuses_.clear();
 }
 
-void AudioNode::connectNode(const std::shared_ptr<AudioNode> &node) {
-  auto position = outputNodes_.find(node);
+void AudioNode::connectNode(const std::shared_ptr<AudioNode> &node, int input) {
+  auto connection = std::make_pair(node.get(), input);
 
-  if (position == outputNodes_.end()) {
+  // connections are unique per input, one node can feed several inputs of another one
+  if (std::find(outputConnections_.begin(), outputConnections_.end(), connection) ==
+      outputConnections_.end()) {
+    outputConnections_.push_back(connection);
     outputNodes_.insert(node);
-    node->onInputConnected(this);
+    node->onInputConnected(this, input);
   }
 }
 
@@ -255,11 +281,22 @@ void AudioNode::connectParam(const std::shared_ptr<AudioParam> &param) {
   }
 }
 
-void AudioNode::disconnectNode(const std::shared_ptr<AudioNode> &node) {
-  auto position = outputNodes_.find(node);
+void AudioNode::disconnectNode(const std::shared_ptr<AudioNode> &node, int input) {
+  bool isStillConnected = false;
+
+  for (auto it = outputConnections_.begin(); it != outputConnections_.end();) {
+    if (it->first != node.get()) {
+      ++it;
+    } else if (input != ALL_INPUTS && it->second != input) {
+      isStillConnected = true;
+      ++it;
+    } else {
+      node->onInputDisconnected(this, it->second);
+      it = outputConnections_.erase(it);
+    }
+  }
 
-  if (position != outputNodes_.end()) {
-    node->onInputDisconnected(this);
+  if (!isStillConnected) {
     outputNodes_.erase(node);
   }
 }
@@ -289,41 +326,47 @@ void AudioNode::onInputDisabled() {
   }
 }
 
-void AudioNode::onInputConnected(AudioNode *node) {
+void AudioNode::onInputConnected(AudioNode *node, int /* input */) {
   if (!isInitialized_) {
     return;
   }
 
-  inputNodes_.insert(node);
+  // a node connected to several inputs is processed and counted as enabled once
+  if (inputNodes_[node]++ > 0) {
+    return;
+  }
 
   if (node->isEnabled()) {
     onInputEnabled();
   }
 }
 
-void AudioNode::onInputDisconnected(AudioNode *node) {
+void AudioNode::onInputDisconnected(AudioNode *node, int /* input */) {
   if (!isInitialized_) {
     return;
   }
 
+  auto position = inputNodes_.find(node);
+
+  if (position == inputNodes_.end() || --position->second > 0) {
+    return;
+  }
+
   if (node->isEnabled()) {
     onInputDisabled();
   }
 
-  auto position = inputNodes_.find(node);
-
-  if (position != inputNodes_.end()) {
-    inputNodes_.erase(position);
-  }
+  inputNodes_.erase(position);
 }
 
 void AudioNode::cleanup() {
   isInitialized_ = false;
 
-  for (auto it = outputNodes_.begin(), end = outputNodes_.end(); it != end; ++it) {
-    it->get()->onInputDisconnected(this);
+  for (const auto &[node, input] : outputConnections_) {
+    node->onInputDisconnected(this, input);
   }
 
+  outputConnections_.clear();
   outputNodes_.clear();
 }
 
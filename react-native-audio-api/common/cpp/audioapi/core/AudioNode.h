@@ -8,7 +8,9 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace audioapi {
@@ -27,11 +29,20 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
   int getChannelCount() const;
   std::string getChannelCountMode() const;
   std::string getChannelInterpretation() const;
-  void connect(const std::shared_ptr<AudioNode> &node);
+  /// @param input Index of the input of node which receives the output of this node.
+  /// @throws std::out_of_range when node has no such input, like IndexSizeError in JS
+  void connect(const std::shared_ptr<AudioNode> &node, int input = 0);
   void connect(const std::shared_ptr<AudioParam> &param);
   void disconnect();
+  /// @brief Removes every connection to node, whatever its input.
   void disconnect(const std::shared_ptr<AudioNode> &node);
+  /// @brief Removes only the connection to the given input of node.
+  /// @throws std::out_of_range when node has no such input, like IndexSizeError in JS
+  void disconnect(const std::shared_ptr<AudioNode> &node, int input);
   void disconnect(const std::shared_ptr<AudioParam> &param);
+  /// @brief Lets the context reclaim the node once nothing else references it.
+  /// @note Should be called when JS drops its last reference to the node.
+  void release();
   virtual std::shared_ptr<AudioBus> processAudio(
       const std::shared_ptr<AudioBus> &outputBus,
       int framesToProcess,
@@ -59,8 +70,11 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
 
       ChannelInterpretation::SPEAKERS;
 
-  std::unordered_set<AudioNode *> inputNodes_ = {};
+  // number of connections from every input node, one node can feed several inputs
+  std::unordered_map<AudioNode *, int> inputNodes_ = {};
   std::unordered_set<std::shared_ptr<AudioNode>> outputNodes_ = {};
+  // destination node and its input of every connection in outputNodes_
+  std::vector<std::pair<AudioNode *, int>> outputConnections_ = {};
   std::unordered_set<std::shared_ptr<AudioParam>> outputParams_ = {};
 
   int numberOfEnabledInputNodes_ = 0;
@@ -70,6 +84,16 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
 
   std::size_t lastRenderedFrame_{SIZE_MAX};
 
+  static constexpr int ALL_INPUTS = -1;
+
+  // position in the node manager registry, SIZE_MAX when the node is not registered
+  std::size_t registryIndex_{SIZE_MAX};
+  bool isReclaimCandidate_ = false;
+
+  // called for every connection, also when node is already connected to another input
+  virtual void onInputConnected(AudioNode *node, int input);
+  virtual void onInputDisconnected(AudioNode *node, int input);
+
  private:
   std::vector<std::shared_ptr<AudioBus>> inputBuses_ = {};
 
@@ -86,15 +110,14 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
   std::shared_ptr<AudioBus> applyChannelCountMode(const std::shared_ptr<AudioBus> &processingBus);
   void mixInputsBuses(const std::shared_ptr<AudioBus> &processingBus);
 
-  void connectNode(const std::shared_ptr<AudioNode> &node);
-  void disconnectNode(const std::shared_ptr<AudioNode> &node);
+  void connectNode(const std::shared_ptr<AudioNode> &node, int input);
+  /// @param input Input of node to disconnect from, ALL_INPUTS removes every connection.
+  void disconnectNode(const std::shared_ptr<AudioNode> &node, int input = ALL_INPUTS);
   void connectParam(const std::shared_ptr<AudioParam> &param);
   void disconnectParam(const std::shared_ptr<AudioParam> &param);
 
   void onInputEnabled();
   virtual void onInputDisabled();
-  void onInputConnected(AudioNode *node);
-  void onInputDisconnected(AudioNode *node);
 
   void cleanup();
 };
@@ -228,6 +228,24 @@ void AudioParam::cancelAndHoldAtTime(double cancelTime) {
   });
 }
 
+void AudioParam::reset() {
+  // changes scheduled by the previous owner are applied and dropped with the rest of the queue
+  processScheduledEvents();
+
+  ParamChangeEvent event;
+  while (eventsQueue_.popFront(event)) {
+  }
+
+  value_ = defaultValue_;
+  startTime_ = 0;
+  endTime_ = 0;
+  startValue_ = defaultValue_;
+  endValue_ = defaultValue_;
+  calculateValue_ = [this](double, double, float, float, double) {
+    return value_;
+  };
+}
+
 void AudioParam::addInputNode(AudioNode *node) {
   inputNodes_.emplace_back(node);
 }
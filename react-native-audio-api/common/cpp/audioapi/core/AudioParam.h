@@ -76,6 +76,11 @@ class AudioParam {
   // JS-Thread only
   void cancelAndHoldAtTime(double cancelTime);
 
+  // JS-Thread only, once the owning node is no longer rendered
+  /// @brief Restores the default value and drops every scheduled change, so that the param
+  /// can be reused by a recycled node.
+  void reset();
+
   /// Audio-Thread only methods
   /// These methods are called only from the Audio rendering thread.
 
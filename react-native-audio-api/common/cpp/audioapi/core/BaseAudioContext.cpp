@@ -6,6 +6,7 @@
 #include <audioapi/core/effects/DelayNode.h>
 #include <audioapi/core/effects/GainNode.h>
 #include <audioapi/core/effects/IIRFilterNode.h>
+#include <audioapi/core/effects/MixerNode.h>
 #include <audioapi/core/effects/StereoPannerNode.h>
 #include <audioapi/core/effects/WaveShaperNode.h>
 #include <audioapi/core/effects/WorkletNode.h>
@@ -13,20 +14,25 @@
 #include <audioapi/core/sources/AudioBuffer.h>
 #include <audioapi/core/sources/AudioBufferQueueSourceNode.h>
 #include <audioapi/core/sources/AudioBufferSourceNode.h>
+#include <audioapi/core/sources/AudioFileSourceNode.h>
 #include <audioapi/core/sources/ConstantSourceNode.h>
 #include <audioapi/core/sources/OscillatorNode.h>
 #include <audioapi/core/sources/RecorderAdapterNode.h>
+#include <audioapi/core/sources/SamplerNode.h>
 #if !RN_AUDIO_API_FFMPEG_DISABLED
 #include <audioapi/core/sources/StreamerNode.h>
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 #include <audioapi/core/sources/WorkletSourceNode.h>
 #include <audioapi/core/utils/AudioDecoder.h>
 #include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/core/utils/PcmReadAhead.h>
+#include <audioapi/core/utils/StretcherPool.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 #include <audioapi/utils/CircularAudioArray.h>
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -38,6 +44,7 @@ BaseAudioContext::BaseAudioContext(
     const std::shared_ptr<IAudioEventHandlerRegistry> &audioEventHandlerRegistry,
     const RuntimeRegistry &runtimeRegistry)
     : nodeManager_(std::make_shared<AudioNodeManager>()),
+      stretcherPool_(std::make_shared<StretcherPool>()),
       audioEventHandlerRegistry_(audioEventHandlerRegistry),
       runtimeRegistry_(runtimeRegistry) {}
 
@@ -117,7 +124,10 @@ std::shared_ptr<RecorderAdapterNode> BaseAudioContext::createRecorderAdapter() {
 }
 
 std::shared_ptr<OscillatorNode> BaseAudioContext::createOscillator() {
-  auto oscillator = std::make_shared<OscillatorNode>(shared_from_this());
+  auto oscillator = nodeManager_->getNodePool()->acquireOscillator();
+  if (oscillator == nullptr) {
+    oscillator = std::make_shared<OscillatorNode>(shared_from_this());
+  }
   nodeManager_->addSourceNode(oscillator);
   return oscillator;
 }
@@ -128,6 +138,14 @@ std::shared_ptr<ConstantSourceNode> BaseAudioContext::createConstantSource() {
   return constantSource;
 }
 
+std::shared_ptr<SamplerNode> BaseAudioContext::createSampler(
+    size_t maxPolyphony,
+    VoiceStealingPolicy voiceStealing) {
+  auto sampler = std::make_shared<SamplerNode>(shared_from_this(), maxPolyphony, voiceStealing);
+  nodeManager_->addProcessingNode(sampler);
+  return sampler;
+}
+
 std::shared_ptr<StreamerNode> BaseAudioContext::createStreamer() {
 #if !RN_AUDIO_API_FFMPEG_DISABLED
   auto streamer = std::make_shared<StreamerNode>(shared_from_this());
@@ -138,12 +156,30 @@ std::shared_ptr<StreamerNode> BaseAudioContext::createStreamer() {
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 }
 
+std::shared_ptr<AudioFileSourceNode> BaseAudioContext::createFileSource(
+    std::unique_ptr<AudioStreamReader> reader,
+    double readAhead) {
+  auto fileSource =
+      std::make_shared<AudioFileSourceNode>(shared_from_this(), std::move(reader), readAhead);
+  nodeManager_->addSourceNode(fileSource);
+  return fileSource;
+}
+
 std::shared_ptr<GainNode> BaseAudioContext::createGain() {
   auto gain = std::make_shared<GainNode>(shared_from_this());
   nodeManager_->addProcessingNode(gain);
   return gain;
 }
 
+std::shared_ptr<MixerNode> BaseAudioContext::createMixer(
+    int numberOfInputs,
+    int numberOfOutputChannels) {
+  auto mixer =
+      std::make_shared<MixerNode>(shared_from_this(), numberOfInputs, numberOfOutputChannels);
+  nodeManager_->addProcessingNode(mixer);
+  return mixer;
+}
+
 std::shared_ptr<DelayNode> BaseAudioContext::createDelay(float maxDelayTime) {
   auto delay = std::make_shared<DelayNode>(shared_from_this(), maxDelayTime);
   nodeManager_->addProcessingNode(delay);
@@ -170,16 +206,24 @@ std::shared_ptr<IIRFilterNode> BaseAudioContext::createIIRFilter(
   return iirFilter;
 }
 
-std::shared_ptr<AudioBufferSourceNode> BaseAudioContext::createBufferSource(bool pitchCorrection) {
-  auto bufferSource = std::make_shared<AudioBufferSourceNode>(shared_from_this(), pitchCorrection);
+std::shared_ptr<AudioBufferSourceNode> BaseAudioContext::createBufferSource(
+    bool pitchCorrection,
+    PitchCorrectionQuality pitchCorrectionQuality) {
+  auto bufferSource =
+      pitchCorrection ? nullptr : nodeManager_->getNodePool()->acquireBufferSource();
+  if (bufferSource == nullptr) {
+    bufferSource = std::make_shared<AudioBufferSourceNode>(
+        shared_from_this(), pitchCorrection, pitchCorrectionQuality);
+  }
   nodeManager_->addSourceNode(bufferSource);
   return bufferSource;
 }
 
 std::shared_ptr<AudioBufferQueueSourceNode> BaseAudioContext::createBufferQueueSource(
-    bool pitchCorrection) {
-  auto bufferSource =
-      std::make_shared<AudioBufferQueueSourceNode>(shared_from_this(), pitchCorrection);
+    bool pitchCorrection,
+    PitchCorrectionQuality pitchCorrectionQuality) {
+  auto bufferSource = std::make_shared<AudioBufferQueueSourceNode>(
+      shared_from_this(), pitchCorrection, pitchCorrectionQuality);
   nodeManager_->addSourceNode(bufferSource);
   return bufferSource;
 }
@@ -217,10 +261,38 @@ std::shared_ptr<WaveShaperNode> BaseAudioContext::createWaveShaper() {
   return waveShaper;
 }
 
+void BaseAudioContext::prewarmBufferSources(size_t count) {
+  auto *nodePool = nodeManager_->getNodePool();
+  count = std::min(count, AudioNodePool::getCapacity() - nodePool->getBufferSourceCount());
+
+  for (size_t i = 0; i < count; i++) {
+    nodePool->addBufferSource(std::make_shared<AudioBufferSourceNode>(shared_from_this(), false));
+  }
+}
+
+void BaseAudioContext::prewarmOscillators(size_t count) {
+  auto *nodePool = nodeManager_->getNodePool();
+  count = std::min(count, AudioNodePool::getCapacity() - nodePool->getOscillatorCount());
+
+  for (size_t i = 0; i < count; i++) {
+    nodePool->addOscillator(std::make_shared<OscillatorNode>(shared_from_this()));
+  }
+}
+
 AudioNodeManager *BaseAudioContext::getNodeManager() {
   return nodeManager_.get();
 }
 
+std::shared_ptr<StretcherPool> BaseAudioContext::getStretcherPool() {
+  return stretcherPool_;
+}
+
+std::shared_ptr<PcmReadAhead> BaseAudioContext::getPcmReadAhead() {
+  std::call_once(
+      pcmReadAheadFlag_, [this]() { pcmReadAhead_ = std::make_shared<PcmReadAhead>(); });
+  return pcmReadAhead_;
+}
+
 bool BaseAudioContext::isRunning() const {
   return state_ == ContextState::RUNNING && isDriverRunning();
 }
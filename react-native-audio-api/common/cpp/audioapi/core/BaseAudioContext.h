@@ -2,12 +2,15 @@
 
 #include <audioapi/core/types/ContextState.h>
 #include <audioapi/core/types/OscillatorType.h>
+#include <audioapi/core/types/PitchCorrectionQuality.h>
+#include <audioapi/core/types/VoiceStealingPolicy.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
 #include <cassert>
 #include <complex>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,11 +19,13 @@ namespace audioapi {
 
 class AudioBus;
 class GainNode;
+class MixerNode;
 class DelayNode;
 class AudioBuffer;
 class PeriodicWave;
 class OscillatorNode;
 class ConstantSourceNode;
+class SamplerNode;
 class StereoPannerNode;
 class AudioNodeManager;
 class BiquadFilterNode;
@@ -37,7 +42,11 @@ class WorkletSourceNode;
 class WorkletNode;
 class WorkletProcessingNode;
 class StreamerNode;
+class AudioFileSourceNode;
+class AudioStreamReader;
 class WaveShaperNode;
+class StretcherPool;
+class PcmReadAhead;
 
 class BaseAudioContext : public std::enable_shared_from_this<BaseAudioContext> {
  public:
@@ -71,16 +80,27 @@ class BaseAudioContext : public std::enable_shared_from_this<BaseAudioContext> {
       bool shouldLockRuntime = true);
   std::shared_ptr<OscillatorNode> createOscillator();
   std::shared_ptr<ConstantSourceNode> createConstantSource();
+  std::shared_ptr<SamplerNode> createSampler(
+      size_t maxPolyphony,
+      VoiceStealingPolicy voiceStealing);
   std::shared_ptr<StreamerNode> createStreamer();
+  std::shared_ptr<AudioFileSourceNode> createFileSource(
+      std::unique_ptr<AudioStreamReader> reader,
+      double readAhead);
   std::shared_ptr<GainNode> createGain();
+  std::shared_ptr<MixerNode> createMixer(int numberOfInputs, int numberOfOutputChannels);
   std::shared_ptr<DelayNode> createDelay(float maxDelayTime);
   std::shared_ptr<StereoPannerNode> createStereoPanner();
   std::shared_ptr<BiquadFilterNode> createBiquadFilter();
   std::shared_ptr<IIRFilterNode> createIIRFilter(
       const std::vector<float> &feedforward,
       const std::vector<float> &feedback);
-  std::shared_ptr<AudioBufferSourceNode> createBufferSource(bool pitchCorrection);
-  std::shared_ptr<AudioBufferQueueSourceNode> createBufferQueueSource(bool pitchCorrection);
+  std::shared_ptr<AudioBufferSourceNode> createBufferSource(
+      bool pitchCorrection,
+      PitchCorrectionQuality pitchCorrectionQuality = PitchCorrectionQuality::HIGH);
+  std::shared_ptr<AudioBufferQueueSourceNode> createBufferQueueSource(
+      bool pitchCorrection,
+      PitchCorrectionQuality pitchCorrectionQuality = PitchCorrectionQuality::HIGH);
   static std::shared_ptr<AudioBuffer>
   createBuffer(int numberOfChannels, size_t length, float sampleRate);
   std::shared_ptr<PeriodicWave> createPeriodicWave(
@@ -93,9 +113,17 @@ class BaseAudioContext : public std::enable_shared_from_this<BaseAudioContext> {
       bool disableNormalization);
   std::shared_ptr<WaveShaperNode> createWaveShaper();
 
+  /// @brief Creates nodes ahead of time, so that creating them later takes them from the pool.
+  /// @note Only buffer sources without pitch correction and oscillators are pooled.
+  void prewarmBufferSources(size_t count);
+  void prewarmOscillators(size_t count);
+
   std::shared_ptr<PeriodicWave> getBasicWaveForm(OscillatorType type);
   [[nodiscard]] float getNyquistFrequency() const;
   AudioNodeManager *getNodeManager();
+  std::shared_ptr<StretcherPool> getStretcherPool();
+  /// @brief Starts the read ahead thread the first time a node plays PCM storage.
+  std::shared_ptr<PcmReadAhead> getPcmReadAhead();
 
   [[nodiscard]] bool isRunning() const;
   [[nodiscard]] bool isSuspended() const;
@@ -109,6 +137,9 @@ class BaseAudioContext : public std::enable_shared_from_this<BaseAudioContext> {
   float sampleRate_{};
   ContextState state_ = ContextState::RUNNING;
   std::shared_ptr<AudioNodeManager> nodeManager_;
+  std::shared_ptr<StretcherPool> stretcherPool_;
+  std::shared_ptr<PcmReadAhead> pcmReadAhead_;
+  std::once_flag pcmReadAheadFlag_;
 
  private:
   std::shared_ptr<PeriodicWave> cachedSineWave_ = nullptr;
@@ -3,6 +3,7 @@
 #include <audioapi/core/AudioNode.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <vector>
@@ -29,7 +30,8 @@ class AudioDestinationNode : public AudioNode {
   };
 
  private:
-  std::size_t currentSampleFrame_;
+  // advanced by the audio thread, polled by JS through the context current time
+  std::atomic<std::size_t> currentSampleFrame_;
 };
 
 } // namespace audioapi
@@ -0,0 +1,226 @@
+#include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/effects/MixerNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+// panning follows https://webaudio.github.io/web-audio-api/#stereopanner-algorithm
+
+namespace audioapi {
+
+MixerNode::MixerNode(
+    std::shared_ptr<BaseAudioContext> context,
+    int numberOfInputs,
+    int numberOfOutputChannels)
+    : AudioNode(context),
+      strips_(static_cast<size_t>(numberOfInputs)),
+      gains_(RENDER_QUANTUM_SIZE),
+      monoToLeft_(RENDER_QUANTUM_SIZE),
+      monoToRight_(RENDER_QUANTUM_SIZE),
+      leftToLeft_(RENDER_QUANTUM_SIZE),
+      rightToLeft_(RENDER_QUANTUM_SIZE),
+      leftToRight_(RENDER_QUANTUM_SIZE),
+      rightToRight_(RENDER_QUANTUM_SIZE) {
+  numberOfInputs_ = numberOfInputs;
+  channelCount_ = numberOfOutputChannels;
+  channelCountMode_ = ChannelCountMode::EXPLICIT;
+  audioBus_ =
+      std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
+
+  for (auto &strip : strips_) {
+    strip.gainParam = std::make_shared<AudioParam>(
+        1.0, MOST_NEGATIVE_SINGLE_FLOAT, MOST_POSITIVE_SINGLE_FLOAT, context);
+    strip.panParam = std::make_shared<AudioParam>(0.0, -1.0f, 1.0f, context);
+  }
+
+  isInitialized_ = true;
+}
+
+std::shared_ptr<AudioParam> MixerNode::getGainParam(int input) const {
+  return strips_.at(static_cast<size_t>(input)).gainParam;
+}
+
+std::shared_ptr<AudioParam> MixerNode::getPanParam(int input) const {
+  return strips_.at(static_cast<size_t>(input)).panParam;
+}
+
+bool MixerNode::isMuted(int input) const {
+  return strips_.at(static_cast<size_t>(input)).isMuted.load(std::memory_order_relaxed);
+}
+
+void MixerNode::setMuted(int input, bool muted) {
+  strips_.at(static_cast<size_t>(input)).isMuted.store(muted, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AudioBus> MixerNode::processNode(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int /* framesToProcess */) {
+  // inputs are already mixed by processInputs
+  return processingBus;
+}
+
+void MixerNode::onInputConnected(AudioNode *node, int input) {
+  if (!isInitialized_) {
+    return;
+  }
+
+  // the input index is validated by connect
+  AudioNode::onInputConnected(node, input);
+  strips_[static_cast<size_t>(input)].inputNodes.push_back(node);
+}
+
+void MixerNode::onInputDisconnected(AudioNode *node, int input) {
+  if (!isInitialized_) {
+    return;
+  }
+
+  AudioNode::onInputDisconnected(node, input);
+
+  auto &inputNodes = strips_[static_cast<size_t>(input)].inputNodes;
+  auto position = std::find(inputNodes.begin(), inputNodes.end(), node);
+
+  if (position != inputNodes.end()) {
+    inputNodes.erase(position);
+  }
+}
+
+std::shared_ptr<AudioBus> MixerNode::processInputs(
+    const std::shared_ptr<AudioBus> &outputBus,
+    int framesToProcess,
+    bool checkIsAlreadyProcessed) {
+  audioBus_->zero();
+
+  std::shared_ptr<BaseAudioContext> context = context_.lock();
+  if (context == nullptr) {
+    return audioBus_;
+  }
+
+  double time = context->getCurrentTime();
+  auto frames = static_cast<size_t>(framesToProcess);
+
+  for (auto &strip : strips_) {
+    bool isPrepared = false;
+    bool isAudible = false;
+
+    for (auto *inputNode : strip.inputNodes) {
+      if (!inputNode->isEnabled()) {
+        continue;
+      }
+
+      // muted inputs are processed as well, so that they keep playing in the background
+      auto inputBus = inputNode->processAudio(outputBus, framesToProcess, checkIsAlreadyProcessed);
+
+      if (!isPrepared) {
+        isAudible = prepareStrip(strip, frames, time);
+        isPrepared = true;
+      }
+
+      if (isAudible) {
+        mixInput(*inputBus, frames);
+      }
+    }
+
+    if (!isPrepared) {
+      strip.muteGain = strip.isMuted.load(std::memory_order_relaxed) ? 0.0f : 1.0f;
+    }
+  }
+
+  return audioBus_;
+}
+
+bool MixerNode::prepareStrip(Strip &strip, size_t framesToProcess, double time) {
+  float muteGain = strip.muteGain;
+  float targetMuteGain = strip.isMuted.load(std::memory_order_relaxed) ? 0.0f : 1.0f;
+  strip.muteGain = targetMuteGain;
+
+  if (muteGain == 0.0f && targetMuteGain == 0.0f) {
+    return false;
+  }
+
+  auto gainValues =
+      strip.gainParam->processARateParam(static_cast<int>(framesToProcess), time)
+          ->getChannel(0)
+          ->getData();
+  auto panValues = strip.panParam->processARateParam(static_cast<int>(framesToProcess), time)
+                       ->getChannel(0)
+                       ->getData();
+  float muteStep = (targetMuteGain - muteGain) / static_cast<float>(framesToProcess);
+
+  // pan is usually constant over a render quantum, so the gains are computed once per change
+  float lastPan = NAN;
+  float monoGainL = 0.0f;
+  float monoGainR = 0.0f;
+  float stereoGainL = 0.0f;
+  float stereoGainR = 0.0f;
+
+  for (size_t i = 0; i < framesToProcess; i++) {
+    muteGain += muteStep;
+    float gain = gainValues[i] * muteGain;
+    float pan = std::clamp(panValues[i], -1.0f, 1.0f);
+
+    if (pan != lastPan) {
+      lastPan = pan;
+
+      auto monoX = (pan + 1) / 2;
+      monoGainL = static_cast<float>(cos(monoX * PI / 2));
+      monoGainR = static_cast<float>(sin(monoX * PI / 2));
+
+      auto stereoX = pan <= 0 ? pan + 1 : pan;
+      stereoGainL = static_cast<float>(cos(stereoX * PI / 2));
+      stereoGainR = static_cast<float>(sin(stereoX * PI / 2));
+    }
+
+    gains_[i] = gain;
+    monoToLeft_[i] = gain * monoGainL;
+    monoToRight_[i] = gain * monoGainR;
+
+    if (pan <= 0) {
+      leftToLeft_[i] = gain;
+      rightToLeft_[i] = gain * stereoGainL;
+      leftToRight_[i] = 0.0f;
+      rightToRight_[i] = gain * stereoGainR;
+    } else {
+      leftToLeft_[i] = gain * stereoGainL;
+      rightToLeft_[i] = 0.0f;
+      leftToRight_[i] = gain * stereoGainR;
+      rightToRight_[i] = gain;
+    }
+  }
+
+  return true;
+}
+
+void MixerNode::mixInput(const AudioBus &inputBus, size_t framesToProcess) {
+  int inputChannels = inputBus.getNumberOfChannels();
+  const float *inputLeft = inputBus.getChannel(0)->getData();
+  float *outputLeft = audioBus_->getChannel(0)->getData();
+  float *outputRight = audioBus_->getChannel(1)->getData();
+
+  if (inputChannels == 1) {
+    dsp::multiplyThenAddToOutput(inputLeft, monoToLeft_.data(), outputLeft, framesToProcess);
+    dsp::multiplyThenAddToOutput(inputLeft, monoToRight_.data(), outputRight, framesToProcess);
+    return;
+  }
+
+  const float *inputRight = inputBus.getChannel(1)->getData();
+  dsp::multiplyThenAddToOutput(inputLeft, leftToLeft_.data(), outputLeft, framesToProcess);
+  dsp::multiplyThenAddToOutput(inputRight, rightToLeft_.data(), outputLeft, framesToProcess);
+  dsp::multiplyThenAddToOutput(inputLeft, leftToRight_.data(), outputRight, framesToProcess);
+  dsp::multiplyThenAddToOutput(inputRight, rightToRight_.data(), outputRight, framesToProcess);
+
+  // channels past the stereo pair are not panned, they are mixed into the same channel
+  int discreteChannels = std::min(inputChannels, audioBus_->getNumberOfChannels());
+  for (int channel = 2; channel < discreteChannels; channel++) {
+    dsp::multiplyThenAddToOutput(
+        inputBus.getChannel(channel)->getData(),
+        gains_.data(),
+        audioBus_->getChannel(channel)->getData(),
+        framesToProcess);
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <audioapi/core/AudioNode.h>
+#include <audioapi/core/AudioParam.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// @brief Sums many inputs, each with its own gain, pan and mute, into a single output.
+/// Unlike a chain of gain and stereo panner nodes per input, every input is scaled, panned
+/// and added to the output in one pass, without buses in between.
+/// Inputs are addressed by the input index of the connection, several nodes connected to
+/// the same input share its settings.
+class MixerNode : public AudioNode {
+ public:
+  explicit MixerNode(
+      std::shared_ptr<BaseAudioContext> context,
+      int numberOfInputs,
+      int numberOfOutputChannels);
+
+  /// @throws std::out_of_range when the input does not exist
+  [[nodiscard]] std::shared_ptr<AudioParam> getGainParam(int input) const;
+  [[nodiscard]] std::shared_ptr<AudioParam> getPanParam(int input) const;
+  [[nodiscard]] bool isMuted(int input) const;
+  /// @note Muting fades the input out over a render quantum, so that it does not click.
+  void setMuted(int input, bool muted);
+
+ protected:
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override;
+
+  void onInputConnected(AudioNode *node, int input) override;
+  void onInputDisconnected(AudioNode *node, int input) override;
+
+ private:
+  struct Strip {
+    std::shared_ptr<AudioParam> gainParam;
+    std::shared_ptr<AudioParam> panParam;
+    std::atomic<bool> isMuted{false};
+    // gain applied by muting at the end of the last render quantum
+    float muteGain = 1.0f;
+    // audio thread state
+    std::vector<AudioNode *> inputNodes;
+  };
+
+  std::vector<Strip> strips_;
+
+  // per frame coefficients of the strip being mixed, they combine gain, pan and mute
+  std::vector<float> gains_;
+  std::vector<float> monoToLeft_;
+  std::vector<float> monoToRight_;
+  std::vector<float> leftToLeft_;
+  std::vector<float> rightToLeft_;
+  std::vector<float> leftToRight_;
+  std::vector<float> rightToRight_;
+
+  std::shared_ptr<AudioBus> processInputs(
+      const std::shared_ptr<AudioBus> &outputBus,
+      int framesToProcess,
+      bool checkIsAlreadyProcessed) override;
+
+  /// @brief Computes the coefficients of the strip for the current render quantum.
+  /// @return false when the strip is muted and its inputs do not have to be mixed.
+  bool prepareStrip(Strip &strip, size_t framesToProcess, double time);
+  void mixInput(const AudioBus &inputBus, size_t framesToProcess);
+};
+
+} // namespace audioapi
@@ -144,7 +144,7 @@ void PeriodicWave::generateBasicWaveForm(OscillatorType type) {
     // https://mathworld.wolfram.com/FourierSeries.html
 
     // Coefficient for sin()
-    float b;
+    float b = 0.0f;
 
     auto piFactor = 1.0f / (PI * static_cast<float>(i));
 
@@ -273,70 +273,134 @@ float PeriodicWave::doInterpolation(
     float waveTableInterpolationFactor,
     const float *lowerWaveData,
     const float *higherWaveData) const {
-  float lowerWaveDataSample = 0;
-  float higherWaveDataSample = 0;
-
   // We use linear, 3-point Lagrange, or 5-point Lagrange interpolation based on
   // the value of phase increment. https://dlmf.nist.gov/3.3#ii
+  if (phaseIncrement >= interpolate2Point) {
+    return interpolate<2>(phase, waveTableInterpolationFactor, lowerWaveData, higherWaveData);
+  }
 
-  int index = static_cast<int>(phase);
-  auto factor = phase - static_cast<float>(index);
+  if (phaseIncrement >= interpolate3Point) {
+    return interpolate<3>(phase, waveTableInterpolationFactor, lowerWaveData, higherWaveData);
+  }
 
-  if (phaseIncrement >= interpolate2Point) { // linear interpolation
-    int indices[2];
+  return interpolate<5>(phase, waveTableInterpolationFactor, lowerWaveData, higherWaveData);
+}
 
-    for (int i = 0; i < 2; i++) {
-      indices[i] = (index + i) &
-          (getPeriodicWaveSize() - 1); // more efficient alternative to % getPeriodicWaveSize()
-    }
+void PeriodicWave::processWithConstantFrequency(
+    float *outputVector,
+    size_t framesToProcess,
+    float fundamentalFrequency,
+    float &phase) {
+  float *lowerWaveData = nullptr;
+  float *higherWaveData = nullptr;
 
-    auto lowerWaveDataSample1 = lowerWaveData[indices[0]];
-    auto lowerWaveDataSample2 = lowerWaveData[indices[1]];
-    auto higherWaveDataSample1 = higherWaveData[indices[0]];
-    auto higherWaveDataSample2 = higherWaveData[indices[1]];
+  auto interpolationFactor =
+      getWaveDataForFundamentalFrequency(fundamentalFrequency, lowerWaveData, higherWaveData);
+  auto phaseIncrement = fundamentalFrequency * scale_;
+
+  if (phaseIncrement >= interpolate2Point) {
+    processBlock<2>(
+        outputVector,
+        framesToProcess,
+        phase,
+        phaseIncrement,
+        interpolationFactor,
+        lowerWaveData,
+        higherWaveData);
+  } else if (phaseIncrement >= interpolate3Point) {
+    processBlock<3>(
+        outputVector,
+        framesToProcess,
+        phase,
+        phaseIncrement,
+        interpolationFactor,
+        lowerWaveData,
+        higherWaveData);
+  } else {
+    processBlock<5>(
+        outputVector,
+        framesToProcess,
+        phase,
+        phaseIncrement,
+        interpolationFactor,
+        lowerWaveData,
+        higherWaveData);
+  }
+}
 
-    lowerWaveDataSample = (1 - factor) * lowerWaveDataSample1 + factor * lowerWaveDataSample2;
-    higherWaveDataSample = (1 - factor) * higherWaveDataSample1 + factor * higherWaveDataSample2;
-  } else if (phaseIncrement >= interpolate3Point) { // 3-point Lagrange
-                                                    // interpolation
-    int indices[3];
+template <int NumberOfPoints>
+float PeriodicWave::interpolate(
+    float phase,
+    float waveTableInterpolationFactor,
+    const float *lowerWaveData,
+    const float *higherWaveData) const {
+  static_assert(NumberOfPoints == 2 || NumberOfPoints == 3 || NumberOfPoints == 5);
 
-    for (int i = 0; i < 3; i++) {
-      indices[i] = (index + i - 1) & (getPeriodicWaveSize() - 1);
-    }
+  int index = static_cast<int>(phase);
+  auto factor = phase - static_cast<float>(index);
+  // more efficient alternative to % getPeriodicWaveSize()
+  auto mask = getPeriodicWaveSize() - 1;
 
-    float A[3];
+  float A[NumberOfPoints];
 
+  if constexpr (NumberOfPoints == 2) {
+    A[0] = 1 - factor;
+    A[1] = factor;
+  } else if constexpr (NumberOfPoints == 3) {
     A[0] = factor * (factor - 1) / 2;
     A[1] = 1 - factor * factor;
     A[2] = factor * (factor + 1) / 2;
-
-    for (int i = 0; i < 3; i++) {
-      lowerWaveDataSample += lowerWaveData[indices[i]] * A[i];
-      higherWaveDataSample += higherWaveData[indices[i]] * A[i];
-    }
-  } else { // 5-point Lagrange interpolation
-    int indices[5];
-
-    for (int i = 0; i < 5; i++) {
-      indices[i] = (index + i - 2) & (getPeriodicWaveSize() - 1);
-    }
-
-    float A[5];
-
+  } else {
     A[0] = factor * (factor * factor - 1) * (factor - 2) / 24;
     A[1] = -factor * (factor - 1) * (factor * factor - 4) / 6;
     A[2] = (factor * factor - 1) * (factor * factor - 4) / 4;
     A[3] = -factor * (factor + 1) * (factor * factor - 4) / 6;
     A[4] = factor * (factor * factor - 1) * (factor + 2) / 24;
+  }
 
-    for (int i = 0; i < 5; i++) {
-      lowerWaveDataSample += lowerWaveData[indices[i]] * A[i];
-      higherWaveDataSample += higherWaveData[indices[i]] * A[i];
-    }
+  // window is centered around index, linear interpolation starts at it.
+  constexpr int firstOffset = (NumberOfPoints - 1) / 2;
+
+  float lowerWaveDataSample = 0;
+  float higherWaveDataSample = 0;
+
+  for (int i = 0; i < NumberOfPoints; i++) {
+    auto sampleIndex = (index + i - firstOffset) & mask;
+    lowerWaveDataSample += lowerWaveData[sampleIndex] * A[i];
+    higherWaveDataSample += higherWaveData[sampleIndex] * A[i];
   }
 
   return (1 - waveTableInterpolationFactor) * higherWaveDataSample +
       waveTableInterpolationFactor * lowerWaveDataSample;
 }
+
+template <int NumberOfPoints>
+void PeriodicWave::processBlock(
+    float *outputVector,
+    size_t framesToProcess,
+    float &phase,
+    float phaseIncrement,
+    float waveTableInterpolationFactor,
+    const float *lowerWaveData,
+    const float *higherWaveData) const {
+  auto waveSize = static_cast<float>(getPeriodicWaveSize());
+
+  // with the increment reduced to a single period, one conditional wrap keeps
+  // the phase in [0, waveSize) instead of a floor per sample.
+  if (std::fabs(phaseIncrement) >= waveSize) {
+    phaseIncrement -= std::trunc(phaseIncrement / waveSize) * waveSize;
+  }
+
+  for (size_t i = 0; i < framesToProcess; i++) {
+    outputVector[i] = interpolate<NumberOfPoints>(
+        phase, waveTableInterpolationFactor, lowerWaveData, higherWaveData);
+
+    phase += phaseIncrement;
+    if (phase >= waveSize) {
+      phase -= waveSize;
+    } else if (phase < 0) {
+      phase += waveSize;
+    }
+  }
+}
 } // namespace audioapi
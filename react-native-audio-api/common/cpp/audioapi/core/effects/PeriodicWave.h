@@ -53,6 +53,15 @@ class PeriodicWave {
 
   float getSample(float fundamentalFrequency, float phase, float phaseIncrement);
 
+  // Renders framesToProcess samples for a fundamental frequency that is
+  // constant over the whole block. Wave data range, interpolation factor and
+  // interpolation order are resolved once, phase is advanced in place.
+  void processWithConstantFrequency(
+      float *outputVector,
+      size_t framesToProcess,
+      float fundamentalFrequency,
+      float &phase);
+
  private:
   explicit PeriodicWave(float sampleRate, bool disableNormalization);
 
@@ -97,6 +106,25 @@ class PeriodicWave {
       const float *lowerWaveData,
       const float *higherWaveData) const;
 
+  // Lagrange interpolation kernel of a given order (2 - linear, 3 or 5 point)
+  // shared by the per-sample and block paths.
+  template <int NumberOfPoints>
+  float interpolate(
+      float phase,
+      float waveTableInterpolationFactor,
+      const float *lowerWaveData,
+      const float *higherWaveData) const;
+
+  template <int NumberOfPoints>
+  void processBlock(
+      float *outputVector,
+      size_t framesToProcess,
+      float &phase,
+      float phaseIncrement,
+      float waveTableInterpolationFactor,
+      const float *lowerWaveData,
+      const float *higherWaveData) const;
+
   // determines the time resolution of the waveform.
   float sampleRate_;
   // determines number of frequency segments (or bands) the signal is divided.
@@ -3,6 +3,9 @@
 #include <audioapi/core/utils/AudioFileWriter.h>
 #include <audioapi/core/utils/AudioRecorderCallback.h>
 
+#include <memory>
+#include <vector>
+
 namespace audioapi {
 
 /// @brief Sets the error callback to be invoked when an error occurs during recording.
@@ -39,6 +42,32 @@ void AudioRecorder::clearOnErrorCallback() {
   errorCallbackId_.store(0, std::memory_order_release);
 }
 
+/// @brief Gets the buffers recycled by the audio data callback.
+/// This method should be called from the JS thread only.
+/// @returns Buffers of every batch, empty unless the callback reuses buffers.
+std::vector<std::shared_ptr<AudioBuffer>> AudioRecorder::getAudioReadyBuffers() {
+  std::scoped_lock lock(callbackMutex_);
+
+  if (dataCallback_ == nullptr) {
+    return {};
+  }
+
+  return dataCallback_->getPooledBuffers();
+}
+
+/// @brief Returns a batch of buffers to the audio data callback once JS is done with them.
+/// Batches of a callback which has been replaced in the meantime are ignored.
+/// This method should be called from the JS thread only.
+/// @param callbackId Identifier of the callback which delivered the batch.
+/// @param batchIndex Index of the batch to release.
+void AudioRecorder::releaseAudioReadyBatch(uint64_t callbackId, size_t batchIndex) {
+  std::scoped_lock lock(callbackMutex_);
+
+  if (dataCallback_ != nullptr && dataCallback_->getCallbackId() == callbackId) {
+    dataCallback_->releaseBatch(batchIndex);
+  }
+}
+
 /// @brief Gets the current duration of the recorded audio in seconds.
 /// @returns Duration in seconds.
 double AudioRecorder::getCurrentDuration() const {
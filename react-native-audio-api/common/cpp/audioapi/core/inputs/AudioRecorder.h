@@ -6,6 +6,7 @@
 #include <mutex>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace audioapi {
 
@@ -15,6 +16,7 @@ class CircularAudioArray;
 class RecorderAdapterNode;
 class AudioFileProperties;
 class AudioRecorderCallback;
+class AudioBuffer;
 class AudioEventHandlerRegistry;
 
 class AudioRecorder {
@@ -42,9 +44,14 @@ class AudioRecorder {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId) = 0;
+      uint64_t callbackId,
+      bool reuseBuffers,
+      size_t batchSize) = 0;
   virtual void clearOnAudioReadyCallback() = 0;
 
+  std::vector<std::shared_ptr<AudioBuffer>> getAudioReadyBuffers();
+  void releaseAudioReadyBatch(uint64_t callbackId, size_t batchIndex);
+
   void setOnErrorCallback(uint64_t callbackId);
   void clearOnErrorCallback();
 
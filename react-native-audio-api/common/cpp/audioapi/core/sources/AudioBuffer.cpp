@@ -1,10 +1,13 @@
 #include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/CompactPcmStorage.h>
+#include <audioapi/core/utils/PcmStorage.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 
 #include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace audioapi {
 
@@ -15,31 +18,91 @@ AudioBuffer::AudioBuffer(std::shared_ptr<AudioBus> bus) {
   bus_ = std::move(bus);
 }
 
+AudioBuffer::AudioBuffer(std::shared_ptr<PcmStorage> storage) : storage_(std::move(storage)) {}
+
+AudioBuffer::AudioBuffer(const AudioBuffer &other) {
+  // PCM storage is never written to, so it can be shared as is. Other is
+  // not modified, so it can be copied on any thread owning a reference.
+  if (other.storage_ != nullptr) {
+    storage_ = other.storage_;
+  } else if (!other.hasExposedChannels()) {
+    bus_ = other.bus_;
+  } else if (
+      other.snapshot_ != nullptr && !other.channelsWritten_.load(std::memory_order_acquire)) {
+    bus_ = other.snapshot_;
+  } else {
+    bus_ = std::make_shared<AudioBus>(*other.bus_);
+  }
+}
+
 size_t AudioBuffer::getLength() const {
-  return bus_->getSize();
+  return storage_ != nullptr ? storage_->getLength() : bus_->getSize();
 }
 
 int AudioBuffer::getNumberOfChannels() const {
-  return bus_->getNumberOfChannels();
+  return storage_ != nullptr ? storage_->getNumberOfChannels() : bus_->getNumberOfChannels();
 }
 
 float AudioBuffer::getSampleRate() const {
-  return bus_->getSampleRate();
+  return storage_ != nullptr ? storage_->getSampleRate() : bus_->getSampleRate();
 }
 
 double AudioBuffer::getDuration() const {
   return static_cast<double>(getLength()) / getSampleRate();
 }
 
-float *AudioBuffer::getChannelData(int channel) const {
+const float *AudioBuffer::getChannelData(int channel) const {
+  expandStorage();
   return bus_->getChannel(channel)->getData();
 }
 
+std::shared_ptr<AudioArray> AudioBuffer::getSharedChannel(int channel) {
+  expandStorage();
+  detachIfShared();
+
+  auto audioArray = bus_->getSharedChannel(channel);
+  std::erase_if(exposedChannels_, [](const auto &exposed) { return exposed.use_count() <= 1; });
+  exposedChannels_.emplace_back(audioArray);
+  // the caller is about to write to the channel
+  channelsWritten_.store(true, std::memory_order_release);
+
+  return audioArray;
+}
+
+std::shared_ptr<AudioBus> AudioBuffer::acquireBus() {
+  expandStorage();
+
+  // Exposed channels can be written to at any time, so readers get a copy of
+  // the content. It is shared until a write path marks the channels written.
+  if (hasExposedChannels()) {
+    if (channelsWritten_.exchange(false, std::memory_order_acq_rel) || snapshot_ == nullptr) {
+      snapshot_ = std::make_shared<AudioBus>(*bus_);
+    }
+    return snapshot_;
+  }
+
+  snapshot_ = nullptr;
+  return bus_;
+}
+
+std::shared_ptr<PcmStorage> AudioBuffer::getPcmStorage() const {
+  return storage_;
+}
+
 void AudioBuffer::copyFromChannel(
     float *destination,
     size_t destinationLength,
     int channelNumber,
     size_t startInChannel) const {
+  if (storage_ != nullptr) {
+    storage_->read(
+        channelNumber,
+        startInChannel,
+        std::min(destinationLength, getLength() - startInChannel),
+        destination);
+    return;
+  }
+
   memcpy(
       destination,
       bus_->getChannel(channelNumber)->getData() + startInChannel,
@@ -51,10 +114,62 @@ void AudioBuffer::copyToChannel(
     size_t sourceLength,
     int channelNumber,
     size_t startInChannel) {
+  expandStorage();
+  detachIfShared();
+
   memcpy(
       bus_->getChannel(channelNumber)->getData() + startInChannel,
       source,
       std::min(sourceLength, getLength() - startInChannel) * sizeof(float));
+  channelsWritten_.store(true, std::memory_order_release);
+}
+
+void AudioBuffer::markChannelsWritten() {
+  channelsWritten_.store(true, std::memory_order_release);
+}
+
+void AudioBuffer::compact(PcmSampleFormat format) {
+  if (storage_ != nullptr && storage_->getSampleFormat() == format) {
+    return;
+  }
+
+  expandStorage();
+  storage_ = CompactPcmStorage::create(*bus_, format);
+  bus_ = nullptr;
+  snapshot_ = nullptr;
+  exposedChannels_.clear();
+}
+
+bool AudioBuffer::hasExposedChannels() const {
+  // The bus holds one reference, any other one belongs to an exposed view.
+  return std::any_of(
+      exposedChannels_.begin(), exposedChannels_.end(), [](const auto &exposed) {
+        return exposed.use_count() > 1;
+      });
+}
+
+void AudioBuffer::expandStorage() const {
+  if (storage_ == nullptr) {
+    return;
+  }
+
+  // Source nodes already reading the storage keep their own reference.
+  bus_ = std::make_shared<AudioBus>(
+      storage_->getLength(), storage_->getNumberOfChannels(), storage_->getSampleRate());
+  for (int i = 0; i < storage_->getNumberOfChannels(); i += 1) {
+    storage_->read(i, 0, storage_->getLength(), bus_->getChannel(i)->getData());
+  }
+
+  storage_ = nullptr;
+}
+
+void AudioBuffer::detachIfShared() {
+  // Storage is shared with source nodes or other buffers, copy it before writing.
+  // Shared storage never has exposed channels, see acquireBus.
+  if (bus_.use_count() > 1) {
+    bus_ = std::make_shared<AudioBus>(*bus_);
+    exposedChannels_.clear();
+  }
 }
 
 } // namespace audioapi
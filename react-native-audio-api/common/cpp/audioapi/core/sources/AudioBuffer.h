@@ -1,6 +1,9 @@
 #pragma once
 
+#include <audioapi/core/types/PcmSampleFormat.h>
+
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <memory>
@@ -10,18 +13,45 @@
 namespace audioapi {
 
 class AudioBus;
+class AudioArray;
+class PcmStorage;
 
+/// AudioBuffer storage is reference-counted and treated as immutable once it
+/// is shared. Source nodes read it in place through acquireBus(), writes go
+/// through copy-on-write, so a buffer played by many voices is stored once.
+/// A buffer can also be backed by PcmStorage, which source nodes convert
+/// while rendering. It is expanded to float only when the channel data is
+/// requested as such.
 class AudioBuffer {
  public:
   explicit AudioBuffer(int numberOfChannels, size_t length, float sampleRate);
   explicit AudioBuffer(std::shared_ptr<AudioBus> bus);
+  explicit AudioBuffer(std::shared_ptr<PcmStorage> storage);
+  AudioBuffer(const AudioBuffer &other);
+  AudioBuffer &operator=(const AudioBuffer &other) = delete;
 
   [[nodiscard]] size_t getLength() const;
   [[nodiscard]] float getSampleRate() const;
   [[nodiscard]] double getDuration() const;
 
   [[nodiscard]] int getNumberOfChannels() const;
-  [[nodiscard]] float *getChannelData(int channel) const;
+  [[nodiscard]] const float *getChannelData(int channel) const;
+
+  /// Returns writable channel storage, e.g. to be exposed to JS as Float32Array.
+  /// Storage shared with source nodes is copied first.
+  [[nodiscard]] std::shared_ptr<AudioArray> getSharedChannel(int channel);
+
+  /// Returns storage which is never written to and can be read in place.
+  /// While channel storage is exposed through getSharedChannel, a snapshot
+  /// is returned instead. Like acquiring the content in Web Audio, writes to
+  /// channels exposed before are picked up only once they are exposed again,
+  /// written with copyToChannel or marked with markChannelsWritten.
+  /// @note Should be only used from the thread owning the buffer, which is
+  /// the JavaScript/HostObjects thread for buffers held by JS.
+  [[nodiscard]] std::shared_ptr<AudioBus> acquireBus();
+  /// Returns the PCM storage backing the buffer, nullptr while the samples
+  /// are stored as float.
+  [[nodiscard]] std::shared_ptr<PcmStorage> getPcmStorage() const;
 
   void copyFromChannel(
       float *destination,
@@ -30,13 +60,28 @@ class AudioBuffer {
       size_t startInChannel) const;
   void
   copyToChannel(const float *source, size_t sourceLength, int channelNumber, size_t startInChannel);
+  /// Marks exposed channels as written by a thread other than the owning one,
+  /// so the next acquireBus takes a new snapshot.
+  /// @note Can be used from any thread.
+  void markChannelsWritten();
+
+  /// Converts the storage to 16-bit integer or half-float samples. Channel
+  /// data exposed before is detached from the buffer.
+  void compact(PcmSampleFormat format);
 
  private:
-  friend class AudioBufferSourceNode;
-  friend class AudioBufferQueueSourceNode;
-  friend class AudioBufferHostObject;
+  // Float storage is created from the PCM storage on first access.
+  mutable std::shared_ptr<AudioBus> bus_;
+  mutable std::shared_ptr<PcmStorage> storage_;
+  std::vector<std::weak_ptr<AudioArray>> exposedChannels_;
+  // Last snapshot of exposed channels, shared by every reader since.
+  std::shared_ptr<AudioBus> snapshot_;
+  // Set whenever exposed channels may have been written since the snapshot.
+  std::atomic<bool> channelsWritten_{false};
 
-  std::shared_ptr<AudioBus> bus_;
+  [[nodiscard]] bool hasExposedChannels() const;
+  void expandStorage() const;
+  void detachIfShared();
 };
 
 } // namespace audioapi
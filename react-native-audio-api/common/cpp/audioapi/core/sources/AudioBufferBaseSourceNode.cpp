@@ -2,20 +2,30 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/AudioBufferBaseSourceNode.h>
 #include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/AudioUtils.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/CircularAudioArray.h>
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace audioapi {
 AudioBufferBaseSourceNode::AudioBufferBaseSourceNode(
     std::shared_ptr<BaseAudioContext> context,
-    bool pitchCorrection)
+    bool pitchCorrection,
+    PitchCorrectionQuality pitchCorrectionQuality)
     : AudioScheduledSourceNode(context),
       pitchCorrection_(pitchCorrection),
-      stretch_(std::make_shared<signalsmith::stretch::SignalsmithStretch<float>>()),
+      pitchCorrectionQuality_(pitchCorrectionQuality),
+      stretcherPool_(context->getStretcherPool()),
+      stretchGroup_(nullptr),
+      stretch_(nullptr),
+      stretchChannelCount_(0),
+      stretchSampleRate_(context->getSampleRate()),
       playbackRateBus_(
           std::make_shared<AudioBus>(
               RENDER_QUANTUM_SIZE * 3,
@@ -36,6 +46,10 @@ AudioBufferBaseSourceNode::AudioBufferBaseSourceNode(
       vReadIndex_(0.0),
       onPositionChangedInterval_(static_cast<int>(context->getSampleRate() * 0.1f)) {}
 
+AudioBufferBaseSourceNode::~AudioBufferBaseSourceNode() {
+  releasePitchCorrection();
+}
+
 std::shared_ptr<AudioParam> AudioBufferBaseSourceNode::getDetuneParam() const {
   return detuneParam_;
 }
@@ -63,40 +77,153 @@ int AudioBufferBaseSourceNode::getOnPositionChangedInterval() const {
   return onPositionChangedInterval_;
 }
 
+void AudioBufferBaseSourceNode::resetForReuse() {
+  AudioScheduledSourceNode::resetForReuse();
+
+  detuneParam_->reset();
+  playbackRateParam_->reset();
+  vReadIndex_ = 0.0;
+
+  setOnPositionChangedCallbackId(0);
+  onPositionChangedTime_ = 0;
+  if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    onPositionChangedInterval_ = static_cast<int>(context->getSampleRate() * 0.1f);
+  }
+}
+
 std::mutex &AudioBufferBaseSourceNode::getBufferLock() {
   return bufferLock_;
 }
 
 double AudioBufferBaseSourceNode::getInputLatency() const {
   if (pitchCorrection_) {
-    if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
-      return static_cast<double>(stretch_->inputLatency()) / context->getSampleRate();
-    } else {
-      return 0;
-    }
+    return static_cast<double>(stretchLatency_.input) / stretchSampleRate_;
   }
   return 0;
 }
 
 double AudioBufferBaseSourceNode::getOutputLatency() const {
   if (pitchCorrection_) {
-    if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
-      return static_cast<double>(stretch_->outputLatency()) / context->getSampleRate();
-    } else {
-      return 0;
-    }
+    return static_cast<double>(stretchLatency_.output) / stretchSampleRate_;
   }
   return 0;
 }
 
+void AudioBufferBaseSourceNode::initPitchCorrection(int channelCount, float sampleRate) {
+  if (!pitchCorrection_) {
+    return;
+  }
+
+  releasePitchCorrection();
+
+  stretchChannelCount_ = channelCount;
+  stretchSampleRate_ = sampleRate;
+  neutralFrames_ = 0;
+
+  // Reserve a stretcher for this node, so changing playback rate or detune
+  // does not allocate on the audio thread, even when other nodes are stretching.
+  stretchGroup_ = stretcherPool_->reserve(channelCount, sampleRate, pitchCorrectionQuality_, 1);
+  stretchLatency_ = stretchGroup_->getLatency();
+
+  auto latencyFrames = getPitchCorrectionLatencyFrames();
+  auto silence = std::vector<float>(latencyFrames, 0.0f);
+
+  bypassDelayLine_.clear();
+  for (int i = 0; i < channelCount; i += 1) {
+    auto delayLine =
+        std::make_shared<CircularAudioArray>(latencyFrames + RENDER_QUANTUM_SIZE * 3);
+    delayLine->push_back(silence.data(), latencyFrames);
+    bypassDelayLine_.emplace_back(delayLine);
+  }
+
+  stretchHistoryBus_ = std::make_shared<AudioBus>(latencyFrames, channelCount, sampleRate);
+}
+
+size_t AudioBufferBaseSourceNode::getPitchCorrectionLatencyFrames() const {
+  return static_cast<size_t>(stretchLatency_.input + stretchLatency_.output);
+}
+
+void AudioBufferBaseSourceNode::attachStretcher() {
+  if (stretch_ != nullptr || bypassDelayLine_.empty()) {
+    return;
+  }
+
+  // when every stretcher is in use, the input keeps being passed through until one is released
+  stretch_ = stretchGroup_->acquire();
+  if (stretch_ == nullptr) {
+    return;
+  }
+
+  // Prime the stretcher with the input which is still in the delay line,
+  // so its output continues from where the passthrough left off.
+  auto latencyFrames = getPitchCorrectionLatencyFrames();
+  for (int i = 0; i < stretchChannelCount_; i += 1) {
+    auto history = stretchHistoryBus_->getChannel(i)->getData();
+    bypassDelayLine_[i]->pop_front(history, latencyFrames);
+    bypassDelayLine_[i]->push_back(history, latencyFrames);
+  }
+
+  stretch_->seek(*stretchHistoryBus_, static_cast<int>(latencyFrames), 1.0);
+}
+
+void AudioBufferBaseSourceNode::detachStretcher() {
+  if (stretch_ == nullptr) {
+    return;
+  }
+
+  stretchGroup_->release(stretch_);
+  stretch_ = nullptr;
+}
+
+void AudioBufferBaseSourceNode::releasePitchCorrection() {
+  detachStretcher();
+  bypassDelayLine_.clear();
+
+  if (stretchGroup_ != nullptr) {
+    stretcherPool_->unreserve(stretchGroup_, 1);
+    stretchGroup_ = nullptr;
+  }
+}
+
+void AudioBufferBaseSourceNode::resampleWithoutStretcher(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int inputFrames,
+    int framesToProcess) {
+  auto numberOfChannels =
+      std::min(playbackRateBus_->getNumberOfChannels(), processingBus->getNumberOfChannels());
+
+  if (inputFrames <= 0) {
+    processingBus->zero();
+    return;
+  }
+
+  // Pitch follows the playback rate, as without pitch correction, but playback keeps its pace.
+  auto step = static_cast<float>(inputFrames) / static_cast<float>(framesToProcess);
+  auto lastFrame = static_cast<size_t>(inputFrames - 1);
+
+  for (int i = 0; i < numberOfChannels; i += 1) {
+    auto input = playbackRateBus_->getChannel(i)->getData();
+    auto output = processingBus->getChannel(i)->getData();
+
+    for (int j = 0; j < framesToProcess; j += 1) {
+      auto position = static_cast<float>(j) * step;
+      auto readIndex = std::min(static_cast<size_t>(position), lastFrame);
+      auto nextReadIndex = std::min(readIndex + 1, lastFrame);
+      auto factor = position - static_cast<float>(readIndex);
+
+      output[j] = dsp::linearInterpolate(input, readIndex, nextReadIndex, factor);
+    }
+  }
+}
+
 void AudioBufferBaseSourceNode::sendOnPositionChangedEvent() {
   auto onPositionChangedCallbackId = onPositionChangedCallbackId_.load(std::memory_order_acquire);
 
   if (onPositionChangedCallbackId != 0 && onPositionChangedTime_ > onPositionChangedInterval_) {
-    std::unordered_map<std::string, EventValue> body = {{"value", getCurrentPosition()}};
-
-    audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-        "positionChanged", onPositionChangedCallbackId, body);
+    audioEventHandlerRegistry_->dispatchAudioEvent(AudioEvent{
+        .type = AudioEventType::POSITION_CHANGED,
+        .listenerId = onPositionChangedCallbackId,
+        .value = getCurrentPosition()});
 
     onPositionChangedTime_ = 0;
   }
@@ -135,16 +262,52 @@ void AudioBufferBaseSourceNode::processWithPitchCorrection(
 
   if (playbackRate == 0.0f || (!isPlaying() && !isStopScheduled())) {
     processingBus->zero();
+    detachStretcher();
     return;
   }
 
   processWithoutInterpolation(playbackRateBus_, startOffset, offsetLength, playbackRate);
 
-  stretch_->process(
-      playbackRateBus_.get()[0], framesNeededToStretch, processingBus.get()[0], framesToProcess);
+  // Stretcher is kept for a while after returning to neutral settings,
+  // so automated rate or detune does not keep swapping it.
+  if (playbackRate == 1.0f && detune == 0.0f) {
+    neutralFrames_ += framesToProcess;
+  } else {
+    neutralFrames_ = 0;
+    attachStretcher();
+  }
 
-  if (detune != 0.0f) {
+  if (stretch_ != nullptr && neutralFrames_ > PITCH_CORRECTION_RELEASE_DELAY_FRAMES) {
+    detachStretcher();
+  }
+
+  auto numberOfChannels =
+      std::min(playbackRateBus_->getNumberOfChannels(), static_cast<int>(bypassDelayLine_.size()));
+
+  if (stretch_ == nullptr) {
+    // At playback rate 1 the input has exactly framesToProcess frames, otherwise every
+    // stretcher is in use and it is resampled to them.
+    if (framesNeededToStretch != framesToProcess) {
+      resampleWithoutStretcher(processingBus, framesNeededToStretch, framesToProcess);
+    }
+
+    for (int i = 0; i < numberOfChannels; i += 1) {
+      auto input = framesNeededToStretch != framesToProcess
+          ? processingBus->getChannel(i)->getData()
+          : playbackRateBus_->getChannel(i)->getData();
+      bypassDelayLine_[i]->push_back(input, framesToProcess);
+      bypassDelayLine_[i]->pop_front(processingBus->getChannel(i)->getData(), framesToProcess);
+    }
+  } else {
     stretch_->setTransposeSemitones(detune);
+    stretch_->process(*playbackRateBus_, framesNeededToStretch, *processingBus, framesToProcess);
+
+    // Keep the delay line filled with the latest input for the next passthrough.
+    for (int i = 0; i < numberOfChannels; i += 1) {
+      auto input = playbackRateBus_->getChannel(i)->getData();
+      bypassDelayLine_[i]->push_back(input, framesNeededToStretch);
+      bypassDelayLine_[i]->pop_front(input, framesNeededToStretch);
+    }
   }
 
   sendOnPositionChangedEvent();
@@ -1,22 +1,30 @@
 #pragma once
 
 #include <audioapi/core/sources/AudioScheduledSourceNode.h>
-#include <audioapi/libs/signalsmith-stretch/signalsmith-stretch.h>
+#include <audioapi/core/types/PitchCorrectionQuality.h>
+#include <audioapi/core/utils/StretcherPool.h>
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace audioapi {
 
 class AudioBus;
 class AudioParam;
+class CircularAudioArray;
 
 class AudioBufferBaseSourceNode : public AudioScheduledSourceNode {
  public:
   explicit AudioBufferBaseSourceNode(
       std::shared_ptr<BaseAudioContext> context,
-      bool pitchCorrection);
+      bool pitchCorrection,
+      PitchCorrectionQuality pitchCorrectionQuality = PitchCorrectionQuality::HIGH);
+  ~AudioBufferBaseSourceNode() override;
 
   [[nodiscard]] std::shared_ptr<AudioParam> getDetuneParam() const;
   [[nodiscard]] std::shared_ptr<AudioParam> getPlaybackRateParam() const;
@@ -27,14 +35,27 @@ class AudioBufferBaseSourceNode : public AudioScheduledSourceNode {
   [[nodiscard]] double getInputLatency() const;
   [[nodiscard]] double getOutputLatency() const;
 
+  void resetForReuse() override;
+
  protected:
   // pitch correction
   bool pitchCorrection_;
+  PitchCorrectionQuality pitchCorrectionQuality_;
 
   std::mutex bufferLock_;
 
-  // pitch correction
-  std::shared_ptr<signalsmith::stretch::SignalsmithStretch<float>> stretch_;
+  // pitch correction, the stretcher reserved in the pool is taken only while
+  // playback rate or detune deviate, otherwise the input is delayed
+  // by the stretcher latency and passed through.
+  std::shared_ptr<StretcherPool> stretcherPool_;
+  StretcherPool::Group *stretchGroup_;
+  SignalsmithStretch *stretch_;
+  StretcherPool::Latency stretchLatency_;
+  int stretchChannelCount_;
+  float stretchSampleRate_;
+  std::vector<std::shared_ptr<CircularAudioArray>> bypassDelayLine_;
+  std::shared_ptr<AudioBus> stretchHistoryBus_;
+  int neutralFrames_ = 0;
   std::shared_ptr<AudioBus> playbackRateBus_;
 
   // k-rate params
@@ -51,6 +72,10 @@ class AudioBufferBaseSourceNode : public AudioScheduledSourceNode {
   std::mutex &getBufferLock();
   virtual double getCurrentPosition() const = 0;
 
+  /// Prepares pitch correction for given channel count, must be called with the buffer lock held.
+  void initPitchCorrection(int channelCount, float sampleRate);
+  [[nodiscard]] size_t getPitchCorrectionLatencyFrames() const;
+
   void sendOnPositionChangedEvent();
 
   void processWithPitchCorrection(
@@ -62,6 +87,17 @@ class AudioBufferBaseSourceNode : public AudioScheduledSourceNode {
 
   float getComputedPlaybackRateValue(int framesToProcess, double time);
 
+  void attachStretcher();
+  void detachStretcher();
+  /// @brief Gives back the stretcher reserved for the node and drops the passthrough state.
+  /// @note Should not be used while the audio thread may process the node.
+  void releasePitchCorrection();
+  /// @brief Resamples rendered input to framesToProcess frames, when no stretcher is free.
+  void resampleWithoutStretcher(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int inputFrames,
+      int framesToProcess);
+
   virtual void processWithoutInterpolation(
       const std::shared_ptr<AudioBus> &processingBus,
       size_t startOffset,
@@ -73,6 +109,19 @@ class AudioBufferBaseSourceNode : public AudioScheduledSourceNode {
       size_t startOffset,
       size_t offsetLength,
       float playbackRate) = 0;
+
+ public:
+  static PitchCorrectionQuality pitchCorrectionQualityFromString(const std::string &quality) {
+    std::string lowerQuality = quality;
+    std::transform(lowerQuality.begin(), lowerQuality.end(), lowerQuality.begin(), ::tolower);
+
+    if (lowerQuality == "high")
+      return PitchCorrectionQuality::HIGH;
+    if (lowerQuality == "low")
+      return PitchCorrectionQuality::LOW;
+
+    throw std::invalid_argument("Unknown pitch correction quality: " + quality);
+  }
 };
 
 } // namespace audioapi
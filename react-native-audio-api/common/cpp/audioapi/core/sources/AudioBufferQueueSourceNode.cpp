@@ -2,7 +2,6 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/AudioBufferQueueSourceNode.h>
 #include <audioapi/core/utils/Constants.h>
-#include <audioapi/core/utils/Locker.h>
 #include <audioapi/dsp/AudioUtils.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
@@ -10,7 +9,7 @@
 
 #include <algorithm>
 #include <memory>
-#include <queue>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -19,29 +18,42 @@ namespace audioapi {
 
 AudioBufferQueueSourceNode::AudioBufferQueueSourceNode(
     std::shared_ptr<BaseAudioContext> context,
-    bool pitchCorrection)
-    : AudioBufferBaseSourceNode(context, pitchCorrection), buffers_() {
-  stretch_->presetDefault(channelCount_, context->getSampleRate());
+    bool pitchCorrection,
+    PitchCorrectionQuality pitchCorrectionQuality)
+    : AudioBufferBaseSourceNode(context, pitchCorrection, pitchCorrectionQuality) {
+  // Commands are drained by the audio thread at most BUFFER_QUEUE_CAPACITY at a time,
+  // released buffers can not outnumber the buffers which were ever in flight.
+  auto [commandSender, commandReceiver] = channels::spsc::channel<
+      QueueCommand,
+      BUFFER_QUEUE_SPSC_OVERFLOW_STRATEGY,
+      BUFFER_QUEUE_SPSC_WAIT_STRATEGY>(BUFFER_QUEUE_CAPACITY);
+  commandSender_ = std::move(commandSender);
+  commandReceiver_ = std::move(commandReceiver);
+
+  auto [releaseSender, releaseReceiver] = channels::spsc::channel<
+      std::shared_ptr<AudioBus>,
+      BUFFER_QUEUE_SPSC_OVERFLOW_STRATEGY,
+      BUFFER_QUEUE_SPSC_WAIT_STRATEGY>(2 * BUFFER_QUEUE_CAPACITY);
+  releaseSender_ = std::move(releaseSender);
+  releaseReceiver_ = std::move(releaseReceiver);
 
   if (pitchCorrection) {
+    initPitchCorrection(channelCount_, context->getSampleRate());
+
     // If pitch correction is enabled, add extra frames at the end
     // to compensate for processing latency.
     addExtraTailFrames_ = true;
 
-    int extraTailFrames = static_cast<int>(stretch_->inputLatency() + stretch_->outputLatency());
-    tailBuffer_ =
-        std::make_shared<AudioBuffer>(channelCount_, extraTailFrames, context->getSampleRate());
-
-    tailBuffer_->bus_->zero();
+    auto extraTailFrames = getPitchCorrectionLatencyFrames();
+    tailBus_ =
+        std::make_shared<AudioBus>(extraTailFrames, channelCount_, context->getSampleRate());
   }
 
   isInitialized_ = true;
 }
 
 AudioBufferQueueSourceNode::~AudioBufferQueueSourceNode() {
-  Locker locker(getBufferLock());
-
-  buffers_ = {};
+  removeAllBuffers();
 }
 
 void AudioBufferQueueSourceNode::stop(double when) {
@@ -58,12 +70,10 @@ void AudioBufferQueueSourceNode::start(double when) {
 void AudioBufferQueueSourceNode::start(double when, double offset) {
   start(when);
 
-  if (buffers_.empty()) {
-    return;
-  }
-
-  offset = std::min(offset, buffers_.front().second->getDuration());
-  vReadIndex_ = static_cast<double>(buffers_.front().second->getSampleRate() * offset);
+  QueueCommand command;
+  command.type = QueueCommand::Type::SET_OFFSET;
+  command.offset = offset;
+  sendCommand(std::move(command));
 }
 
 void AudioBufferQueueSourceNode::pause() {
@@ -72,43 +82,39 @@ void AudioBufferQueueSourceNode::pause() {
 }
 
 std::string AudioBufferQueueSourceNode::enqueueBuffer(const std::shared_ptr<AudioBuffer> &buffer) {
-  auto locker = Locker(getBufferLock());
-  buffers_.emplace(bufferId_, buffer);
+  releasePlayedBuffers();
+
+  // Queued buffers are read on the audio thread, keep the current content
+  // which is not affected by later writes from JS.
+  QueueCommand command;
+  command.type = QueueCommand::Type::ENQUEUE;
+  command.bufferId = bufferId_;
+  command.bus = buffer->acquireBus();
+  sendCommand(std::move(command));
 
   return std::to_string(bufferId_++);
 }
 
 void AudioBufferQueueSourceNode::dequeueBuffer(const size_t bufferId) {
-  auto locker = Locker(getBufferLock());
-  if (buffers_.empty()) {
-    return;
-  }
+  releasePlayedBuffers();
 
-  if (buffers_.front().first == bufferId) {
-    buffers_.pop();
-    vReadIndex_ = 0.0;
-    return;
-  }
-
-  // If the buffer is not at the front, we need to remove it from the queue.
-  // And keep vReadIndex_ at the same position.
-  std::queue<std::pair<size_t, std::shared_ptr<AudioBuffer>>> newQueue;
-  while (!buffers_.empty()) {
-    if (buffers_.front().first != bufferId) {
-      newQueue.push(buffers_.front());
-    }
-    buffers_.pop();
-  }
-  std::swap(buffers_, newQueue);
+  QueueCommand command;
+  command.type = QueueCommand::Type::DEQUEUE;
+  command.bufferId = bufferId;
+  sendCommand(std::move(command));
 }
 
 void AudioBufferQueueSourceNode::clearBuffers() {
-  auto locker = Locker(getBufferLock());
-  buffers_ = {};
-  vReadIndex_ = 0.0;
+  releasePlayedBuffers();
+
+  QueueCommand command;
+  command.type = QueueCommand::Type::CLEAR;
+  sendCommand(std::move(command));
 }
 
 void AudioBufferQueueSourceNode::disable() {
+  detachStretcher();
+
   if (isPaused_) {
     playbackState_ = PlaybackState::UNSCHEDULED;
     startTime_ = -1.0;
@@ -119,30 +125,45 @@ void AudioBufferQueueSourceNode::disable() {
   }
 
   AudioScheduledSourceNode::disable();
-  buffers_ = {};
+  removeAllBuffers();
+}
+
+void AudioBufferQueueSourceNode::setLowWaterMark(double lowWaterMark) {
+  lowWaterMark_.store(std::max(lowWaterMark, 0.0), std::memory_order_release);
+}
+
+double AudioBufferQueueSourceNode::getLowWaterMark() const {
+  return lowWaterMark_.load(std::memory_order_acquire);
+}
+
+void AudioBufferQueueSourceNode::setOnBufferQueueLowCallbackId(uint64_t callbackId) {
+  auto oldCallbackId = onBufferQueueLowCallbackId_.exchange(callbackId, std::memory_order_acq_rel);
+
+  if (oldCallbackId != 0) {
+    audioEventHandlerRegistry_->unregisterHandler("bufferQueueLow", oldCallbackId);
+  }
 }
 
 std::shared_ptr<AudioBus> AudioBufferQueueSourceNode::processNode(
     const std::shared_ptr<AudioBus> &processingBus,
     int framesToProcess) {
-  if (auto locker = Locker::tryLock(getBufferLock())) {
-    // no audio data to fill, zero the output and return.
-    if (buffers_.empty()) {
-      processingBus->zero();
-      return processingBus;
-    }
+  processCommands();
 
-    if (!pitchCorrection_) {
-      processWithoutPitchCorrection(processingBus, framesToProcess);
-    } else {
-      processWithPitchCorrection(processingBus, framesToProcess);
-    }
+  // no audio data to fill, zero the output and return.
+  if (buffers_.isEmpty()) {
+    processingBus->zero();
+    return processingBus;
+  }
 
-    handleStopScheduled();
+  if (!pitchCorrection_) {
+    processWithoutPitchCorrection(processingBus, framesToProcess);
   } else {
-    processingBus->zero();
+    processWithPitchCorrection(processingBus, framesToProcess);
   }
 
+  sendOnBufferQueueLowEvent();
+  handleStopScheduled();
+
   return processingBus;
 }
 
@@ -155,10 +176,199 @@ double AudioBufferQueueSourceNode::getCurrentPosition() const {
   }
 }
 
+void AudioBufferQueueSourceNode::updatePlaybackSnapshot(PlaybackSnapshot &snapshot) {
+  snapshot.position = getCurrentPosition();
+  snapshot.bufferedDuration = getQueuedDuration();
+}
+
 /**
  * Helper functions
  */
 
+void AudioBufferQueueSourceNode::sendCommand(QueueCommand &&command) {
+  if (commandSender_.try_send(std::move(command)) != channels::spsc::ResponseStatus::SUCCESS) {
+    throw std::runtime_error(
+        "Too many pending buffer queue operations, at most " +
+        std::to_string(BUFFER_QUEUE_CAPACITY) + " can wait for the audio thread.");
+  }
+}
+
+void AudioBufferQueueSourceNode::releasePlayedBuffers() {
+  std::shared_ptr<AudioBus> bus;
+  while (releaseReceiver_.try_receive(bus) == channels::spsc::ResponseStatus::SUCCESS) {
+    bus.reset();
+  }
+}
+
+void AudioBufferQueueSourceNode::processCommands() {
+  if (hasPendingCommand_) {
+    if (!applyCommand(pendingCommand_)) {
+      return;
+    }
+
+    hasPendingCommand_ = false;
+  }
+
+  QueueCommand command;
+  while (commandReceiver_.try_receive(command) == channels::spsc::ResponseStatus::SUCCESS) {
+    if (!applyCommand(command)) {
+      // the queue is full, keep the command until some buffer is played
+      pendingCommand_ = std::move(command);
+      hasPendingCommand_ = true;
+      return;
+    }
+  }
+}
+
+bool AudioBufferQueueSourceNode::applyCommand(QueueCommand &command) {
+  switch (command.type) {
+    case QueueCommand::Type::ENQUEUE:
+      if (buffers_.isFull()) {
+        return false;
+      }
+
+      queuedFrames_ += command.bus->getSize();
+      buffers_.pushBack(QueuedBuffer{command.bufferId, std::move(command.bus)});
+      break;
+    case QueueCommand::Type::DEQUEUE:
+      removeBuffer(command.bufferId);
+      break;
+    case QueueCommand::Type::CLEAR:
+      removeAllBuffers();
+      break;
+    case QueueCommand::Type::SET_OFFSET:
+      if (!buffers_.isEmpty()) {
+        const auto &bus = buffers_.peekFront().bus;
+        auto duration = static_cast<double>(bus->getSize()) / bus->getSampleRate();
+        vReadIndex_ = static_cast<double>(bus->getSampleRate()) * std::min(command.offset, duration);
+      }
+      break;
+  }
+
+  return true;
+}
+
+void AudioBufferQueueSourceNode::removeBuffer(size_t bufferId) {
+  if (buffers_.isEmpty()) {
+    return;
+  }
+
+  QueuedBuffer buffer;
+
+  if (buffers_.peekFront().id == bufferId) {
+    buffers_.popFront(buffer);
+    queuedFrames_ -= buffer.bus->getSize();
+    releaseBuffer(std::move(buffer.bus));
+    vReadIndex_ = 0.0;
+    return;
+  }
+
+  // If the buffer is not at the front, rotate the queue once to remove it
+  // and keep vReadIndex_ at the same position.
+  auto size = buffers_.size();
+  for (size_t i = 0; i < size; i += 1) {
+    buffers_.popFront(buffer);
+
+    if (buffer.id == bufferId) {
+      queuedFrames_ -= buffer.bus->getSize();
+      releaseBuffer(std::move(buffer.bus));
+    } else {
+      buffers_.pushBack(std::move(buffer));
+    }
+  }
+}
+
+void AudioBufferQueueSourceNode::removeAllBuffers() {
+  QueuedBuffer buffer;
+  while (buffers_.popFront(buffer)) {
+    releaseBuffer(std::move(buffer.bus));
+  }
+
+  queuedFrames_ = 0;
+  vReadIndex_ = 0.0;
+}
+
+void AudioBufferQueueSourceNode::releaseBuffer(std::shared_ptr<AudioBus> &&bus) {
+  // Buffers still owned by JS are dropped right away, so that JS can refill
+  // them in place. Last references are handed over to the JS thread.
+  if (bus.use_count() == 1 && releaseSender_.try_send(std::move(bus)) ==
+          channels::spsc::ResponseStatus::SUCCESS) {
+    return;
+  }
+
+  bus.reset();
+}
+
+void AudioBufferQueueSourceNode::finishFrontBuffer() {
+  QueuedBuffer buffer;
+  buffers_.popFront(buffer);
+
+  // tail frames are internal, they are not reported to the user
+  if (buffer.id == TAIL_BUFFER_ID) {
+    return;
+  }
+
+  queuedFrames_ -= buffer.bus->getSize();
+  playedBuffersDuration_ +=
+      static_cast<double>(buffer.bus->getSize()) / buffer.bus->getSampleRate();
+  releaseBuffer(std::move(buffer.bus));
+
+  if (buffers_.isEmpty() && addExtraTailFrames_) {
+    buffers_.pushBack(QueuedBuffer{TAIL_BUFFER_ID, tailBus_});
+    addExtraTailFrames_ = false;
+  }
+
+  auto onEndedCallbackId = onEndedCallbackId_.load(std::memory_order_acquire);
+  if (onEndedCallbackId == 0) {
+    return;
+  }
+
+  bool isLast = buffers_.isEmpty() || buffers_.peekFront().id == TAIL_BUFFER_ID;
+  audioEventHandlerRegistry_->dispatchAudioEvent(AudioEvent{
+      .type = AudioEventType::ENDED,
+      .listenerId = onEndedCallbackId,
+      .hasBufferId = true,
+      .bufferId = buffer.id,
+      .isLast = isLast});
+}
+
+void AudioBufferQueueSourceNode::sendOnBufferQueueLowEvent() {
+  auto callbackId = onBufferQueueLowCallbackId_.load(std::memory_order_acquire);
+  auto lowWaterMark = lowWaterMark_.load(std::memory_order_acquire);
+
+  if (callbackId == 0 || lowWaterMark <= 0.0) {
+    return;
+  }
+
+  auto queuedDuration = getQueuedDuration();
+
+  // The event is edge triggered, it is sent again only after the queue
+  // has been refilled above the low water mark.
+  if (queuedDuration >= lowWaterMark) {
+    isQueueLow_ = false;
+    return;
+  }
+
+  if (isQueueLow_) {
+    return;
+  }
+
+  isQueueLow_ = true;
+  audioEventHandlerRegistry_->dispatchAudioEvent(AudioEvent{
+      .type = AudioEventType::BUFFER_QUEUE_LOW, .listenerId = callbackId, .value = queuedDuration});
+}
+
+double AudioBufferQueueSourceNode::getQueuedDuration() const {
+  auto sampleRate = static_cast<double>(buffers_.isEmpty()
+      ? audioBus_->getSampleRate()
+      : buffers_.peekFront().bus->getSampleRate());
+  auto playedFrames = buffers_.isEmpty() || buffers_.peekFront().id == TAIL_BUFFER_ID
+      ? 0.0
+      : vReadIndex_;
+
+  return std::max(static_cast<double>(queuedFrames_) - playedFrames, 0.0) / sampleRate;
+}
+
 void AudioBufferQueueSourceNode::processWithoutInterpolation(
     const std::shared_ptr<AudioBus> &processingBus,
     size_t startOffset,
@@ -166,58 +376,31 @@ void AudioBufferQueueSourceNode::processWithoutInterpolation(
     float playbackRate) {
   auto readIndex = static_cast<size_t>(vReadIndex_);
   size_t writeIndex = startOffset;
-
-  auto data = buffers_.front();
-  auto bufferId = data.first;
-  auto buffer = data.second;
-
   size_t framesLeft = offsetLength;
 
   while (framesLeft > 0) {
-    size_t framesToEnd = buffer->getLength() - readIndex;
+    const auto &bus = buffers_.peekFront().bus;
+
+    size_t framesToEnd = bus->getSize() - readIndex;
     size_t framesToCopy = std::min(framesToEnd, framesLeft);
-    framesToCopy = framesToCopy > 0 ? framesToCopy : 0;
 
-    assert(readIndex >= 0);
-    assert(writeIndex >= 0);
-    assert(readIndex + framesToCopy <= buffer->getLength());
+    assert(readIndex + framesToCopy <= bus->getSize());
     assert(writeIndex + framesToCopy <= processingBus->getSize());
 
-    processingBus->copy(buffer->bus_.get(), readIndex, writeIndex, framesToCopy);
+    processingBus->copy(bus.get(), readIndex, writeIndex, framesToCopy);
 
     writeIndex += framesToCopy;
     readIndex += framesToCopy;
     framesLeft -= framesToCopy;
 
-    if (readIndex >= buffer->getLength()) {
-      playedBuffersDuration_ += buffer->getDuration();
-      buffers_.pop();
-
-      std::unordered_map<std::string, EventValue> body = {
-          {"bufferId", std::to_string(bufferId)}, {"isLast", buffers_.empty()}};
-      if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
-        context->audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-            "ended", onEndedCallbackId_, body);
-      }
-
-      if (buffers_.empty()) {
-        if (addExtraTailFrames_) {
-          buffers_.emplace(bufferId_, tailBuffer_);
-          bufferId_++;
-
-          addExtraTailFrames_ = false;
-        } else if (buffers_.empty()) {
-          processingBus->zero(writeIndex, framesLeft);
-          readIndex = 0;
+    if (readIndex >= bus->getSize()) {
+      finishFrontBuffer();
+      readIndex = 0;
 
-          break;
-        }
+      if (buffers_.isEmpty()) {
+        processingBus->zero(writeIndex, framesLeft);
+        break;
       }
-
-      data = buffers_.front();
-      bufferId = data.first;
-      buffer = data.second;
-      readIndex = 0;
     }
   }
 
@@ -233,25 +416,18 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
   size_t writeIndex = startOffset;
   size_t framesLeft = offsetLength;
 
-  auto data = buffers_.front();
-  auto bufferId = data.first;
-  auto buffer = data.second;
-
   while (framesLeft > 0) {
+    const auto &bus = buffers_.peekFront().bus;
+    const AudioBus *nextBus = bus.get();
+
     auto readIndex = static_cast<size_t>(vReadIndex_);
     size_t nextReadIndex = readIndex + 1;
     auto factor = static_cast<float>(vReadIndex_ - static_cast<double>(readIndex));
 
-    bool crossBufferInterpolation = false;
-    std::shared_ptr<AudioBuffer> nextBuffer = nullptr;
-
-    if (nextReadIndex >= buffer->getLength()) {
+    if (nextReadIndex >= bus->getSize()) {
       if (buffers_.size() > 1) {
-        auto tempQueue = buffers_;
-        tempQueue.pop();
-        nextBuffer = tempQueue.front().second;
+        nextBus = buffers_.peekAt(1).bus.get();
         nextReadIndex = 0;
-        crossBufferInterpolation = true;
       } else {
         nextReadIndex = readIndex;
       }
@@ -259,17 +435,9 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
 
     for (int i = 0; i < processingBus->getNumberOfChannels(); i += 1) {
       float *destination = processingBus->getChannel(i)->getData();
-      const float *currentSource = buffer->bus_->getChannel(i)->getData();
-
-      if (crossBufferInterpolation) {
-        const float *nextSource = nextBuffer->bus_->getChannel(i)->getData();
-        float currentSample = currentSource[readIndex];
-        float nextSample = nextSource[nextReadIndex];
-        destination[writeIndex] = currentSample + factor * (nextSample - currentSample);
-      } else {
-        destination[writeIndex] =
-            dsp::linearInterpolate(currentSource, readIndex, nextReadIndex, factor);
-      }
+      float currentSample = bus->getChannel(i)->getData()[readIndex];
+      float nextSample = nextBus->getChannel(i)->getData()[nextReadIndex];
+      destination[writeIndex] = currentSample + factor * (nextSample - currentSample);
     }
 
     writeIndex += 1;
@@ -277,26 +445,16 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
     vReadIndex_ += std::abs(playbackRate);
     framesLeft -= 1;
 
-    if (vReadIndex_ >= static_cast<double>(buffer->getLength())) {
-      playedBuffersDuration_ += buffer->getDuration();
-      buffers_.pop();
-
-      std::unordered_map<std::string, EventValue> body = {{"bufferId", std::to_string(bufferId)}};
-      if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
-        context->audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-            "ended", onEndedCallbackId_, body);
-      }
+    auto length = static_cast<double>(bus->getSize());
+    if (vReadIndex_ >= length) {
+      vReadIndex_ -= length;
+      finishFrontBuffer();
 
-      if (buffers_.empty()) {
+      if (buffers_.isEmpty()) {
         processingBus->zero(writeIndex, framesLeft);
         vReadIndex_ = 0.0;
         break;
       }
-
-      vReadIndex_ = vReadIndex_ - buffer->getLength();
-      data = buffers_.front();
-      bufferId = data.first;
-      buffer = data.second;
     }
   }
 }
@@ -2,12 +2,14 @@
 
 #include <audioapi/core/sources/AudioBuffer.h>
 #include <audioapi/core/sources/AudioBufferBaseSourceNode.h>
-#include <audioapi/libs/signalsmith-stretch/signalsmith-stretch.h>
+#include <audioapi/utils/RingBiDirectionalBuffer.hpp>
+#include <audioapi/utils/SpscChannel.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <limits>
 #include <memory>
-#include <queue>
 #include <string>
 
 namespace audioapi {
@@ -15,11 +17,21 @@ namespace audioapi {
 class AudioBus;
 class AudioParam;
 
+// Maximal number of buffers held by the audio thread, further enqueued
+// buffers wait in the command channel.
+static constexpr size_t BUFFER_QUEUE_CAPACITY = 1024;
+
+static constexpr channels::spsc::OverflowStrategy BUFFER_QUEUE_SPSC_OVERFLOW_STRATEGY =
+    channels::spsc::OverflowStrategy::WAIT_ON_FULL;
+static constexpr channels::spsc::WaitStrategy BUFFER_QUEUE_SPSC_WAIT_STRATEGY =
+    channels::spsc::WaitStrategy::BUSY_LOOP;
+
 class AudioBufferQueueSourceNode : public AudioBufferBaseSourceNode {
  public:
   explicit AudioBufferQueueSourceNode(
       std::shared_ptr<BaseAudioContext> context,
-      bool pitchCorrection);
+      bool pitchCorrection,
+      PitchCorrectionQuality pitchCorrectionQuality = PitchCorrectionQuality::HIGH);
   ~AudioBufferQueueSourceNode() override;
 
   void stop(double when) override;
@@ -33,23 +45,86 @@ class AudioBufferQueueSourceNode : public AudioBufferBaseSourceNode {
   void clearBuffers();
   void disable() override;
 
+  void setLowWaterMark(double lowWaterMark);
+  [[nodiscard]] double getLowWaterMark() const;
+  void setOnBufferQueueLowCallbackId(uint64_t callbackId);
+
  protected:
   std::shared_ptr<AudioBus> processNode(
       const std::shared_ptr<AudioBus> &processingBus,
       int framesToProcess) override;
   double getCurrentPosition() const override;
+  void updatePlaybackSnapshot(PlaybackSnapshot &snapshot) override;
 
  private:
-  // User provided buffers
-  std::queue<std::pair<size_t, std::shared_ptr<AudioBuffer>>> buffers_;
+  struct QueuedBuffer {
+    size_t id = 0;
+    std::shared_ptr<AudioBus> bus;
+  };
+
+  struct QueueCommand {
+    enum class Type { ENQUEUE, DEQUEUE, CLEAR, SET_OFFSET };
+
+    Type type = Type::ENQUEUE;
+    size_t bufferId = 0;
+    std::shared_ptr<AudioBus> bus;
+    double offset = 0.0;
+  };
+
+  static constexpr size_t TAIL_BUFFER_ID = std::numeric_limits<size_t>::max();
+
+  // JS thread -> audio thread, every change of the queue goes through
+  // the channel so that neither side ever blocks.
+  channels::spsc::
+      Sender<QueueCommand, BUFFER_QUEUE_SPSC_OVERFLOW_STRATEGY, BUFFER_QUEUE_SPSC_WAIT_STRATEGY>
+          commandSender_;
+  channels::spsc::
+      Receiver<QueueCommand, BUFFER_QUEUE_SPSC_OVERFLOW_STRATEGY, BUFFER_QUEUE_SPSC_WAIT_STRATEGY>
+          commandReceiver_;
+  // audio thread -> JS thread, played buffers which are not referenced
+  // anywhere else are released on the JS thread.
+  channels::spsc::Sender<
+      std::shared_ptr<AudioBus>,
+      BUFFER_QUEUE_SPSC_OVERFLOW_STRATEGY,
+      BUFFER_QUEUE_SPSC_WAIT_STRATEGY>
+      releaseSender_;
+  channels::spsc::Receiver<
+      std::shared_ptr<AudioBus>,
+      BUFFER_QUEUE_SPSC_OVERFLOW_STRATEGY,
+      BUFFER_QUEUE_SPSC_WAIT_STRATEGY>
+      releaseReceiver_;
+
+  // audio thread only
+  RingBiDirectionalBuffer<QueuedBuffer, BUFFER_QUEUE_CAPACITY> buffers_;
+  QueueCommand pendingCommand_;
+  bool hasPendingCommand_ = false;
+  size_t queuedFrames_ = 0;
+  bool isQueueLow_ = false;
+
   size_t bufferId_ = 0;
 
   bool isPaused_ = false;
   bool addExtraTailFrames_ = false;
-  std::shared_ptr<AudioBuffer> tailBuffer_;
+  std::shared_ptr<AudioBus> tailBus_;
 
   double playedBuffersDuration_ = 0;
 
+  std::atomic<double> lowWaterMark_ = 0.0;
+  std::atomic<uint64_t> onBufferQueueLowCallbackId_ = 0; // 0 means no callback
+
+  void sendCommand(QueueCommand &&command);
+  void releasePlayedBuffers();
+
+  void processCommands();
+  bool applyCommand(QueueCommand &command);
+  void removeBuffer(size_t bufferId);
+  void removeAllBuffers();
+  void releaseBuffer(std::shared_ptr<AudioBus> &&bus);
+  void finishFrontBuffer();
+  void sendOnBufferQueueLowEvent();
+  /// Duration of the queued audio which has not been played yet, in seconds.
+  [[nodiscard]] double getQueuedDuration() const;
+
   void processWithoutInterpolation(
       const std::shared_ptr<AudioBus> &processingBus,
       size_t startOffset,
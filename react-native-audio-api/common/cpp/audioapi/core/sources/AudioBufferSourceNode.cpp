@@ -3,25 +3,41 @@
 #include <audioapi/core/sources/AudioBufferSourceNode.h>
 #include <audioapi/core/utils/Constants.h>
 #include <audioapi/core/utils/Locker.h>
+#include <audioapi/core/utils/PcmReadAhead.h>
+#include <audioapi/core/utils/PcmStorage.h>
 #include <audioapi/dsp/AudioUtils.h>
+#include <audioapi/dsp/Interpolation.h>
+#include <audioapi/dsp/VectorMath.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <memory>
+#include <string>
 
 namespace audioapi {
 
 AudioBufferSourceNode::AudioBufferSourceNode(
     std::shared_ptr<BaseAudioContext> context,
-    bool pitchCorrection)
-    : AudioBufferBaseSourceNode(context, pitchCorrection),
+    bool pitchCorrection,
+    PitchCorrectionQuality pitchCorrectionQuality)
+    : AudioBufferBaseSourceNode(context, pitchCorrection, pitchCorrectionQuality),
       loop_(false),
       loopSkip_(false),
       loopStart_(0),
       loopEnd_(0),
       buffer_(nullptr),
-      alignedBus_(nullptr) {
+      bufferBus_(nullptr),
+      bufferStorage_(nullptr),
+      readAhead_(nullptr),
+      readAheadStart_(0),
+      readAheadEnd_(0),
+      tailFrames_(0),
+      interpolation_(InterpolationType::LINEAR),
+      readIndices_(RENDER_QUANTUM_SIZE),
+      readFractions_(RENDER_QUANTUM_SIZE) {
   isInitialized_ = true;
 }
 
@@ -29,7 +45,8 @@ AudioBufferSourceNode::~AudioBufferSourceNode() {
   Locker locker(getBufferLock());
 
   buffer_.reset();
-  alignedBus_.reset();
+  bufferBus_.reset();
+  bufferStorage_.reset();
 }
 
 bool AudioBufferSourceNode::getLoop() const {
@@ -52,6 +69,17 @@ std::shared_ptr<AudioBuffer> AudioBufferSourceNode::getBuffer() const {
   return buffer_;
 }
 
+std::string AudioBufferSourceNode::getInterpolation() const {
+  return AudioBufferSourceNode::interpolationToString(interpolation_);
+}
+
+void AudioBufferSourceNode::setInterpolation(const std::string &interpolation) {
+  auto type = AudioBufferSourceNode::interpolationFromString(interpolation);
+  // kernel tables are built here, not on the first render quantum.
+  dsp::prepareInterpolation(type);
+  interpolation_ = type;
+}
+
 void AudioBufferSourceNode::setLoop(bool loop) {
   loop_ = loop;
 }
@@ -79,32 +107,40 @@ void AudioBufferSourceNode::setBuffer(const std::shared_ptr<AudioBuffer> &buffer
 
   if (buffer == nullptr || context == nullptr) {
     buffer_ = std::shared_ptr<AudioBuffer>(nullptr);
-    alignedBus_ = std::shared_ptr<AudioBus>(nullptr);
+    bufferBus_ = std::shared_ptr<AudioBus>(nullptr);
+    bufferStorage_ = std::shared_ptr<PcmStorage>(nullptr);
+    tailFrames_ = 0;
     loopEnd_ = 0;
+    releasePitchCorrection();
     return;
   }
 
   buffer_ = buffer;
+  bufferStorage_ = buffer_->getPcmStorage();
+  bufferBus_ = bufferStorage_ == nullptr ? buffer_->acquireBus() : nullptr;
+  if (bufferStorage_ != nullptr && readAhead_ == nullptr) {
+    readAhead_ = context->getPcmReadAhead();
+  }
+  readAheadStart_ = 0;
+  readAheadEnd_ = 0;
   channelCount_ = buffer_->getNumberOfChannels();
 
-  stretch_->presetDefault(channelCount_, buffer_->getSampleRate());
-
-  if (pitchCorrection_) {
-    int extraTailFrames =
-        static_cast<int>((getInputLatency() + getOutputLatency()) * context->getSampleRate());
-    size_t totalSize = buffer_->getLength() + extraTailFrames;
+  if (bufferStorage_ != nullptr && taps_.empty()) {
+    tapIndices_.resize(RENDER_QUANTUM_SIZE * MAX_INTERPOLATION_TAPS);
+    tapReadIndices_.resize(RENDER_QUANTUM_SIZE);
+    taps_.resize(RENDER_QUANTUM_SIZE * MAX_INTERPOLATION_TAPS);
+  }
 
-    alignedBus_ = std::make_shared<AudioBus>(totalSize, channelCount_, buffer_->getSampleRate());
-    alignedBus_->copy(buffer_->bus_.get(), 0, 0, buffer_->getLength());
+  initPitchCorrection(channelCount_, context->getSampleRate());
+  tailFrames_ = pitchCorrection_ ? getPitchCorrectionLatencyFrames() : 0;
 
-    alignedBus_->zero(buffer_->getLength(), extraTailFrames);
-  } else {
-    alignedBus_ = std::make_shared<AudioBus>(*buffer_->bus_);
+  // recycled nodes keep their buses while the channel count does not change
+  if (audioBus_->getNumberOfChannels() != channelCount_) {
+    audioBus_ =
+        std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
+    playbackRateBus_ = std::make_shared<AudioBus>(
+        RENDER_QUANTUM_SIZE * 3, channelCount_, context->getSampleRate());
   }
-  audioBus_ =
-      std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
-  playbackRateBus_ = std::make_shared<AudioBus>(
-      RENDER_QUANTUM_SIZE * 3, channelCount_, context->getSampleRate());
 
   loopEnd_ = buffer_->getDuration();
 }
@@ -116,23 +152,36 @@ void AudioBufferSourceNode::start(double when, double offset, double duration) {
     AudioScheduledSourceNode::stop(when + duration);
   }
 
-  if (!alignedBus_) {
+  if (!hasBufferData()) {
     return;
   }
 
-  offset =
-      std::min(offset, static_cast<double>(alignedBus_->getSize()) / alignedBus_->getSampleRate());
+  offset = std::min(offset, buffer_->getDuration());
 
   if (loop_) {
     offset = std::min(offset, loopEnd_);
   }
 
-  vReadIndex_ = static_cast<double>(alignedBus_->getSampleRate() * offset);
+  vReadIndex_ = static_cast<double>(buffer_->getSampleRate() * offset);
+
+  if (bufferStorage_ != nullptr) {
+    // the first window is loaded right away, the audio thread requests the next ones
+    prefetchAt(static_cast<size_t>(vReadIndex_));
+  }
+}
+
+void AudioBufferSourceNode::prefetchAt(size_t readIndex) {
+  auto window = static_cast<size_t>(buffer_->getSampleRate() * READ_AHEAD_DURATION);
+  readAheadStart_ = readIndex;
+  readAheadEnd_ = readIndex + window;
+  bufferStorage_->prefetch(readAheadStart_, window);
 }
 
 void AudioBufferSourceNode::disable() {
   AudioScheduledSourceNode::disable();
-  alignedBus_.reset();
+  bufferBus_.reset();
+  bufferStorage_.reset();
+  detachStretcher();
 }
 
 void AudioBufferSourceNode::setOnLoopEndedCallbackId(uint64_t callbackId) {
@@ -143,12 +192,30 @@ void AudioBufferSourceNode::setOnLoopEndedCallbackId(uint64_t callbackId) {
   }
 }
 
+bool AudioBufferSourceNode::canBeRecycled() const {
+  // pitch correction keeps delay lines sized for the buffer, so such nodes are not reused
+  return !pitchCorrection_ && outputParams_.empty() && detuneParam_.use_count() == 1 &&
+      playbackRateParam_.use_count() == 1;
+}
+
+void AudioBufferSourceNode::resetForReuse() {
+  AudioBufferBaseSourceNode::resetForReuse();
+
+  setBuffer(nullptr);
+  loop_ = false;
+  loopSkip_ = false;
+  loopStart_ = 0;
+  loopEnd_ = 0;
+  interpolation_ = InterpolationType::LINEAR;
+  setOnLoopEndedCallbackId(0);
+}
+
 std::shared_ptr<AudioBus> AudioBufferSourceNode::processNode(
     const std::shared_ptr<AudioBus> &processingBus,
     int framesToProcess) {
   if (auto locker = Locker::tryLock(getBufferLock())) {
     // No audio data to fill, zero the output and return.
-    if (!alignedBus_) {
+    if (!hasBufferData()) {
       processingBus->zero();
       return processingBus;
     }
@@ -171,10 +238,24 @@ double AudioBufferSourceNode::getCurrentPosition() const {
   return dsp::sampleFrameToTime(static_cast<int>(vReadIndex_), buffer_->getSampleRate());
 }
 
+void AudioBufferSourceNode::updatePlaybackSnapshot(PlaybackSnapshot &snapshot) {
+  // the buffer may be replaced from the JS thread, the previous values are kept meanwhile
+  if (auto locker = Locker::tryLock(getBufferLock())) {
+    if (!hasBufferData()) {
+      return;
+    }
+
+    auto remainingFrames = std::max(static_cast<double>(getBufferLength()) - vReadIndex_, 0.0);
+    snapshot.position = getCurrentPosition();
+    snapshot.bufferedDuration = remainingFrames / buffer_->getSampleRate();
+  }
+}
+
 void AudioBufferSourceNode::sendOnLoopEndedEvent() {
   auto onLoopEndedCallbackId = onLoopEndedCallbackId_.load(std::memory_order_acquire);
   if (onLoopEndedCallbackId != 0) {
-    audioEventHandlerRegistry_->invokeHandlerWithEventBody("loopEnded", onLoopEndedCallbackId, {});
+    audioEventHandlerRegistry_->dispatchAudioEvent(
+        AudioEvent{.type = AudioEventType::LOOP_ENDED, .listenerId = onLoopEndedCallbackId});
   }
 }
 
@@ -182,12 +263,54 @@ void AudioBufferSourceNode::sendOnLoopEndedEvent() {
  * Helper functions
  */
 
+void AudioBufferSourceNode::readAhead(float playbackRate) {
+  if (bufferStorage_ == nullptr || readAhead_ == nullptr) {
+    return;
+  }
+
+  auto window = static_cast<size_t>(
+      buffer_->getSampleRate() * std::max(std::fabs(playbackRate), 1.0f) * READ_AHEAD_DURATION);
+  auto length = getBufferLength();
+  auto readIndex = std::min(static_cast<size_t>(vReadIndex_), length);
+  bool reverse = playbackRate < 0.0f;
+
+  // a new window is requested once the play head leaves the loaded one or gets within
+  // half a window of its edge, so reading never waits for storage
+  if (readIndex >= readAheadStart_ && readIndex < readAheadEnd_) {
+    auto framesAhead = reverse ? readIndex - readAheadStart_ : readAheadEnd_ - readIndex;
+    auto isAtEdge = reverse ? readAheadStart_ == 0 : readAheadEnd_ >= length;
+    if (isAtEdge || framesAhead >= window / 2) {
+      return;
+    }
+  }
+
+  readAheadStart_ = reverse ? readIndex - std::min(readIndex, window) : readIndex;
+  readAheadEnd_ = reverse ? readIndex + 1 : readIndex + window;
+  readAhead_->request(bufferStorage_, readAheadStart_, readAheadEnd_ - readAheadStart_);
+
+  if (!loop_) {
+    return;
+  }
+
+  // the play head wraps around the loop within the window
+  auto sampleRate = buffer_->getSampleRate();
+  auto frameStart = static_cast<size_t>(getVirtualStartFrame(sampleRate));
+  auto frameEnd = static_cast<size_t>(getVirtualEndFrame(sampleRate));
+  if (!reverse && readAheadEnd_ > frameEnd) {
+    readAhead_->request(bufferStorage_, frameStart, window);
+  } else if (reverse && readAheadStart_ < frameStart) {
+    readAhead_->request(bufferStorage_, frameEnd - std::min(frameEnd, window), window);
+  }
+}
+
 void AudioBufferSourceNode::processWithoutInterpolation(
     const std::shared_ptr<AudioBus> &processingBus,
     size_t startOffset,
     size_t offsetLength,
     float playbackRate) {
-  size_t direction = playbackRate < 0.0f ? -1 : 1;
+  readAhead(playbackRate);
+
+  bool reverse = playbackRate < 0.0f;
 
   auto readIndex = static_cast<size_t>(vReadIndex_);
   size_t writeIndex = startOffset;
@@ -207,65 +330,124 @@ void AudioBufferSourceNode::processWithoutInterpolation(
 
   // if we are moving towards loop, we do nothing because we will achieve it
   // otherwise, we wrap to the start of the loop if necessary
-  if (loop_ &&
-      ((readIndex >= frameEnd && direction == 1) || (readIndex < frameStart && direction == -1))) {
-    readIndex = frameStart +
-        (static_cast<int64_t>(readIndex) - static_cast<int64_t>(frameStart)) % frameDelta;
+  if (loop_ && frameDelta > 0 &&
+      ((readIndex >= frameEnd && !reverse) || (readIndex < frameStart && reverse))) {
+    auto offset = (static_cast<int64_t>(readIndex) - static_cast<int64_t>(frameStart)) %
+        static_cast<int64_t>(frameDelta);
+    readIndex = frameStart + (offset + static_cast<int64_t>(frameDelta)) % frameDelta;
+  }
+
+  // reading backwards starts at the last frame of the range at most
+  if (reverse && readIndex >= frameEnd) {
+    readIndex = frameEnd - 1;
   }
 
   while (framesLeft > 0) {
-    size_t framesToEnd = frameEnd - readIndex;
-    size_t framesToCopy = std::min(framesToEnd, framesLeft);
-    framesToCopy = framesToCopy > 0 ? framesToCopy : 0;
+    size_t framesToEdge;
+    if (reverse) {
+      framesToEdge =
+          readIndex >= frameStart && frameEnd > frameStart ? readIndex - frameStart + 1 : 0;
+    } else {
+      framesToEdge = readIndex < frameEnd ? frameEnd - readIndex : 0;
+    }
+    size_t framesToCopy = std::min(framesToEdge, framesLeft);
 
-    assert(readIndex >= 0);
-    assert(writeIndex >= 0);
-    assert(readIndex + framesToCopy <= alignedBus_->getSize());
     assert(writeIndex + framesToCopy <= processingBus->getSize());
 
-    // Direction is forward, we can normally copy the data
-    if (direction == 1) {
-      processingBus->copy(alignedBus_.get(), readIndex, writeIndex, framesToCopy);
-    } else {
-      for (int i = 0; i < framesToCopy; i += 1) {
-        for (int j = 0; j < processingBus->getNumberOfChannels(); j += 1) {
-          (*processingBus->getChannel(j))[writeIndex + i] =
-              (*alignedBus_->getChannel(j))[readIndex - i];
-        }
-      }
-    }
+    copyFromBuffer(processingBus, readIndex, writeIndex, framesToCopy, reverse);
 
     writeIndex += framesToCopy;
-    readIndex += framesToCopy * direction;
     framesLeft -= framesToCopy;
 
-    // if we are moving towards loop, we do nothing because we will achieve it
-    // otherwise, we wrap to the start of the loop if necessary
-    if ((readIndex >= frameEnd && direction == 1) || (readIndex < frameStart && direction == -1)) {
-      readIndex -= direction * frameDelta;
+    if (framesToCopy < framesToEdge) {
+      readIndex = reverse ? readIndex - framesToCopy : readIndex + framesToCopy;
+      continue;
+    }
 
-      if (!loop_) {
-        processingBus->zero(writeIndex, framesLeft);
-        playbackState_ = PlaybackState::STOP_SCHEDULED;
-        break;
-      }
+    // we reached the edge of the range, wrap to the other side of the loop
+    readIndex = reverse ? frameEnd - 1 : frameStart;
 
-      sendOnLoopEndedEvent();
+    if (!loop_ || frameDelta == 0) {
+      processingBus->zero(writeIndex, framesLeft);
+      playbackState_ = PlaybackState::STOP_SCHEDULED;
+      break;
     }
+
+    sendOnLoopEndedEvent();
   }
 
   // update reading index for next render quantum
   vReadIndex_ = static_cast<double>(readIndex);
 }
 
+void AudioBufferSourceNode::copyFromBuffer(
+    const std::shared_ptr<AudioBus> &processingBus,
+    size_t readIndex,
+    size_t writeIndex,
+    size_t framesToCopy,
+    bool reverse) {
+  if (framesToCopy == 0) {
+    return;
+  }
+
+  // Frames past the end of the buffer belong to the silent tail.
+  auto bufferLength = getBufferLength();
+
+  if (!reverse) {
+    size_t framesFromBuffer =
+        readIndex < bufferLength ? std::min(framesToCopy, bufferLength - readIndex) : 0;
+
+    if (bufferStorage_ != nullptr) {
+      for (int j = 0; j < processingBus->getNumberOfChannels(); j += 1) {
+        bufferStorage_->read(
+            j,
+            readIndex,
+            framesFromBuffer,
+            processingBus->getChannel(j)->getData() + writeIndex);
+      }
+    } else {
+      processingBus->copy(bufferBus_.get(), readIndex, writeIndex, framesFromBuffer);
+    }
+    processingBus->zero(writeIndex + framesFromBuffer, framesToCopy - framesFromBuffer);
+    return;
+  }
+
+  // Reading backwards from readIndex, the tail comes first.
+  size_t tailFramesToCopy =
+      readIndex >= bufferLength ? std::min(framesToCopy, readIndex - bufferLength + 1) : 0;
+  size_t framesFromBuffer = framesToCopy - tailFramesToCopy;
+
+  processingBus->zero(writeIndex, tailFramesToCopy);
+
+  if (framesFromBuffer == 0) {
+    return;
+  }
+
+  size_t lastReadIndex = readIndex - tailFramesToCopy;
+
+  if (bufferStorage_ != nullptr) {
+    for (int j = 0; j < processingBus->getNumberOfChannels(); j += 1) {
+      auto destination = processingBus->getChannel(j)->getData() + writeIndex + tailFramesToCopy;
+      bufferStorage_->read(j, lastReadIndex + 1 - framesFromBuffer, framesFromBuffer, destination);
+      std::reverse(destination, destination + framesFromBuffer);
+    }
+    return;
+  }
+
+  for (int j = 0; j < processingBus->getNumberOfChannels(); j += 1) {
+    dsp::reverse(
+        bufferBus_->getChannel(j)->getData() + lastReadIndex + 1 - framesFromBuffer,
+        processingBus->getChannel(j)->getData() + writeIndex + tailFramesToCopy,
+        framesFromBuffer);
+  }
+}
+
 void AudioBufferSourceNode::processWithInterpolation(
     const std::shared_ptr<AudioBus> &processingBus,
     size_t startOffset,
     size_t offsetLength,
     float playbackRate) {
-  size_t direction = playbackRate < 0.0f ? -1 : 1;
-
-  size_t writeIndex = startOffset;
+  readAhead(playbackRate);
 
   double vFrameStart;
   double vFrameEnd;
@@ -277,49 +459,177 @@ void AudioBufferSourceNode::processWithInterpolation(
     return;
   }
   auto vFrameDelta = vFrameEnd - vFrameStart;
+  double direction = playbackRate < 0.0f ? -1.0 : 1.0;
 
   auto frameStart = static_cast<size_t>(vFrameStart);
   auto frameEnd = static_cast<size_t>(vFrameEnd);
 
-  size_t framesLeft = offsetLength;
-
   // Wrap to the start of the loop if necessary
   if (loop_ && (vReadIndex_ >= vFrameEnd || vReadIndex_ < vFrameStart)) {
     vReadIndex_ = vFrameStart + std::fmod(vReadIndex_ - vFrameStart, vFrameDelta);
-  }
 
-  while (framesLeft > 0) {
-    auto readIndex = static_cast<size_t>(vReadIndex_);
-    size_t nextReadIndex = readIndex + 1;
-    auto factor = static_cast<float>(vReadIndex_ - static_cast<double>(readIndex));
-
-    if (nextReadIndex >= frameEnd) {
-      nextReadIndex = loop_ ? frameStart : readIndex;
+    if (vReadIndex_ < vFrameStart) {
+      vReadIndex_ += vFrameDelta;
     }
+  }
 
-    for (int i = 0; i < processingBus->getNumberOfChannels(); i += 1) {
-      float *destination = processingBus->getChannel(i)->getData();
-      const float *source = alignedBus_->getChannel(i)->getData();
+  // First pass: read positions for the whole block, shared by all channels.
+  size_t framesToRender = 0;
+  bool reachedEnd = false;
 
-      destination[writeIndex] = dsp::linearInterpolate(source, readIndex, nextReadIndex, factor);
-    }
+  while (framesToRender < offsetLength) {
+    auto readIndex = static_cast<size_t>(vReadIndex_);
+    readIndices_[framesToRender] = readIndex;
+    readFractions_[framesToRender] =
+        static_cast<float>(vReadIndex_ - static_cast<double>(readIndex));
+    framesToRender += 1;
 
-    writeIndex += 1;
-    vReadIndex_ += playbackRate * static_cast<double>(direction);
-    framesLeft -= 1;
+    vReadIndex_ += playbackRate;
 
     if (vReadIndex_ < vFrameStart || vReadIndex_ >= vFrameEnd) {
-      vReadIndex_ -= static_cast<double>(direction) * vFrameDelta;
+      vReadIndex_ -= direction * vFrameDelta;
 
       if (!loop_) {
-        processingBus->zero(writeIndex, framesLeft);
-        playbackState_ = PlaybackState::STOP_SCHEDULED;
+        reachedEnd = true;
         break;
       }
 
       sendOnLoopEndedEvent();
     }
   }
+
+  // Second pass: run the kernel over every channel. Positions whose taps
+  // cross the playback range are evaluated separately.
+  auto tapsBefore = static_cast<size_t>(dsp::getInterpolationTapsBefore(interpolation_));
+  auto tapsAfter = static_cast<size_t>(dsp::getInterpolationTapsAfter(interpolation_));
+
+  if (bufferStorage_ != nullptr) {
+    interpolateFromStorage(processingBus, startOffset, framesToRender, frameStart, frameEnd);
+  } else {
+    for (int j = 0; j < processingBus->getNumberOfChannels(); j += 1) {
+      const float *source = bufferBus_->getChannel(j)->getData();
+      float *destination = processingBus->getChannel(j)->getData() + startOffset;
+
+      size_t i = 0;
+      while (i < framesToRender) {
+        size_t runStart = i;
+        while (i < framesToRender && readIndices_[i] >= frameStart + tapsBefore &&
+               readIndices_[i] + tapsAfter < frameEnd) {
+          i += 1;
+        }
+
+        if (i > runStart) {
+          dsp::interpolate(
+              interpolation_,
+              source,
+              readIndices_.data() + runStart,
+              readFractions_.data() + runStart,
+              destination + runStart,
+              i - runStart);
+        }
+
+        if (i < framesToRender) {
+          destination[i] =
+              interpolateAtEdge(source, readIndices_[i], readFractions_[i], frameStart, frameEnd);
+          i += 1;
+        }
+      }
+    }
+  }
+
+  if (reachedEnd) {
+    processingBus->zero(startOffset + framesToRender, offsetLength - framesToRender);
+    playbackState_ = PlaybackState::STOP_SCHEDULED;
+  }
+}
+
+float AudioBufferSourceNode::interpolateAtEdge(
+    const float *source,
+    size_t readIndex,
+    float fraction,
+    size_t frameStart,
+    size_t frameEnd) const {
+  if (frameEnd <= frameStart) {
+    return 0.0f;
+  }
+
+  auto tapsBefore = dsp::getInterpolationTapsBefore(interpolation_);
+  auto tapsAfter = dsp::getInterpolationTapsAfter(interpolation_);
+
+  std::array<float, MAX_INTERPOLATION_TAPS> taps{};
+
+  for (int k = -tapsBefore; k <= tapsAfter; k += 1) {
+    taps[k + tapsBefore] = source[getTapIndex(readIndex, k, frameStart, frameEnd)];
+  }
+
+  auto localIndex = static_cast<size_t>(tapsBefore);
+  float sample;
+  dsp::interpolate(interpolation_, taps.data(), &localIndex, &fraction, &sample, 1);
+
+  return sample;
+}
+
+void AudioBufferSourceNode::interpolateFromStorage(
+    const std::shared_ptr<AudioBus> &processingBus,
+    size_t startOffset,
+    size_t framesToRender,
+    size_t frameStart,
+    size_t frameEnd) {
+  if (frameEnd <= frameStart) {
+    processingBus->zero(startOffset, framesToRender);
+    return;
+  }
+
+  auto tapsBefore = dsp::getInterpolationTapsBefore(interpolation_);
+  auto tapsAfter = dsp::getInterpolationTapsAfter(interpolation_);
+  auto tapCount = static_cast<size_t>(tapsBefore + tapsAfter + 1);
+
+  // Taps of every position are laid out next to each other, so only they
+  // are converted and edge positions need no special handling.
+  for (size_t i = 0; i < framesToRender; i += 1) {
+    for (int k = -tapsBefore; k <= tapsAfter; k += 1) {
+      tapIndices_[i * tapCount + k + tapsBefore] =
+          getTapIndex(readIndices_[i], k, frameStart, frameEnd);
+    }
+    tapReadIndices_[i] = i * tapCount + tapsBefore;
+  }
+
+  for (int j = 0; j < processingBus->getNumberOfChannels(); j += 1) {
+    bufferStorage_->gather(j, tapIndices_.data(), framesToRender * tapCount, taps_.data());
+    dsp::interpolate(
+        interpolation_,
+        taps_.data(),
+        tapReadIndices_.data(),
+        readFractions_.data(),
+        processingBus->getChannel(j)->getData() + startOffset,
+        framesToRender);
+  }
+}
+
+size_t AudioBufferSourceNode::getTapIndex(
+    size_t readIndex,
+    int tap,
+    size_t frameStart,
+    size_t frameEnd) const {
+  auto rangeStart = static_cast<int64_t>(frameStart);
+  auto rangeLength = static_cast<int64_t>(frameEnd - frameStart);
+  auto index = static_cast<int64_t>(readIndex) + tap - rangeStart;
+
+  if (loop_) {
+    index = ((index % rangeLength) + rangeLength) % rangeLength;
+  } else {
+    index = std::clamp<int64_t>(index, 0, rangeLength - 1);
+  }
+
+  return static_cast<size_t>(rangeStart + index);
+}
+
+bool AudioBufferSourceNode::hasBufferData() const {
+  return bufferBus_ != nullptr || bufferStorage_ != nullptr;
+}
+
+size_t AudioBufferSourceNode::getBufferLength() const {
+  return bufferStorage_ != nullptr ? bufferStorage_->getLength() : bufferBus_->getSize();
 }
 
 double AudioBufferSourceNode::getVirtualStartFrame(float sampleRate) {
@@ -328,7 +638,9 @@ double AudioBufferSourceNode::getVirtualStartFrame(float sampleRate) {
 }
 
 double AudioBufferSourceNode::getVirtualEndFrame(float sampleRate) {
-  auto inputBufferLength = static_cast<double>(alignedBus_->getSize());
+  // The silent tail is only used with pitch correction,
+  // which always reads without interpolation.
+  auto inputBufferLength = static_cast<double>(getBufferLength() + tailFrames_);
   auto loopEndFrame = loopEnd_ * sampleRate;
 
   return loop_ && loopEndFrame > 0 && loopStart_ < loopEnd_
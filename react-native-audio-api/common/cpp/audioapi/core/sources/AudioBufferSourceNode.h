@@ -2,21 +2,27 @@
 
 #include <audioapi/core/sources/AudioBuffer.h>
 #include <audioapi/core/sources/AudioBufferBaseSourceNode.h>
-#include <audioapi/libs/signalsmith-stretch/signalsmith-stretch.h>
+#include <audioapi/core/types/InterpolationType.h>
 
 #include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace audioapi {
 
 class AudioBus;
 class AudioParam;
+class PcmReadAhead;
+class PcmStorage;
 
 class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
  public:
-  explicit AudioBufferSourceNode(std::shared_ptr<BaseAudioContext> context, bool pitchCorrection);
+  explicit AudioBufferSourceNode(
+      std::shared_ptr<BaseAudioContext> context,
+      bool pitchCorrection,
+      PitchCorrectionQuality pitchCorrectionQuality = PitchCorrectionQuality::HIGH);
   ~AudioBufferSourceNode() override;
 
   [[nodiscard]] bool getLoop() const;
@@ -24,12 +30,14 @@ class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
   [[nodiscard]] double getLoopStart() const;
   [[nodiscard]] double getLoopEnd() const;
   [[nodiscard]] std::shared_ptr<AudioBuffer> getBuffer() const;
+  [[nodiscard]] std::string getInterpolation() const;
 
   void setLoop(bool loop);
   void setLoopSkip(bool loopSkip);
   void setLoopStart(double loopStart);
   void setLoopEnd(double loopEnd);
   void setBuffer(const std::shared_ptr<AudioBuffer> &buffer);
+  void setInterpolation(const std::string &interpolation);
 
   using AudioScheduledSourceNode::start;
   void start(double when, double offset, double duration = -1);
@@ -37,11 +45,15 @@ class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
 
   void setOnLoopEndedCallbackId(uint64_t callbackId);
 
+  [[nodiscard]] bool canBeRecycled() const override;
+  void resetForReuse() override;
+
  protected:
   std::shared_ptr<AudioBus> processNode(
       const std::shared_ptr<AudioBus> &processingBus,
       int framesToProcess) override;
   double getCurrentPosition() const override;
+  void updatePlaybackSnapshot(PlaybackSnapshot &snapshot) override;
 
  private:
   // Looping related properties
@@ -50,9 +62,33 @@ class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
   double loopStart_;
   double loopEnd_;
 
-  // User provided buffer
+  // User provided buffer, its storage is shared and read in place.
+  // PCM storage is converted to float only for the frames being rendered.
   std::shared_ptr<AudioBuffer> buffer_;
-  std::shared_ptr<AudioBus> alignedBus_;
+  std::shared_ptr<AudioBus> bufferBus_;
+  std::shared_ptr<PcmStorage> bufferStorage_;
+
+  // Frames of PCM storage requested to be loaded, the window rolls along the play head.
+  static constexpr double READ_AHEAD_DURATION = 1.0;
+  std::shared_ptr<PcmReadAhead> readAhead_;
+  size_t readAheadStart_;
+  size_t readAheadEnd_;
+
+  // Silent frames virtually appended after the buffer to flush
+  // the pitch correction latency.
+  size_t tailFrames_;
+
+  // Interpolation used when playback rate is not 1, read positions are
+  // computed once per render quantum and shared by all channels.
+  InterpolationType interpolation_;
+  std::vector<size_t> readIndices_;
+  std::vector<float> readFractions_;
+
+  // Kernel taps of every rendered position gathered from PCM storage.
+  static constexpr size_t MAX_INTERPOLATION_TAPS = 32;
+  std::vector<size_t> tapIndices_;
+  std::vector<size_t> tapReadIndices_;
+  std::vector<float> taps_;
 
   std::atomic<uint64_t> onLoopEndedCallbackId_ = 0; // 0 means no callback
   void sendOnLoopEndedEvent();
@@ -63,14 +99,71 @@ class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
       size_t offsetLength,
       float playbackRate) override;
 
+  void copyFromBuffer(
+      const std::shared_ptr<AudioBus> &processingBus,
+      size_t readIndex,
+      size_t writeIndex,
+      size_t framesToCopy,
+      bool reverse);
+
   void processWithInterpolation(
       const std::shared_ptr<AudioBus> &processingBus,
       size_t startOffset,
       size_t offsetLength,
       float playbackRate) override;
 
+  // Evaluates a single position whose kernel taps cross the playback range,
+  // taps are wrapped around the loop or clamped to the range otherwise.
+  float interpolateAtEdge(
+      const float *source,
+      size_t readIndex,
+      float fraction,
+      size_t frameStart,
+      size_t frameEnd) const;
+
+  void interpolateFromStorage(
+      const std::shared_ptr<AudioBus> &processingBus,
+      size_t startOffset,
+      size_t framesToRender,
+      size_t frameStart,
+      size_t frameEnd);
+
+  [[nodiscard]] size_t
+  getTapIndex(size_t readIndex, int tap, size_t frameStart, size_t frameEnd) const;
+  void prefetchAt(size_t readIndex);
+  void readAhead(float playbackRate);
+  [[nodiscard]] bool hasBufferData() const;
+  [[nodiscard]] size_t getBufferLength() const;
+
   double getVirtualStartFrame(float sampleRate);
   double getVirtualEndFrame(float sampleRate);
+
+  static InterpolationType interpolationFromString(const std::string &interpolation) {
+    std::string lowerType = interpolation;
+    std::transform(lowerType.begin(), lowerType.end(), lowerType.begin(), ::tolower);
+
+    if (lowerType == "linear")
+      return InterpolationType::LINEAR;
+    if (lowerType == "cubic")
+      return InterpolationType::CUBIC;
+    if (lowerType == "sinc")
+      return InterpolationType::SINC;
+
+    throw std::invalid_argument("Unknown interpolation type: " + interpolation);
+  }
+
+  static std::string interpolationToString(InterpolationType interpolation) {
+    switch (interpolation) {
+      case InterpolationType::LINEAR:
+        return "linear";
+      case InterpolationType::CUBIC:
+        return "cubic";
+      case InterpolationType::SINC:
+        return "sinc";
+      default:
+        throw std::invalid_argument("Unknown interpolation type");
+    }
+  }
 };
 
 } // namespace audioapi
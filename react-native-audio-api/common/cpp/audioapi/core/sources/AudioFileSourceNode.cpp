@@ -0,0 +1,251 @@
+#include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/sources/AudioFileSourceNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/AudioUtils.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+namespace audioapi {
+
+AudioFileSourceNode::AudioFileSourceNode(
+    std::shared_ptr<BaseAudioContext> context,
+    std::unique_ptr<AudioStreamReader> reader,
+    double readAhead)
+    : AudioScheduledSourceNode(context),
+      readAhead_(std::max(readAhead, 0.0)),
+      reader_(std::move(reader)) {
+  sampleRate_ = reader_->getSampleRate();
+  auto lengthInFrames = reader_->getLengthInFrames();
+  endFrame_.store(lengthInFrames > 0 ? lengthInFrames : UNKNOWN_END_FRAME);
+
+  channelCount_ = reader_->getNumberOfChannels();
+  audioBus_ =
+      std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
+
+  // at least two chunks, so one can be decoded while the other one is played
+  auto readAheadFrames = static_cast<size_t>(readAhead_ * sampleRate_);
+  auto chunkCount = std::max<size_t>(
+      (readAheadFrames + AUDIO_FILE_SOURCE_NODE_CHUNK_SIZE - 1) / AUDIO_FILE_SOURCE_NODE_CHUNK_SIZE,
+      2);
+  jitterBuffer_ = std::make_unique<StreamJitterBuffer>(
+      channelCount_, sampleRate_, AUDIO_FILE_SOURCE_NODE_CHUNK_SIZE, chunkCount, 0);
+
+  decodingThread_ = std::thread(&AudioFileSourceNode::decodeFile, this);
+  isInitialized_ = true;
+}
+
+AudioFileSourceNode::~AudioFileSourceNode() {
+  isDecodingStopped_.store(true, std::memory_order_release);
+  if (decodingThread_.joinable()) {
+    decodingThread_.join();
+  }
+}
+
+bool AudioFileSourceNode::getLoop() const {
+  return loop_.load(std::memory_order_acquire);
+}
+
+double AudioFileSourceNode::getLoopStart() const {
+  return loopStart_.load(std::memory_order_acquire);
+}
+
+double AudioFileSourceNode::getLoopEnd() const {
+  return loopEnd_.load(std::memory_order_acquire);
+}
+
+double AudioFileSourceNode::getDuration() const {
+  auto endFrame = endFrame_.load(std::memory_order_acquire);
+  if (endFrame == UNKNOWN_END_FRAME) {
+    return 0.0;
+  }
+
+  return static_cast<double>(endFrame) / sampleRate_;
+}
+
+double AudioFileSourceNode::getPosition() const {
+  return static_cast<double>(playbackFrame_.load(std::memory_order_acquire)) / sampleRate_;
+}
+
+double AudioFileSourceNode::getReadAhead() const {
+  return readAhead_;
+}
+
+double AudioFileSourceNode::getBufferedDuration() const {
+  return static_cast<double>(jitterBuffer_->getBufferedFrames()) / sampleRate_;
+}
+
+size_t AudioFileSourceNode::getUnderrunCount() const {
+  return jitterBuffer_->getUnderrunCount();
+}
+
+void AudioFileSourceNode::setLoop(bool loop) {
+  loop_.store(loop, std::memory_order_release);
+}
+
+void AudioFileSourceNode::setLoopStart(double loopStart) {
+  loopStart_.store(std::max(loopStart, 0.0), std::memory_order_release);
+}
+
+void AudioFileSourceNode::setLoopEnd(double loopEnd) {
+  loopEnd_.store(std::max(loopEnd, 0.0), std::memory_order_release);
+}
+
+void AudioFileSourceNode::seek(double position) {
+  auto frame = dsp::timeToSampleFrame(std::max(position, 0.0), sampleRate_);
+  pendingSeekFrame_.store(static_cast<int64_t>(frame), std::memory_order_release);
+}
+
+std::shared_ptr<AudioBus> AudioFileSourceNode::processNode(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int framesToProcess) {
+  size_t startOffset = 0;
+  size_t offsetLength = 0;
+
+  std::shared_ptr<BaseAudioContext> context = context_.lock();
+  if (context == nullptr) {
+    processingBus->zero();
+    return processingBus;
+  }
+
+  updatePlaybackInfo(
+      processingBus,
+      framesToProcess,
+      startOffset,
+      offsetLength,
+      context->getSampleRate(),
+      context->getCurrentSampleFrame());
+
+  if (!isPlaying() && !isStopScheduled()) {
+    processingBus->zero();
+    return processingBus;
+  }
+
+  auto pendingSeekFrame = pendingSeekFrame_.exchange(NO_PENDING_SEEK, std::memory_order_acq_rel);
+  if (pendingSeekFrame != NO_PENDING_SEEK) {
+    position_ = static_cast<size_t>(pendingSeekFrame);
+    requestDecoderSeek(position_);
+  }
+
+  size_t framesProcessed = 0;
+
+  while (framesProcessed < offsetLength) {
+    auto endFrame = getLoopEndFrame();
+
+    if (position_ >= endFrame) {
+      if (isLooping(endFrame)) {
+        // the decoding thread wraps around on its own
+        position_ = getLoopStartFrame();
+        continue;
+      }
+
+      processingBus->zero(startOffset + framesProcessed, offsetLength - framesProcessed);
+      playbackState_ = PlaybackState::STOP_SCHEDULED;
+      break;
+    }
+
+    auto framesToRead = std::min(offsetLength - framesProcessed, endFrame - position_);
+    bool isOutOfSync = false;
+    auto framesRead = jitterBuffer_->readAt(
+        processingBus.get(), startOffset + framesProcessed, framesToRead, position_, isOutOfSync);
+
+    position_ += framesRead;
+    framesProcessed += framesRead;
+
+    // The rest of the quantum is silent, playback resumes from the same
+    // frame once the decoder catches up.
+    if (framesRead < framesToRead) {
+      if (isOutOfSync && requestedFrame_ != position_) {
+        requestDecoderSeek(position_);
+      }
+      break;
+    }
+  }
+
+  playbackFrame_.store(position_, std::memory_order_release);
+  handleStopScheduled();
+
+  return processingBus;
+}
+
+size_t AudioFileSourceNode::getLoopStartFrame() const {
+  return dsp::timeToSampleFrame(loopStart_.load(std::memory_order_acquire), sampleRate_);
+}
+
+size_t AudioFileSourceNode::getLoopEndFrame() const {
+  auto endFrame = endFrame_.load(std::memory_order_acquire);
+  auto loopEnd = loopEnd_.load(std::memory_order_acquire);
+
+  if (loop_.load(std::memory_order_acquire) && loopEnd > 0.0) {
+    endFrame = std::min(endFrame, dsp::timeToSampleFrame(loopEnd, sampleRate_));
+  }
+
+  return endFrame;
+}
+
+bool AudioFileSourceNode::isLooping(size_t endFrame) const {
+  return loop_.load(std::memory_order_acquire) && endFrame != UNKNOWN_END_FRAME &&
+      getLoopStartFrame() < endFrame;
+}
+
+void AudioFileSourceNode::requestDecoderSeek(size_t frame) {
+  requestedFrame_ = frame;
+  seekFrame_.store(frame, std::memory_order_relaxed);
+  seekGeneration_.fetch_add(1, std::memory_order_release);
+}
+
+void AudioFileSourceNode::decodeFile() {
+  size_t seekGeneration = 0;
+  size_t decodePosition = 0;
+
+  auto seekDecoder = [this, &decodePosition](size_t frame) {
+    reader_->seek(frame);
+    jitterBuffer_->seekWrite(frame);
+    decodePosition = frame;
+  };
+
+  while (!isDecodingStopped_.load(std::memory_order_acquire)) {
+    auto requestedGeneration = seekGeneration_.load(std::memory_order_acquire);
+    if (requestedGeneration != seekGeneration) {
+      seekGeneration = requestedGeneration;
+      seekDecoder(seekFrame_.load(std::memory_order_relaxed));
+    }
+
+    auto endFrame = getLoopEndFrame();
+    if (decodePosition >= endFrame) {
+      if (isLooping(endFrame)) {
+        seekDecoder(getLoopStartFrame());
+        continue;
+      }
+
+      // Keep the thread around, playback can still be moved back by a seek.
+      if (!jitterBuffer_->isFinished()) {
+        jitterBuffer_->finish();
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_INTERVAL_MS));
+      continue;
+    }
+
+    auto framesToDecode = std::min(AUDIO_FILE_SOURCE_NODE_CHUNK_SIZE, endFrame - decodePosition);
+    size_t writeOffset = 0;
+    auto *chunk = jitterBuffer_->reserve(framesToDecode, writeOffset, isDecodingStopped_);
+    if (chunk == nullptr) {
+      break;
+    }
+
+    auto framesRead = reader_->read(chunk, writeOffset, framesToDecode);
+    jitterBuffer_->commit(framesRead);
+    decodePosition += framesRead;
+
+    if (framesRead < framesToDecode) {
+      // the file is shorter than reported or its length was not known
+      endFrame_.store(decodePosition, std::memory_order_release);
+    }
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <audioapi/core/sources/AudioScheduledSourceNode.h>
+#include <audioapi/core/utils/AudioStreamReader.h>
+#include <audioapi/core/utils/StreamJitterBuffer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+// Frames decoded at once by the background thread.
+static constexpr size_t AUDIO_FILE_SOURCE_NODE_CHUNK_SIZE = 4096;
+static constexpr double AUDIO_FILE_SOURCE_NODE_DEFAULT_READ_AHEAD = 0.5;
+
+namespace audioapi {
+
+class AudioBus;
+
+/// Plays a file straight from disk. A background thread decodes only the
+/// next readAhead seconds into a pool of chunks, so memory usage does not
+/// depend on the length of the file.
+class AudioFileSourceNode : public AudioScheduledSourceNode {
+ public:
+  explicit AudioFileSourceNode(
+      std::shared_ptr<BaseAudioContext> context,
+      std::unique_ptr<AudioStreamReader> reader,
+      double readAhead = AUDIO_FILE_SOURCE_NODE_DEFAULT_READ_AHEAD);
+  ~AudioFileSourceNode() override;
+
+  [[nodiscard]] bool getLoop() const;
+  [[nodiscard]] double getLoopStart() const;
+  [[nodiscard]] double getLoopEnd() const;
+  /// @return Duration of the file in seconds, 0 until it is known.
+  [[nodiscard]] double getDuration() const;
+  /// @return Playback position in the file in seconds.
+  [[nodiscard]] double getPosition() const;
+  [[nodiscard]] double getReadAhead() const;
+  [[nodiscard]] double getBufferedDuration() const;
+  [[nodiscard]] size_t getUnderrunCount() const;
+
+  void setLoop(bool loop);
+  void setLoopStart(double loopStart);
+  void setLoopEnd(double loopEnd);
+  /// Moves playback to the given position, applied on the next render quantum.
+  void seek(double position);
+
+ protected:
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override;
+
+ private:
+  static constexpr size_t UNKNOWN_END_FRAME = SIZE_MAX;
+  static constexpr int64_t NO_PENDING_SEEK = -1;
+  // how often the decoding thread checks for seeks once the file is decoded
+  static constexpr int IDLE_INTERVAL_MS = 5;
+
+  float sampleRate_;
+  double readAhead_;
+
+  std::atomic<bool> loop_ = false;
+  std::atomic<double> loopStart_ = 0.0;
+  std::atomic<double> loopEnd_ = 0.0;
+
+  // JS thread -> audio thread
+  std::atomic<int64_t> pendingSeekFrame_ = NO_PENDING_SEEK;
+  // audio thread -> decoding thread, the generation is bumped after the frame is stored
+  std::atomic<size_t> seekFrame_ = 0;
+  std::atomic<size_t> seekGeneration_ = 0;
+  // length of the file, known upfront or once the decoder reaches its end
+  std::atomic<size_t> endFrame_;
+  std::atomic<size_t> playbackFrame_ = 0;
+
+  // audio thread state
+  size_t position_ = 0;
+  size_t requestedFrame_ = 0;
+
+  // decoding thread state
+  std::unique_ptr<AudioStreamReader> reader_;
+  std::unique_ptr<StreamJitterBuffer> jitterBuffer_;
+  std::thread decodingThread_;
+  std::atomic<bool> isDecodingStopped_ = false;
+
+  [[nodiscard]] size_t getLoopStartFrame() const;
+  /// @return Frame at which playback wraps or ends.
+  [[nodiscard]] size_t getLoopEndFrame() const;
+  [[nodiscard]] bool isLooping(size_t endFrame) const;
+
+  void requestDecoderSeek(size_t frame);
+  void decodeFile();
+};
+
+} // namespace audioapi
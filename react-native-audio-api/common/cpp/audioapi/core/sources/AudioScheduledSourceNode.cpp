@@ -70,6 +70,19 @@ void AudioScheduledSourceNode::setOnEndedCallbackId(const uint64_t callbackId) {
   }
 }
 
+std::shared_ptr<AudioBus> AudioScheduledSourceNode::processAudio(
+    const std::shared_ptr<AudioBus> &outputBus,
+    int framesToProcess,
+    bool checkIsAlreadyProcessed) {
+  auto processedBus = AudioNode::processAudio(outputBus, framesToProcess, checkIsAlreadyProcessed);
+  publishPlaybackSnapshot();
+  return processedBus;
+}
+
+AudioScheduledSourceNode::PlaybackSnapshot AudioScheduledSourceNode::getPlaybackSnapshot() const {
+  return playbackSnapshot_.load();
+}
+
 void AudioScheduledSourceNode::updatePlaybackInfo(
     const std::shared_ptr<AudioBus> &processingBus,
     int framesToProcess,
@@ -167,10 +180,42 @@ void AudioScheduledSourceNode::disable() {
 
   auto onEndedCallbackId = onEndedCallbackId_.load(std::memory_order_acquire);
   if (onEndedCallbackId != 0) {
-    audioEventHandlerRegistry_->invokeHandlerWithEventBody("ended", onEndedCallbackId, {});
+    audioEventHandlerRegistry_->dispatchAudioEvent(
+        AudioEvent{.type = AudioEventType::ENDED, .listenerId = onEndedCallbackId});
   }
 }
 
+bool AudioScheduledSourceNode::canBeRecycled() const {
+  return false;
+}
+
+void AudioScheduledSourceNode::resetForReuse() {
+  startTime_ = -1.0;
+  stopTime_ = -1.0;
+  playbackState_ = PlaybackState::UNSCHEDULED;
+  setOnEndedCallbackId(0);
+
+  pendingSnapshot_ = PlaybackSnapshot{};
+  playbackSnapshot_.store(pendingSnapshot_);
+
+  // reclaimed nodes are cleaned up and finished nodes are disabled
+  isInitialized_ = true;
+  enable();
+  lastRenderedFrame_ = SIZE_MAX;
+}
+
+void AudioScheduledSourceNode::updatePlaybackSnapshot(PlaybackSnapshot & /* snapshot */) {}
+
+void AudioScheduledSourceNode::publishPlaybackSnapshot() {
+  pendingSnapshot_.state = playbackState_;
+  if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    pendingSnapshot_.contextTime = context->getCurrentTime();
+  }
+
+  updatePlaybackSnapshot(pendingSnapshot_);
+  playbackSnapshot_.store(pendingSnapshot_);
+}
+
 void AudioScheduledSourceNode::handleStopScheduled() {
   if (isStopScheduled()) {
     playbackState_ = PlaybackState::FINISHED;
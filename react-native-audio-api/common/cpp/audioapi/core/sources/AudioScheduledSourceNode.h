@@ -1,6 +1,7 @@
 #pragma once
 
 #include <audioapi/core/AudioNode.h>
+#include <audioapi/utils/SeqLock.hpp>
 
 #include <algorithm>
 #include <atomic>
@@ -26,6 +27,18 @@ class AudioScheduledSourceNode : public AudioNode {
   // STOP_SCHEDULED: The node is scheduled to stop at a specific time, but is still playing.
   // FINISHED: The node has finished playing.
   enum class PlaybackState { UNSCHEDULED, SCHEDULED, PLAYING, STOP_SCHEDULED, FINISHED };
+
+  /// Playback state published by the audio thread after every render quantum.
+  struct PlaybackSnapshot {
+    PlaybackState state = PlaybackState::UNSCHEDULED;
+    /// Position in the played audio, in seconds.
+    double position = 0.0;
+    /// Audio left to play after the position, in seconds.
+    double bufferedDuration = 0.0;
+    /// Context time at the start of the render quantum the snapshot was taken in.
+    double contextTime = 0.0;
+  };
+
   explicit AudioScheduledSourceNode(std::shared_ptr<BaseAudioContext> context);
 
   virtual void start(double when);
@@ -41,6 +54,22 @@ class AudioScheduledSourceNode : public AudioNode {
 
   void disable() override;
 
+  std::shared_ptr<AudioBus> processAudio(
+      const std::shared_ptr<AudioBus> &outputBus,
+      int framesToProcess,
+      bool checkIsAlreadyProcessed) override;
+
+  /// @brief Any thread, never blocks the audio thread.
+  [[nodiscard]] PlaybackSnapshot getPlaybackSnapshot() const;
+
+  /// @brief Audio thread, whether a reclaimed node can be reset and handed out again.
+  /// Nodes whose params are still referenced, e.g. by a connection, or which are still
+  /// connected to a param are destroyed instead.
+  [[nodiscard]] virtual bool canBeRecycled() const;
+  /// @brief JS thread, brings a reclaimed node back to its freshly created state.
+  /// @note Should be called only once the audio thread no longer renders the node.
+  virtual void resetForReuse();
+
  protected:
   double startTime_;
   double stopTime_;
@@ -59,6 +88,17 @@ class AudioScheduledSourceNode : public AudioNode {
       size_t currentSampleFrame);
 
   void handleStopScheduled();
+
+  /// @brief Audio thread, fills in the position and buffered duration of the snapshot.
+  /// Sources without a position keep the values of the previous snapshot.
+  virtual void updatePlaybackSnapshot(PlaybackSnapshot &snapshot);
+
+ private:
+  SeqLock<PlaybackSnapshot> playbackSnapshot_;
+  // written by the audio thread only
+  PlaybackSnapshot pendingSnapshot_;
+
+  void publishPlaybackSnapshot();
 };
 
 } // namespace audioapi
@@ -1,6 +1,7 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/OscillatorNode.h>
 #include <audioapi/dsp/AudioUtils.h>
+#include <audioapi/dsp/PolyBlep.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 #include <memory>
@@ -23,11 +24,31 @@ OscillatorNode::OscillatorNode(std::shared_ptr<BaseAudioContext> context)
               1200 * LOG2_MOST_POSITIVE_SINGLE_FLOAT,
               context)),
       type_(OscillatorType::SINE),
+      mode_(OscillatorMode::WAVETABLE),
       periodicWave_(context->getBasicWaveForm(type_)) {
   audioBus_ = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, context->getSampleRate());
   isInitialized_ = true;
 }
 
+bool OscillatorNode::canBeRecycled() const {
+  // a param the node still modulates keeps a pointer to it, so such nodes are not reused
+  return outputParams_.empty() && frequencyParam_.use_count() == 1 &&
+      detuneParam_.use_count() == 1;
+}
+
+void OscillatorNode::resetForReuse() {
+  AudioScheduledSourceNode::resetForReuse();
+
+  frequencyParam_->reset();
+  detuneParam_->reset();
+  type_ = OscillatorType::SINE;
+  mode_ = OscillatorMode::WAVETABLE;
+  phase_ = 0.0;
+  if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    periodicWave_ = context->getBasicWaveForm(type_);
+  }
+}
+
 std::shared_ptr<AudioParam> OscillatorNode::getFrequencyParam() const {
   return frequencyParam_;
 }
@@ -47,6 +68,14 @@ void OscillatorNode::setType(const std::string &type) {
   }
 }
 
+std::string OscillatorNode::getMode() {
+  return OscillatorNode::modeToString(mode_);
+}
+
+void OscillatorNode::setMode(const std::string &mode) {
+  mode_ = OscillatorNode::modeFromString(mode);
+}
+
 void OscillatorNode::setPeriodicWave(const std::shared_ptr<PeriodicWave> &periodicWave) {
   periodicWave_ = periodicWave;
   type_ = OscillatorType::CUSTOM;
@@ -73,28 +102,91 @@ std::shared_ptr<AudioBus> OscillatorNode::processNode(
 
   auto time =
       context->getCurrentTime() + static_cast<double>(startOffset) * 1.0 / context->getSampleRate();
-  auto detuneParamValues = detuneParam_->processARateParam(framesToProcess, time);
-  auto frequencyParamValues = frequencyParam_->processARateParam(framesToProcess, time);
+  auto detuneValues =
+      detuneParam_->processARateParam(framesToProcess, time)->getChannel(0)->getData();
+  auto frequencyValues =
+      frequencyParam_->processARateParam(framesToProcess, time)->getChannel(0)->getData();
+
+  auto outputChannel = processingBus->getChannel(0);
+  auto framesToRender = offsetLength;
+
+  auto isConstant = [startOffset, framesToRender](const float *values) {
+    auto first = values[startOffset];
+    return std::all_of(
+        values + startOffset, values + startOffset + framesToRender, [first](float value) {
+          return value == first;
+        });
+  };
+
+  if (framesToRender > 0 && isConstant(frequencyValues) && isConstant(detuneValues)) {
+    auto detuneRatio = std::exp2(detuneValues[startOffset] / 1200.0f);
+    processConstantFrequency(
+        outputChannel->getData() + startOffset,
+        framesToRender,
+        frequencyValues[startOffset] * detuneRatio);
+  } else {
+    processAutomatedFrequency(
+        outputChannel->getData() + startOffset,
+        frequencyValues + startOffset,
+        detuneValues + startOffset,
+        framesToRender);
+  }
 
-  for (size_t i = startOffset; i < offsetLength; i += 1) {
-    auto detuneRatio = std::pow(2.0f, detuneParamValues->getChannel(0)->getData()[i] / 1200.0f);
-    auto detunedFrequency = frequencyParamValues->getChannel(0)->getData()[i] * detuneRatio;
-    auto phaseIncrement = detunedFrequency * periodicWave_->getScale();
+  for (int j = 1; j < processingBus->getNumberOfChannels(); j += 1) {
+    processingBus->getChannel(j)->copy(outputChannel, startOffset, framesToRender);
+  }
+
+  handleStopScheduled();
 
-    float sample = periodicWave_->getSample(detunedFrequency, phase_, phaseIncrement);
+  return processingBus;
+}
 
-    for (int j = 0; j < processingBus->getNumberOfChannels(); j += 1) {
-      (*processingBus->getChannel(j))[i] = sample;
-    }
+bool OscillatorNode::usesPolyBlep() const {
+  // custom waveforms are defined only by their wave tables.
+  return mode_ == OscillatorMode::POLYBLEP && type_ != OscillatorType::CUSTOM;
+}
 
-    phase_ += phaseIncrement;
-    phase_ -= floor(phase_ / static_cast<float>(periodicWave_->getPeriodicWaveSize())) *
-        static_cast<float>(periodicWave_->getPeriodicWaveSize());
+void OscillatorNode::processConstantFrequency(
+    float *outputVector,
+    size_t framesToProcess,
+    float frequency) {
+  if (usesPolyBlep()) {
+    auto waveSize = static_cast<float>(periodicWave_->getPeriodicWaveSize());
+    auto phaseIncrement = frequency * periodicWave_->getScale() / waveSize;
+    auto normalizedPhase = phase_ / waveSize;
+
+    dsp::processPolyBlep(type_, outputVector, framesToProcess, phaseIncrement, normalizedPhase);
+    phase_ = normalizedPhase * waveSize;
+    return;
   }
 
-  handleStopScheduled();
+  periodicWave_->processWithConstantFrequency(outputVector, framesToProcess, frequency, phase_);
+}
 
-  return processingBus;
+void OscillatorNode::processAutomatedFrequency(
+    float *outputVector,
+    const float *frequencyValues,
+    const float *detuneValues,
+    size_t framesToProcess) {
+  auto waveSize = static_cast<float>(periodicWave_->getPeriodicWaveSize());
+  auto polyBlep = usesPolyBlep();
+
+  for (size_t i = 0; i < framesToProcess; i += 1) {
+    auto detuneRatio = std::exp2(detuneValues[i] / 1200.0f);
+    auto detunedFrequency = frequencyValues[i] * detuneRatio;
+    auto phaseIncrement = detunedFrequency * periodicWave_->getScale();
+
+    if (polyBlep) {
+      outputVector[i] = dsp::polyBlepSample(type_, phase_ / waveSize, phaseIncrement / waveSize);
+    } else {
+      outputVector[i] = periodicWave_->getSample(detunedFrequency, phase_, phaseIncrement);
+    }
+
+    phase_ += phaseIncrement;
+    if (phase_ >= waveSize || phase_ < 0) {
+      phase_ -= std::floor(phase_ / waveSize) * waveSize;
+    }
+  }
 }
 
 } // namespace audioapi
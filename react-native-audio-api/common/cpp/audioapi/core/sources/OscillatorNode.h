@@ -3,6 +3,7 @@
 #include <audioapi/core/AudioParam.h>
 #include <audioapi/core/effects/PeriodicWave.h>
 #include <audioapi/core/sources/AudioScheduledSourceNode.h>
+#include <audioapi/core/types/OscillatorMode.h>
 #include <audioapi/core/types/OscillatorType.h>
 
 #include <algorithm>
@@ -22,20 +23,38 @@ class OscillatorNode : public AudioScheduledSourceNode {
   [[nodiscard]] std::shared_ptr<AudioParam> getDetuneParam() const;
   [[nodiscard]] std::string getType();
   void setType(const std::string &type);
+  [[nodiscard]] std::string getMode();
+  void setMode(const std::string &mode);
   void setPeriodicWave(const std::shared_ptr<PeriodicWave> &periodicWave);
 
+  [[nodiscard]] bool canBeRecycled() const override;
+  void resetForReuse() override;
+
  protected:
   std::shared_ptr<AudioBus> processNode(
       const std::shared_ptr<AudioBus> &processingBus,
       int framesToProcess) override;
 
+  // Renders the waveform for frequency and detune that do not change within
+  // the block, phase increment and wave table range are resolved once.
+  void processConstantFrequency(float *outputVector, size_t framesToProcess, float frequency);
+  // Renders the waveform sample by sample for automated frequency or detune.
+  void processAutomatedFrequency(
+      float *outputVector,
+      const float *frequencyValues,
+      const float *detuneValues,
+      size_t framesToProcess);
+
  private:
   std::shared_ptr<AudioParam> frequencyParam_;
   std::shared_ptr<AudioParam> detuneParam_;
   OscillatorType type_;
+  OscillatorMode mode_;
   float phase_ = 0.0;
   std::shared_ptr<PeriodicWave> periodicWave_;
 
+  [[nodiscard]] bool usesPolyBlep() const;
+
   static OscillatorType fromString(const std::string &type) {
     std::string lowerType = type;
     std::transform(lowerType.begin(), lowerType.end(), lowerType.begin(), ::tolower);
@@ -54,6 +73,29 @@ class OscillatorNode : public AudioScheduledSourceNode {
     throw std::invalid_argument("Unknown oscillator type: " + type);
   }
 
+  static OscillatorMode modeFromString(const std::string &mode) {
+    std::string lowerMode = mode;
+    std::transform(lowerMode.begin(), lowerMode.end(), lowerMode.begin(), ::tolower);
+
+    if (lowerMode == "wavetable")
+      return OscillatorMode::WAVETABLE;
+    if (lowerMode == "polyblep")
+      return OscillatorMode::POLYBLEP;
+
+    throw std::invalid_argument("Unknown oscillator mode: " + mode);
+  }
+
+  static std::string modeToString(OscillatorMode mode) {
+    switch (mode) {
+      case OscillatorMode::WAVETABLE:
+        return "wavetable";
+      case OscillatorMode::POLYBLEP:
+        return "polyblep";
+      default:
+        throw std::invalid_argument("Unknown oscillator mode");
+    }
+  }
+
   static std::string toString(OscillatorType type) {
     switch (type) {
       case OscillatorType::SINE:
@@ -4,8 +4,10 @@
 #include <audioapi/core/utils/Constants.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <memory>
-#include <type_traits>
 
 namespace audioapi {
 
@@ -16,42 +18,70 @@ RecorderAdapterNode::RecorderAdapterNode(std::shared_ptr<BaseAudioContext> conte
   isInitialized_ = false;
 }
 
-void RecorderAdapterNode::init(size_t bufferSize, int channelCount) {
+void RecorderAdapterNode::init(size_t bufferSize, int channelCount, float sampleRate) {
   std::shared_ptr<BaseAudioContext> context = context_.lock();
-  if (isInitialized_ || context == nullptr) {
+  if (isInitialized_ || context == nullptr || channelCount > MAX_CHANNEL_COUNT) {
     return;
   }
 
   channelCount_ = channelCount;
+  auto contextSampleRate = context->getSampleRate();
 
-  buff_.resize(channelCount_);
+  // The recorder pushes bufferSize frames at once, the ring is kept filled with
+  // one such buffer and the input of a render quantum, so that it neither runs
+  // dry between two pushes nor adds more latency than needed.
+  auto maxRatio = (1.0 + MAX_DRIFT_CORRECTION) * sampleRate / contextSampleRate;
+  auto quantumInputFrames = static_cast<size_t>(std::ceil(RENDER_QUANTUM_SIZE * maxRatio)) + 1;
+  targetFrames_ = bufferSize + quantumInputFrames;
 
-  for (size_t i = 0; i < channelCount_; ++i) {
-    buff_[i] = std::make_shared<CircularOverflowableAudioArray>(bufferSize);
-  }
+  ring_ = std::make_unique<SpscAudioRing>(4 * targetFrames_, channelCount_, sampleRate);
+  resampler_ = std::make_unique<PolyphaseResampler>(
+      channelCount_,
+      sampleRate,
+      contextSampleRate,
+      ResamplerQuality::MEDIUM,
+      quantumInputFrames,
+      true);
+  inputBus_ = std::make_shared<AudioBus>(quantumInputFrames, channelCount_, sampleRate);
+  inputOffset_ = 0;
+  inputFrames_ = 0;
+  fillError_ = 0.0;
+  isPrebuffering_ = true;
 
-  // This assumes that the sample rate is the same in audio context and recorder.
-  // (recorder is not enforcing any sample rate on the system*). This means that only
-  // channel mixing might be required. To do so, we create an output bus with
-  // the desired channel count and will take advantage of the AudioBus sum method.
-  //
-  // * any allocations required by the recorder (including this method) are during recording start
-  // or after, which means that audio context has already setup the system in 99% of sane cases.
-  // But if we would like to support cases when context is created on the fly during recording,
-  // we would need to add sample rate conversion as well or other weird bullshit like resampling
-  // context output and not enforcing anything on the system output/input configuration.
-  // A lot of words for a couple of lines of implementation :shrug:
+  // Channel mixing is done by AudioBus sum method.
   adapterOutputBus_ =
-      std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
+      std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, channelCount_, contextSampleRate);
   isInitialized_ = true;
 }
 
 void RecorderAdapterNode::cleanup() {
   isInitialized_ = false;
-  buff_.clear();
+  ring_.reset();
+  resampler_.reset();
+  inputBus_.reset();
   adapterOutputBus_.reset();
 }
 
+void RecorderAdapterNode::write(const float *const *data, size_t frames) {
+  if (ring_ != nullptr) {
+    ring_->write(data, frames);
+  }
+}
+
+void RecorderAdapterNode::writeInterleaved(const float *data, size_t frames) {
+  if (ring_ != nullptr) {
+    ring_->writeInterleaved(data, frames);
+  }
+}
+
+int RecorderAdapterNode::getChannelCount() const {
+  return channelCount_;
+}
+
+size_t RecorderAdapterNode::getBufferedFrames() const {
+  return ring_ != nullptr ? ring_->getAvailableFrames() + inputFrames_ : 0;
+}
+
 std::shared_ptr<AudioBus> RecorderAdapterNode::processNode(
     const std::shared_ptr<AudioBus> &processingBus,
     int framesToProcess) {
@@ -67,11 +97,60 @@ std::shared_ptr<AudioBus> RecorderAdapterNode::processNode(
 }
 
 void RecorderAdapterNode::readFrames(const size_t framesToRead) {
-  adapterOutputBus_->zero();
+  if (isPrebuffering_) {
+    if (ring_->getAvailableFrames() < targetFrames_) {
+      adapterOutputBus_->zero();
+      return;
+    }
 
-  for (size_t channel = 0; channel < channelCount_; ++channel) {
-    buff_[channel]->read(adapterOutputBus_->getChannel(channel)->getData(), framesToRead);
+    isPrebuffering_ = false;
   }
+
+  compensateDrift();
+
+  std::array<const float *, MAX_CHANNEL_COUNT> input{};
+  std::array<float *, MAX_CHANNEL_COUNT> output{};
+  size_t framesRead = 0;
+
+  while (framesRead < framesToRead) {
+    if (inputFrames_ == 0) {
+      inputOffset_ = 0;
+      inputFrames_ = ring_->read(inputBus_.get(), 0, inputBus_->getSize());
+
+      if (inputFrames_ == 0) {
+        adapterOutputBus_->zero(framesRead, framesToRead - framesRead);
+        isPrebuffering_ = true;
+        return;
+      }
+    }
+
+    for (int channel = 0; channel < channelCount_; ++channel) {
+      input[channel] = inputBus_->getChannel(channel)->getData() + inputOffset_;
+      output[channel] = adapterOutputBus_->getChannel(channel)->getData() + framesRead;
+    }
+
+    auto framesConsumed = inputFrames_;
+    framesRead += resampler_->process(
+        input.data(), framesConsumed, output.data(), framesToRead - framesRead);
+    inputOffset_ += framesConsumed;
+    inputFrames_ -= framesConsumed;
+  }
+}
+
+void RecorderAdapterNode::compensateDrift() {
+  auto bufferedFrames = static_cast<double>(getBufferedFrames());
+  auto targetFrames = static_cast<double>(targetFrames_);
+
+  // a large backlog, e.g. after the audio thread stalled, is dropped at once
+  if (bufferedFrames > 3.0 * targetFrames) {
+    ring_->skip(ring_->getAvailableFrames() - targetFrames_);
+    bufferedFrames = static_cast<double>(getBufferedFrames());
+    fillError_ = 0.0;
+  }
+
+  fillError_ += DRIFT_SMOOTHING * ((bufferedFrames - targetFrames) / targetFrames - fillError_);
+  resampler_->setRatioAdjustment(
+      1.0 + std::clamp(DRIFT_GAIN * fillError_, -MAX_DRIFT_CORRECTION, MAX_DRIFT_CORRECTION));
 }
 
 } // namespace audioapi
@@ -4,7 +4,8 @@
 #include <audioapi/core/AudioParam.h>
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/inputs/AudioRecorder.h>
-#include <audioapi/utils/CircularOverflowableAudioArray.h>
+#include <audioapi/dsp/PolyphaseResampler.h>
+#include <audioapi/utils/SpscAudioRing.h>
 #include <memory>
 #include <vector>
 
@@ -13,8 +14,10 @@ namespace audioapi {
 class AudioBus;
 
 /// @brief RecorderAdapterNode is an AudioNode which adapts push Recorder into pull graph.
-/// It uses RingBuffer to store audio data and AudioParam to provide audio data in pull mode.
-/// It is used to connect native audio recording APIs with Audio API.
+/// The recorder thread pushes frames to a lock-free ring shared by all channels, the audio
+/// thread pulls them through a resampler converting from the recorder to the context rate.
+/// Input and output devices run on separate clocks, so the resampling ratio is fine-tuned
+/// to keep the ring fill level around a target, which absorbs the drift between them.
 ///
 /// @note it will push silence if it is not connected to any Recorder
 class RecorderAdapterNode : public AudioNode {
@@ -23,14 +26,22 @@ class RecorderAdapterNode : public AudioNode {
 
   /// @brief Initialize the RecorderAdapterNode with a buffer size and channel count.
   /// @note This method should be called ONLY ONCE when the buffer size is known.
-  /// @param bufferSize The size of the buffer to be used.
+  /// @param bufferSize The maximum number of frames pushed by the recorder at once.
   /// @param channelCount The number of channels.
-  void init(size_t bufferSize, int channelCount);
+  /// @param sampleRate The sample rate of the recorder.
+  void init(size_t bufferSize, int channelCount, float sampleRate);
   void cleanup();
 
-  int channelCount_;
-  // TODO: CircularOverflowableAudioBus
-  std::vector<std::shared_ptr<CircularOverflowableAudioArray>> buff_;
+  /// @brief Recorder thread, pushes planar frames of every channel.
+  /// @note Frames which do not fit in the ring are dropped.
+  void write(const float *const *data, size_t frames);
+  /// @brief Recorder thread, pushes interleaved frames of every channel.
+  /// @note Frames which do not fit in the ring are dropped.
+  void writeInterleaved(const float *data, size_t frames);
+
+  [[nodiscard]] int getChannelCount() const;
+  /// @brief Number of recorder frames waiting to be played.
+  [[nodiscard]] size_t getBufferedFrames() const;
 
  protected:
   std::shared_ptr<AudioBus> processNode(
@@ -39,10 +50,33 @@ class RecorderAdapterNode : public AudioNode {
   std::shared_ptr<AudioBus> adapterOutputBus_;
 
  private:
-  /// @brief Read audio frames from the recorder's internal circular buffer into output buss.
-  /// @note If `framesToRead` is greater than the number of available frames, it will fill empty space with silence.
+  // the fill level error is smoothed over roughly a hundred render quanta and
+  // limits the correction to 0.2%, about 3.5 cents
+  static constexpr double DRIFT_SMOOTHING = 0.01;
+  static constexpr double DRIFT_GAIN = 0.005;
+  static constexpr double MAX_DRIFT_CORRECTION = 0.002;
+
+  int channelCount_ = 0;
+  std::unique_ptr<SpscAudioRing> ring_;
+  std::unique_ptr<PolyphaseResampler> resampler_;
+
+  // recorder frames taken from the ring, not yet consumed by the resampler
+  std::shared_ptr<AudioBus> inputBus_;
+  size_t inputOffset_ = 0;
+  size_t inputFrames_ = 0;
+
+  size_t targetFrames_ = 0;
+  double fillError_ = 0.0;
+  double ratioAdjustment_ = 1.0;
+  bool isPrebuffering_ = true;
+
+  /// @brief Read audio frames from the ring through the resampler into the output bus.
+  /// @note When the ring runs dry, it fills the rest with silence and waits for the ring to
+  /// refill up to the target level.
   /// @param framesToRead Number of frames to read.
   void readFrames(size_t framesToRead);
+  /// @brief Adjusts the resampling ratio towards the target fill level.
+  void compensateDrift();
 };
 
 } // namespace audioapi
@@ -0,0 +1,486 @@
+#include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/sources/SamplerNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/Locker.h>
+#include <audioapi/core/utils/PcmStorage.h>
+#include <audioapi/dsp/Interpolation.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+SamplerNode::SamplerNode(
+    std::shared_ptr<BaseAudioContext> context,
+    size_t maxPolyphony,
+    VoiceStealingPolicy voiceStealing)
+    : AudioNode(context),
+      maxPolyphony_(maxPolyphony),
+      voiceStealing_(voiceStealing),
+      attack_(0.002f),
+      decay_(0.1f),
+      sustain_(1.0f),
+      release_(0.1f),
+      activeVoiceCount_(0),
+      voices_(maxPolyphony),
+      readIndices_(RENDER_QUANTUM_SIZE),
+      readFractions_(RENDER_QUANTUM_SIZE),
+      gains_(RENDER_QUANTUM_SIZE),
+      voiceSamples_(RENDER_QUANTUM_SIZE),
+      tapIndices_(2 * RENDER_QUANTUM_SIZE),
+      tapReadIndices_(RENDER_QUANTUM_SIZE),
+      taps_(2 * RENDER_QUANTUM_SIZE) {
+  numberOfInputs_ = 0;
+  pendingEvents_.reserve(kEventCapacity);
+
+  // the channel holds one element less than its capacity
+  auto [sender, receiver] = channels::spsc::channel<
+      NoteEvent,
+      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
+      channels::spsc::WaitStrategy::BUSY_LOOP>(kEventCapacity + 1);
+  eventSender_ = std::move(sender);
+  eventReceiver_ = std::move(receiver);
+
+  isInitialized_ = true;
+}
+
+SamplerNode::~SamplerNode() {
+  Locker locker(regionsLock_);
+  regions_.clear();
+}
+
+size_t SamplerNode::getMaxPolyphony() const {
+  return maxPolyphony_;
+}
+
+std::string SamplerNode::getVoiceStealing() const {
+  return SamplerNode::voiceStealingToString(voiceStealing_);
+}
+
+size_t SamplerNode::getActiveVoiceCount() const {
+  return activeVoiceCount_.load(std::memory_order_relaxed);
+}
+
+float SamplerNode::getAttack() const {
+  return attack_.load(std::memory_order_relaxed);
+}
+
+float SamplerNode::getDecay() const {
+  return decay_.load(std::memory_order_relaxed);
+}
+
+float SamplerNode::getSustain() const {
+  return sustain_.load(std::memory_order_relaxed);
+}
+
+float SamplerNode::getRelease() const {
+  return release_.load(std::memory_order_relaxed);
+}
+
+void SamplerNode::setAttack(float attack) {
+  attack_.store(std::max(attack, 0.0f), std::memory_order_relaxed);
+}
+
+void SamplerNode::setDecay(float decay) {
+  decay_.store(std::max(decay, 0.0f), std::memory_order_relaxed);
+}
+
+void SamplerNode::setSustain(float sustain) {
+  sustain_.store(std::clamp(sustain, 0.0f, 1.0f), std::memory_order_relaxed);
+}
+
+void SamplerNode::setRelease(float release) {
+  release_.store(std::max(release, 0.0f), std::memory_order_relaxed);
+}
+
+void SamplerNode::setRegions(const std::vector<SamplerRegion> &regions) {
+  std::shared_ptr<BaseAudioContext> context = context_.lock();
+  if (context == nullptr) {
+    return;
+  }
+
+  std::vector<PreparedRegion> preparedRegions;
+  preparedRegions.reserve(regions.size());
+
+  for (const auto &region : regions) {
+    // linear interpolation reads one frame past the read index
+    if (region.buffer == nullptr || region.buffer->getLength() < 2) {
+      continue;
+    }
+
+    double bufferSampleRate = region.buffer->getSampleRate();
+
+    PreparedRegion prepared;
+    prepared.region = region;
+    // buffers kept as PCM storage are never expanded to float, which would defeat
+    // the memory savings of large sample libraries
+    prepared.storage = region.buffer->getPcmStorage();
+    if (prepared.storage == nullptr) {
+      prepared.bus = region.buffer->acquireBus();
+    }
+    prepared.numberOfChannels = region.buffer->getNumberOfChannels();
+    prepared.lastFrame = static_cast<double>(region.buffer->getLength() - 1);
+    prepared.loopStartFrame =
+        std::clamp(region.loopStart * bufferSampleRate, 0.0, prepared.lastFrame);
+    prepared.loopEndFrame = region.loopEnd > 0.0
+        ? std::clamp(region.loopEnd * bufferSampleRate, 0.0, prepared.lastFrame)
+        : prepared.lastFrame;
+    prepared.region.loop = region.loop && prepared.loopEndFrame > prepared.loopStartFrame;
+    prepared.rateScale = bufferSampleRate / context->getSampleRate();
+
+    if (prepared.storage != nullptr) {
+      auto prefetchFrames = static_cast<size_t>(PREFETCH_DURATION * bufferSampleRate);
+      prepared.storage->prefetch(0, prefetchFrames);
+      if (prepared.region.loop) {
+        prepared.storage->prefetch(static_cast<size_t>(prepared.loopStartFrame), prefetchFrames);
+      }
+    }
+
+    preparedRegions.push_back(std::move(prepared));
+  }
+
+  {
+    Locker locker(regionsLock_);
+    std::swap(regions_, preparedRegions);
+
+    // voices refer to regions by index, so they can not outlive the regions they play
+    for (auto &voice : voices_) {
+      voice.isActive = false;
+    }
+  }
+
+  // the previous regions are released here, outside of the lock
+}
+
+void SamplerNode::noteOn(int note, float velocity, double when, float detune) {
+  if (velocity <= 0.0f) {
+    sendEvent(NoteEventType::NOTE_OFF, note, 0.0f, 0.0f, when);
+    return;
+  }
+
+  sendEvent(NoteEventType::NOTE_ON, note, std::min(velocity, 1.0f), detune, when);
+}
+
+void SamplerNode::noteOff(int note, double when) {
+  sendEvent(NoteEventType::NOTE_OFF, note, 0.0f, 0.0f, when);
+}
+
+void SamplerNode::allNotesOff(double when) {
+  sendEvent(NoteEventType::ALL_NOTES_OFF, 0, 0.0f, 0.0f, when);
+}
+
+std::shared_ptr<AudioBus> SamplerNode::processNode(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int framesToProcess) {
+  processingBus->zero();
+
+  std::shared_ptr<BaseAudioContext> context = context_.lock();
+  if (context == nullptr) {
+    return processingBus;
+  }
+
+  auto locker = Locker::tryLock(regionsLock_);
+  if (!locker) {
+    return processingBus;
+  }
+
+  receiveEvents();
+
+  float sampleRate = context->getSampleRate();
+  size_t quantumStartFrame = context->getCurrentSampleFrame();
+  auto framesToRender = static_cast<size_t>(framesToProcess);
+  size_t offset = 0;
+
+  // the quantum is rendered in segments, so that every event applies at its exact frame
+  while (offset < framesToRender) {
+    size_t nextEventOffset = framesToRender;
+
+    for (size_t i = 0; i < pendingEvents_.size();) {
+      const auto &event = pendingEvents_[i];
+
+      if (event.frame <= quantumStartFrame + offset) {
+        handleEvent(event, sampleRate);
+        pendingEvents_.erase(pendingEvents_.begin() + static_cast<std::ptrdiff_t>(i));
+      } else {
+        nextEventOffset = std::min(nextEventOffset, event.frame - quantumStartFrame);
+        i += 1;
+      }
+    }
+
+    renderVoices(processingBus, offset, nextEventOffset - offset, sampleRate);
+    offset = nextEventOffset;
+  }
+
+  activeVoiceCount_.store(
+      std::count_if(
+          voices_.begin(), voices_.end(), [](const Voice &voice) { return voice.isActive; }),
+      std::memory_order_relaxed);
+
+  return processingBus;
+}
+
+void SamplerNode::sendEvent(
+    NoteEventType type,
+    int note,
+    float velocity,
+    float detune,
+    double when) {
+  std::shared_ptr<BaseAudioContext> context = context_.lock();
+  if (context == nullptr) {
+    return;
+  }
+
+  NoteEvent event;
+  event.type = type;
+  event.note = note;
+  event.velocity = velocity;
+  event.detune = detune;
+  event.frame = when > 0.0 ? static_cast<size_t>(std::round(when * context->getSampleRate())) : 0;
+
+  if (eventSender_.try_send(std::move(event)) != channels::spsc::ResponseStatus::SUCCESS) {
+    throw std::runtime_error(
+        "Sampler event queue is full, at most " + std::to_string(kEventCapacity) +
+        " events can wait for the audio thread");
+  }
+}
+
+void SamplerNode::receiveEvents() {
+  NoteEvent event;
+
+  // pending events never exceed the reserved capacity, so receiving does not allocate
+  while (pendingEvents_.size() < kEventCapacity &&
+         eventReceiver_.try_receive(event) == channels::spsc::ResponseStatus::SUCCESS) {
+    pendingEvents_.push_back(event);
+  }
+}
+
+void SamplerNode::handleEvent(const NoteEvent &event, float sampleRate) {
+  switch (event.type) {
+    case NoteEventType::NOTE_ON:
+      startVoice(event);
+      break;
+
+    case NoteEventType::NOTE_OFF:
+      for (auto &voice : voices_) {
+        if (voice.isActive && voice.note == event.note && voice.stage != EnvelopeStage::RELEASE) {
+          releaseVoice(voice, sampleRate);
+        }
+      }
+      break;
+
+    case NoteEventType::ALL_NOTES_OFF:
+      for (auto &voice : voices_) {
+        if (voice.isActive && voice.stage != EnvelopeStage::RELEASE) {
+          releaseVoice(voice, sampleRate);
+        }
+      }
+      break;
+  }
+}
+
+void SamplerNode::startVoice(const NoteEvent &event) {
+  auto region = std::find_if(regions_.begin(), regions_.end(), [&](const PreparedRegion &r) {
+    return event.note >= r.region.lowNote && event.note <= r.region.highNote &&
+        event.velocity >= r.region.lowVelocity && event.velocity <= r.region.highVelocity;
+  });
+
+  if (region == regions_.end()) {
+    return;
+  }
+
+  Voice *voice = allocateVoice();
+  if (voice == nullptr) {
+    return;
+  }
+
+  auto semitones = static_cast<double>(event.note - region->region.rootNote);
+
+  voice->isActive = true;
+  voice->regionIndex = static_cast<size_t>(std::distance(regions_.begin(), region));
+  voice->note = event.note;
+  voice->position = 0.0;
+  voice->rate =
+      region->rateScale * std::pow(2.0, semitones / 12.0 + event.detune / 1200.0);
+  voice->gain = event.velocity * region->region.gain;
+  voice->stage = EnvelopeStage::ATTACK;
+  voice->level = 0.0f;
+  voice->releaseStep = 0.0f;
+  voice->startIndex = nextStartIndex_++;
+}
+
+void SamplerNode::releaseVoice(Voice &voice, float sampleRate) {
+  float releaseFrames = release_.load(std::memory_order_relaxed) * sampleRate;
+
+  voice.stage = EnvelopeStage::RELEASE;
+  voice.releaseStep = voice.level / std::max(releaseFrames, 1.0f);
+}
+
+SamplerNode::Voice *SamplerNode::allocateVoice() {
+  Voice *stolenVoice = nullptr;
+
+  for (auto &voice : voices_) {
+    if (!voice.isActive) {
+      return &voice;
+    }
+
+    if (voiceStealing_ == VoiceStealingPolicy::NONE) {
+      continue;
+    }
+
+    if (stolenVoice == nullptr) {
+      stolenVoice = &voice;
+      continue;
+    }
+
+    // released voices are stolen first, as they are already fading out
+    bool isReleased = voice.stage == EnvelopeStage::RELEASE;
+    bool isStolenReleased = stolenVoice->stage == EnvelopeStage::RELEASE;
+
+    if (isReleased != isStolenReleased) {
+      if (isReleased) {
+        stolenVoice = &voice;
+      }
+      continue;
+    }
+
+    bool isBetterCandidate = voiceStealing_ == VoiceStealingPolicy::OLDEST
+        ? voice.startIndex < stolenVoice->startIndex
+        : voice.level * voice.gain < stolenVoice->level * stolenVoice->gain;
+
+    if (isBetterCandidate) {
+      stolenVoice = &voice;
+    }
+  }
+
+  return stolenVoice;
+}
+
+void SamplerNode::renderVoices(
+    const std::shared_ptr<AudioBus> &processingBus,
+    size_t startOffset,
+    size_t framesToRender,
+    float sampleRate) {
+  if (framesToRender == 0) {
+    return;
+  }
+
+  for (auto &voice : voices_) {
+    if (!voice.isActive) {
+      continue;
+    }
+
+    const auto &region = regions_[voice.regionIndex];
+    size_t voiceFrames = prepareVoice(voice, region, framesToRender, sampleRate);
+    int sourceChannels = region.numberOfChannels;
+
+    if (region.storage != nullptr) {
+      // positions never reach the last frame, so the next one is always in the buffer
+      for (size_t i = 0; i < voiceFrames; i += 1) {
+        tapIndices_[2 * i] = readIndices_[i];
+        tapIndices_[2 * i + 1] = readIndices_[i] + 1;
+        tapReadIndices_[i] = 2 * i;
+      }
+    }
+
+    for (int channel = 0; channel < processingBus->getNumberOfChannels(); channel += 1) {
+      // channels missing from the buffer repeat its last channel, e.g. mono samples
+      if (channel < sourceChannels) {
+        if (region.storage != nullptr) {
+          region.storage->gather(channel, tapIndices_.data(), 2 * voiceFrames, taps_.data());
+          dsp::interpolate(
+              InterpolationType::LINEAR,
+              taps_.data(),
+              tapReadIndices_.data(),
+              readFractions_.data(),
+              voiceSamples_.data(),
+              voiceFrames);
+        } else {
+          dsp::interpolate(
+              InterpolationType::LINEAR,
+              region.bus->getChannel(channel)->getData(),
+              readIndices_.data(),
+              readFractions_.data(),
+              voiceSamples_.data(),
+              voiceFrames);
+        }
+        dsp::multiply(voiceSamples_.data(), gains_.data(), voiceSamples_.data(), voiceFrames);
+      }
+
+      float *destination = processingBus->getChannel(channel)->getData() + startOffset;
+      dsp::add(voiceSamples_.data(), destination, destination, voiceFrames);
+    }
+  }
+}
+
+size_t SamplerNode::prepareVoice(
+    Voice &voice,
+    const PreparedRegion &region,
+    size_t framesToRender,
+    float sampleRate) {
+  float sustain = sustain_.load(std::memory_order_relaxed);
+  float attackStep = 1.0f / std::max(attack_.load(std::memory_order_relaxed) * sampleRate, 1.0f);
+  float decayStep =
+      (1.0f - sustain) / std::max(decay_.load(std::memory_order_relaxed) * sampleRate, 1.0f);
+  double loopLength = region.loopEndFrame - region.loopStartFrame;
+
+  for (size_t i = 0; i < framesToRender; i += 1) {
+    switch (voice.stage) {
+      case EnvelopeStage::ATTACK:
+        voice.level += attackStep;
+        if (voice.level >= 1.0f) {
+          voice.level = 1.0f;
+          voice.stage = EnvelopeStage::DECAY;
+        }
+        break;
+
+      case EnvelopeStage::DECAY:
+        voice.level -= decayStep;
+        if (voice.level <= sustain) {
+          voice.level = sustain;
+          voice.stage = EnvelopeStage::SUSTAIN;
+        }
+        break;
+
+      case EnvelopeStage::SUSTAIN:
+        voice.level = sustain;
+        break;
+
+      case EnvelopeStage::RELEASE:
+        voice.level -= voice.releaseStep;
+        if (voice.level <= 0.0f) {
+          voice.isActive = false;
+          return i;
+        }
+        break;
+    }
+
+    auto readIndex = static_cast<size_t>(voice.position);
+    readIndices_[i] = readIndex;
+    readFractions_[i] = static_cast<float>(voice.position - static_cast<double>(readIndex));
+    gains_[i] = voice.level * voice.gain;
+
+    voice.position += voice.rate;
+
+    if (region.region.loop) {
+      if (voice.position >= region.loopEndFrame) {
+        voice.position =
+            region.loopStartFrame + std::fmod(voice.position - region.loopStartFrame, loopLength);
+      }
+    } else if (voice.position >= region.lastFrame) {
+      voice.isActive = false;
+      return i + 1;
+    }
+  }
+
+  return framesToRender;
+}
+
+} // namespace audioapi
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <audioapi/core/AudioNode.h>
+#include <audioapi/core/types/VoiceStealingPolicy.h>
+#include <audioapi/utils/SpscChannel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBus;
+class AudioBuffer;
+class PcmStorage;
+
+/// @brief Maps a range of notes and velocities to a buffer.
+struct SamplerRegion {
+  std::shared_ptr<AudioBuffer> buffer;
+  // note at which the buffer plays at its original pitch
+  int rootNote = 60;
+  int lowNote = 0;
+  int highNote = 127;
+  float lowVelocity = 0.0f;
+  float highVelocity = 1.0f;
+  float gain = 1.0f;
+  bool loop = false;
+  // in seconds, a loop end of 0 loops up to the end of the buffer
+  double loopStart = 0.0;
+  double loopEnd = 0.0;
+};
+
+#define SAMPLER_NODE_SPSC_OPTIONS \
+  NoteEvent, channels::spsc::OverflowStrategy::WAIT_ON_FULL, \
+      channels::spsc::WaitStrategy::BUSY_LOOP
+
+/// @brief Plays buffer regions in response to note events, using a fixed pool of voices.
+/// Every voice has its own playback rate, gain and ADSR envelope, and all of them are mixed
+/// into the output of the node, so a polyphonic instrument needs a single node.
+/// When every voice is busy, a note-on steals a voice according to the stealing policy,
+/// preferring voices which are already released.
+class SamplerNode : public AudioNode {
+ public:
+  explicit SamplerNode(
+      std::shared_ptr<BaseAudioContext> context,
+      size_t maxPolyphony,
+      VoiceStealingPolicy voiceStealing);
+  ~SamplerNode() override;
+
+  [[nodiscard]] size_t getMaxPolyphony() const;
+  [[nodiscard]] std::string getVoiceStealing() const;
+  /// @brief Number of voices which were playing at the end of the last render quantum.
+  [[nodiscard]] size_t getActiveVoiceCount() const;
+
+  [[nodiscard]] float getAttack() const;
+  [[nodiscard]] float getDecay() const;
+  [[nodiscard]] float getSustain() const;
+  [[nodiscard]] float getRelease() const;
+  /// @note Times are in seconds, changes also apply to playing voices which are not released.
+  void setAttack(float attack);
+  void setDecay(float decay);
+  void setSustain(float sustain);
+  void setRelease(float release);
+
+  /// @brief Replaces the regions of the sampler, silencing every voice.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void setRegions(const std::vector<SamplerRegion> &regions);
+
+  // scheduled events waiting for the audio thread, and events it keeps until their frame,
+  // one less than a power of two as that is what the event channel holds
+  static constexpr size_t kEventCapacity = 255;
+
+  /// @brief Schedules a note at the given context time, times in the past apply immediately.
+  /// @param velocity Scales the gain of the voice and selects the region, in range [0, 1].
+  /// @param detune Offset of the playback rate of the voice in cents.
+  /// @throws std::runtime_error when the event queue is full, it holds kEventCapacity events
+  /// which the audio thread has not received yet.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void noteOn(int note, float velocity, double when, float detune);
+  void noteOff(int note, double when);
+  void allNotesOff(double when);
+
+  static VoiceStealingPolicy voiceStealingFromString(const std::string &policy) {
+    std::string lowerPolicy = policy;
+    std::transform(lowerPolicy.begin(), lowerPolicy.end(), lowerPolicy.begin(), ::tolower);
+
+    if (lowerPolicy == "none")
+      return VoiceStealingPolicy::NONE;
+    if (lowerPolicy == "oldest")
+      return VoiceStealingPolicy::OLDEST;
+    if (lowerPolicy == "quietest")
+      return VoiceStealingPolicy::QUIETEST;
+
+    throw std::invalid_argument("Unknown voice stealing policy: " + policy);
+  }
+
+  static std::string voiceStealingToString(VoiceStealingPolicy policy) {
+    switch (policy) {
+      case VoiceStealingPolicy::NONE:
+        return "none";
+      case VoiceStealingPolicy::OLDEST:
+        return "oldest";
+      case VoiceStealingPolicy::QUIETEST:
+        return "quietest";
+      default:
+        throw std::invalid_argument("Unknown voice stealing policy");
+    }
+  }
+
+ protected:
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override;
+
+ private:
+  enum class NoteEventType { NOTE_ON, NOTE_OFF, ALL_NOTES_OFF };
+  enum class EnvelopeStage { ATTACK, DECAY, SUSTAIN, RELEASE };
+
+  struct NoteEvent {
+    NoteEventType type = NoteEventType::NOTE_ON;
+    int note = 0;
+    float velocity = 0.0f;
+    float detune = 0.0f;
+    size_t frame = 0;
+  };
+
+  /// @brief Region with its samples and frame positions resolved on the JS thread.
+  /// PCM storage is read in place and converted only for the frames voices play.
+  struct PreparedRegion {
+    SamplerRegion region;
+    std::shared_ptr<AudioBus> bus;
+    std::shared_ptr<PcmStorage> storage;
+    int numberOfChannels = 0;
+    double lastFrame = 0.0;
+    double loopStartFrame = 0.0;
+    double loopEndFrame = 0.0;
+    // converts the sample rate of the buffer to the sample rate of the context
+    double rateScale = 1.0;
+  };
+
+  struct Voice {
+    bool isActive = false;
+    size_t regionIndex = 0;
+    int note = 0;
+    double position = 0.0;
+    double rate = 1.0;
+    float gain = 0.0f;
+    EnvelopeStage stage = EnvelopeStage::ATTACK;
+    float level = 0.0f;
+    float releaseStep = 0.0f;
+    // order in which the voices were started, the lowest one is the oldest
+    uint64_t startIndex = 0;
+  };
+
+  size_t maxPolyphony_;
+  VoiceStealingPolicy voiceStealing_;
+
+  std::atomic<float> attack_;
+  std::atomic<float> decay_;
+  std::atomic<float> sustain_;
+  std::atomic<float> release_;
+  std::atomic<size_t> activeVoiceCount_;
+
+  std::mutex regionsLock_;
+  std::vector<PreparedRegion> regions_;
+
+  channels::spsc::Sender<SAMPLER_NODE_SPSC_OPTIONS> eventSender_;
+  channels::spsc::Receiver<SAMPLER_NODE_SPSC_OPTIONS> eventReceiver_;
+
+  // audio thread state
+  std::vector<NoteEvent> pendingEvents_;
+  std::vector<Voice> voices_;
+  uint64_t nextStartIndex_ = 0;
+
+  // per voice positions and gains for a render quantum, shared by all channels
+  std::vector<size_t> readIndices_;
+  std::vector<float> readFractions_;
+  std::vector<float> gains_;
+  std::vector<float> voiceSamples_;
+
+  // Frames of PCM storage hinted to be loaded when the regions are set, where voices start.
+  static constexpr double PREFETCH_DURATION = 1.0;
+  // Both taps of every position gathered from PCM storage.
+  std::vector<size_t> tapIndices_;
+  std::vector<size_t> tapReadIndices_;
+  std::vector<float> taps_;
+
+  void sendEvent(NoteEventType type, int note, float velocity, float detune, double when);
+  void receiveEvents();
+  void handleEvent(const NoteEvent &event, float sampleRate);
+  void startVoice(const NoteEvent &event);
+  void releaseVoice(Voice &voice, float sampleRate);
+  Voice *allocateVoice();
+
+  void renderVoices(
+      const std::shared_ptr<AudioBus> &processingBus,
+      size_t startOffset,
+      size_t framesToRender,
+      float sampleRate);
+  /// @brief Computes read positions and envelope gains of the voice into the scratch buffers.
+  /// @return Number of frames the voice plays for, the voice is stopped when it ends early.
+  size_t prepareVoice(
+      Voice &voice,
+      const PreparedRegion &region,
+      size_t framesToRender,
+      float sampleRate);
+};
+
+#undef SAMPLER_NODE_SPSC_OPTIONS
+
+} // namespace audioapi
@@ -10,10 +10,10 @@
 
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/StreamerNode.h>
-#include <audioapi/core/utils/Locker.h>
 #include <audioapi/dsp/VectorMath.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <memory>
@@ -32,10 +32,9 @@ StreamerNode::StreamerNode(std::shared_ptr<BaseAudioContext> context)
       frame_(nullptr),
       swrCtx_(nullptr),
       resampledData_(nullptr),
-      bufferedBus_(nullptr),
       audio_stream_index_(-1),
       maxResampledSamples_(0),
-      processedSamples_(0) {}
+      isNodeFinished_(false) {}
 #else
 StreamerNode::StreamerNode(std::shared_ptr<BaseAudioContext> context) : AudioScheduledSourceNode(context) {}
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
@@ -84,13 +83,17 @@ bool StreamerNode::initialize(const std::string &input_url) {
   audioBus_ =
       std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
 
-  auto [sender, receiver] = channels::spsc::channel<
-      StreamingData,
-      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
-      channels::spsc::WaitStrategy::ATOMIC_WAIT>(CHANNEL_CAPACITY);
-  sender_ = std::move(sender);
-  receiver_ = std::move(receiver);
-
+  auto sampleRate = context->getSampleRate();
+  auto prebufferFrames =
+      static_cast<size_t>(prebufferDuration_.load(std::memory_order_acquire) * sampleRate);
+  auto capacityFrames =
+      prebufferFrames + static_cast<size_t>(STREAMER_NODE_HEADROOM_DURATION * sampleRate);
+  auto chunkCount = (capacityFrames + STREAMER_NODE_CHUNK_SIZE - 1) / STREAMER_NODE_CHUNK_SIZE;
+  jitterBuffer_ = std::make_unique<StreamJitterBuffer>(
+      channelCount_, sampleRate, STREAMER_NODE_CHUNK_SIZE, chunkCount, prebufferFrames);
+  outputPlanes_.resize(channelCount_);
+
+  isNodeFinished_.store(false, std::memory_order_release);
   streamingThread_ = std::thread(&StreamerNode::streamAudio, this);
   isInitialized_ = true;
   return true;
@@ -118,43 +121,33 @@ std::shared_ptr<AudioBus> StreamerNode::processNode(
     return processingBus;
   }
 
-  int bufferRemaining = bufferedBusSize_ - processedSamples_;
-  int alreadyProcessed = 0;
-  if (bufferRemaining < framesToProcess) {
-    if (bufferedBus_ != nullptr) {
-      for (int ch = 0; ch < processingBus->getNumberOfChannels(); ch++) {
-        memcpy(
-            processingBus->getChannel(ch)->getData(),
-            bufferedBus_->getChannel(ch)->getData() + processedSamples_,
-            bufferRemaining * sizeof(float));
-      }
-      framesToProcess -= bufferRemaining;
-      alreadyProcessed += bufferRemaining;
-    }
-    StreamingData data;
-    auto res = receiver_.try_receive(data);
-    if (res == channels::spsc::ResponseStatus::SUCCESS) {
-      bufferedBus_ = std::make_shared<AudioBus>(std::move(data.bus));
-      bufferedBusSize_ = data.size;
-      processedSamples_ = 0;
-    } else {
-      bufferedBus_ = nullptr;
-    }
-  }
-  if (bufferedBus_ != nullptr) {
-    for (int ch = 0; ch < processingBus->getNumberOfChannels(); ch++) {
-      memcpy(
-          processingBus->getChannel(ch)->getData() + alreadyProcessed,
-          bufferedBus_->getChannel(ch)->getData() + processedSamples_,
-          framesToProcess * sizeof(float));
-    }
-    processedSamples_ += framesToProcess;
-  }
+  jitterBuffer_->read(processingBus.get(), startOffset, offsetLength);
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 
   return processingBus;
 }
 
+void StreamerNode::setPrebufferDuration(double prebufferDuration) {
+  prebufferDuration_.store(std::max(prebufferDuration, 0.0), std::memory_order_release);
+}
+
+double StreamerNode::getPrebufferDuration() const {
+  return prebufferDuration_.load(std::memory_order_acquire);
+}
+
+double StreamerNode::getBufferedDuration() const {
+  std::shared_ptr<BaseAudioContext> context = context_.lock();
+  if (context == nullptr || jitterBuffer_ == nullptr) {
+    return 0.0;
+  }
+
+  return static_cast<double>(jitterBuffer_->getBufferedFrames()) / context->getSampleRate();
+}
+
+size_t StreamerNode::getUnderrunCount() const {
+  return jitterBuffer_ == nullptr ? 0 : jitterBuffer_->getUnderrunCount();
+}
+
 #if !RN_AUDIO_API_FFMPEG_DISABLED
 bool StreamerNode::setupResampler(float outSampleRate) {
   // Allocate resampler context
@@ -193,31 +186,71 @@ bool StreamerNode::setupResampler(float outSampleRate) {
 
 void StreamerNode::streamAudio() {
   while (!isNodeFinished_.load(std::memory_order_acquire)) {
-    if (av_read_frame(fmtCtx_, pkt_) < 0) {
-      return;
-    }
-    if (pkt_->stream_index == audio_stream_index_) {
-      if (avcodec_send_packet(codecCtx_, pkt_) != 0) {
-        return;
-      }
-      if (avcodec_receive_frame(codecCtx_, frame_) != 0) {
-        return;
-      }
-      std::shared_ptr<BaseAudioContext> context = context_.lock();
-      if (context == nullptr) {
-        return;
+    // end of the stream, drain the frames left in the decoder
+    bool isEndOfStream = av_read_frame(fmtCtx_, pkt_) < 0;
+
+    if (isEndOfStream || pkt_->stream_index == audio_stream_index_) {
+      if (avcodec_send_packet(codecCtx_, isEndOfStream ? nullptr : pkt_) != 0) {
+        break;
       }
-      if (!processFrameWithResampler(frame_, context)) {
-        return;
+
+      while (avcodec_receive_frame(codecCtx_, frame_) == 0) {
+        std::shared_ptr<BaseAudioContext> context = context_.lock();
+        if (context == nullptr || !processFrameWithResampler(frame_, context)) {
+          av_packet_unref(pkt_);
+          return;
+        }
       }
     }
+
     av_packet_unref(pkt_);
+
+    if (isEndOfStream) {
+      break;
+    }
   }
+
+  // play out what is buffered without waiting for the prebuffer
+  jitterBuffer_->finish();
 }
 
 bool StreamerNode::processFrameWithResampler(AVFrame *frame, std::shared_ptr<BaseAudioContext> context) {
-  // Check if we need to reallocate the resampled buffer
+  // if we would like to finish dont copy anything
+  if (this->isFinished()) {
+    return true;
+  }
+
   int out_samples = swr_get_out_samples(swrCtx_, frame->nb_samples);
+  if (out_samples < 0) {
+    return false;
+  }
+
+  // Convert the frame straight into the pooled chunk
+  if (static_cast<size_t>(out_samples) <= jitterBuffer_->getChunkSize()) {
+    size_t writeOffset = 0;
+    auto *chunk = jitterBuffer_->reserve(out_samples, writeOffset, isNodeFinished_);
+    if (chunk == nullptr) {
+      return false;
+    }
+
+    for (int ch = 0; ch < chunk->getNumberOfChannels(); ch++) {
+      outputPlanes_[ch] =
+          reinterpret_cast<uint8_t *>(chunk->getChannel(ch)->getData() + writeOffset);
+    }
+
+    int converted_samples = swr_convert(
+        swrCtx_, outputPlanes_.data(), out_samples, (const uint8_t **)frame->data, frame->nb_samples);
+
+    if (converted_samples < 0) {
+      return false;
+    }
+
+    jitterBuffer_->commit(converted_samples);
+    return true;
+  }
+
+  // Frames bigger than a chunk go through the resampled buffer,
+  // check if we need to reallocate it
   if (out_samples > maxResampledSamples_) {
     av_freep(&resampledData_[0]);
     av_freep(&resampledData_);
@@ -248,22 +281,10 @@ bool StreamerNode::processFrameWithResampler(AVFrame *frame, std::shared_ptr<Bas
     return false;
   }
 
-  // if we would like to finish dont copy anything
-  if (this->isFinished()) {
-    return true;
-  }
-  auto bus = AudioBus(
+  return jitterBuffer_->write(
+      reinterpret_cast<const float *const *>(resampledData_),
       static_cast<size_t>(converted_samples),
-      codecCtx_->ch_layout.nb_channels,
-      context->getSampleRate());
-  for (int ch = 0; ch < codecCtx_->ch_layout.nb_channels; ch++) {
-    auto *src = reinterpret_cast<float *>(resampledData_[ch]);
-    float *dst = bus.getChannel(ch)->getData();
-    memcpy(dst, src, converted_samples * sizeof(float));
-  }
-  StreamingData data{std::move(bus), static_cast<size_t>(converted_samples)};
-  sender_.send(std::move(data));
-  return true;
+      isNodeFinished_);
 }
 
 bool StreamerNode::openInput(const std::string &input_url) {
@@ -310,9 +331,6 @@ void StreamerNode::cleanup() {
   this->playbackState_ = PlaybackState::FINISHED;
   isNodeFinished_.store(true, std::memory_order_release);
   if (streamingThread_.joinable()) {
-    StreamingData dummy;
-    while (receiver_.try_receive(dummy) == channels::spsc::ResponseStatus::SUCCESS)
-      ; // clear the receiver
     streamingThread_.join();
   }
   if (swrCtx_ != nullptr) {
@@ -24,37 +24,22 @@ extern "C" {
 }
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 
-#include <audioapi/utils/SpscChannel.hpp>
+#include <audioapi/core/utils/StreamJitterBuffer.h>
 #include <atomic>
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
-
-static constexpr audioapi::channels::spsc::OverflowStrategy STREAMER_NODE_SPSC_OVERFLOW_STRATEGY =
-    audioapi::channels::spsc::OverflowStrategy::WAIT_ON_FULL;
-static constexpr audioapi::channels::spsc::WaitStrategy STREAMER_NODE_SPSC_WAIT_STRATEGY =
-    audioapi::channels::spsc::WaitStrategy::ATOMIC_WAIT;
+#include <vector>
 
 static constexpr bool VERBOSE = false;
-static constexpr int CHANNEL_CAPACITY = 32;
-
-struct StreamingData {
-  audioapi::AudioBus bus;
-  size_t size;
-  StreamingData() = default;
-  StreamingData(audioapi::AudioBus b, size_t s) : bus(b), size(s) {}
-  StreamingData(const StreamingData &data) : bus(data.bus), size(data.size) {}
-  StreamingData(StreamingData &&data) noexcept : bus(std::move(data.bus)), size(data.size) {}
-  StreamingData &operator=(const StreamingData &data) {
-    if (this == &data) {
-      return *this;
-    }
-    bus = data.bus;
-    size = data.size;
-    return *this;
-  }
-};
+
+// Frames of a single pooled chunk, big enough to hold most decoded frames.
+static constexpr size_t STREAMER_NODE_CHUNK_SIZE = 4096;
+static constexpr double STREAMER_NODE_DEFAULT_PREBUFFER_DURATION = 0.2;
+// How much audio can be buffered on top of the prebuffer, in seconds.
+static constexpr double STREAMER_NODE_HEADROOM_DURATION = 1.0;
 
 namespace audioapi {
 
@@ -74,6 +59,19 @@ class StreamerNode : public AudioScheduledSourceNode {
     return streamPath_;
   }
 
+  /**
+   * @brief Set how much audio has to be buffered before playback starts or
+   * resumes after an underrun, applied on the next initialize
+   */
+  void setPrebufferDuration(double prebufferDuration);
+  [[nodiscard]] double getPrebufferDuration() const;
+
+  /** @brief Duration of decoded audio waiting for playback, in seconds */
+  [[nodiscard]] double getBufferedDuration() const;
+
+  /** @brief Number of times playback ran out of data before the end of the stream */
+  [[nodiscard]] size_t getUnderrunCount() const;
+
  protected:
   std::shared_ptr<AudioBus> processNode(
       const std::shared_ptr<AudioBus> &processingBus,
@@ -82,6 +80,9 @@ class StreamerNode : public AudioScheduledSourceNode {
  private:
   std::string streamPath_;
 
+  std::atomic<double> prebufferDuration_ = STREAMER_NODE_DEFAULT_PREBUFFER_DURATION;
+  std::unique_ptr<StreamJitterBuffer> jitterBuffer_;
+
 #if !RN_AUDIO_API_FFMPEG_DISABLED
   AVFormatContext *fmtCtx_;
   AVCodecContext *codecCtx_;
@@ -91,24 +92,14 @@ class StreamerNode : public AudioScheduledSourceNode {
   AVFrame *frame_; // Frame that is currently being processed
   SwrContext *swrCtx_;
   uint8_t **resampledData_; // weird ffmpeg way of using raw byte pointers for resampled data
+  std::vector<uint8_t *> outputPlanes_; // pointers to the jitter buffer chunk being filled
 
-  std::shared_ptr<AudioBus> bufferedBus_; // audio bus for buffering hls frames
-  size_t bufferedBusSize_;                // size of currently buffered bus
-  int audio_stream_index_;                // index of the audio stream channel in the input
+  int audio_stream_index_; // index of the audio stream channel in the input
   int maxResampledSamples_;
-  size_t processedSamples_;
 
   std::thread streamingThread_;
   std::atomic<bool> isNodeFinished_;                         // Flag to control the streaming thread
   static constexpr int INITIAL_MAX_RESAMPLED_SAMPLES = 8192; // Initial size for resampled data
-  channels::spsc::
-      Sender<StreamingData, STREAMER_NODE_SPSC_OVERFLOW_STRATEGY, STREAMER_NODE_SPSC_WAIT_STRATEGY>
-          sender_;
-  channels::spsc::Receiver<
-      StreamingData,
-      STREAMER_NODE_SPSC_OVERFLOW_STRATEGY,
-      STREAMER_NODE_SPSC_WAIT_STRATEGY>
-      receiver_;
 
   /**
    * @brief Setting up the resampler
@@ -127,7 +118,7 @@ class StreamerNode : public AudioScheduledSourceNode {
   /**
    * @brief Thread function to continuously read and process audio frames
    * @details This function runs in a separate thread to avoid blocking the main audio processing thread
-   * @note It will read frames from the input stream, resample them, and store them in the buffered bus
+   * @note It will read frames from the input stream, resample them, and store them in the jitter buffer
    * @note The thread will stop when streamFlag is set to false
    */
   void streamAudio();
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+namespace audioapi {
+
+enum class AudioEventType : uint8_t {
+  ENDED,
+  LOOP_ENDED,
+  POSITION_CHANGED,
+  BUFFER_QUEUE_LOW,
+  AUDIO_READY,
+};
+
+} // namespace audioapi
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace audioapi {
+
+enum class InterpolationType { LINEAR, CUBIC, SINC };
+
+} // namespace audioapi
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace audioapi {
+
+enum class OscillatorMode { WAVETABLE, POLYBLEP };
+
+} // namespace audioapi
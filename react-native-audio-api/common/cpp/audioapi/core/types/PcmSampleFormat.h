@@ -0,0 +1,7 @@
+#pragma once
+
+namespace audioapi {
+
+enum class PcmSampleFormat { INT16, INT24, FLOAT16, FLOAT32 };
+
+} // namespace audioapi
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace audioapi {
+
+enum class PitchCorrectionQuality { HIGH, LOW };
+
+} // namespace audioapi
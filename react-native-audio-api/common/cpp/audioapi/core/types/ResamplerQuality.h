@@ -0,0 +1,7 @@
+#pragma once
+
+namespace audioapi {
+
+enum class ResamplerQuality { LOW, MEDIUM, HIGH };
+
+} // namespace audioapi
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace audioapi {
+
+enum class StretchAlgorithm { TDHS, SIGNALSMITH };
+
+} // namespace audioapi
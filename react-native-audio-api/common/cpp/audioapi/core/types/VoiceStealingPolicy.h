@@ -0,0 +1,7 @@
+#pragma once
+
+namespace audioapi {
+
+enum class VoiceStealingPolicy { NONE, OLDEST, QUIETEST };
+
+} // namespace audioapi
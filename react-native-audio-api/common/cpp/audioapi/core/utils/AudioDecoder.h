@@ -1,6 +1,7 @@
 #pragma once
 
 #include <audioapi/core/types/AudioFormat.h>
+#include <audioapi/core/types/PcmSampleFormat.h>
 #include <audioapi/libs/miniaudio/miniaudio.h>
 #include <algorithm>
 #include <cstring>
@@ -28,13 +29,19 @@ class AudioDecoder {
       float inputSampleRate,
       int inputChannelCount,
       bool interleaved);
+  /// Converts raw int16 or float32 samples without decoding them first.
+  /// @param outputSampleRate Rate to resample to, 0 keeps inputSampleRate.
+  [[nodiscard]] static std::shared_ptr<AudioBuffer> decodeWithPCMData(
+      const void *data,
+      size_t size,
+      PcmSampleFormat format,
+      float inputSampleRate,
+      int inputChannelCount,
+      bool interleaved,
+      float outputSampleRate);
 
  private:
-  static std::vector<float> readAllPcmFrames(ma_decoder &decoder, int outputChannels);
-  static std::shared_ptr<AudioBuffer> makeAudioBufferFromFloatBuffer(
-      const std::vector<float> &buffer,
-      float outputSampleRate,
-      int outputChannels);
+  static std::shared_ptr<AudioBuffer> readAllPcmFrames(ma_decoder &decoder, float sampleRate);
 
   static AudioFormat detectAudioFormat(const void *data, size_t size) {
     if (size < 12)
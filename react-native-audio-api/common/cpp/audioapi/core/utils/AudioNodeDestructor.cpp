@@ -8,12 +8,29 @@ namespace audioapi {
 
 AudioNodeDestructor::AudioNodeDestructor() {
   isExiting_.store(false, std::memory_order_release);
+
+  batches_.reserve(kBatchCount);
+  for (size_t i = 0; i < kBatchCount; i++) {
+    batches_.push_back(std::make_unique<Batch>());
+    batches_.back()->reserve(kBatchCapacity);
+  }
+
+  // the channels hold one element less than their capacity
   auto [sender, receiver] = channels::spsc::channel<
-      std::shared_ptr<AudioNode>,
+      Batch *,
       channels::spsc::OverflowStrategy::WAIT_ON_FULL,
-      channels::spsc::WaitStrategy::ATOMIC_WAIT>(kChannelCapacity);
+      channels::spsc::WaitStrategy::ATOMIC_WAIT>(kBatchCount + 1);
+  auto [freeBatchSender, freeBatchReceiver] = channels::spsc::channel<Batch *>(kBatchCount + 1);
   sender_ = std::move(sender);
-  workerHandle_ = std::thread(&AudioNodeDestructor::process, this, std::move(receiver));
+  freeBatchReceiver_ = std::move(freeBatchReceiver);
+
+  currentBatch_ = batches_[0].get();
+  for (size_t i = 1; i < kBatchCount; i++) {
+    freeBatchSender.try_send(batches_[i].get());
+  }
+
+  workerHandle_ = std::thread(
+      &AudioNodeDestructor::process, this, std::move(receiver), std::move(freeBatchSender));
 }
 
 AudioNodeDestructor::~AudioNodeDestructor() {
@@ -26,18 +43,43 @@ AudioNodeDestructor::~AudioNodeDestructor() {
   }
 }
 
-bool AudioNodeDestructor::tryAddNodeForDeconstruction(std::shared_ptr<AudioNode> &&node) {
-  return sender_.try_send(std::move(node)) == channels::spsc::ResponseStatus::SUCCESS;
+void AudioNodeDestructor::retire(std::shared_ptr<AudioNode> &&node) {
+  currentBatch_->push_back(std::move(node));
+}
+
+void AudioNodeDestructor::advanceEpoch() {
+  if (currentBatch_->empty()) {
+    return;
+  }
+
+  Batch *nextBatch = nullptr;
+  if (freeBatchReceiver_.try_receive(nextBatch) != channels::spsc::ResponseStatus::SUCCESS) {
+    return;
+  }
+
+  // every batch which is not free fits in the channel, so sending never fails
+  sender_.try_send(currentBatch_);
+  currentBatch_ = nextBatch;
 }
 
 void AudioNodeDestructor::process(
     channels::spsc::Receiver<
-        std::shared_ptr<AudioNode>,
+        Batch *,
         channels::spsc::OverflowStrategy::WAIT_ON_FULL,
-        channels::spsc::WaitStrategy::ATOMIC_WAIT> &&receiver) {
+        channels::spsc::WaitStrategy::ATOMIC_WAIT> &&receiver,
+    channels::spsc::Sender<Batch *> &&freeBatchSender) {
   auto rcv = std::move(receiver);
+  auto freeSender = std::move(freeBatchSender);
+
   while (!isExiting_.load(std::memory_order_acquire)) {
-    rcv.receive();
+    auto *batch = rcv.receive();
+    if (batch == nullptr) {
+      continue;
+    }
+
+    // keeps the capacity, so that retiring nodes does not allocate on the audio thread
+    batch->clear();
+    freeSender.try_send(batch);
   }
 }
 
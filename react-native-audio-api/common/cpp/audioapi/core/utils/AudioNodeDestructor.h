@@ -11,31 +11,50 @@ namespace audioapi {
 class AudioNode;
 
 #define AUDIO_NODE_DESTRUCTOR_SPSC_OPTIONS \
-  std::shared_ptr<AudioNode>, channels::spsc::OverflowStrategy::WAIT_ON_FULL, \
+  Batch *, channels::spsc::OverflowStrategy::WAIT_ON_FULL, \
       channels::spsc::WaitStrategy::ATOMIC_WAIT
 
+/// @brief Destroys audio nodes on a dedicated thread, so that the audio thread never
+/// releases their memory.
+/// Nodes retired during a render quantum form one epoch, which is handed to the worker
+/// as a whole once the audio thread moves past it. Batches are recycled between the
+/// threads, so retiring a node never fails and rarely allocates.
 class AudioNodeDestructor {
  public:
+  using Batch = std::vector<std::shared_ptr<AudioNode>>;
+
   AudioNodeDestructor();
   ~AudioNodeDestructor();
 
-  /// @brief Adds a node to the deconstruction queue.
+  /// @brief Adds a node to the current epoch.
   /// @param node The audio node to be deconstructed.
-  /// @return True if the node was successfully added, false otherwise.
-  /// @note node does NOT get moved out if it is not successfully added.
-  bool tryAddNodeForDeconstruction(std::shared_ptr<AudioNode> &&node);
+  /// @note Should be only used from the audio thread
+  void retire(std::shared_ptr<AudioNode> &&node);
+
+  /// @brief Hands the nodes retired so far to the worker thread.
+  /// @note When every batch is still being destroyed, the current epoch is extended instead.
+  /// @note Should be only used from the audio thread, once per render quantum
+  void advanceEpoch();
 
  private:
-  static constexpr size_t kChannelCapacity = 1024;
+  static constexpr size_t kBatchCount = 4;
+  static constexpr size_t kBatchCapacity = 64;
 
   std::thread workerHandle_;
   std::atomic<bool> isExiting_;
 
-  channels::spsc::Sender<AUDIO_NODE_DESTRUCTOR_SPSC_OPTIONS> sender_;
+  std::vector<std::unique_ptr<Batch>> batches_;
+  Batch *currentBatch_;
 
-  /// @brief Processes audio nodes for deconstruction.
-  /// @param receiver The receiver channel for incoming audio nodes.
-  void process(channels::spsc::Receiver<AUDIO_NODE_DESTRUCTOR_SPSC_OPTIONS> &&receiver);
+  channels::spsc::Sender<AUDIO_NODE_DESTRUCTOR_SPSC_OPTIONS> sender_;
+  channels::spsc::Receiver<Batch *> freeBatchReceiver_;
+
+  /// @brief Processes batches of audio nodes for deconstruction.
+  /// @param receiver The receiver channel for retired batches.
+  /// @param freeBatchSender The sender channel returning emptied batches.
+  void process(
+      channels::spsc::Receiver<AUDIO_NODE_DESTRUCTOR_SPSC_OPTIONS> &&receiver,
+      channels::spsc::Sender<Batch *> &&freeBatchSender);
 };
 
 #undef AUDIO_NODE_DESTRUCTOR_SPSC_OPTIONS
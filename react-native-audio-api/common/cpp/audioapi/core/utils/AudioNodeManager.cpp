@@ -11,7 +11,7 @@
 
 namespace audioapi {
 
-AudioNodeManager::Event::Event(Event &&other) {
+AudioNodeManager::Event::Event(Event &&other) : Event() {
   *this = std::move(other);
 }
 
@@ -20,26 +20,33 @@ AudioNodeManager::Event &AudioNodeManager::Event::operator=(Event &&other) {
     // Clean up current resources
     this->~Event();
 
-    // Move resources from the other event
+    // Move resources from the other event, the payload members were destroyed
+    // above, so they are constructed in place
     type = other.type;
     payloadType = other.payloadType;
+    input = other.input;
     switch (payloadType) {
       case EventPayloadType::NODES:
-        payload.nodes.from = std::move(other.payload.nodes.from);
-        payload.nodes.to = std::move(other.payload.nodes.to);
+        new (&payload.nodes.from) std::shared_ptr<AudioNode>(std::move(other.payload.nodes.from));
+        new (&payload.nodes.to) std::shared_ptr<AudioNode>(std::move(other.payload.nodes.to));
         break;
       case EventPayloadType::PARAMS:
-        payload.params.from = std::move(other.payload.params.from);
-        payload.params.to = std::move(other.payload.params.to);
+        new (&payload.params.from)
+            std::shared_ptr<AudioNode>(std::move(other.payload.params.from));
+        new (&payload.params.to) std::shared_ptr<AudioParam>(std::move(other.payload.params.to));
         break;
       case EventPayloadType::SOURCE_NODE:
-        payload.sourceNode = std::move(other.payload.sourceNode);
+        new (&payload.sourceNode)
+            std::shared_ptr<AudioScheduledSourceNode>(std::move(other.payload.sourceNode));
         break;
       case EventPayloadType::AUDIO_PARAM:
-        payload.audioParam = std::move(other.payload.audioParam);
+        new (&payload.audioParam) std::shared_ptr<AudioParam>(std::move(other.payload.audioParam));
         break;
       case EventPayloadType::NODE:
-        payload.node = std::move(other.payload.node);
+        new (&payload.node) std::shared_ptr<AudioNode>(std::move(other.payload.node));
+        break;
+      case EventPayloadType::CHANGE_SET:
+        payload.changeSet = other.payload.changeSet;
         break;
 
       default:
@@ -68,21 +75,30 @@ AudioNodeManager::Event::~Event() {
     case EventPayloadType::NODE:
       payload.node.~shared_ptr();
       break;
+    case EventPayloadType::CHANGE_SET:
+      break;
   }
 }
 
 AudioNodeManager::AudioNodeManager() {
-  sourceNodes_.reserve(kInitialCapacity);
-  processingNodes_.reserve(kInitialCapacity);
+  nodes_.reserve(kInitialCapacity);
   audioParams_.reserve(kInitialCapacity);
+  candidates_.reserve(kInitialCapacity);
 
   auto channel_pair = channels::spsc::channel<
-      std::unique_ptr<Event>,
+      Event,
       channels::spsc::OverflowStrategy::WAIT_ON_FULL,
       channels::spsc::WaitStrategy::BUSY_LOOP>(kChannelCapacity);
 
   sender_ = std::move(channel_pair.first);
   receiver_ = std::move(channel_pair.second);
+
+  // at most kChannelCapacity change sets can be waiting in the event channel, so the free
+  // channel is large enough to never reject a change set returned by the audio thread
+  auto free_channel_pair = channels::spsc::channel<ChangeSet *>(2 * kChannelCapacity);
+
+  freeChangeSetSender_ = std::move(free_channel_pair.first);
+  freeChangeSetReceiver_ = std::move(free_channel_pair.second);
 }
 
 AudioNodeManager::~AudioNodeManager() {
@@ -92,205 +108,366 @@ AudioNodeManager::~AudioNodeManager() {
 void AudioNodeManager::addPendingNodeConnection(
     const std::shared_ptr<AudioNode> &from,
     const std::shared_ptr<AudioNode> &to,
-    ConnectionType type) {
-  auto event = std::make_unique<Event>();
-  event->type = type;
-  event->payloadType = EventPayloadType::NODES;
-  event->payload.nodes.from = from;
-  event->payload.nodes.to = to;
-
-  sender_.send(std::move(event));
+    ConnectionType type,
+    int input) {
+  Event event;
+  event.type = type;
+  event.payloadType = EventPayloadType::NODES;
+  event.payload.nodes.from = from;
+  event.payload.nodes.to = to;
+  event.input = input;
+
+  sendEvent(std::move(event));
 }
 
 void AudioNodeManager::addPendingParamConnection(
     const std::shared_ptr<AudioNode> &from,
     const std::shared_ptr<AudioParam> &to,
     ConnectionType type) {
-  auto event = std::make_unique<Event>();
-  event->type = type;
-  event->payloadType = EventPayloadType::PARAMS;
-  event->payload.params.from = from;
-  event->payload.params.to = to;
+  Event event;
+  event.type = type;
+  event.payloadType = EventPayloadType::PARAMS;
+  event.payload.params.from = from;
+  event.payload.params.to = to;
 
-  sender_.send(std::move(event));
+  sendEvent(std::move(event));
 }
 
 void AudioNodeManager::preProcessGraph() {
   settlePendingConnections();
-  prepareNodesForDestruction(sourceNodes_);
-  prepareNodesForDestruction(processingNodes_);
+  sweepRegisteredNodes();
+  reclaimCandidates();
+  nodeDeconstructor_.advanceEpoch();
 }
 
 void AudioNodeManager::addProcessingNode(const std::shared_ptr<AudioNode> &node) {
-  auto event = std::make_unique<Event>();
-  event->type = ConnectionType::ADD;
-  event->payloadType = EventPayloadType::NODE;
-  event->payload.node = node;
+  Event event;
+  event.type = ConnectionType::ADD;
+  event.payloadType = EventPayloadType::NODE;
+  event.payload.node = node;
 
-  sender_.send(std::move(event));
+  sendEvent(std::move(event));
 }
 
 void AudioNodeManager::addSourceNode(const std::shared_ptr<AudioScheduledSourceNode> &node) {
-  auto event = std::make_unique<Event>();
-  event->type = ConnectionType::ADD;
-  event->payloadType = EventPayloadType::SOURCE_NODE;
-  event->payload.sourceNode = node;
+  Event event;
+  event.type = ConnectionType::ADD;
+  event.payloadType = EventPayloadType::SOURCE_NODE;
+  event.payload.sourceNode = node;
 
-  sender_.send(std::move(event));
+  sendEvent(std::move(event));
 }
 
 void AudioNodeManager::addAudioParam(const std::shared_ptr<AudioParam> &param) {
-  auto event = std::make_unique<Event>();
-  event->type = ConnectionType::ADD;
-  event->payloadType = EventPayloadType::AUDIO_PARAM;
-  event->payload.audioParam = param;
+  Event event;
+  event.type = ConnectionType::ADD;
+  event.payloadType = EventPayloadType::AUDIO_PARAM;
+  event.payload.audioParam = param;
+
+  sendEvent(std::move(event));
+}
+
+void AudioNodeManager::addReleasedNode(const std::shared_ptr<AudioNode> &node) {
+  Event event;
+  event.type = ConnectionType::RELEASE;
+  event.payloadType = EventPayloadType::NODE;
+  event.payload.node = node;
+
+  if (currentChangeSet_ != nullptr) {
+    currentChangeSet_->events.push_back(std::move(event));
+    return;
+  }
+
+  // nodes are released from host object destructors, which must not wait for the audio thread,
+  // e.g. while the context is suspended, a release which does not fit is found by the sweep
+  sender_.try_send(std::move(event));
+}
+
+void AudioNodeManager::beginTransaction() {
+  if (transactionDepth_ == 0) {
+    currentChangeSet_ = acquireChangeSet();
+  }
+
+  transactionDepth_ += 1;
+}
+
+void AudioNodeManager::commitTransaction() {
+  if (transactionDepth_ == 0) {
+    return;
+  }
+
+  transactionDepth_ -= 1;
+  if (transactionDepth_ > 0) {
+    return;
+  }
+
+  Event event;
+  event.type = ConnectionType::APPLY_CHANGE_SET;
+  event.payloadType = EventPayloadType::CHANGE_SET;
+  event.payload.changeSet = currentChangeSet_;
+  currentChangeSet_ = nullptr;
+
+  sender_.send(std::move(event));
+}
+
+void AudioNodeManager::sendEvent(Event &&event) {
+  if (currentChangeSet_ != nullptr) {
+    currentChangeSet_->events.push_back(std::move(event));
+    return;
+  }
 
   sender_.send(std::move(event));
 }
 
+AudioNodeManager::ChangeSet *AudioNodeManager::acquireChangeSet() {
+  ChangeSet *changeSet = nullptr;
+  if (freeChangeSetReceiver_.try_receive(changeSet) == channels::spsc::ResponseStatus::SUCCESS) {
+    return changeSet;
+  }
+
+  // every change set is still waiting for the audio thread, e.g. while the context is suspended
+  auto &newChangeSet = changeSets_.emplace_back(std::make_unique<ChangeSet>());
+  newChangeSet->events.reserve(kChangeSetCapacity);
+  return newChangeSet.get();
+}
+
 void AudioNodeManager::settlePendingConnections() {
-  std::unique_ptr<Event> value;
-  while (receiver_.try_receive(value) != channels::spsc::ResponseStatus::CHANNEL_EMPTY) {
-    switch (value->type) {
-      case ConnectionType::CONNECT:
-        handleConnectEvent(std::move(value));
-        break;
-      case ConnectionType::DISCONNECT:
-        handleDisconnectEvent(std::move(value));
-        break;
-      case ConnectionType::DISCONNECT_ALL:
-        handleDisconnectAllEvent(std::move(value));
-        break;
-      case ConnectionType::ADD:
-        handleAddToDeconstructionEvent(std::move(value));
-        break;
-    }
+  Event event;
+  while (receiver_.try_receive(event) != channels::spsc::ResponseStatus::CHANNEL_EMPTY) {
+    handleEvent(event);
   }
 }
 
-void AudioNodeManager::handleConnectEvent(std::unique_ptr<Event> event) {
-  if (event->payloadType == EventPayloadType::NODES) {
-    event->payload.nodes.from->connectNode(event->payload.nodes.to);
-  } else if (event->payloadType == EventPayloadType::PARAMS) {
-    event->payload.params.from->connectParam(event->payload.params.to);
+void AudioNodeManager::handleEvent(Event &event) {
+  switch (event.type) {
+    case ConnectionType::CONNECT:
+      handleConnectEvent(event);
+      break;
+    case ConnectionType::DISCONNECT:
+      handleDisconnectEvent(event);
+      break;
+    case ConnectionType::DISCONNECT_ALL:
+      handleDisconnectAllEvent(event);
+      break;
+    case ConnectionType::ADD:
+      handleAddToDeconstructionEvent(event);
+      break;
+    case ConnectionType::RELEASE:
+      handleReleaseEvent(event);
+      break;
+    case ConnectionType::APPLY_CHANGE_SET:
+      handleChangeSetEvent(event);
+      break;
+  }
+}
+
+void AudioNodeManager::handleChangeSetEvent(Event &event) {
+  assert(event.payloadType == EventPayloadType::CHANGE_SET);
+  auto *changeSet = event.payload.changeSet;
+
+  for (auto &change : changeSet->events) {
+    handleEvent(change);
+  }
+
+  recycleChangeSet(changeSet);
+}
+
+void AudioNodeManager::recycleChangeSet(ChangeSet *changeSet) {
+  // keeps the capacity, so that the change set is not reallocated when reused
+  changeSet->events.clear();
+  freeChangeSetSender_.try_send(changeSet);
+}
+
+void AudioNodeManager::handleConnectEvent(Event &event) {
+  if (event.payloadType == EventPayloadType::NODES) {
+    event.payload.nodes.from->connectNode(event.payload.nodes.to, event.input);
+  } else if (event.payloadType == EventPayloadType::PARAMS) {
+    event.payload.params.from->connectParam(event.payload.params.to);
   } else {
     assert(false && "Invalid payload type for connect event");
   }
 }
 
-void AudioNodeManager::handleDisconnectEvent(std::unique_ptr<Event> event) {
-  if (event->payloadType == EventPayloadType::NODES) {
-    event->payload.nodes.from->disconnectNode(event->payload.nodes.to);
-  } else if (event->payloadType == EventPayloadType::PARAMS) {
-    event->payload.params.from->disconnectParam(event->payload.params.to);
+void AudioNodeManager::handleDisconnectEvent(Event &event) {
+  if (event.payloadType == EventPayloadType::NODES) {
+    event.payload.nodes.from->disconnectNode(event.payload.nodes.to, event.input);
+    markCandidate(event.payload.nodes.to.get());
+  } else if (event.payloadType == EventPayloadType::PARAMS) {
+    event.payload.params.from->disconnectParam(event.payload.params.to);
   } else {
     assert(false && "Invalid payload type for disconnect event");
   }
 }
 
-void AudioNodeManager::handleDisconnectAllEvent(std::unique_ptr<Event> event) {
-  assert(event->payloadType == EventPayloadType::NODES);
-  for (auto it = event->payload.nodes.from->outputNodes_.begin();
-       it != event->payload.nodes.from->outputNodes_.end();) {
+void AudioNodeManager::handleDisconnectAllEvent(Event &event) {
+  assert(event.payloadType == EventPayloadType::NODES);
+  for (auto it = event.payload.nodes.from->outputNodes_.begin();
+       it != event.payload.nodes.from->outputNodes_.end();) {
     auto next = std::next(it);
-    event->payload.nodes.from->disconnectNode(*it);
+    markCandidate(it->get());
+    event.payload.nodes.from->disconnectNode(*it);
     it = next;
   }
 }
 
-void AudioNodeManager::handleAddToDeconstructionEvent(std::unique_ptr<Event> event) {
-  switch (event->payloadType) {
+void AudioNodeManager::handleAddToDeconstructionEvent(Event &event) {
+  switch (event.payloadType) {
     case EventPayloadType::NODE:
-      processingNodes_.push_back(event->payload.node);
+      registerNode(event.payload.node, nullptr);
       break;
     case EventPayloadType::SOURCE_NODE:
-      sourceNodes_.push_back(event->payload.sourceNode);
+      registerNode(event.payload.sourceNode, event.payload.sourceNode.get());
       break;
     case EventPayloadType::AUDIO_PARAM:
-      audioParams_.push_back(event->payload.audioParam);
+      audioParams_.push_back(event.payload.audioParam);
       break;
     default:
       assert(false && "Unknown event payload type");
   }
 }
 
-template <typename U>
-inline bool AudioNodeManager::nodeCanBeDestructed(std::shared_ptr<U> const &node) {
-  // If the node is an AudioScheduledSourceNode, we need to check if it is
-  // playing
-  if constexpr (std::is_base_of_v<AudioScheduledSourceNode, U>) {
-    return node.use_count() == 1 && (node->isUnscheduled() || node->isFinished());
-  } else if (node->requiresTailProcessing()) {
-    // if the node requires tail processing, its own implementation handles disabling it at the right time
-    return node.use_count() == 1 && !node->isEnabled();
+void AudioNodeManager::handleReleaseEvent(Event &event) {
+  assert(event.payloadType == EventPayloadType::NODE);
+  markCandidate(event.payload.node.get());
+}
+
+void AudioNodeManager::registerNode(
+    const std::shared_ptr<AudioNode> &node,
+    AudioScheduledSourceNode *sourceNode) {
+  node->registryIndex_ = nodes_.size();
+  nodes_.push_back({node, sourceNode});
+}
+
+void AudioNodeManager::unregisterNode(AudioNode *node) {
+  auto index = node->registryIndex_;
+  node->registryIndex_ = SIZE_MAX;
+
+  // the last registration takes the place of the removed one
+  if (index != nodes_.size() - 1) {
+    nodes_[index] = std::move(nodes_.back());
+    nodes_[index].node->registryIndex_ = index;
   }
-  return node.use_count() == 1;
+  nodes_.pop_back();
 }
 
-template <typename U>
-void AudioNodeManager::prepareNodesForDestruction(std::vector<std::shared_ptr<U>> &vec) {
-  if (vec.empty()) {
+void AudioNodeManager::markCandidate(AudioNode *node) {
+  if (node == nullptr || node->isReclaimCandidate_ || node->registryIndex_ == SIZE_MAX) {
     return;
   }
-  /// An example of input-output
-  /// for simplicity we will be considering vector where each value represents
-  /// use_count() of an element vec = [1, 2, 1, 3, 1] our end result will be vec
-  /// = [2, 3, 1, 1, 1] After this operation all nodes with use_count() == 1
-  /// will be at the end and we will try to send them After sending, we will
-  /// only keep nodes with use_count() > 1 or which failed vec = [2, 3, failed,
-  /// sent, sent] // failed will be always before sents vec = [2, 3, failed] and
-  /// we resize
-  /// @note if there are no nodes with use_count() == 1 `begin` will be equal to
-  /// vec.size()
-  /// @note if all nodes have use_count() == 1 `begin` will be 0
-
-  int begin = 0;
-  int end = vec.size() - 1; // can be -1 (edge case)
-
-  // Moves all nodes with use_count() == 1 to the end
-  // nodes in range [begin, vec.size()) should be deleted
-  // so new size of the vector will be `begin`
-  while (begin <= end) {
-    while (begin < end && AudioNodeManager::nodeCanBeDestructed(vec[end])) {
-      end--;
-    }
-    if (AudioNodeManager::nodeCanBeDestructed(vec[begin])) {
-      std::swap(vec[begin], vec[end]);
-      end--;
+
+  node->isReclaimCandidate_ = true;
+  candidates_.push_back(node);
+}
+
+void AudioNodeManager::sweepRegisteredNodes() {
+  for (size_t i = 0; i < kSweepNodesPerQuantum && !nodes_.empty(); i++) {
+    if (sweepCursor_ >= nodes_.size()) {
+      sweepCursor_ = 0;
     }
-    begin++;
+
+    markCandidate(nodes_[sweepCursor_].node.get());
+    sweepCursor_ += 1;
   }
+}
 
-  for (int i = begin; i < vec.size(); i++) {
-    if (vec[i])
-      vec[i]->cleanup();
+void AudioNodeManager::reclaimCandidates() {
+  // reclaiming a node disconnects its outputs, which may append new candidates,
+  // so the whole chain of released nodes is reclaimed in the same quantum
+  size_t i = 0;
+  while (i < candidates_.size()) {
+    auto *node = candidates_[i];
+
+    switch (getReclaimStatus(nodes_[node->registryIndex_])) {
+      case ReclaimStatus::BUSY:
+        // still playing or processing its tail, checked again in the next quantum
+        i++;
+        continue;
+
+      case ReclaimStatus::RECLAIMABLE: {
+        for (auto &output : node->outputNodes_) {
+          markCandidate(output.get());
+        }
+        node->cleanup();
+        node->isReclaimCandidate_ = false;
+        candidates_[i] = candidates_.back();
+        candidates_.pop_back();
+
+        // the node is not touched after it is handed over, as the JS thread may reuse it
+        auto registration = std::move(nodes_[node->registryIndex_]);
+        unregisterNode(node);
+        reclaimNode(std::move(registration));
+        continue;
+      }
+
+      case ReclaimStatus::REFERENCED:
+        // checked again when one of its references is dropped
+        break;
+    }
 
-    /// If we fail to add we can't safely remove the node from the vector
-    /// so we swap it and advance begin cursor
-    /// @note vec[i] does NOT get moved out if it is not successfully added.
-    if (!nodeDeconstructor_.tryAddNodeForDeconstruction(std::move(vec[i]))) {
-      std::swap(vec[i], vec[begin]);
-      begin++;
+    node->isReclaimCandidate_ = false;
+    candidates_[i] = candidates_.back();
+    candidates_.pop_back();
+  }
+}
+
+void AudioNodeManager::reclaimNode(Registration &&registration) {
+  if (registration.sourceNode != nullptr && registration.sourceNode->canBeRecycled()) {
+    auto sourceNode =
+        std::static_pointer_cast<AudioScheduledSourceNode>(std::move(registration.node));
+    if (!nodePool_.tryRecycle(std::move(sourceNode))) {
+      nodeDeconstructor_.retire(std::move(sourceNode));
     }
+    return;
   }
-  if (begin < vec.size()) {
-    // it does not realocate if newer size is < current size
-    vec.resize(begin);
+
+  nodeDeconstructor_.retire(std::move(registration.node));
+}
+
+AudioNodeManager::ReclaimStatus AudioNodeManager::getReclaimStatus(
+    const Registration &registration) {
+  const auto &node = registration.node;
+  if (node.use_count() != 1) {
+    return ReclaimStatus::REFERENCED;
   }
+
+  if (registration.sourceNode != nullptr) {
+    return registration.sourceNode->isUnscheduled() || registration.sourceNode->isFinished()
+        ? ReclaimStatus::RECLAIMABLE
+        : ReclaimStatus::BUSY;
+  }
+
+  // if the node requires tail processing, its own implementation handles disabling it at
+  // the right time
+  if (node->requiresTailProcessing() && node->isEnabled()) {
+    return ReclaimStatus::BUSY;
+  }
+
+  return ReclaimStatus::RECLAIMABLE;
+}
+
+AudioNodePool *AudioNodeManager::getNodePool() {
+  return &nodePool_;
 }
 
 void AudioNodeManager::cleanup() {
-  for (auto it = sourceNodes_.begin(), end = sourceNodes_.end(); it != end; ++it) {
-    it->get()->cleanup();
+  // the audio thread is stopped, so events which it did not receive are dropped
+  Event event;
+  while (receiver_.try_receive(event) != channels::spsc::ResponseStatus::CHANNEL_EMPTY) {
+    if (event.payloadType == EventPayloadType::CHANGE_SET) {
+      recycleChangeSet(event.payload.changeSet);
+    }
   }
 
-  for (auto it = processingNodes_.begin(), end = processingNodes_.end(); it != end; ++it) {
-    it->get()->cleanup();
+  for (auto it = nodes_.begin(), end = nodes_.end(); it != end; ++it) {
+    it->node->cleanup();
+    it->node->registryIndex_ = SIZE_MAX;
+    it->node->isReclaimCandidate_ = false;
   }
 
-  sourceNodes_.clear();
-  processingNodes_.clear();
+  nodes_.clear();
   audioParams_.clear();
+  candidates_.clear();
+  sweepCursor_ = 0;
 }
 
 } // namespace audioapi
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <audioapi/core/utils/AudioNodeDestructor.h>
+#include <audioapi/core/utils/AudioNodePool.h>
 
 #include <memory>
 #include <mutex>
@@ -16,14 +17,14 @@ class AudioScheduledSourceNode;
 class AudioParam;
 
 #define AUDIO_NODE_MANAGER_SPSC_OPTIONS \
-  std::unique_ptr<Event>, channels::spsc::OverflowStrategy::WAIT_ON_FULL, \
-      channels::spsc::WaitStrategy::BUSY_LOOP
+  Event, channels::spsc::OverflowStrategy::WAIT_ON_FULL, channels::spsc::WaitStrategy::BUSY_LOOP
 
 class AudioNodeManager {
  public:
-  enum class ConnectionType { CONNECT, DISCONNECT, DISCONNECT_ALL, ADD };
+  enum class ConnectionType { CONNECT, DISCONNECT, DISCONNECT_ALL, ADD, RELEASE, APPLY_CHANGE_SET };
   typedef ConnectionType EventType; // for backwards compatibility
-  enum class EventPayloadType { NODES, PARAMS, SOURCE_NODE, AUDIO_PARAM, NODE };
+  enum class EventPayloadType { NODES, PARAMS, SOURCE_NODE, AUDIO_PARAM, NODE, CHANGE_SET };
+  struct ChangeSet;
   union EventPayload {
     struct {
       std::shared_ptr<AudioNode> from;
@@ -36,6 +37,7 @@ class AudioNodeManager {
     std::shared_ptr<AudioScheduledSourceNode> sourceNode;
     std::shared_ptr<AudioParam> audioParam;
     std::shared_ptr<AudioNode> node;
+    ChangeSet *changeSet;
 
     // Default constructor that initializes the first member
     EventPayload() : nodes{} {}
@@ -47,12 +49,23 @@ class AudioNodeManager {
     EventType type;
     EventPayloadType payloadType;
     EventPayload payload;
+    // input of the destination node, for connections between nodes
+    int input;
 
     Event(Event &&other);
     Event &operator=(Event &&other);
-    Event() : type(ConnectionType::CONNECT), payloadType(EventPayloadType::NODES), payload() {}
+    Event()
+        : type(ConnectionType::CONNECT),
+          payloadType(EventPayloadType::NODES),
+          payload(),
+          input(0) {}
     ~Event();
   };
+  /// @brief Graph changes collected by a transaction, applied by the audio thread at once.
+  /// Change sets are recycled, so that their storage is allocated only once.
+  struct ChangeSet {
+    std::vector<Event> events;
+  };
 
   AudioNodeManager();
   ~AudioNodeManager();
@@ -63,11 +76,14 @@ class AudioNodeManager {
   /// @param from The source audio node.
   /// @param to The destination audio node.
   /// @param type The type of connection (connect/disconnect).
+  /// @param input The input of the destination node, disconnecting with
+  /// AudioNode::ALL_INPUTS removes every connection to it.
   /// @note Should be only used from JavaScript/HostObjects thread
   void addPendingNodeConnection(
       const std::shared_ptr<AudioNode> &from,
       const std::shared_ptr<AudioNode> &to,
-      ConnectionType type);
+      ConnectionType type,
+      int input = 0);
 
   /// @brief Adds a pending connection between an audio node and an audio parameter.
   /// @param from The source audio node.
@@ -94,10 +110,34 @@ class AudioNodeManager {
   /// @note Should be only used from JavaScript/HostObjects thread
   void addAudioParam(const std::shared_ptr<AudioParam> &param);
 
+  /// @brief Marks a node as released by JS, so that it is checked for reclamation.
+  /// @param node The released node.
+  /// @note Never waits for the audio thread, when the event channel is full the node is
+  /// reclaimed once the sweep of registered nodes reaches it.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void addReleasedNode(const std::shared_ptr<AudioNode> &node);
+
+  /// @brief Starts collecting graph changes into a single change set.
+  /// The audio thread applies all changes of the set before the same render quantum,
+  /// so a partially rebuilt graph is never heard.
+  /// @note Transactions can be nested, changes are sent when the outermost one is committed.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void beginTransaction();
+
+  /// @brief Sends the changes collected since the matching beginTransaction.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void commitTransaction();
+
+  /// @brief Pool receiving reclaimed source nodes which can be reused.
+  AudioNodePool *getNodePool();
+
+  /// @brief Releases every node and drops the events which were not applied.
+  /// @note Should be only used once the audio thread is stopped
   void cleanup();
 
  private:
   AudioNodeDestructor nodeDeconstructor_;
+  AudioNodePool nodePool_;
 
   /// @brief Initial capacity for various node types for deletion
   /// @note Higher capacity decreases number of reallocations at runtime (can be easily adjusted to 128 if needed)
@@ -107,25 +147,62 @@ class AudioNodeManager {
   /// @note High value reduces wait time for sender (JavaScript/HostObjects thread here)
   static constexpr size_t kChannelCapacity = 1024;
 
-  std::vector<std::shared_ptr<AudioScheduledSourceNode>> sourceNodes_;
-  std::vector<std::shared_ptr<AudioNode>> processingNodes_;
+  /// @brief Number of changes a change set is allocated for
+  /// @note Larger transactions grow it once, the capacity is kept when it is reused
+  static constexpr size_t kChangeSetCapacity = 256;
+
+  /// @brief Number of registered nodes checked every render quantum, which catches nodes
+  /// released by owners other than JS and the graph, e.g. a recorder
+  static constexpr size_t kSweepNodesPerQuantum = 4;
+
+  /// @brief A node kept alive by the manager until it can be destructed.
+  /// @note sourceNode is set for scheduled source nodes only, as they can not be destructed
+  /// while playing.
+  struct Registration {
+    std::shared_ptr<AudioNode> node;
+    AudioScheduledSourceNode *sourceNode;
+  };
+
+  enum class ReclaimStatus { RECLAIMABLE, BUSY, REFERENCED };
+
+  std::vector<Registration> nodes_;
   std::vector<std::shared_ptr<AudioParam>> audioParams_;
 
+  // registered nodes which may have lost their last reference since the last check
+  std::vector<AudioNode *> candidates_;
+  size_t sweepCursor_ = 0;
+
   channels::spsc::Receiver<AUDIO_NODE_MANAGER_SPSC_OPTIONS> receiver_;
 
   channels::spsc::Sender<AUDIO_NODE_MANAGER_SPSC_OPTIONS> sender_;
 
+  // change sets are owned by the JS thread, the audio thread only borrows them
+  // between a commit and returning them through the free channel
+  std::vector<std::unique_ptr<ChangeSet>> changeSets_;
+  channels::spsc::Sender<ChangeSet *> freeChangeSetSender_;
+  channels::spsc::Receiver<ChangeSet *> freeChangeSetReceiver_;
+  ChangeSet *currentChangeSet_ = nullptr;
+  size_t transactionDepth_ = 0;
+
+  void sendEvent(Event &&event);
+  ChangeSet *acquireChangeSet();
+  void recycleChangeSet(ChangeSet *changeSet);
   void settlePendingConnections();
-  void handleConnectEvent(std::unique_ptr<Event> event);
-  void handleDisconnectEvent(std::unique_ptr<Event> event);
-  void handleDisconnectAllEvent(std::unique_ptr<Event> event);
-  void handleAddToDeconstructionEvent(std::unique_ptr<Event> event);
-
-  template <typename U>
-  void prepareNodesForDestruction(std::vector<std::shared_ptr<U>> &vec);
-
-  template <typename U>
-  inline static bool nodeCanBeDestructed(std::shared_ptr<U> const &node);
+  void handleEvent(Event &event);
+  void handleChangeSetEvent(Event &event);
+  void handleConnectEvent(Event &event);
+  void handleDisconnectEvent(Event &event);
+  void handleDisconnectAllEvent(Event &event);
+  void handleAddToDeconstructionEvent(Event &event);
+  void handleReleaseEvent(Event &event);
+
+  void registerNode(const std::shared_ptr<AudioNode> &node, AudioScheduledSourceNode *sourceNode);
+  void unregisterNode(AudioNode *node);
+  void markCandidate(AudioNode *node);
+  void sweepRegisteredNodes();
+  void reclaimCandidates();
+  void reclaimNode(Registration &&registration);
+  static ReclaimStatus getReclaimStatus(const Registration &registration);
 };
 
 #undef AUDIO_NODE_MANAGER_SPSC_OPTIONS
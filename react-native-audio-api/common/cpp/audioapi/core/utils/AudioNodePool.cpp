@@ -0,0 +1,90 @@
+#include <audioapi/core/sources/AudioBufferSourceNode.h>
+#include <audioapi/core/sources/OscillatorNode.h>
+#include <audioapi/core/utils/AudioNodePool.h>
+#include <memory>
+#include <utility>
+
+namespace audioapi {
+
+AudioNodePool::AudioNodePool() {
+  bufferSources_.reserve(kCapacity);
+  oscillators_.reserve(kCapacity);
+
+  auto [sender, receiver] = channels::spsc::channel<
+      std::shared_ptr<AudioScheduledSourceNode>,
+      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
+      channels::spsc::WaitStrategy::BUSY_LOOP>(kCapacity);
+
+  recycledSender_ = std::move(sender);
+  recycledReceiver_ = std::move(receiver);
+}
+
+std::shared_ptr<AudioBufferSourceNode> AudioNodePool::acquireBufferSource() {
+  collectRecycledNodes();
+
+  if (bufferSources_.empty()) {
+    return nullptr;
+  }
+
+  auto node = std::move(bufferSources_.back());
+  bufferSources_.pop_back();
+  return node;
+}
+
+std::shared_ptr<OscillatorNode> AudioNodePool::acquireOscillator() {
+  collectRecycledNodes();
+
+  if (oscillators_.empty()) {
+    return nullptr;
+  }
+
+  auto node = std::move(oscillators_.back());
+  oscillators_.pop_back();
+  return node;
+}
+
+void AudioNodePool::addBufferSource(std::shared_ptr<AudioBufferSourceNode> &&node) {
+  if (bufferSources_.size() < kCapacity) {
+    bufferSources_.push_back(std::move(node));
+  }
+}
+
+void AudioNodePool::addOscillator(std::shared_ptr<OscillatorNode> &&node) {
+  if (oscillators_.size() < kCapacity) {
+    oscillators_.push_back(std::move(node));
+  }
+}
+
+size_t AudioNodePool::getCapacity() {
+  return kCapacity;
+}
+
+size_t AudioNodePool::getBufferSourceCount() {
+  collectRecycledNodes();
+  return bufferSources_.size();
+}
+
+size_t AudioNodePool::getOscillatorCount() {
+  collectRecycledNodes();
+  return oscillators_.size();
+}
+
+bool AudioNodePool::tryRecycle(std::shared_ptr<AudioScheduledSourceNode> &&node) {
+  return recycledSender_.try_send(std::move(node)) == channels::spsc::ResponseStatus::SUCCESS;
+}
+
+void AudioNodePool::collectRecycledNodes() {
+  std::shared_ptr<AudioScheduledSourceNode> node;
+
+  while (recycledReceiver_.try_receive(node) == channels::spsc::ResponseStatus::SUCCESS) {
+    node->resetForReuse();
+
+    if (auto bufferSource = std::dynamic_pointer_cast<AudioBufferSourceNode>(node)) {
+      addBufferSource(std::move(bufferSource));
+    } else if (auto oscillator = std::dynamic_pointer_cast<OscillatorNode>(node)) {
+      addOscillator(std::move(oscillator));
+    }
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <audioapi/utils/SpscChannel.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioScheduledSourceNode;
+class AudioBufferSourceNode;
+class OscillatorNode;
+
+#define AUDIO_NODE_POOL_SPSC_OPTIONS \
+  std::shared_ptr<AudioScheduledSourceNode>, channels::spsc::OverflowStrategy::WAIT_ON_FULL, \
+      channels::spsc::WaitStrategy::BUSY_LOOP
+
+/// @brief Recycles one-shot source nodes of a context.
+/// Instead of being destroyed, reclaimed nodes are handed back to the JS thread, which resets
+/// them when creating the next node of the same type. Creating a node then reuses its buses,
+/// params and event schedulers instead of allocating them.
+class AudioNodePool {
+ public:
+  AudioNodePool();
+
+  /// @brief Takes a reset buffer source out of the pool.
+  /// @return nullptr when the pool has none.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  std::shared_ptr<AudioBufferSourceNode> acquireBufferSource();
+
+  /// @brief Takes a reset oscillator out of the pool.
+  /// @return nullptr when the pool has none.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  std::shared_ptr<OscillatorNode> acquireOscillator();
+
+  /// @brief Adds freshly created nodes, e.g. when prewarming the pool at load time.
+  /// @note Nodes which do not fit in the pool are dropped.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void addBufferSource(std::shared_ptr<AudioBufferSourceNode> &&node);
+  void addOscillator(std::shared_ptr<OscillatorNode> &&node);
+
+  /// @brief Number of nodes of each type the pool can hold.
+  [[nodiscard]] static size_t getCapacity();
+  /// @note Should be only used from JavaScript/HostObjects thread
+  [[nodiscard]] size_t getBufferSourceCount();
+  /// @note Should be only used from JavaScript/HostObjects thread
+  [[nodiscard]] size_t getOscillatorCount();
+
+  /// @brief Hands a reclaimed node back to the JS thread.
+  /// @return false when too many nodes are waiting, the node should be destroyed then.
+  /// @note node does NOT get moved out if it is not recycled.
+  /// @note Should be only used from the audio thread
+  bool tryRecycle(std::shared_ptr<AudioScheduledSourceNode> &&node);
+
+ private:
+  static constexpr size_t kCapacity = 64;
+
+  channels::spsc::Sender<AUDIO_NODE_POOL_SPSC_OPTIONS> recycledSender_;
+  channels::spsc::Receiver<AUDIO_NODE_POOL_SPSC_OPTIONS> recycledReceiver_;
+
+  std::vector<std::shared_ptr<AudioBufferSourceNode>> bufferSources_;
+  std::vector<std::shared_ptr<OscillatorNode>> oscillators_;
+
+  /// @brief Resets the recycled nodes and sorts them by type.
+  void collectRecycledNodes();
+};
+
+#undef AUDIO_NODE_POOL_SPSC_OPTIONS
+
+} // namespace audioapi
@@ -0,0 +1,136 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/AudioRecorderBufferPool.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/SpscAudioRing.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Constructor
+/// Allocates every batch of the pool, as every property to do so is already known.
+/// @param batchSize The number of chunks delivered in a single event
+AudioRecorderBufferPool::AudioRecorderBufferPool(
+    const std::shared_ptr<IAudioEventHandlerRegistry> &audioEventHandlerRegistry,
+    float sampleRate,
+    size_t bufferLength,
+    int channelCount,
+    uint64_t callbackId,
+    size_t batchSize)
+    : audioEventHandlerRegistry_(audioEventHandlerRegistry),
+      bufferLength_(bufferLength),
+      channelCount_(channelCount),
+      callbackId_(callbackId),
+      batchSize_(std::max(batchSize, static_cast<size_t>(1))),
+      chunkBus_(std::make_shared<AudioBus>(bufferLength, channelCount, sampleRate)) {
+  buffers_.reserve(BATCH_POOL_SIZE * batchSize_);
+  channels_.reserve(BATCH_POOL_SIZE * batchSize_ * channelCount_);
+
+  for (size_t i = 0; i < BATCH_POOL_SIZE * batchSize_; ++i) {
+    auto buffer = std::make_shared<AudioBuffer>(channelCount_, bufferLength_, sampleRate);
+
+    // the channels are exposed like the ones of a Float32Array, so the buffer never
+    // replaces their storage and source nodes playing it get a snapshot instead
+    for (int channel = 0; channel < channelCount_; ++channel) {
+      channels_.push_back(buffer->getSharedChannel(channel));
+    }
+    buffers_.push_back(std::move(buffer));
+  }
+
+  // the channel holds one element less than its capacity
+  auto [sender, receiver] = channels::spsc::channel<size_t>(BATCH_POOL_SIZE + 1);
+  freeBatchSender_ = std::move(sender);
+  freeBatchReceiver_ = std::move(receiver);
+
+  for (size_t i = 0; i < BATCH_POOL_SIZE; ++i) {
+    freeBatchSender_.try_send(i);
+  }
+}
+
+void AudioRecorderBufferPool::emit(SpscAudioRing &ring, bool flush) {
+  while (true) {
+    auto availableFrames = ring.getAvailableFrames();
+
+    if (availableFrames == 0 || (availableFrames < bufferLength_ && !flush)) {
+      break;
+    }
+
+    if (!acquireBatch()) {
+      break;
+    }
+
+    auto chunkFrames = std::min(availableFrames, bufferLength_);
+    if (chunkFrames < bufferLength_) {
+      chunkBus_->zero();
+    }
+    ring.read(chunkBus_.get(), 0, chunkFrames);
+
+    auto bufferIndex = currentBatch_ * batchSize_ + chunksInBatch_;
+    for (int i = 0; i < channelCount_; ++i) {
+      channels_[bufferIndex * channelCount_ + i]->copy(chunkBus_->getChannel(i));
+    }
+    buffers_[bufferIndex]->markChannelsWritten();
+
+    chunksInBatch_ += 1;
+    lastChunkFrames_ = chunkFrames;
+
+    if (chunksInBatch_ == batchSize_) {
+      dispatchBatch();
+    }
+  }
+
+  if (flush && chunksInBatch_ > 0) {
+    dispatchBatch();
+  }
+}
+
+const std::vector<std::shared_ptr<AudioBuffer>> &AudioRecorderBufferPool::getBuffers() const {
+  return buffers_;
+}
+
+void AudioRecorderBufferPool::releaseBatch(size_t batchIndex) {
+  if (batchIndex >= BATCH_POOL_SIZE) {
+    return;
+  }
+
+  freeBatchSender_.try_send(batchIndex);
+}
+
+/// @brief Takes a free batch from the pool, unless one is being filled already.
+/// @returns False when JS holds every batch of the pool.
+bool AudioRecorderBufferPool::acquireBatch() {
+  if (hasCurrentBatch_) {
+    return true;
+  }
+
+  if (freeBatchReceiver_.try_receive(currentBatch_) != channels::spsc::ResponseStatus::SUCCESS) {
+    return false;
+  }
+
+  hasCurrentBatch_ = true;
+  chunksInBatch_ = 0;
+  return true;
+}
+
+/// @brief Queues the audioReady event of the current batch, without allocating.
+/// A batch whose event is dropped is never released by JS, so it is filled again.
+void AudioRecorderBufferPool::dispatchBatch() {
+  auto event = AudioEvent{
+      .type = AudioEventType::AUDIO_READY,
+      .listenerId = callbackId_,
+      .batch = static_cast<uint32_t>(currentBatch_),
+      .chunkCount = static_cast<uint32_t>(chunksInBatch_),
+      .numFrames = static_cast<uint32_t>(lastChunkFrames_)};
+  chunksInBatch_ = 0;
+
+  if (audioEventHandlerRegistry_ != nullptr &&
+      audioEventHandlerRegistry_->dispatchAudioEvent(event)) {
+    hasCurrentBatch_ = false;
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <audioapi/events/IAudioEventHandlerRegistry.h>
+#include <audioapi/utils/SpscChannel.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioArray;
+class AudioBuffer;
+class AudioBus;
+class SpscAudioRing;
+
+/// @brief Buffers reused between audioReady events of a recorder callback.
+/// Chunks are copied into a fixed pool of batches allocated up front, and every complete
+/// batch is announced to JS with a fixed-layout event. JS reads the pooled buffers, which it
+/// wrapped once, and hands the batch back with releaseBatch.
+class AudioRecorderBufferPool {
+ public:
+  // number of batches JS can hold at once, before the recorder has to wait
+  static constexpr size_t BATCH_POOL_SIZE = 4;
+
+  AudioRecorderBufferPool(
+      const std::shared_ptr<IAudioEventHandlerRegistry> &audioEventHandlerRegistry,
+      float sampleRate,
+      size_t bufferLength,
+      int channelCount,
+      uint64_t callbackId,
+      size_t batchSize);
+
+  /// @brief Copies full chunks from the ring buffer to pooled buffers, dispatching every
+  /// complete batch. Data stays in the ring buffer while JS holds every batch of the pool.
+  /// @param flush If true, emits the remaining frames and the incomplete batch.
+  /// @note Lock-free and never allocates.
+  /// @note Should be only used from the recorder thread
+  void emit(SpscAudioRing &ring, bool flush);
+
+  /// @brief Batch i is delivered in buffers [i * batchSize, i * batchSize + chunkCount).
+  [[nodiscard]] const std::vector<std::shared_ptr<AudioBuffer>> &getBuffers() const;
+  /// @brief Returns the batch to the pool once JS is done with its buffers.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void releaseBatch(size_t batchIndex);
+
+ private:
+  std::shared_ptr<IAudioEventHandlerRegistry> audioEventHandlerRegistry_;
+  size_t bufferLength_;
+  int channelCount_;
+  uint64_t callbackId_;
+  size_t batchSize_;
+
+  std::vector<std::shared_ptr<AudioBuffer>> buffers_;
+  // channel storage of the pooled buffers, written by the recorder thread without
+  // touching the buffers themselves, which JS may use at the same time
+  std::vector<std::shared_ptr<AudioArray>> channels_;
+  channels::spsc::Sender<size_t> freeBatchSender_;
+  channels::spsc::Receiver<size_t> freeBatchReceiver_;
+
+  // batch being filled by the recorder thread
+  std::shared_ptr<AudioBus> chunkBus_;
+  size_t currentBatch_ = 0;
+  bool hasCurrentBatch_ = false;
+  size_t chunksInBatch_ = 0;
+  size_t lastChunkFrames_ = 0;
+
+  bool acquireBatch();
+  void dispatchBatch();
+};
+
+} // namespace audioapi
@@ -2,10 +2,12 @@
 #include <audioapi/core/utils/AudioRecorderCallback.h>
 
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/AudioRecorderBufferPool.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
-#include <audioapi/utils/CircularAudioArray.h>
+#include <audioapi/utils/SpscAudioRing.h>
 
 #include <algorithm>
 #include <memory>
@@ -15,28 +17,39 @@
 namespace audioapi {
 
 /// @brief Constructor
-/// Allocates circular buffer (as every property to do so is already known at this point).
+/// Allocates the ring buffer and, when buffers are reused, the whole buffer pool
+/// (as every property to do so is already known at this point).
 /// @param audioEventHandlerRegistry The audio event handler registry
 /// @param sampleRate The user desired sample rate
 /// @param bufferLength The user desired buffer length
 /// @param channelCount The user desired channel count
 /// @param callbackId The callback identifier
+/// @param reuseBuffers Whether buffers are recycled instead of allocated for every chunk
+/// @param batchSize The number of chunks delivered in a single event when buffers are reused
 AudioRecorderCallback::AudioRecorderCallback(
     const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry,
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId)
+    uint64_t callbackId,
+    bool reuseBuffers,
+    size_t batchSize)
     : sampleRate_(sampleRate),
       bufferLength_(bufferLength),
       channelCount_(channelCount),
       callbackId_(callbackId),
       audioEventHandlerRegistry_(audioEventHandlerRegistry) {
   ringBufferSize_ = std::max(bufferLength * 2, static_cast<size_t>(8192));
-  circularBus_.resize(channelCount_);
-
-  for (size_t i = 0; i < channelCount_; ++i) {
-    circularBus_[i] = std::make_shared<CircularAudioArray>(ringBufferSize_);
+  ring_ = std::make_unique<SpscAudioRing>(ringBufferSize_, channelCount_, sampleRate_);
+
+  if (reuseBuffers) {
+    bufferPool_ = std::make_unique<AudioRecorderBufferPool>(
+        audioEventHandlerRegistry_,
+        sampleRate_,
+        bufferLength_,
+        channelCount_,
+        callbackId_,
+        batchSize);
   }
 
   isInitialized_.store(true, std::memory_order_release);
@@ -46,22 +59,23 @@ AudioRecorderCallback::~AudioRecorderCallback() {
   isInitialized_.store(false, std::memory_order_release);
 }
 
-/// @brief Emits audio data from the circular buffer when enough frames are available.
+/// @brief Emits audio data from the ring buffer when enough frames are available.
 /// @param flush If true, emits all available data regardless of buffer length.
 void AudioRecorderCallback::emitAudioData(bool flush) {
-  size_t sizeLimit = flush ? circularBus_[0]->getNumberOfAvailableFrames() : bufferLength_;
+  if (bufferPool_ != nullptr) {
+    emitPooledAudioData(flush);
+    return;
+  }
+
+  size_t sizeLimit = flush ? ring_->getAvailableFrames() : bufferLength_;
 
   if (sizeLimit == 0) {
     return;
   }
 
-  while (circularBus_[0]->getNumberOfAvailableFrames() >= sizeLimit) {
+  while (ring_->getAvailableFrames() >= sizeLimit) {
     auto bus = std::make_shared<AudioBus>(sizeLimit, channelCount_, sampleRate_);
-
-    for (int i = 0; i < channelCount_; ++i) {
-      auto *outputChannel = bus->getChannel(i)->getData();
-      circularBus_[i]->pop_front(outputChannel, sizeLimit);
-    }
+    ring_->read(bus.get(), 0, sizeLimit);
 
     invokeCallback(bus, static_cast<int>(sizeLimit));
   }
@@ -80,6 +94,36 @@ void AudioRecorderCallback::invokeCallback(const std::shared_ptr<AudioBus> &bus,
   }
 }
 
+uint64_t AudioRecorderCallback::getCallbackId() const {
+  return callbackId_;
+}
+
+std::vector<std::shared_ptr<AudioBuffer>> AudioRecorderCallback::getPooledBuffers() const {
+  if (bufferPool_ == nullptr) {
+    return {};
+  }
+
+  return bufferPool_->getBuffers();
+}
+
+void AudioRecorderCallback::releaseBatch(size_t batchIndex) {
+  if (bufferPool_ != nullptr) {
+    bufferPool_->releaseBatch(batchIndex);
+  }
+}
+
+/// @brief Fills pooled buffers and reports frames dropped while JS held every batch.
+/// @param flush If true, emits the remaining frames and the incomplete batch.
+void AudioRecorderCallback::emitPooledAudioData(bool flush) {
+  bufferPool_->emit(*ring_, flush);
+
+  auto droppedFrames = ring_->getDroppedFrames();
+  if (droppedFrames != reportedDroppedFrames_) {
+    reportedDroppedFrames_ = droppedFrames;
+    invokeOnErrorCallback("Audio data dropped, buffers are not released to the recorder in time");
+  }
+}
+
 void AudioRecorderCallback::setOnErrorCallback(uint64_t callbackId) {
   errorCallbackId_.store(callbackId, std::memory_order_release);
 }
@@ -1,17 +1,20 @@
 #pragma once
 
+#include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/Result.hpp>
 #include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace audioapi {
 
 class AudioBus;
 class AudioArray;
-class CircularAudioArray;
-class AudioEventHandlerRegistry;
+class AudioBuffer;
+class AudioRecorderBufferPool;
+class SpscAudioRing;
 
 class AudioRecorderCallback {
  public:
@@ -20,7 +23,9 @@ class AudioRecorderCallback {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId);
+      uint64_t callbackId,
+      bool reuseBuffers = false,
+      size_t batchSize = 1);
   virtual ~AudioRecorderCallback();
 
   virtual void cleanup() = 0;
@@ -32,6 +37,14 @@ class AudioRecorderCallback {
   void clearOnErrorCallback();
   void invokeOnErrorCallback(const std::string &message);
 
+  [[nodiscard]] uint64_t getCallbackId() const;
+  /// @brief Buffers reused between callbacks, empty unless buffers are reused.
+  /// Batch i is delivered in buffers [i * batchSize, i * batchSize + chunkCount).
+  [[nodiscard]] std::vector<std::shared_ptr<AudioBuffer>> getPooledBuffers() const;
+  /// @brief Returns the batch to the pool once JS is done with its buffers.
+  /// This method should be called from the JS thread only.
+  void releaseBatch(size_t batchIndex);
+
  protected:
   std::atomic<bool> isInitialized_{false};
 
@@ -45,8 +58,14 @@ class AudioRecorderCallback {
 
   std::shared_ptr<AudioEventHandlerRegistry> audioEventHandlerRegistry_;
 
-  // TODO: CircularAudioBus
-  std::vector<std::shared_ptr<CircularAudioArray>> circularBus_;
+  std::unique_ptr<SpscAudioRing> ring_;
+
+ private:
+  // set only when buffers are reused
+  std::unique_ptr<AudioRecorderBufferPool> bufferPool_;
+  size_t reportedDroppedFrames_ = 0;
+
+  void emitPooledAudioData(bool flush);
 };
 
 } // namespace audioapi
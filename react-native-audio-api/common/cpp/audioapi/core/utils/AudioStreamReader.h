@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// Pull-based source of decoded planar audio, read sequentially by a
+/// background thread and repositioned with sample accuracy.
+class AudioStreamReader {
+ public:
+  virtual ~AudioStreamReader() = default;
+
+  [[nodiscard]] virtual int getNumberOfChannels() const = 0;
+  [[nodiscard]] virtual float getSampleRate() const = 0;
+  /// @return Length of the stream in frames, 0 when it is not known upfront.
+  [[nodiscard]] virtual size_t getLengthInFrames() const = 0;
+
+  /// Decodes up to frames frames into bus starting at offset.
+  /// @return Number of frames read, less than requested at the end of the stream.
+  virtual size_t read(AudioBus *bus, size_t offset, size_t frames) = 0;
+  /// Moves the read position to the given frame.
+  virtual bool seek(size_t frame) = 0;
+};
+
+} // namespace audioapi
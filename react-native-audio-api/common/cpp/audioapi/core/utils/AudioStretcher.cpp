@@ -1,75 +1,391 @@
 #include <audioapi/core/sources/AudioBuffer.h>
 #include <audioapi/core/utils/AudioStretcher.h>
 #include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/Locker.h>
+#include <audioapi/core/utils/PlanarAudioStore.h>
+#include <audioapi/dsp/VectorMath.h>
 #include <audioapi/libs/audio-stretch/stretch.h>
+#include <audioapi/libs/signalsmith-stretch/signalsmith-stretch.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/FrameRanges.hpp>
+#include <audioapi/utils/ThreadPool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace audioapi {
 
-std::vector<int16_t> AudioStretcher::castToInt16Buffer(AudioBuffer &buffer) {
-  const size_t numChannels = buffer.getNumberOfChannels();
-  const size_t numFrames = buffer.getLength();
+namespace {
+
+inline int16_t floatToInt16(float sample) {
+  return static_cast<int16_t>(std::lrint(std::clamp(sample, -1.0f, 1.0f) * INT16_MAX));
+}
 
-  std::vector<int16_t> int16Buffer(numFrames * numChannels);
+// Channels of the input readable at any position, frames outside of the bus
+// are silent, which covers the pre-roll before the start and the tail past
+// the end.
+struct PaddedInput {
+  const AudioBus *bus;
+  long offset;
 
-  for (size_t ch = 0; ch < numChannels; ++ch) {
-    const float *channelData = buffer.getChannelData(ch);
-    for (size_t i = 0; i < numFrames; ++i) {
-      int16Buffer[i * numChannels + ch] = floatToInt16(channelData[i]);
+  struct Channel {
+    const float *data;
+    long offset;
+    long length;
+
+    float operator[](int index) const {
+      auto position = offset + index;
+      return position >= 0 && position < length ? data[position] : 0.0f;
     }
+  };
+
+  Channel operator[](int channel) const {
+    return {bus->getChannel(channel)->getData(), offset, static_cast<long>(bus->getSize())};
   }
+};
 
-  return int16Buffer;
-}
+} // namespace
+
+class AudioStretcher::Progress {
+ public:
+  Progress(size_t total, const ProgressCallback &onProgress)
+      : total_(total), onProgress_(onProgress) {}
+
+  void advance(size_t frames) {
+    if (!onProgress_ || total_ == 0) {
+      return;
+    }
+
+    auto done = done_.fetch_add(frames, std::memory_order_relaxed) + frames;
+    report(std::min(static_cast<float>(done) / static_cast<float>(total_), 1.0f));
+  }
+
+  void finish() {
+    if (onProgress_) {
+      report(1.0f);
+    }
+  }
+
+ private:
+  size_t total_;
+  const ProgressCallback &onProgress_;
+  std::atomic<size_t> done_ = 0;
+
+  std::mutex mutex_;
+  float reported_ = 0.0f;
+
+  void report(float fraction) {
+    Locker locker(mutex_);
+
+    if (fraction >= 1.0f ? reported_ < 1.0f : fraction - reported_ >= PROGRESS_STEP) {
+      reported_ = fraction;
+      onProgress_(fraction);
+    }
+  }
+};
 
 std::shared_ptr<AudioBuffer> AudioStretcher::changePlaybackSpeed(
-    AudioBuffer buffer,
-    float playbackSpeed) {
-  const float sampleRate = buffer.getSampleRate();
-  const size_t outputChannels = buffer.getNumberOfChannels();
-  const size_t numFrames = buffer.getLength();
+    AudioBuffer &buffer,
+    float playbackSpeed,
+    StretchAlgorithm algorithm,
+    const ProgressCallback &onProgress) {
+  if (!(playbackSpeed > 0.0f) || !std::isfinite(playbackSpeed)) {
+    return nullptr;
+  }
+
+  // the buffer is read in place, its samples are not copied
+  auto input = buffer.acquireBus();
+  Progress progress(input->getSize(), onProgress);
 
   if (playbackSpeed == 1.0f) {
+    progress.finish();
     return std::make_shared<AudioBuffer>(buffer);
   }
 
-  std::vector<int16_t> int16Buffer = castToInt16Buffer(buffer);
+  std::shared_ptr<AudioBus> output;
+  switch (algorithm) {
+    case StretchAlgorithm::SIGNALSMITH:
+      output = stretchWithSignalsmith(*input, playbackSpeed, progress);
+      break;
+    case StretchAlgorithm::TDHS:
+    default:
+      output = stretchWithTdhs(*input, playbackSpeed, progress);
+      break;
+  }
+
+  if (output == nullptr) {
+    return nullptr;
+  }
+
+  progress.finish();
+  return std::make_shared<AudioBuffer>(output);
+}
+
+// audio-stretch works on interleaved int16 samples only, every chunk is
+// quantized right before it is stretched.
+std::shared_ptr<AudioBus> AudioStretcher::stretchWithTdhs(
+    const AudioBus &input,
+    float playbackSpeed,
+    Progress &progress) {
+  auto sampleRate = input.getSampleRate();
+  auto numberOfChannels = input.getNumberOfChannels();
+  auto length = input.getSize();
+  auto ratio = 1.0f / playbackSpeed;
 
   auto stretcher = stretch_init(
       static_cast<int>(sampleRate / UPPER_FREQUENCY_LIMIT_DETECTION),
       static_cast<int>(sampleRate / LOWER_FREQUENCY_LIMIT_DETECTION),
-      outputChannels,
-      0x1);
-
-  int maxOutputFrames =
-      stretch_output_capacity(stretcher, static_cast<int>(numFrames), 1 / playbackSpeed);
-  std::vector<int16_t> stretchedBuffer(maxOutputFrames * outputChannels);
-
-  int outputFrames = stretch_samples(
-      stretcher,
-      int16Buffer.data(),
-      static_cast<int>(numFrames),
-      stretchedBuffer.data(),
-      1 / playbackSpeed);
-
-  outputFrames += stretch_flush(stretcher, stretchedBuffer.data() + (outputFrames));
-  stretchedBuffer.resize(outputFrames * outputChannels);
+      numberOfChannels,
+      STRETCH_FAST_FLAG);
+  if (stretcher == nullptr) {
+    return nullptr;
+  }
+
+  auto capacity = static_cast<size_t>(
+      stretch_output_capacity(stretcher, static_cast<int>(CHUNK_SIZE), ratio));
+  std::vector<int16_t> inputChunk(CHUNK_SIZE * numberOfChannels);
+  std::vector<int16_t> outputChunk(capacity * numberOfChannels);
+  std::vector<float> convertedChunk(capacity * numberOfChannels);
+
+  PlanarAudioStore store(
+      numberOfChannels, sampleRate, static_cast<size_t>(static_cast<float>(length) * ratio));
+
+  auto appendOutput = [&](int frames) {
+    auto samples = static_cast<size_t>(frames) * numberOfChannels;
+    dsp::int16ToFloat(outputChunk.data(), 1, convertedChunk.data(), samples);
+    store.appendInterleaved(convertedChunk.data(), static_cast<size_t>(frames));
+  };
+
+  for (size_t start = 0; start < length; start += CHUNK_SIZE) {
+    auto frames = std::min(CHUNK_SIZE, length - start);
+
+    for (int ch = 0; ch < numberOfChannels; ch += 1) {
+      auto channelData = input.getChannel(ch)->getData() + start;
+      for (size_t i = 0; i < frames; i += 1) {
+        inputChunk[i * numberOfChannels + ch] = floatToInt16(channelData[i]);
+      }
+    }
+
+    appendOutput(stretch_samples(
+        stretcher, inputChunk.data(), static_cast<int>(frames), outputChunk.data(), ratio));
+    progress.advance(frames);
+  }
+
+  for (auto frames = stretch_flush(stretcher, outputChunk.data()); frames > 0;
+       frames = stretch_flush(stretcher, outputChunk.data())) {
+    appendOutput(frames);
+  }
+
   stretch_deinit(stretcher);
+  return store.finish();
+}
+
+// Every segment is stretched by its own instance, started from a pre-roll of
+// the preceding input. Outputs produced during the latency of the instance
+// are discarded, so the following ones map to the same input positions as
+// one instance running over the whole buffer would.
+// Instances do not share phases, so segments are stitched the way WSOLA
+// joins frames: every segment also renders a margin around its range, is
+// shifted by the lag which best matches the end of the previous segment and
+// crossfaded with it.
+std::shared_ptr<AudioBus> AudioStretcher::stretchWithSignalsmith(
+    const AudioBus &input,
+    float playbackSpeed,
+    Progress &progress) {
+  using SignalsmithStretch = signalsmith::stretch::SignalsmithStretch<float>;
+
+  auto sampleRate = input.getSampleRate();
+  auto numberOfChannels = input.getNumberOfChannels();
+  auto outputLength = static_cast<size_t>(
+      std::llround(static_cast<double>(input.getSize()) / static_cast<double>(playbackSpeed)));
+  if (outputLength == 0) {
+    return nullptr;
+  }
+
+  auto maxSegments =
+      std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), MAX_WORKERS);
+  auto segments = splitIntoRanges(
+      outputLength, maxSegments, static_cast<size_t>(MIN_SEGMENT_DURATION * sampleRate));
+
+  auto output = std::make_shared<AudioBus>(outputLength, numberOfChannels, sampleRate);
+  // Every segment but the first one renders CROSSFADE_LENGTH + MAX_LAG frames
+  // before its start and MAX_LAG frames past its end. The head also repeats
+  // the first MAX_LAG frames of the segment, as the segment may be shifted.
+  constexpr size_t headLength = CROSSFADE_LENGTH + 2 * MAX_LAG;
+  std::vector<std::unique_ptr<AudioBus>> heads(segments.size());
+  std::vector<std::unique_ptr<AudioBus>> tails(segments.size());
+
+  auto stretchSegment = [&](size_t index) {
+    const auto &segment = segments[index];
+    auto segmentEnd = segment.start + segment.length;
+    auto start = index == 0 ? 0 : segment.start - CROSSFADE_LENGTH - MAX_LAG;
+    auto end = index == 0 ? segmentEnd : segmentEnd + MAX_LAG;
+
+    if (index > 0) {
+      heads[index] = std::make_unique<AudioBus>(headLength, numberOfChannels, sampleRate);
+      tails[index] = std::make_unique<AudioBus>(MAX_LAG, numberOfChannels, sampleRate);
+    }
+
+    SignalsmithStretch stretch;
+    stretch.presetDefault(numberOfChannels, sampleRate);
+
+    // The next output of an instance maps to its input position minus the
+    // input latency and the output latency scaled to input frames.
+    auto warmUpLength = static_cast<size_t>(stretch.outputLatency());
+    auto inputStart = std::lround(static_cast<double>(start) * playbackSpeed) +
+        static_cast<long>(stretch.inputLatency());
+    stretch.seek(
+        PaddedInput{&input, inputStart - stretch.seekLength()},
+        stretch.seekLength(),
+        playbackSpeed);
+
+    AudioBus chunk(CHUNK_SIZE, numberOfChannels, sampleRate);
+    std::vector<float *> chunkChannels(numberOfChannels);
+    for (int ch = 0; ch < numberOfChannels; ch += 1) {
+      chunkChannels[ch] = chunk.getChannel(ch)->getData();
+    }
+
+    // copies rendered frames of [chunkStart, chunkEnd) overlapping with
+    // [destinationStart, destinationEnd), all in output positions
+    auto copyOverlap = [&](AudioBus *destination,
+                           size_t destinationStart,
+                           size_t destinationEnd,
+                           size_t chunkStart,
+                           size_t chunkEnd,
+                           size_t chunkOffset) {
+      auto from = std::max(destinationStart, chunkStart);
+      auto to = std::min(destinationEnd, chunkEnd);
+      if (destination == nullptr || from >= to) {
+        return;
+      }
+
+      for (int ch = 0; ch < numberOfChannels; ch += 1) {
+        std::memcpy(
+            destination->getChannel(ch)->getData() + (from - destinationStart),
+            chunkChannels[ch] + chunkOffset + (from - chunkStart),
+            (to - from) * sizeof(float));
+      }
+    };
+
+    auto totalLength = warmUpLength + end - start;
+    auto inputPosition = inputStart;
+
+    for (size_t rendered = 0; rendered < totalLength;) {
+      auto frames = std::min(CHUNK_SIZE, totalLength - rendered);
+      // positions are derived from the total count, so rounding never drifts
+      auto nextInputPosition = inputStart +
+          std::lround(static_cast<double>(rendered + frames) * static_cast<double>(playbackSpeed));
+
+      stretch.process(
+          PaddedInput{&input, inputPosition},
+          static_cast<int>(nextInputPosition - inputPosition),
+          chunkChannels,
+          static_cast<int>(frames));
+      inputPosition = nextInputPosition;
+
+      if (rendered + frames > warmUpLength) {
+        auto chunkOffset = rendered < warmUpLength ? warmUpLength - rendered : 0;
+        auto chunkStart = start + rendered + chunkOffset - warmUpLength;
+        auto chunkEnd = start + rendered + frames - warmUpLength;
+
+        copyOverlap(output.get(), segment.start, segmentEnd, chunkStart, chunkEnd, chunkOffset);
+        copyOverlap(heads[index].get(), start, start + headLength, chunkStart, chunkEnd, chunkOffset);
+        copyOverlap(tails[index].get(), segmentEnd, end, chunkStart, chunkEnd, chunkOffset);
+
+        // progress is counted in input frames
+        progress.advance(
+            static_cast<size_t>(static_cast<float>(chunkEnd - chunkStart) * playbackSpeed));
+      }
+
+      rendered += frames;
+    }
+  };
+
+  if (segments.size() == 1) {
+    stretchSegment(0);
+  } else {
+    ThreadPool threadPool(segments.size());
+
+    for (size_t index = 0; index < segments.size(); index += 1) {
+      threadPool.schedule([&stretchSegment, index]() { stretchSegment(index); });
+    }
+
+    threadPool.wait();
+  }
+
+  // Segments are stitched in order, so every one of them is matched with the
+  // already shifted end of the previous one.
+  for (size_t index = 1; index < segments.size(); index += 1) {
+    const auto &segment = segments[index];
+    auto fadeStart = segment.start - CROSSFADE_LENGTH;
+    auto *head = heads[index].get();
+    auto *tail = tails[index].get();
+
+    size_t bestLag = MAX_LAG;
+    float bestCorrelation = -std::numeric_limits<float>::infinity();
+    for (size_t lag = 0; lag <= 2 * MAX_LAG; lag += 1) {
+      float correlation = 0.0f;
+      float energy = 0.0f;
+
+      for (int ch = 0; ch < numberOfChannels; ch += 1) {
+        auto headData = head->getChannel(ch)->getData() + lag;
+        correlation += dsp::dotProduct(
+            output->getChannel(ch)->getData() + fadeStart, headData, CROSSFADE_LENGTH);
+        energy += dsp::dotProduct(headData, headData, CROSSFADE_LENGTH);
+      }
+
+      correlation /= std::sqrt(energy + 1e-9f);
+      if (correlation > bestCorrelation) {
+        bestCorrelation = correlation;
+        bestLag = lag;
+      }
+    }
+
+    for (int ch = 0; ch < numberOfChannels; ch += 1) {
+      auto outputData = output->getChannel(ch)->getData();
+      auto headData = head->getChannel(ch)->getData() + bestLag;
+      auto tailData = tail->getChannel(ch)->getData();
 
-  auto audioBus = std::make_shared<AudioBus>(outputFrames, outputChannels, sampleRate);
+      // moves the segment by bestLag - MAX_LAG frames
+      if (bestLag > MAX_LAG) {
+        auto shift = bestLag - MAX_LAG;
+        std::memmove(
+            outputData + segment.start,
+            outputData + segment.start + shift,
+            (segment.length - shift) * sizeof(float));
+        std::memcpy(
+            outputData + segment.start + segment.length - shift, tailData, shift * sizeof(float));
+      } else if (bestLag < MAX_LAG) {
+        auto shift = MAX_LAG - bestLag;
+        std::memmove(
+            outputData + segment.start + shift,
+            outputData + segment.start,
+            (segment.length - shift) * sizeof(float));
+        std::memcpy(
+            outputData + segment.start, headData + CROSSFADE_LENGTH, shift * sizeof(float));
+      }
 
-  for (int ch = 0; ch < outputChannels; ++ch) {
-    auto channelData = audioBus->getChannel(ch)->getData();
-    for (int i = 0; i < outputFrames; ++i) {
-      channelData[i] = int16ToFloat(stretchedBuffer[i * outputChannels + ch]);
+      // the matched segments are correlated, so their gains sum up to one
+      for (size_t i = 0; i < CROSSFADE_LENGTH; i += 1) {
+        auto fadeIn = std::sin(
+            (static_cast<float>(i) + 0.5f) / static_cast<float>(CROSSFADE_LENGTH) * PI / 2.0f);
+        fadeIn *= fadeIn;
+        outputData[fadeStart + i] =
+            outputData[fadeStart + i] * (1.0f - fadeIn) + headData[i] * fadeIn;
+      }
     }
   }
 
-  return std::make_shared<AudioBuffer>(audioBus);
+  return output;
 }
 
 } // namespace audioapi
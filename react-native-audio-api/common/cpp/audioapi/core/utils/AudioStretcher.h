@@ -1,30 +1,58 @@
 #pragma once
 
+#include <audioapi/core/types/StretchAlgorithm.h>
+
+#include <cstddef>
+#include <functional>
 #include <memory>
-#include <vector>
 
 namespace audioapi {
 
 class AudioBus;
 class AudioBuffer;
 
+/// Offline time-stretch of whole buffers. Input is read in place and
+/// processed in bounded chunks, the output is written straight into the
+/// final planar bus.
+/// TDHS (audio-stretch) is a fast time domain method working on int16
+/// samples, all channels share one instance so they stay in lockstep.
+/// Signalsmith works on floats, the output is split into segments which
+/// are stretched on several threads and aligned and crossfaded at their
+/// boundaries.
 class AudioStretcher {
  public:
+  /// Receives the processed fraction in [0, 1], possibly from a worker
+  /// thread, calls are serialized and the fraction never decreases.
+  using ProgressCallback = std::function<void(float)>;
+
   AudioStretcher() = delete;
 
+  /// @return Stretched buffer, nullptr when playbackSpeed is not positive
+  /// or the stretcher can not be initialized.
+  /// @note The buffer is read on the calling thread, which must be the only one using it,
+  /// e.g. a copy of a buffer held by JS.
   [[nodiscard]] static std::shared_ptr<AudioBuffer> changePlaybackSpeed(
-      AudioBuffer buffer,
-      float playbackSpeed);
+      AudioBuffer &buffer,
+      float playbackSpeed,
+      StretchAlgorithm algorithm = StretchAlgorithm::TDHS,
+      const ProgressCallback &onProgress = nullptr);
 
  private:
-  static std::vector<int16_t> castToInt16Buffer(AudioBuffer &buffer);
-
-  [[nodiscard]] static inline int16_t floatToInt16(float sample) {
-    return static_cast<int16_t>(sample * INT16_MAX);
-  }
-  [[nodiscard]] static inline float int16ToFloat(int16_t sample) {
-    return static_cast<float>(sample) / INT16_MAX;
-  }
+  static constexpr size_t CHUNK_SIZE = 8192;
+  static constexpr size_t MAX_WORKERS = 8;
+  static constexpr double MIN_SEGMENT_DURATION = 5.0;
+  static constexpr size_t CROSSFADE_LENGTH = 1024;
+  // largest shift of a segment which aligns it with the previous one
+  static constexpr size_t MAX_LAG = 256;
+  // progress is reported in steps of at least 1%
+  static constexpr float PROGRESS_STEP = 0.01f;
+
+  class Progress;
+
+  static std::shared_ptr<AudioBus>
+  stretchWithTdhs(const AudioBus &input, float playbackSpeed, Progress &progress);
+  static std::shared_ptr<AudioBus>
+  stretchWithSignalsmith(const AudioBus &input, float playbackSpeed, Progress &progress);
 };
 
 } // namespace audioapi
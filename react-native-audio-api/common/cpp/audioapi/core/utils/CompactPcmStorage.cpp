@@ -0,0 +1,105 @@
+#include <audioapi/core/utils/CompactPcmStorage.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+namespace {
+
+inline uint16_t floatToInt16(float value) {
+  auto scaled = std::lrint(std::clamp(value, -1.0f, 1.0f) * 32768.0f);
+  return static_cast<uint16_t>(static_cast<int16_t>(std::min(scaled, 32767L)));
+}
+
+// IEEE 754 binary16 rounded to the nearest even value.
+inline uint16_t floatToHalf(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  bits &= 0x7FFFFFFF;
+
+  if (bits > 0x7F800000) {
+    return sign | 0x7E00;
+  }
+
+  // 65520 and above round to infinity
+  if (bits >= 0x477FF000) {
+    return sign | 0x7C00;
+  }
+
+  // below the smallest half normal, the value becomes a half subnormal
+  if (bits < 0x38800000) {
+    float absolute;
+    std::memcpy(&absolute, &bits, sizeof(absolute));
+    return sign | static_cast<uint16_t>(std::lrint(absolute * 0x1.0p24f));
+  }
+
+  bits += 0x0FFF + ((bits >> 13) & 1);
+  return sign | static_cast<uint16_t>((bits - (112u << 23)) >> 13);
+}
+
+} // namespace
+
+CompactPcmStorage::CompactPcmStorage(
+    std::vector<uint8_t> samples,
+    PcmSampleFormat format,
+    int numberOfChannels,
+    float sampleRate,
+    size_t length)
+    // moving the vector keeps its data in place
+    : PcmStorage(
+          samples.data(),
+          format,
+          numberOfChannels,
+          sampleRate,
+          length,
+          getBytesPerSample(format),
+          length * getBytesPerSample(format)),
+      samples_(std::move(samples)) {}
+
+std::shared_ptr<CompactPcmStorage> CompactPcmStorage::create(
+    const AudioBus &bus,
+    PcmSampleFormat format) {
+  if (format != PcmSampleFormat::INT16 && format != PcmSampleFormat::FLOAT16) {
+    throw std::invalid_argument("Compact storage holds 16-bit integer or half-float samples");
+  }
+
+  auto length = bus.getSize();
+  auto numberOfChannels = bus.getNumberOfChannels();
+  std::vector<uint16_t> encoded(length);
+  std::vector<uint8_t> samples(length * numberOfChannels * sizeof(uint16_t));
+
+  for (int ch = 0; ch < numberOfChannels; ch += 1) {
+    const float *source = bus.getChannel(ch)->getData();
+
+    if (format == PcmSampleFormat::INT16) {
+      std::transform(source, source + length, encoded.begin(), floatToInt16);
+    } else {
+      std::transform(source, source + length, encoded.begin(), floatToHalf);
+    }
+
+    // samples are little-endian like every supported target
+    std::memcpy(
+        samples.data() + ch * length * sizeof(uint16_t),
+        encoded.data(),
+        length * sizeof(uint16_t));
+  }
+
+  return std::shared_ptr<CompactPcmStorage>(new CompactPcmStorage(
+      std::move(samples), format, numberOfChannels, bus.getSampleRate(), length));
+}
+
+size_t CompactPcmStorage::getAllocatedSizeInBytes() const {
+  return samples_.size();
+}
+
+} // namespace audioapi
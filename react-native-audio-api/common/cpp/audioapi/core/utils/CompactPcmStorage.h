@@ -0,0 +1,39 @@
+#pragma once
+
+#include <audioapi/core/utils/PcmStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// Heap storage of 16-bit integer or half-float samples, half the size of
+/// float storage. Channels are stored one after another, so the frames of a
+/// channel are contiguous when converted back.
+class CompactPcmStorage : public PcmStorage {
+ public:
+  /// Quantizes float samples of the bus, integer samples are rounded to the
+  /// nearest value and clipped to [-1, 1].
+  /// @throws std::invalid_argument when format is not INT16 or FLOAT16.
+  [[nodiscard]] static std::shared_ptr<CompactPcmStorage> create(
+      const AudioBus &bus,
+      PcmSampleFormat format);
+
+  [[nodiscard]] size_t getAllocatedSizeInBytes() const override;
+
+ private:
+  std::vector<uint8_t> samples_;
+
+  CompactPcmStorage(
+      std::vector<uint8_t> samples,
+      PcmSampleFormat format,
+      int numberOfChannels,
+      float sampleRate,
+      size_t length);
+};
+
+} // namespace audioapi
@@ -15,6 +15,7 @@ static constexpr int MAX_CHANNEL_COUNT = 32;
 // stretcher
 static constexpr float UPPER_FREQUENCY_LIMIT_DETECTION = 333.0f;
 static constexpr float LOWER_FREQUENCY_LIMIT_DETECTION = 55.0f;
+static constexpr int PITCH_CORRECTION_RELEASE_DELAY_FRAMES = RENDER_QUANTUM_SIZE * 128;
 
 // general
 static constexpr float MOST_POSITIVE_SINGLE_FLOAT =
@@ -29,4 +30,5 @@ static constexpr float PI = std::numbers::pi_v<float>;
 static constexpr size_t PROMISE_VENDOR_THREAD_POOL_WORKER_COUNT = 4;
 static constexpr size_t PROMISE_VENDOR_THREAD_POOL_LOAD_BALANCER_QUEUE_SIZE = 32;
 static constexpr size_t PROMISE_VENDOR_THREAD_POOL_WORKER_QUEUE_SIZE = 32;
+static constexpr size_t DECODED_AUDIO_CACHE_DEFAULT_BUDGET = 32 * 1024 * 1024;
 } // namespace audioapi
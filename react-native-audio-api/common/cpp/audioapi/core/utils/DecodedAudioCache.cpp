@@ -0,0 +1,153 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/DecodedAudioCache.h>
+#include <audioapi/core/utils/PcmStorage.h>
+
+#include <sys/stat.h>
+
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace audioapi {
+
+DecodedAudioCache::DecodedAudioCache(size_t budget) : budget_(budget) {}
+
+DecodedAudioCache &DecodedAudioCache::shared() {
+  static DecodedAudioCache cache(DECODED_AUDIO_CACHE_DEFAULT_BUDGET);
+  return cache;
+}
+
+std::shared_ptr<AudioBuffer>
+DecodedAudioCache::getOrDecode(const std::string &path, float sampleRate, const Decoder &decode) {
+  FileStamp stamp;
+  if (!readFileStamp(path, stamp)) {
+    return decode();
+  }
+
+  auto key = std::to_string(sampleRate) + ":" + path;
+  std::promise<std::shared_ptr<AudioBuffer>> decoded;
+
+  {
+    std::unique_lock lock(mutex_);
+
+    if (auto it = index_.find(key); it != index_.end()) {
+      if (it->second->stamp == stamp) {
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return std::make_shared<AudioBuffer>(*it->second->buffer);
+      }
+
+      erase(it->second);
+    }
+
+    if (auto it = inFlight_.find(key); it != inFlight_.end()) {
+      auto pending = it->second;
+      lock.unlock();
+
+      auto buffer = pending.get();
+      return buffer != nullptr ? std::make_shared<AudioBuffer>(*buffer) : nullptr;
+    }
+
+    inFlight_.emplace(key, decoded.get_future().share());
+  }
+
+  std::shared_ptr<AudioBuffer> buffer;
+
+  try {
+    // the decode is no longer in flight however this scope is left, so a throwing
+    // decoder does not leave every later request waiting for it
+    InFlightGuard inFlight(*this, key);
+    buffer = decode();
+
+    if (buffer != nullptr) {
+      auto size = getBufferSize(*buffer);
+      std::lock_guard lock(mutex_);
+      if (size <= budget_) {
+        entries_.push_front({key, stamp, buffer, size});
+        index_[key] = entries_.begin();
+        size_ += size;
+        evictToBudget();
+      }
+    }
+  } catch (...) {
+    // concurrent requests rethrow the same error, later ones decode again
+    decoded.set_exception(std::current_exception());
+    throw;
+  }
+
+  decoded.set_value(buffer);
+  return buffer != nullptr ? std::make_shared<AudioBuffer>(*buffer) : nullptr;
+}
+
+DecodedAudioCache::InFlightGuard::InFlightGuard(DecodedAudioCache &cache, const std::string &key)
+    : cache_(cache), key_(key) {}
+
+DecodedAudioCache::InFlightGuard::~InFlightGuard() {
+  std::lock_guard lock(cache_.mutex_);
+  cache_.inFlight_.erase(key_);
+}
+
+void DecodedAudioCache::setBudget(size_t budget) {
+  std::lock_guard lock(mutex_);
+  budget_ = budget;
+  evictToBudget();
+}
+
+size_t DecodedAudioCache::getBudget() const {
+  std::lock_guard lock(mutex_);
+  return budget_;
+}
+
+size_t DecodedAudioCache::getSize() const {
+  std::lock_guard lock(mutex_);
+  return size_;
+}
+
+void DecodedAudioCache::clear() {
+  std::lock_guard lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  size_ = 0;
+}
+
+void DecodedAudioCache::erase(std::list<Entry>::iterator entry) {
+  size_ -= entry->size;
+  index_.erase(entry->key);
+  entries_.erase(entry);
+}
+
+void DecodedAudioCache::evictToBudget() {
+  while (size_ > budget_ && !entries_.empty()) {
+    erase(std::prev(entries_.end()));
+  }
+}
+
+bool DecodedAudioCache::readFileStamp(const std::string &path, FileStamp &stamp) {
+  struct stat fileStat {};
+  if (stat(path.c_str(), &fileStat) != 0) {
+    return false;
+  }
+
+#ifdef __APPLE__
+  const auto &modificationTime = fileStat.st_mtimespec;
+#else
+  const auto &modificationTime = fileStat.st_mtim;
+#endif // __APPLE__
+
+  stamp.modificationTime =
+      static_cast<int64_t>(modificationTime.tv_sec) * 1000000000 + modificationTime.tv_nsec;
+  stamp.size = static_cast<int64_t>(fileStat.st_size);
+  return true;
+}
+
+size_t DecodedAudioCache::getBufferSize(const AudioBuffer &buffer) {
+  if (auto storage = buffer.getPcmStorage()) {
+    return storage->getAllocatedSizeInBytes();
+  }
+
+  return buffer.getLength() * buffer.getNumberOfChannels() * sizeof(float);
+}
+
+} // namespace audioapi
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+/// Cache of decoded files keyed by path and target sample rate, shared by
+/// all contexts. Entries are dropped when the file changes on disk and
+/// evicted in least recently used order once the byte budget is exceeded.
+/// Concurrent requests for the same file wait for a single decode.
+/// Callers get buffers sharing the cached samples, writes to them are
+/// copy-on-write and never reach the cache.
+class DecodedAudioCache {
+ public:
+  using Decoder = std::function<std::shared_ptr<AudioBuffer>()>;
+
+  explicit DecodedAudioCache(size_t budget);
+
+  [[nodiscard]] static DecodedAudioCache &shared();
+
+  /// @return Cached buffer, or the one produced by decode which is cached
+  /// when it fits in the budget. nullptr when decoding fails.
+  /// @throws Whatever decode throws, also to concurrent requests waiting for it.
+  std::shared_ptr<AudioBuffer>
+  getOrDecode(const std::string &path, float sampleRate, const Decoder &decode);
+
+  void setBudget(size_t budget);
+  [[nodiscard]] size_t getBudget() const;
+  /// @return Number of bytes held by cached buffers.
+  [[nodiscard]] size_t getSize() const;
+  void clear();
+
+ private:
+  struct FileStamp {
+    // nanoseconds since the epoch
+    int64_t modificationTime = 0;
+    int64_t size = 0;
+
+    bool operator==(const FileStamp &other) const = default;
+  };
+
+  struct Entry {
+    std::string key;
+    FileStamp stamp;
+    std::shared_ptr<AudioBuffer> buffer;
+    size_t size;
+  };
+
+  /// Removes the in flight decode of a key when leaving its scope.
+  class InFlightGuard {
+   public:
+    InFlightGuard(DecodedAudioCache &cache, const std::string &key);
+    ~InFlightGuard();
+    InFlightGuard(const InFlightGuard &) = delete;
+    InFlightGuard &operator=(const InFlightGuard &) = delete;
+
+   private:
+    DecodedAudioCache &cache_;
+    const std::string &key_;
+  };
+
+  mutable std::mutex mutex_;
+  size_t budget_;
+  size_t size_ = 0;
+  // most recently used first
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  std::unordered_map<std::string, std::shared_future<std::shared_ptr<AudioBuffer>>> inFlight_;
+
+  // both expect mutex_ to be held
+  void erase(std::list<Entry>::iterator entry);
+  void evictToBudget();
+
+  [[nodiscard]] static bool readFileStamp(const std::string &path, FileStamp &stamp);
+  [[nodiscard]] static size_t getBufferSize(const AudioBuffer &buffer);
+};
+
+} // namespace audioapi
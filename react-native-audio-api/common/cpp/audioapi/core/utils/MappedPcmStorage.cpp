@@ -0,0 +1,194 @@
+#include <audioapi/core/utils/MappedPcmStorage.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace audioapi {
+
+namespace {
+
+constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+inline uint16_t readUint16(const uint8_t *data) {
+  return static_cast<uint16_t>(data[0] | data[1] << 8);
+}
+
+inline uint32_t readUint32(const uint8_t *data) {
+  return static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 |
+      static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24;
+}
+
+} // namespace
+
+MappedPcmStorage::MappedPcmStorage(void *mapping, size_t mappingSize, const Layout &layout)
+    : PcmStorage(
+          static_cast<const uint8_t *>(mapping) + layout.dataOffset,
+          layout.format,
+          layout.numberOfChannels,
+          layout.sampleRate,
+          layout.length,
+          layout.numberOfChannels * getBytesPerSample(layout.format),
+          getBytesPerSample(layout.format)),
+      mapping_(mapping),
+      mappingSize_(mappingSize),
+      dataOffset_(layout.dataOffset),
+      frameStride_(layout.numberOfChannels * getBytesPerSample(layout.format)) {}
+
+MappedPcmStorage::~MappedPcmStorage() {
+  munmap(mapping_, mappingSize_);
+}
+
+std::shared_ptr<MappedPcmStorage> MappedPcmStorage::openWav(const std::string &path) {
+  return map(path, parseWavHeader);
+}
+
+std::shared_ptr<MappedPcmStorage> MappedPcmStorage::openRaw(
+    const std::string &path,
+    PcmSampleFormat format,
+    int numberOfChannels,
+    float sampleRate) {
+  if (numberOfChannels <= 0 || sampleRate <= 0.0f) {
+    return nullptr;
+  }
+
+  return map(path, [=](const uint8_t *, size_t size, Layout &layout) {
+    layout.format = format;
+    layout.numberOfChannels = numberOfChannels;
+    layout.sampleRate = sampleRate;
+    layout.length = size / (numberOfChannels * getBytesPerSample(format));
+    return true;
+  });
+}
+
+size_t MappedPcmStorage::getAllocatedSizeInBytes() const {
+  return 0;
+}
+
+void MappedPcmStorage::prefetch(size_t start, size_t frames) const {
+  start = std::min(start, getLength());
+  frames = std::min(frames, getLength() - start);
+  if (frames == 0) {
+    return;
+  }
+
+  // madvise takes page aligned addresses
+  static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  auto begin = dataOffset_ + start * frameStride_;
+  auto end = dataOffset_ + (start + frames) * frameStride_;
+  auto alignedBegin = begin - begin % pageSize;
+
+  madvise(static_cast<uint8_t *>(mapping_) + alignedBegin, end - alignedBegin, MADV_WILLNEED);
+}
+
+std::shared_ptr<MappedPcmStorage> MappedPcmStorage::map(
+    const std::string &path,
+    const std::function<bool(const uint8_t *data, size_t size, Layout &layout)> &describe) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat fileStat {};
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  auto size = static_cast<size_t>(fileStat.st_size);
+  void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping keeps its own reference to the file
+  close(fd);
+
+  if (mapping == MAP_FAILED) {
+    return nullptr;
+  }
+
+  Layout layout;
+  if (!describe(static_cast<const uint8_t *>(mapping), size, layout) || layout.length == 0) {
+    munmap(mapping, size);
+    return nullptr;
+  }
+
+  return std::shared_ptr<MappedPcmStorage>(new MappedPcmStorage(mapping, size, layout));
+}
+
+bool MappedPcmStorage::parseWavHeader(const uint8_t *data, size_t size, Layout &layout) {
+  if (size < 12 || std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0) {
+    return false;
+  }
+
+  bool hasFormat = false;
+  size_t offset = 12;
+
+  while (offset + 8 <= size) {
+    const uint8_t *chunk = data + offset;
+    size_t chunkSize = readUint32(chunk + 4);
+    offset += 8;
+
+    if (std::memcmp(chunk, "fmt ", 4) == 0) {
+      if (chunkSize < 16 || offset + chunkSize > size) {
+        return false;
+      }
+
+      auto formatTag = readUint16(chunk + 8);
+      auto numberOfChannels = readUint16(chunk + 10);
+      auto sampleRate = readUint32(chunk + 12);
+      auto blockAlign = readUint16(chunk + 20);
+      auto bitsPerSample = readUint16(chunk + 22);
+
+      // the actual format tag is the head of the sub format GUID
+      if (formatTag == WAVE_FORMAT_EXTENSIBLE) {
+        if (chunkSize < 40) {
+          return false;
+        }
+        formatTag = readUint16(chunk + 32);
+      }
+
+      if (formatTag == WAVE_FORMAT_PCM && bitsPerSample == 16) {
+        layout.format = PcmSampleFormat::INT16;
+      } else if (formatTag == WAVE_FORMAT_PCM && bitsPerSample == 24) {
+        layout.format = PcmSampleFormat::INT24;
+      } else if (formatTag == WAVE_FORMAT_IEEE_FLOAT && bitsPerSample == 32) {
+        layout.format = PcmSampleFormat::FLOAT32;
+      } else {
+        return false;
+      }
+
+      if (numberOfChannels == 0 || sampleRate == 0 ||
+          blockAlign != numberOfChannels * getBytesPerSample(layout.format)) {
+        return false;
+      }
+
+      layout.numberOfChannels = numberOfChannels;
+      layout.sampleRate = static_cast<float>(sampleRate);
+      hasFormat = true;
+    } else if (std::memcmp(chunk, "data", 4) == 0) {
+      if (!hasFormat) {
+        return false;
+      }
+
+      // streamed files may leave the size unset, the data lasts until the end of the file
+      auto dataSize = std::min(chunkSize, size - offset);
+      layout.dataOffset = offset;
+      layout.length = dataSize / (layout.numberOfChannels * getBytesPerSample(layout.format));
+      return true;
+    }
+
+    // chunks are padded to an even size
+    offset += chunkSize + (chunkSize & 1);
+  }
+
+  return false;
+}
+
+} // namespace audioapi
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <audioapi/core/utils/PcmStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace audioapi {
+
+/// PCM samples read straight from a memory-mapped WAV or raw PCM file.
+/// Pages are loaded lazily by the OS and can be reclaimed under memory
+/// pressure, so opening a file costs neither decoding nor resident memory.
+/// Reading a page which is not resident blocks until it is loaded from
+/// storage, source nodes prefetch it ahead of the play head.
+class MappedPcmStorage : public PcmStorage {
+ public:
+  ~MappedPcmStorage() override;
+
+  /// Maps a 16-bit, 24-bit integer or 32-bit float PCM WAV file.
+  /// @return nullptr when the file can not be mapped or has another encoding.
+  [[nodiscard]] static std::shared_ptr<MappedPcmStorage> openWav(const std::string &path);
+  /// Maps a headerless file of interleaved little-endian samples.
+  /// @return nullptr when the file can not be mapped or holds no full frame.
+  [[nodiscard]] static std::shared_ptr<MappedPcmStorage>
+  openRaw(const std::string &path, PcmSampleFormat format, int numberOfChannels, float sampleRate);
+
+  /// Mapped pages belong to the page cache, not to the heap.
+  [[nodiscard]] size_t getAllocatedSizeInBytes() const override;
+  void prefetch(size_t start, size_t frames) const override;
+
+ private:
+  struct Layout {
+    size_t dataOffset = 0;
+    size_t length = 0;
+    PcmSampleFormat format = PcmSampleFormat::INT16;
+    int numberOfChannels = 0;
+    float sampleRate = 0.0f;
+  };
+
+  void *mapping_;
+  size_t mappingSize_;
+  size_t dataOffset_;
+  size_t frameStride_;
+
+  MappedPcmStorage(void *mapping, size_t mappingSize, const Layout &layout);
+
+  /// Maps the whole file, describe finds the samples in the mapped bytes.
+  [[nodiscard]] static std::shared_ptr<MappedPcmStorage> map(
+      const std::string &path,
+      const std::function<bool(const uint8_t *data, size_t size, Layout &layout)> &describe);
+  [[nodiscard]] static bool parseWavHeader(const uint8_t *data, size_t size, Layout &layout);
+};
+
+} // namespace audioapi
@@ -0,0 +1,77 @@
+#include <audioapi/core/utils/MiniaudioStreamReader.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <audioapi/libs/miniaudio/decoders/libopus/miniaudio_libopus.h>
+#include <audioapi/libs/miniaudio/decoders/libvorbis/miniaudio_libvorbis.h>
+
+#include <memory>
+#include <string>
+
+namespace audioapi {
+
+MiniaudioStreamReader::~MiniaudioStreamReader() {
+  ma_decoder_uninit(&decoder_);
+}
+
+std::unique_ptr<MiniaudioStreamReader> MiniaudioStreamReader::open(
+    const std::string &path,
+    float sampleRate) {
+  auto reader = std::unique_ptr<MiniaudioStreamReader>(new MiniaudioStreamReader());
+
+  ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, static_cast<int>(sampleRate));
+  ma_decoding_backend_vtable *customBackends[] = {
+      ma_decoding_backend_libvorbis, ma_decoding_backend_libopus};
+
+  config.ppCustomBackendVTables = customBackends;
+  config.customBackendCount = sizeof(customBackends) / sizeof(customBackends[0]);
+
+  if (ma_decoder_init_file(path.c_str(), &config, &reader->decoder_) != MA_SUCCESS) {
+    return nullptr;
+  }
+
+  // Vorbis decoders always report 0, the end is found while streaming.
+  ma_uint64 lengthInFrames = 0;
+  if (ma_decoder_get_length_in_pcm_frames(&reader->decoder_, &lengthInFrames) == MA_SUCCESS) {
+    reader->lengthInFrames_ = static_cast<size_t>(lengthInFrames);
+  }
+
+  return reader;
+}
+
+int MiniaudioStreamReader::getNumberOfChannels() const {
+  return static_cast<int>(decoder_.outputChannels);
+}
+
+float MiniaudioStreamReader::getSampleRate() const {
+  return static_cast<float>(decoder_.outputSampleRate);
+}
+
+size_t MiniaudioStreamReader::getLengthInFrames() const {
+  return lengthInFrames_;
+}
+
+size_t MiniaudioStreamReader::read(AudioBus *bus, size_t offset, size_t frames) {
+  auto numberOfChannels = getNumberOfChannels();
+  if (interleavedData_.size() < frames * numberOfChannels) {
+    interleavedData_.resize(frames * numberOfChannels);
+  }
+
+  ma_uint64 framesRead = 0;
+  ma_decoder_read_pcm_frames(&decoder_, interleavedData_.data(), frames, &framesRead);
+
+  for (int ch = 0; ch < numberOfChannels; ch += 1) {
+    auto channelData = bus->getChannel(ch)->getData() + offset;
+    for (size_t i = 0; i < framesRead; i += 1) {
+      channelData[i] = interleavedData_[i * numberOfChannels + ch];
+    }
+  }
+
+  return static_cast<size_t>(framesRead);
+}
+
+bool MiniaudioStreamReader::seek(size_t frame) {
+  return ma_decoder_seek_to_pcm_frame(&decoder_, frame) == MA_SUCCESS;
+}
+
+} // namespace audioapi
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <audioapi/core/utils/AudioStreamReader.h>
+#include <audioapi/libs/miniaudio/miniaudio.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace audioapi {
+
+/// Streams a local file through miniaudio's decoder, converting it to float
+/// samples at the requested sample rate on the fly.
+class MiniaudioStreamReader : public AudioStreamReader {
+ public:
+  ~MiniaudioStreamReader() override;
+
+  /// @return nullptr when the file can not be opened or decoded.
+  static std::unique_ptr<MiniaudioStreamReader> open(const std::string &path, float sampleRate);
+
+  [[nodiscard]] int getNumberOfChannels() const override;
+  [[nodiscard]] float getSampleRate() const override;
+  [[nodiscard]] size_t getLengthInFrames() const override;
+
+  size_t read(AudioBus *bus, size_t offset, size_t frames) override;
+  bool seek(size_t frame) override;
+
+ private:
+  MiniaudioStreamReader() = default;
+
+  ma_decoder decoder_{};
+  size_t lengthInFrames_ = 0;
+  // interleaved samples returned by the decoder
+  std::vector<float> interleavedData_;
+};
+
+} // namespace audioapi
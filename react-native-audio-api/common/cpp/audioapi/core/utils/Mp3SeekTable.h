@@ -0,0 +1,21 @@
+#pragma once
+
+#include <audioapi/libs/miniaudio/miniaudio.h>
+
+namespace audioapi {
+
+/// @brief Binds the MP3 seek table of source to destination, which must not outlive it.
+/// The table is only read while seeking and stays owned by source, which frees it.
+/// @note ma_mp3 is only declared along with the miniaudio implementation, so the definition
+/// is compiled by the translation unit defining MINIAUDIO_IMPLEMENTATION.
+void shareMp3SeekTable(const ma_decoder &source, ma_decoder &destination);
+
+#if defined(MINIAUDIO_IMPLEMENTATION)
+void shareMp3SeekTable(const ma_decoder &source, ma_decoder &destination) {
+  const auto &sourceMp3 = static_cast<const ma_mp3 *>(source.pBackend)->dr;
+  auto &destinationMp3 = static_cast<ma_mp3 *>(destination.pBackend)->dr;
+  ma_dr_mp3_bind_seek_table(&destinationMp3, sourceMp3.seekPointCount, sourceMp3.pSeekPoints);
+}
+#endif // MINIAUDIO_IMPLEMENTATION
+
+} // namespace audioapi
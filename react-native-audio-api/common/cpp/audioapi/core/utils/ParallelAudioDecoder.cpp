@@ -0,0 +1,170 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/AudioDecoder.h>
+#include <audioapi/core/utils/Mp3SeekTable.h>
+#include <audioapi/core/utils/ParallelAudioDecoder.h>
+#include <audioapi/core/utils/PlanarAudioStore.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/FrameRanges.hpp>
+#include <audioapi/utils/ThreadPool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace audioapi {
+
+std::shared_ptr<AudioBuffer> ParallelAudioDecoder::decode(
+    AudioFormat format,
+    const DecoderFactory &createDecoder,
+    float sampleRate,
+    size_t maxWorkers) {
+  // Ranges are decoded at the native rate, a resampler restarted at every
+  // range boundary would not stitch sample-exactly. When resampling, every
+  // range is decoded to its own bus and the ranges are streamed in order
+  // through a single resampler, each one freed as soon as it is consumed.
+  ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
+
+  switch (format) {
+    case AudioFormat::WAV:
+      config.encodingFormat = ma_encoding_format_wav;
+      break;
+    case AudioFormat::FLAC:
+      config.encodingFormat = ma_encoding_format_flac;
+      break;
+    case AudioFormat::MP3:
+      // without a seek table every seek decodes the file from its start
+      config.encodingFormat = ma_encoding_format_mp3;
+      config.seekPointCount = MP3_SEEK_POINT_COUNT;
+      break;
+    default:
+      return nullptr;
+  }
+
+  ma_decoder probe;
+  if (createDecoder(&config, &probe) != MA_SUCCESS) {
+    return nullptr;
+  }
+
+  ma_uint64 length = 0;
+  auto lengthResult = ma_decoder_get_length_in_pcm_frames(&probe, &length);
+  auto outputChannels = static_cast<int>(probe.outputChannels);
+  auto outputSampleRate = probe.outputSampleRate;
+
+  if (lengthResult != MA_SUCCESS || length == 0) {
+    ma_decoder_uninit(&probe);
+    return nullptr;
+  }
+
+  // the seek table of the probe is shared by every worker, building it scans the whole file
+  auto workerConfig = config;
+  workerConfig.seekPointCount = 0;
+
+  auto workers = maxWorkers > 0 ? maxWorkers : std::thread::hardware_concurrency();
+  auto maxRanges = std::min<size_t>(std::max<size_t>(workers, 1), MAX_WORKERS);
+  auto ranges = splitIntoRanges(
+      static_cast<size_t>(length),
+      maxRanges,
+      static_cast<size_t>(MIN_RANGE_DURATION * outputSampleRate));
+  if (ranges.size() < 2) {
+    ma_decoder_uninit(&probe);
+    return nullptr;
+  }
+
+  auto nativeSampleRate = static_cast<float>(outputSampleRate);
+  auto needsResampling = sampleRate > 0 && sampleRate != nativeSampleRate;
+
+  // without resampling, every range is written straight to its place in the result
+  std::shared_ptr<AudioBus> audioBus;
+  std::vector<std::shared_ptr<AudioBus>> rangeBuses(ranges.size());
+  if (needsResampling) {
+    for (size_t i = 0; i < ranges.size(); i += 1) {
+      rangeBuses[i] =
+          std::make_shared<AudioBus>(ranges[i].length, outputChannels, nativeSampleRate);
+    }
+  } else {
+    audioBus =
+        std::make_shared<AudioBus>(static_cast<size_t>(length), outputChannels, nativeSampleRate);
+  }
+  std::atomic<bool> hasFailed = false;
+
+  {
+    ThreadPool threadPool(ranges.size());
+
+    for (size_t index = 0; index < ranges.size(); index += 1) {
+      threadPool.schedule([&, index]() {
+        const auto &range = ranges[index];
+        auto *destination = needsResampling ? rangeBuses[index].get() : audioBus.get();
+        auto destinationStart = needsResampling ? 0 : range.start;
+
+        ma_decoder decoder;
+        if (createDecoder(&workerConfig, &decoder) != MA_SUCCESS) {
+          hasFailed.store(true, std::memory_order_release);
+          return;
+        }
+        if (format == AudioFormat::MP3) {
+          shareMp3SeekTable(probe, decoder);
+        }
+
+        std::vector<float> temp(CHUNK_SIZE * outputChannels);
+        size_t framesDecoded = 0;
+
+        if (ma_decoder_seek_to_pcm_frame(&decoder, range.start) == MA_SUCCESS) {
+          while (framesDecoded < range.length) {
+            auto framesToRead = std::min<size_t>(CHUNK_SIZE, range.length - framesDecoded);
+            ma_uint64 tempFramesDecoded = 0;
+            ma_decoder_read_pcm_frames(&decoder, temp.data(), framesToRead, &tempFramesDecoded);
+            if (tempFramesDecoded == 0) {
+              break;
+            }
+
+            auto offset = destinationStart + framesDecoded;
+            for (int ch = 0; ch < outputChannels; ch += 1) {
+              auto channelData = destination->getChannel(ch)->getData() + offset;
+              for (size_t i = 0; i < tempFramesDecoded; i += 1) {
+                channelData[i] = temp[i * outputChannels + ch];
+              }
+            }
+            framesDecoded += static_cast<size_t>(tempFramesDecoded);
+          }
+        }
+
+        ma_decoder_uninit(&decoder);
+
+        if (framesDecoded < range.length) {
+          hasFailed.store(true, std::memory_order_release);
+        }
+      });
+    }
+
+    threadPool.wait();
+  }
+
+  ma_decoder_uninit(&probe);
+
+  if (hasFailed.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+
+  if (needsResampling) {
+    PlanarAudioStore store(
+        outputChannels, nativeSampleRate, static_cast<size_t>(length), sampleRate);
+    std::vector<const float *> channels(outputChannels);
+
+    for (auto &rangeBus : rangeBuses) {
+      for (int ch = 0; ch < outputChannels; ch += 1) {
+        channels[ch] = rangeBus->getChannel(ch)->getData();
+      }
+      store.appendPlanar(channels.data(), rangeBus->getSize());
+      rangeBus.reset();
+    }
+
+    audioBus = store.finish();
+  }
+
+  return std::make_shared<AudioBuffer>(audioBus);
+}
+
+} // namespace audioapi
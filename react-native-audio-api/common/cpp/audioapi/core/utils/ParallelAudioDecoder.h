@@ -0,0 +1,44 @@
+#pragma once
+
+#include <audioapi/core/types/AudioFormat.h>
+#include <audioapi/libs/miniaudio/miniaudio.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+/// Decodes formats with sample-exact seeking (PCM WAV, FLAC, MP3 with a seek
+/// table) on several threads. The file is split into ranges, every worker
+/// opens its own ma_decoder, seeks to the start of its range and writes
+/// straight into the final planar buffer. Decoding runs at the native rate,
+/// when resampling every range is decoded to its own buffer and the ranges
+/// are streamed through a single resampler.
+class ParallelAudioDecoder {
+ public:
+  /// Initializes a new decoder of the same file or memory block.
+  using DecoderFactory = std::function<ma_result(const ma_decoder_config *, ma_decoder *)>;
+
+  ParallelAudioDecoder() = delete;
+
+  /// @return nullptr when the audio can not be decoded in parallel, either
+  /// because of its format, unknown length or short duration, the caller is
+  /// expected to fall back to sequential decoding.
+  /// @param maxWorkers Upper bound of threads, 0 uses one per hardware thread.
+  [[nodiscard]] static std::shared_ptr<AudioBuffer> decode(
+      AudioFormat format,
+      const DecoderFactory &createDecoder,
+      float sampleRate,
+      size_t maxWorkers = 0);
+
+ private:
+  static constexpr size_t MAX_WORKERS = 8;
+  static constexpr double MIN_RANGE_DURATION = 5.0;
+  static constexpr ma_uint32 MP3_SEEK_POINT_COUNT = 1024;
+};
+
+} // namespace audioapi
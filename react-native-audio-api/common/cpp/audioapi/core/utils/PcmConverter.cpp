@@ -0,0 +1,90 @@
+#include <audioapi/core/utils/PcmConverter.h>
+#include <audioapi/core/utils/PcmStorage.h>
+#include <audioapi/core/utils/PlanarAudioStore.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+std::shared_ptr<AudioBus> PcmConverter::toAudioBus(
+    const void *data,
+    size_t size,
+    PcmSampleFormat format,
+    int numberOfChannels,
+    float sampleRate,
+    bool interleaved,
+    float outputSampleRate) {
+  if (format != PcmSampleFormat::INT16 && format != PcmSampleFormat::FLOAT32) {
+    return nullptr;
+  }
+
+  auto bytesPerSample = PcmStorage::getBytesPerSample(format);
+  if (data == nullptr || numberOfChannels <= 0 ||
+      reinterpret_cast<uintptr_t>(data) % bytesPerSample != 0) {
+    return nullptr;
+  }
+
+  auto length = size / (bytesPerSample * numberOfChannels);
+  if (length == 0) {
+    return nullptr;
+  }
+
+  if (outputSampleRate > 0 && outputSampleRate != sampleRate) {
+    PlanarAudioStore store(numberOfChannels, sampleRate, length, outputSampleRate);
+    AudioBus chunkBus(RESAMPLED_CHUNK_SIZE, numberOfChannels, sampleRate);
+    std::vector<float *> channels(numberOfChannels);
+    for (int i = 0; i < numberOfChannels; i += 1) {
+      channels[i] = chunkBus.getChannel(i)->getData();
+    }
+
+    for (size_t start = 0; start < length; start += RESAMPLED_CHUNK_SIZE) {
+      auto chunkLength = std::min(RESAMPLED_CHUNK_SIZE, length - start);
+      convertFrames(
+          data, format, numberOfChannels, interleaved, length, start, chunkLength, channels.data());
+      store.appendPlanar(channels.data(), chunkLength);
+    }
+
+    return store.finish();
+  }
+
+  auto audioBus = std::make_shared<AudioBus>(length, numberOfChannels, sampleRate);
+  std::vector<float *> channels(numberOfChannels);
+  for (int i = 0; i < numberOfChannels; i += 1) {
+    channels[i] = audioBus->getChannel(i)->getData();
+  }
+  convertFrames(data, format, numberOfChannels, interleaved, length, 0, length, channels.data());
+
+  return audioBus;
+}
+
+void PcmConverter::convertFrames(
+    const void *data,
+    PcmSampleFormat format,
+    int numberOfChannels,
+    bool interleaved,
+    size_t totalLength,
+    size_t start,
+    size_t length,
+    float *const *destinations) {
+  auto stride = interleaved ? static_cast<size_t>(numberOfChannels) : 1;
+
+  for (int i = 0; i < numberOfChannels; i += 1) {
+    auto offset = interleaved ? start * numberOfChannels + i : i * totalLength + start;
+
+    if (format == PcmSampleFormat::INT16) {
+      dsp::int16ToFloat(
+          static_cast<const int16_t *>(data) + offset, stride, destinations[i], length);
+    } else {
+      dsp::copyWithStride(
+          static_cast<const float *>(data) + offset, stride, destinations[i], length);
+    }
+  }
+}
+
+} // namespace audioapi
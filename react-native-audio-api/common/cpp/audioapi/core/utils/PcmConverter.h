@@ -0,0 +1,52 @@
+#pragma once
+
+#include <audioapi/core/types/PcmSampleFormat.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// Converts raw 16-bit integer or 32-bit float PCM straight into planar
+/// float channels, one vectorized pass per channel without intermediate
+/// copies of the source.
+class PcmConverter {
+ public:
+  PcmConverter() = delete;
+
+  /// @param data Samples in native byte order, aligned to the sample size.
+  /// @param size Size of data in bytes, a partial trailing frame is ignored.
+  /// @param interleaved Whether frames (ch1, ch2, ch1, ...) are stored one
+  /// after another, otherwise every channel is stored as a whole.
+  /// @param outputSampleRate Rate the channels are resampled to, 0 keeps
+  /// sampleRate. Data is converted and resampled in chunks, so it is never
+  /// held at both rates at once.
+  /// @return Bus with the converted channels, nullptr when the format is
+  /// not INT16 or FLOAT32, data is misaligned or holds no frames.
+  [[nodiscard]] static std::shared_ptr<AudioBus> toAudioBus(
+      const void *data,
+      size_t size,
+      PcmSampleFormat format,
+      int numberOfChannels,
+      float sampleRate,
+      bool interleaved,
+      float outputSampleRate = 0);
+
+ private:
+  static constexpr size_t RESAMPLED_CHUNK_SIZE = 4096;
+
+  /// Converts frames [start, start + length) of every channel to planar float.
+  static void convertFrames(
+      const void *data,
+      PcmSampleFormat format,
+      int numberOfChannels,
+      bool interleaved,
+      size_t totalLength,
+      size_t start,
+      size_t length,
+      float *const *destinations);
+};
+
+} // namespace audioapi
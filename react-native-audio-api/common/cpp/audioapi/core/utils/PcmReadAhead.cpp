@@ -0,0 +1,60 @@
+#include <audioapi/core/utils/PcmReadAhead.h>
+#include <audioapi/core/utils/PcmStorage.h>
+#include <memory>
+#include <utility>
+
+namespace audioapi {
+
+PcmReadAhead::PcmReadAhead() {
+  isExiting_.store(false, std::memory_order_release);
+
+  // the channel holds one element less than its capacity
+  auto [sender, receiver] = channels::spsc::channel<
+      Request,
+      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
+      channels::spsc::WaitStrategy::ATOMIC_WAIT>(kCapacity + 1);
+  sender_ = std::move(sender);
+
+  workerHandle_ = std::thread(&PcmReadAhead::process, this, std::move(receiver));
+}
+
+PcmReadAhead::~PcmReadAhead() {
+  isExiting_.store(true, std::memory_order_release);
+
+  // We need to send an empty request to unblock the receiver
+  sender_.send(Request{});
+  if (workerHandle_.joinable()) {
+    workerHandle_.join();
+  }
+}
+
+bool PcmReadAhead::request(
+    const std::shared_ptr<PcmStorage> &storage,
+    size_t start,
+    size_t frames) {
+  if (storage == nullptr || frames == 0) {
+    return false;
+  }
+
+  return sender_.try_send(Request{storage, start, frames}) ==
+      channels::spsc::ResponseStatus::SUCCESS;
+}
+
+void PcmReadAhead::process(
+    channels::spsc::Receiver<
+        Request,
+        channels::spsc::OverflowStrategy::WAIT_ON_FULL,
+        channels::spsc::WaitStrategy::ATOMIC_WAIT> &&receiver) {
+  auto rcv = std::move(receiver);
+
+  while (!isExiting_.load(std::memory_order_acquire)) {
+    auto request = rcv.receive();
+    if (request.storage == nullptr) {
+      continue;
+    }
+
+    request.storage->prefetch(request.start, request.frames);
+  }
+}
+
+} // namespace audioapi
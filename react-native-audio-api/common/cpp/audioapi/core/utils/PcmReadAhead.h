@@ -0,0 +1,52 @@
+#pragma once
+
+#include <audioapi/utils/SpscChannel.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace audioapi {
+
+class PcmStorage;
+
+#define PCM_READ_AHEAD_SPSC_OPTIONS \
+  Request, channels::spsc::OverflowStrategy::WAIT_ON_FULL, \
+      channels::spsc::WaitStrategy::ATOMIC_WAIT
+
+/// @brief Prefetches PCM storage ahead of the play head on a dedicated thread.
+/// The audio thread only queues the frames it is going to read soon, the worker makes
+/// the system calls which load them. The worker also holds the storage until its request
+/// is served, so a storage released meanwhile is unmapped outside of the audio thread.
+class PcmReadAhead {
+ public:
+  PcmReadAhead();
+  ~PcmReadAhead();
+
+  /// @brief Queues prefetching frames [start, start + frames) of the storage.
+  /// @return False when the queue is full, the request is dropped then.
+  /// @note Never blocks nor allocates, should be only used from the audio thread
+  bool request(const std::shared_ptr<PcmStorage> &storage, size_t start, size_t frames);
+
+ private:
+  struct Request {
+    std::shared_ptr<PcmStorage> storage;
+    size_t start = 0;
+    size_t frames = 0;
+  };
+
+  static constexpr size_t kCapacity = 16;
+
+  std::thread workerHandle_;
+  std::atomic<bool> isExiting_;
+
+  channels::spsc::Sender<PCM_READ_AHEAD_SPSC_OPTIONS> sender_;
+
+  /// @brief Serves requests until the read ahead is destroyed.
+  /// @param receiver The receiver channel for queued requests.
+  void process(channels::spsc::Receiver<PCM_READ_AHEAD_SPSC_OPTIONS> &&receiver);
+};
+
+#undef PCM_READ_AHEAD_SPSC_OPTIONS
+
+} // namespace audioapi
@@ -0,0 +1,156 @@
+#include <audioapi/core/utils/PcmStorage.h>
+
+#include <cstring>
+
+namespace audioapi {
+
+namespace {
+
+// IEEE 754 binary16, the exponent is rebiased by scaling, which also
+// turns half subnormals into float normals.
+inline float halfToFloat(uint16_t half) {
+  uint32_t exponentAndMantissa = static_cast<uint32_t>(half & 0x7FFF) << 13;
+  uint32_t bits;
+
+  if (exponentAndMantissa >= 0x0F800000) {
+    // infinity and NaN keep all exponent bits set
+    bits = exponentAndMantissa | 0x7F800000;
+  } else {
+    float scaled;
+    std::memcpy(&scaled, &exponentAndMantissa, sizeof(scaled));
+    scaled *= 0x1.0p112f;
+    std::memcpy(&bits, &scaled, sizeof(bits));
+  }
+
+  bits |= static_cast<uint32_t>(half & 0x8000) << 16;
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Samples are little-endian and not necessarily aligned to their size.
+inline float loadSample(const uint8_t *sample, PcmSampleFormat format) {
+  switch (format) {
+    case PcmSampleFormat::INT16: {
+      int16_t value;
+      std::memcpy(&value, sample, sizeof(value));
+      return static_cast<float>(value) * (1.0f / 32768.0f);
+    }
+    case PcmSampleFormat::INT24: {
+      auto value = static_cast<int32_t>(
+                       static_cast<uint32_t>(sample[0]) << 8 |
+                       static_cast<uint32_t>(sample[1]) << 16 |
+                       static_cast<uint32_t>(sample[2]) << 24) >>
+          8;
+      return static_cast<float>(value) * (1.0f / 8388608.0f);
+    }
+    case PcmSampleFormat::FLOAT16: {
+      uint16_t value;
+      std::memcpy(&value, sample, sizeof(value));
+      return halfToFloat(value);
+    }
+    case PcmSampleFormat::FLOAT32: {
+      float value;
+      std::memcpy(&value, sample, sizeof(value));
+      return value;
+    }
+  }
+
+  return 0.0f;
+}
+
+template <PcmSampleFormat Format, size_t BytesPerSample>
+void convert(const uint8_t *source, size_t stride, size_t frames, float *destination) {
+  // Planar storage has a stride known at compile time, which lets the
+  // compiler vectorize the conversion.
+  if (stride == BytesPerSample) {
+    for (size_t i = 0; i < frames; i += 1) {
+      destination[i] = loadSample(source + i * BytesPerSample, Format);
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < frames; i += 1) {
+    destination[i] = loadSample(source + i * stride, Format);
+  }
+}
+
+} // namespace
+
+PcmStorage::PcmStorage(
+    const uint8_t *data,
+    PcmSampleFormat format,
+    int numberOfChannels,
+    float sampleRate,
+    size_t length,
+    size_t frameStride,
+    size_t channelStride)
+    : data_(data),
+      format_(format),
+      numberOfChannels_(numberOfChannels),
+      sampleRate_(sampleRate),
+      length_(length),
+      frameStride_(frameStride),
+      channelStride_(channelStride) {}
+
+int PcmStorage::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+size_t PcmStorage::getLength() const {
+  return length_;
+}
+
+float PcmStorage::getSampleRate() const {
+  return sampleRate_;
+}
+
+PcmSampleFormat PcmStorage::getSampleFormat() const {
+  return format_;
+}
+
+void PcmStorage::read(int channel, size_t start, size_t frames, float *destination) const {
+  auto source = data_ + start * frameStride_ + channel * channelStride_;
+
+  // the format is dispatched once, so the conversion loops stay tight
+  switch (format_) {
+    case PcmSampleFormat::INT16:
+      convert<PcmSampleFormat::INT16, 2>(source, frameStride_, frames, destination);
+      break;
+    case PcmSampleFormat::INT24:
+      convert<PcmSampleFormat::INT24, 3>(source, frameStride_, frames, destination);
+      break;
+    case PcmSampleFormat::FLOAT16:
+      convert<PcmSampleFormat::FLOAT16, 2>(source, frameStride_, frames, destination);
+      break;
+    case PcmSampleFormat::FLOAT32:
+      convert<PcmSampleFormat::FLOAT32, 4>(source, frameStride_, frames, destination);
+      break;
+  }
+}
+
+void PcmStorage::gather(int channel, const size_t *indices, size_t count, float *destination)
+    const {
+  auto source = data_ + channel * channelStride_;
+
+  for (size_t i = 0; i < count; i += 1) {
+    destination[i] = loadSample(source + indices[i] * frameStride_, format_);
+  }
+}
+
+size_t PcmStorage::getBytesPerSample(PcmSampleFormat format) {
+  switch (format) {
+    case PcmSampleFormat::INT16:
+      return 2;
+    case PcmSampleFormat::INT24:
+      return 3;
+    case PcmSampleFormat::FLOAT16:
+      return 2;
+    case PcmSampleFormat::FLOAT32:
+      return 4;
+  }
+
+  return 0;
+}
+
+} // namespace audioapi
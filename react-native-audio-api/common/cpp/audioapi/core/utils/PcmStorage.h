@@ -0,0 +1,56 @@
+#pragma once
+
+#include <audioapi/core/types/PcmSampleFormat.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace audioapi {
+
+/// Read-only sample storage kept in its source format instead of 32-bit
+/// float. Samples are converted only for the frames which are actually read,
+/// subclasses own the memory the samples live in.
+class PcmStorage {
+ public:
+  virtual ~PcmStorage() = default;
+
+  [[nodiscard]] int getNumberOfChannels() const;
+  [[nodiscard]] size_t getLength() const;
+  [[nodiscard]] float getSampleRate() const;
+  [[nodiscard]] PcmSampleFormat getSampleFormat() const;
+  /// @return Number of heap bytes holding the samples.
+  [[nodiscard]] virtual size_t getAllocatedSizeInBytes() const = 0;
+
+  /// Converts frames of a single channel starting at start.
+  void read(int channel, size_t start, size_t frames, float *destination) const;
+  /// Converts samples of a single channel at arbitrary frame indices.
+  void gather(int channel, const size_t *indices, size_t count, float *destination) const;
+
+  /// Hints that frames starting at start are going to be read soon.
+  virtual void prefetch(size_t start, size_t frames) const {}
+
+  [[nodiscard]] static size_t getBytesPerSample(PcmSampleFormat format);
+
+ protected:
+  /// @param frameStride Distance in bytes between consecutive frames of a channel.
+  /// @param channelStride Distance in bytes between channels of a frame.
+  PcmStorage(
+      const uint8_t *data,
+      PcmSampleFormat format,
+      int numberOfChannels,
+      float sampleRate,
+      size_t length,
+      size_t frameStride,
+      size_t channelStride);
+
+ private:
+  const uint8_t *data_;
+  PcmSampleFormat format_;
+  int numberOfChannels_;
+  float sampleRate_;
+  size_t length_;
+  size_t frameStride_;
+  size_t channelStride_;
+};
+
+} // namespace audioapi
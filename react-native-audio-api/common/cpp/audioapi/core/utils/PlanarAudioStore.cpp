@@ -0,0 +1,215 @@
+#include <audioapi/core/utils/PlanarAudioStore.h>
+#include <audioapi/dsp/PolyphaseResampler.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+PlanarAudioStore::PlanarAudioStore(
+    int numberOfChannels,
+    float sampleRate,
+    size_t expectedLength,
+    float outputSampleRate)
+    : numberOfChannels_(numberOfChannels),
+      sampleRate_(outputSampleRate > 0 ? outputSampleRate : sampleRate),
+      chunks_(numberOfChannels),
+      destinations_(numberOfChannels) {
+  if (sampleRate_ != sampleRate) {
+    resampler_ = std::make_unique<PolyphaseResampler>(
+        numberOfChannels, sampleRate, sampleRate_, ResamplerQuality::HIGH, RESAMPLER_BLOCK_SIZE);
+    resamplerInputBus_ =
+        std::make_unique<AudioBus>(RESAMPLER_BLOCK_SIZE, numberOfChannels, sampleRate);
+    resamplerOutputBus_ = std::make_unique<AudioBus>(
+        resampler_->getMaxOutputFrames(RESAMPLER_BLOCK_SIZE), numberOfChannels, sampleRate_);
+    resamplerInputs_.resize(numberOfChannels);
+    resamplerOutputs_.resize(numberOfChannels);
+    for (int ch = 0; ch < numberOfChannels; ch += 1) {
+      resamplerOutputs_[ch] = resamplerOutputBus_->getChannel(ch)->getData();
+    }
+
+    expectedLength = static_cast<size_t>(
+        std::ceil(static_cast<double>(expectedLength) * sampleRate_ / sampleRate));
+  }
+
+  if (expectedLength > 0) {
+    bus_ = std::make_shared<AudioBus>(
+        expectedLength + LENGTH_HEADROOM, numberOfChannels, sampleRate_);
+  }
+}
+
+PlanarAudioStore::~PlanarAudioStore() = default;
+
+void PlanarAudioStore::appendInterleaved(const float *data, size_t frames) {
+  if (resampler_ != nullptr) {
+    for (size_t offset = 0; offset < frames; offset += RESAMPLER_BLOCK_SIZE) {
+      auto blockFrames = std::min(RESAMPLER_BLOCK_SIZE, frames - offset);
+      const float *source = data + offset * numberOfChannels_;
+
+      for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+        auto *channelData = resamplerInputBus_->getChannel(ch)->getData();
+        for (size_t i = 0; i < blockFrames; i += 1) {
+          channelData[i] = source[i * numberOfChannels_ + ch];
+        }
+        resamplerInputs_[ch] = channelData;
+      }
+
+      resample(blockFrames);
+    }
+    return;
+  }
+
+  size_t written = 0;
+
+  while (written < frames) {
+    auto framesToWrite = prepareDestinations(frames - written);
+
+    const float *source = data + written * numberOfChannels_;
+    for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+      for (size_t i = 0; i < framesToWrite; i += 1) {
+        destinations_[ch][i] = source[i * numberOfChannels_ + ch];
+      }
+    }
+
+    written += framesToWrite;
+    length_ += framesToWrite;
+  }
+}
+
+void PlanarAudioStore::appendPlanar(const float *const *data, size_t frames) {
+  if (resampler_ != nullptr) {
+    for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+      resamplerInputs_[ch] = data[ch];
+    }
+    resample(frames);
+    return;
+  }
+
+  store(data, frames);
+}
+
+size_t PlanarAudioStore::getLength() const {
+  return length_;
+}
+
+std::shared_ptr<AudioBus> PlanarAudioStore::finish() {
+  if (resampler_ != nullptr) {
+    flushResampler();
+  }
+
+  if (length_ == 0) {
+    bus_ = nullptr;
+    return nullptr;
+  }
+
+  std::vector<std::shared_ptr<AudioArray>> channels(numberOfChannels_);
+  auto expectedLength = getExpectedLength();
+
+  for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+    // Fits in the storage allocated upfront, its unused end is cut off.
+    if (chunks_[ch].empty()) {
+      channels[ch] = bus_->getSharedChannel(ch);
+      channels[ch]->truncate(length_);
+      continue;
+    }
+
+    // Merged one channel at a time, chunks are released as soon as they are copied.
+    channels[ch] = std::make_shared<AudioArray>(length_);
+    auto *destination = channels[ch]->getData();
+
+    if (bus_ != nullptr) {
+      std::memcpy(destination, bus_->getChannel(ch)->getData(), expectedLength * sizeof(float));
+    }
+
+    size_t offset = expectedLength;
+    for (auto &chunk : chunks_[ch]) {
+      auto framesToCopy = std::min(CHUNK_SIZE, length_ - offset);
+      std::memcpy(destination + offset, chunk->getData(), framesToCopy * sizeof(float));
+      offset += framesToCopy;
+      chunk.reset();
+    }
+    chunks_[ch].clear();
+  }
+
+  bus_ = nullptr;
+  length_ = 0;
+  return std::make_shared<AudioBus>(std::move(channels), sampleRate_);
+}
+
+size_t PlanarAudioStore::getExpectedLength() const {
+  return bus_ == nullptr ? 0 : bus_->getSize();
+}
+
+size_t PlanarAudioStore::prepareDestinations(size_t frames) {
+  if (length_ < getExpectedLength()) {
+    for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+      destinations_[ch] = bus_->getChannel(ch)->getData() + length_;
+    }
+    return std::min(frames, getExpectedLength() - length_);
+  }
+
+  auto chunkOffset = (length_ - getExpectedLength()) % CHUNK_SIZE;
+  if (chunkOffset == 0) {
+    for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+      chunks_[ch].push_back(std::make_unique<AudioArray>(CHUNK_SIZE));
+    }
+  }
+
+  for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+    destinations_[ch] = chunks_[ch].back()->getData() + chunkOffset;
+  }
+  return std::min(frames, CHUNK_SIZE - chunkOffset);
+}
+
+void PlanarAudioStore::store(const float *const *data, size_t frames) {
+  size_t written = 0;
+
+  while (written < frames) {
+    auto framesToWrite = prepareDestinations(frames - written);
+
+    for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+      std::memcpy(destinations_[ch], data[ch] + written, framesToWrite * sizeof(float));
+    }
+
+    written += framesToWrite;
+    length_ += framesToWrite;
+  }
+}
+
+void PlanarAudioStore::resample(size_t frames) {
+  while (frames > 0) {
+    auto inputFrames = frames;
+    auto outputFrames = resampler_->process(
+        resamplerInputs_.data(),
+        inputFrames,
+        resamplerOutputs_.data(),
+        resamplerOutputBus_->getSize());
+    store(resamplerOutputs_.data(), outputFrames);
+
+    for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+      resamplerInputs_[ch] += inputFrames;
+    }
+    frames -= inputFrames;
+  }
+}
+
+void PlanarAudioStore::flushResampler() {
+  auto capacity = resamplerOutputBus_->getSize();
+  size_t outputFrames = 0;
+
+  // the output is full while the resampler may hold back more frames
+  do {
+    outputFrames = resampler_->flush(resamplerOutputs_.data(), capacity);
+    store(resamplerOutputs_.data(), outputFrames);
+  } while (outputFrames == capacity);
+
+  resampler_->reset();
+}
+
+} // namespace audioapi
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioArray;
+class AudioBus;
+class PolyphaseResampler;
+
+/// Collects decoded interleaved audio straight into planar channels.
+/// When the length is known upfront the final bus is allocated once and
+/// filled in place, otherwise the audio is kept in fixed-size chunks which
+/// are merged channel by channel, so the peak memory stays close to the
+/// size of the decoded audio.
+/// Audio can be resampled while it is collected, every appended chunk is
+/// converted right away, so the audio is never held at both rates at once.
+class PlanarAudioStore {
+ public:
+  /// @param expectedLength Length in frames reported by the container, 0 when unknown.
+  /// @param outputSampleRate Rate the audio is stored at, 0 keeps sampleRate.
+  PlanarAudioStore(
+      int numberOfChannels,
+      float sampleRate,
+      size_t expectedLength,
+      float outputSampleRate = 0);
+  ~PlanarAudioStore();
+
+  void appendInterleaved(const float *data, size_t frames);
+  void appendPlanar(const float *const *data, size_t frames);
+
+  /// Number of frames stored so far, at the output sample rate.
+  [[nodiscard]] size_t getLength() const;
+
+  /// Moves the collected audio out of the store.
+  /// @return Bus holding all appended frames, nullptr when nothing was appended.
+  std::shared_ptr<AudioBus> finish();
+
+ private:
+  static constexpr size_t CHUNK_SIZE = 65536;
+  // interleaved input is split into planar blocks of this size before being resampled
+  static constexpr size_t RESAMPLER_BLOCK_SIZE = 4096;
+  // Reported lengths of resampled or encoder padded streams are estimates,
+  // a few frames of headroom keep them from spilling into chunks.
+  static constexpr size_t LENGTH_HEADROOM = 4096;
+
+  int numberOfChannels_;
+  float sampleRate_;
+  size_t length_ = 0;
+
+  // storage of the expected length
+  std::shared_ptr<AudioBus> bus_;
+  // frames past the expected length, fixed-size chunks of every channel
+  std::vector<std::vector<std::unique_ptr<AudioArray>>> chunks_;
+  // write position in every channel, reused between appends
+  std::vector<float *> destinations_;
+
+  // set only when the audio is resampled
+  std::unique_ptr<PolyphaseResampler> resampler_;
+  std::unique_ptr<AudioBus> resamplerInputBus_;
+  std::unique_ptr<AudioBus> resamplerOutputBus_;
+  std::vector<const float *> resamplerInputs_;
+  std::vector<float *> resamplerOutputs_;
+
+  [[nodiscard]] size_t getExpectedLength() const;
+  /// Points the destinations at the storage of the next frames.
+  /// @return Number of frames which can be written there, at most frames.
+  size_t prepareDestinations(size_t frames);
+  void store(const float *const *data, size_t frames);
+  /// Converts frames of the input resamplerInputs_ points at.
+  void resample(size_t frames);
+  void flushResampler();
+};
+
+} // namespace audioapi
@@ -0,0 +1,289 @@
+#include <audioapi/core/utils/StreamJitterBuffer.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace audioapi {
+
+StreamJitterBuffer::StreamJitterBuffer(
+    int numberOfChannels,
+    float sampleRate,
+    size_t chunkSize,
+    size_t chunkCount,
+    size_t prebufferFrames)
+    : chunkSize_(chunkSize),
+      prebufferFrames_(std::min(prebufferFrames, chunkSize * chunkCount)),
+      chunkFrames_(chunkCount, 0),
+      chunkStarts_(chunkCount, 0) {
+  chunks_.reserve(chunkCount);
+  for (size_t i = 0; i < chunkCount; i += 1) {
+    chunks_.push_back(std::make_unique<AudioBus>(chunkSize, numberOfChannels, sampleRate));
+  }
+
+  // real capacity of the channel is one less than requested
+  auto [freeSender, freeReceiver] =
+      channels::spsc::channel<size_t, SPSC_OVERFLOW_STRATEGY, SPSC_WAIT_STRATEGY>(chunkCount + 1);
+  freeSender_ = std::move(freeSender);
+  freeReceiver_ = std::move(freeReceiver);
+
+  auto [filledSender, filledReceiver] =
+      channels::spsc::channel<size_t, SPSC_OVERFLOW_STRATEGY, SPSC_WAIT_STRATEGY>(chunkCount + 1);
+  filledSender_ = std::move(filledSender);
+  filledReceiver_ = std::move(filledReceiver);
+
+  for (size_t i = 0; i < chunkCount; i += 1) {
+    freeSender_.try_send(i);
+  }
+}
+
+StreamJitterBuffer::~StreamJitterBuffer() = default;
+
+AudioBus *
+StreamJitterBuffer::reserve(size_t frames, size_t &writeOffset, const std::atomic<bool> &stop) {
+  if (frames > chunkSize_) {
+    return nullptr;
+  }
+
+  if (hasWriteChunk_ && chunkSize_ - writeFrames_ < frames) {
+    publishWriteChunk();
+  }
+
+  if (!hasWriteChunk_ && !acquireWriteChunk(stop)) {
+    return nullptr;
+  }
+
+  writeOffset = writeFrames_;
+  return chunks_[writeChunk_].get();
+}
+
+void StreamJitterBuffer::commit(size_t frames) {
+  writeFrames_ += frames;
+  writePosition_ += frames;
+
+  if (writeFrames_ >= chunkSize_) {
+    publishWriteChunk();
+  }
+}
+
+bool StreamJitterBuffer::write(
+    const float *const *data,
+    size_t frames,
+    const std::atomic<bool> &stop) {
+  size_t written = 0;
+
+  while (written < frames) {
+    if (!hasWriteChunk_ && !acquireWriteChunk(stop)) {
+      return false;
+    }
+
+    auto *chunk = chunks_[writeChunk_].get();
+    auto framesToCopy = std::min(chunkSize_ - writeFrames_, frames - written);
+
+    for (int i = 0; i < chunk->getNumberOfChannels(); i += 1) {
+      std::memcpy(
+          chunk->getChannel(i)->getData() + writeFrames_,
+          data[i] + written,
+          framesToCopy * sizeof(float));
+    }
+
+    written += framesToCopy;
+    commit(framesToCopy);
+  }
+
+  return true;
+}
+
+void StreamJitterBuffer::finish() {
+  if (hasWriteChunk_ && writeFrames_ > 0) {
+    publishWriteChunk();
+  }
+
+  isFinished_.store(true, std::memory_order_release);
+}
+
+void StreamJitterBuffer::seekWrite(size_t position) {
+  if (hasWriteChunk_ && writeFrames_ > 0) {
+    publishWriteChunk();
+  }
+
+  writePosition_ = position;
+  if (hasWriteChunk_) {
+    chunkStarts_[writeChunk_] = position;
+  }
+
+  isFinished_.store(false, std::memory_order_release);
+}
+
+size_t StreamJitterBuffer::read(AudioBus *bus, size_t offset, size_t frames) {
+  if (isPrebuffering_.load(std::memory_order_relaxed)) {
+    if (bufferedFrames_.load(std::memory_order_acquire) < prebufferFrames_ &&
+        !isFinished_.load(std::memory_order_acquire)) {
+      bus->zero(offset, frames);
+      return 0;
+    }
+
+    isPrebuffering_.store(false, std::memory_order_relaxed);
+  }
+
+  size_t framesRead = 0;
+
+  while (framesRead < frames) {
+    if (!hasReadChunk_) {
+      if (filledReceiver_.try_receive(readChunk_) != channels::spsc::ResponseStatus::SUCCESS) {
+        break;
+      }
+
+      hasReadChunk_ = true;
+      readPosition_ = 0;
+    }
+
+    auto framesToCopy = std::min(chunkFrames_[readChunk_] - readPosition_, frames - framesRead);
+    bus->copy(chunks_[readChunk_].get(), readPosition_, offset + framesRead, framesToCopy);
+
+    consumeReadChunk(readPosition_ + framesToCopy);
+    framesRead += framesToCopy;
+
+    if (readPosition_ >= chunkFrames_[readChunk_]) {
+      releaseReadChunk();
+    }
+  }
+
+  if (framesRead < frames) {
+    bus->zero(offset + framesRead, frames - framesRead);
+
+    if (!isFinished_.load(std::memory_order_acquire)) {
+      underrunCount_.fetch_add(1, std::memory_order_relaxed);
+      isPrebuffering_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  return framesRead;
+}
+
+size_t StreamJitterBuffer::readAt(
+    AudioBus *bus,
+    size_t offset,
+    size_t frames,
+    size_t position,
+    bool &isOutOfSync) {
+  isOutOfSync = false;
+  size_t framesRead = 0;
+
+  while (framesRead < frames) {
+    if (!hasReadChunk_) {
+      if (filledReceiver_.try_receive(readChunk_) != channels::spsc::ResponseStatus::SUCCESS) {
+        break;
+      }
+
+      hasReadChunk_ = true;
+      readPosition_ = 0;
+    }
+
+    auto chunkStart = chunkStarts_[readChunk_];
+    auto chunkEnd = chunkStart + chunkFrames_[readChunk_];
+    auto currentPosition = position + framesRead;
+
+    // the chunk was decoded before a seek, it does not hold the position
+    if (currentPosition < chunkStart || currentPosition >= chunkEnd) {
+      releaseReadChunk();
+      isOutOfSync = true;
+      continue;
+    }
+
+    auto readIndex = currentPosition - chunkStart;
+    auto framesToCopy = std::min(chunkEnd - currentPosition, frames - framesRead);
+    bus->copy(chunks_[readChunk_].get(), readIndex, offset + framesRead, framesToCopy);
+
+    consumeReadChunk(readIndex + framesToCopy);
+    framesRead += framesToCopy;
+
+    if (currentPosition + framesToCopy >= chunkEnd) {
+      releaseReadChunk();
+    }
+  }
+
+  if (framesRead < frames) {
+    bus->zero(offset + framesRead, frames - framesRead);
+
+    if (!isOutOfSync && !isFinished_.load(std::memory_order_acquire)) {
+      underrunCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  return framesRead;
+}
+
+size_t StreamJitterBuffer::getChunkSize() const {
+  return chunkSize_;
+}
+
+size_t StreamJitterBuffer::getCapacityFrames() const {
+  return chunkSize_ * chunks_.size();
+}
+
+size_t StreamJitterBuffer::getPrebufferFrames() const {
+  return prebufferFrames_;
+}
+
+size_t StreamJitterBuffer::getBufferedFrames() const {
+  return bufferedFrames_.load(std::memory_order_acquire);
+}
+
+size_t StreamJitterBuffer::getUnderrunCount() const {
+  return underrunCount_.load(std::memory_order_relaxed);
+}
+
+bool StreamJitterBuffer::isPrebuffering() const {
+  return isPrebuffering_.load(std::memory_order_relaxed);
+}
+
+bool StreamJitterBuffer::isFinished() const {
+  return isFinished_.load(std::memory_order_acquire);
+}
+
+bool StreamJitterBuffer::acquireWriteChunk(const std::atomic<bool> &stop) {
+  // The producer is not realtime, poll until the audio thread returns a chunk.
+  while (freeReceiver_.try_receive(writeChunk_) != channels::spsc::ResponseStatus::SUCCESS) {
+    if (stop.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  hasWriteChunk_ = true;
+  writeFrames_ = 0;
+  chunkStarts_[writeChunk_] = writePosition_;
+  return true;
+}
+
+void StreamJitterBuffer::publishWriteChunk() {
+  chunkFrames_[writeChunk_] = writeFrames_;
+  bufferedFrames_.fetch_add(writeFrames_, std::memory_order_acq_rel);
+  filledSender_.try_send(writeChunk_);
+
+  hasWriteChunk_ = false;
+  writeFrames_ = 0;
+}
+
+void StreamJitterBuffer::consumeReadChunk(size_t readPosition) {
+  if (readPosition > readPosition_) {
+    bufferedFrames_.fetch_sub(readPosition - readPosition_, std::memory_order_acq_rel);
+  }
+
+  readPosition_ = readPosition;
+}
+
+void StreamJitterBuffer::releaseReadChunk() {
+  consumeReadChunk(chunkFrames_[readChunk_]);
+  freeSender_.try_send(readChunk_);
+  hasReadChunk_ = false;
+}
+
+} // namespace audioapi
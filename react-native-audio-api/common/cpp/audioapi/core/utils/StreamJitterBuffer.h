@@ -0,0 +1,111 @@
+#pragma once
+
+#include <audioapi/utils/SpscChannel.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// Pool of fixed-size planar chunks passed between a decoding thread and
+/// the audio thread. The producer fills free chunks and publishes them, the
+/// audio thread plays them back and hands them back to the pool, so nothing
+/// is allocated or deep-copied while streaming.
+/// Playback (re)starts only once prebufferFrames are buffered, every time
+/// the audio thread runs dry before the end of the stream an underrun is
+/// counted and the buffer goes back to prebuffering.
+/// Chunks are also tagged with the stream position of their first frame,
+/// which lets seekable sources read by position and drop stale chunks.
+class StreamJitterBuffer {
+ public:
+  StreamJitterBuffer(
+      int numberOfChannels,
+      float sampleRate,
+      size_t chunkSize,
+      size_t chunkCount,
+      size_t prebufferFrames);
+  ~StreamJitterBuffer();
+
+  /// Producer side, makes sure the chunk being filled has room for frames.
+  /// The chunk is published early if it does not, waiting for a free one
+  /// while the pool is exhausted.
+  /// @return Chunk to be written from writeOffset, nullptr when stop was
+  /// requested or frames do not fit in a single chunk.
+  AudioBus *reserve(size_t frames, size_t &writeOffset, const std::atomic<bool> &stop);
+  /// Producer side, marks frames written after reserve as filled.
+  void commit(size_t frames);
+  /// Producer side, copies planar samples spanning any number of chunks.
+  /// @return false when stop was requested before all frames were written.
+  bool write(const float *const *data, size_t frames, const std::atomic<bool> &stop);
+  /// Producer side, publishes the partially filled chunk and marks the end
+  /// of the stream, the remaining frames are played without prebuffering.
+  void finish();
+  /// Producer side, publishes the partially filled chunk, following frames
+  /// are written starting at the given stream position.
+  void seekWrite(size_t position);
+
+  /// Audio thread, copies up to frames buffered frames to bus at offset and
+  /// zeroes the rest of the range.
+  /// @return Number of frames read.
+  size_t read(AudioBus *bus, size_t offset, size_t frames);
+  /// Audio thread, copies frames starting at the given stream position,
+  /// published chunks which do not hold it are dropped. Does not prebuffer.
+  /// @param isOutOfSync Set when a stale chunk was dropped.
+  /// @return Number of consecutive frames read.
+  size_t readAt(AudioBus *bus, size_t offset, size_t frames, size_t position, bool &isOutOfSync);
+
+  [[nodiscard]] size_t getChunkSize() const;
+  [[nodiscard]] size_t getCapacityFrames() const;
+  [[nodiscard]] size_t getPrebufferFrames() const;
+  [[nodiscard]] size_t getBufferedFrames() const;
+  [[nodiscard]] size_t getUnderrunCount() const;
+  [[nodiscard]] bool isPrebuffering() const;
+  [[nodiscard]] bool isFinished() const;
+
+ private:
+  static constexpr auto SPSC_OVERFLOW_STRATEGY = channels::spsc::OverflowStrategy::WAIT_ON_FULL;
+  static constexpr auto SPSC_WAIT_STRATEGY = channels::spsc::WaitStrategy::BUSY_LOOP;
+
+  size_t chunkSize_;
+  size_t prebufferFrames_;
+
+  std::vector<std::unique_ptr<AudioBus>> chunks_;
+  // number of valid frames and stream position of every chunk,
+  // written before it is published
+  std::vector<size_t> chunkFrames_;
+  std::vector<size_t> chunkStarts_;
+
+  // indices of chunks, audio thread -> producer
+  channels::spsc::Sender<size_t, SPSC_OVERFLOW_STRATEGY, SPSC_WAIT_STRATEGY> freeSender_;
+  channels::spsc::Receiver<size_t, SPSC_OVERFLOW_STRATEGY, SPSC_WAIT_STRATEGY> freeReceiver_;
+  // indices of chunks, producer -> audio thread
+  channels::spsc::Sender<size_t, SPSC_OVERFLOW_STRATEGY, SPSC_WAIT_STRATEGY> filledSender_;
+  channels::spsc::Receiver<size_t, SPSC_OVERFLOW_STRATEGY, SPSC_WAIT_STRATEGY> filledReceiver_;
+
+  // producer state
+  size_t writeChunk_ = 0;
+  size_t writeFrames_ = 0;
+  size_t writePosition_ = 0;
+  bool hasWriteChunk_ = false;
+
+  // audio thread state
+  size_t readChunk_ = 0;
+  size_t readPosition_ = 0;
+  bool hasReadChunk_ = false;
+
+  std::atomic<size_t> bufferedFrames_ = 0;
+  std::atomic<size_t> underrunCount_ = 0;
+  std::atomic<bool> isPrebuffering_ = true;
+  std::atomic<bool> isFinished_ = false;
+
+  bool acquireWriteChunk(const std::atomic<bool> &stop);
+  void publishWriteChunk();
+  void consumeReadChunk(size_t readPosition);
+  void releaseReadChunk();
+};
+
+} // namespace audioapi
@@ -0,0 +1,116 @@
+#include <audioapi/core/utils/Locker.h>
+#include <audioapi/core/utils/StretcherPool.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace audioapi {
+
+StretcherPool::Group::Group() : freeStretchers_(kCapacity) {}
+
+SignalsmithStretch *StretcherPool::Group::acquire() {
+  SignalsmithStretch *stretch = nullptr;
+
+  if (!freeStretchers_.try_receive(stretch)) {
+    return nullptr;
+  }
+
+  stretch->reset();
+  stretch->setTransposeSemitones(0);
+  return stretch;
+}
+
+void StretcherPool::Group::release(SignalsmithStretch *stretch) {
+  if (stretch == nullptr) {
+    return;
+  }
+
+  freeStretchers_.try_send(stretch);
+}
+
+StretcherPool::Latency StretcherPool::Group::getLatency() const {
+  return latency_;
+}
+
+StretcherPool::Group *StretcherPool::reserve(
+    int numberOfChannels,
+    float sampleRate,
+    PitchCorrectionQuality quality,
+    size_t count) {
+  Locker locker(mutex_);
+  auto *group = getGroup(numberOfChannels, sampleRate, quality);
+
+  // stretchers are counted per reservation, so idle nodes do not share a spare one
+  group->reservedCount_ += count;
+  while (group->stretchers_.size() < kCapacity &&
+         group->stretchers_.size() < group->reservedCount_) {
+    auto stretch = createStretch(numberOfChannels, sampleRate, quality);
+    group->freeStretchers_.try_send(stretch.get());
+    group->stretchers_.emplace_back(std::move(stretch));
+  }
+
+  return group;
+}
+
+void StretcherPool::unreserve(Group *group, size_t count) {
+  if (group == nullptr) {
+    return;
+  }
+
+  Locker locker(mutex_);
+  group->reservedCount_ -= std::min(count, group->reservedCount_);
+}
+
+StretcherPool::Latency StretcherPool::getLatency(
+    int numberOfChannels,
+    float sampleRate,
+    PitchCorrectionQuality quality) {
+  Locker locker(mutex_);
+  return getGroup(numberOfChannels, sampleRate, quality)->getLatency();
+}
+
+size_t StretcherPool::getCapacity() {
+  return kCapacity;
+}
+
+StretcherPool::Group *StretcherPool::getGroup(
+    int numberOfChannels,
+    float sampleRate,
+    PitchCorrectionQuality quality) {
+  auto &group = groups_[{numberOfChannels, sampleRate, quality}];
+
+  if (group == nullptr) {
+    // the stretcher which tells the latency becomes the first one of the group
+    auto stretch = createStretch(numberOfChannels, sampleRate, quality);
+    group = std::make_unique<Group>();
+    group->latency_ = Latency{stretch->inputLatency(), stretch->outputLatency()};
+    group->freeStretchers_.try_send(stretch.get());
+    group->stretchers_.emplace_back(std::move(stretch));
+  }
+
+  return group.get();
+}
+
+std::unique_ptr<SignalsmithStretch> StretcherPool::createStretch(
+    int numberOfChannels,
+    float sampleRate,
+    PitchCorrectionQuality quality) {
+  auto stretch = std::make_unique<SignalsmithStretch>();
+
+  switch (quality) {
+    case PitchCorrectionQuality::LOW:
+      stretch->presetCheaper(numberOfChannels, sampleRate);
+      break;
+    case PitchCorrectionQuality::HIGH:
+    default:
+      stretch->presetDefault(numberOfChannels, sampleRate);
+      break;
+  }
+
+  // the first reset sizes the stashed buffers, so resetting on acquire does not allocate
+  stretch->reset();
+  return stretch;
+}
+
+} // namespace audioapi
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <audioapi/core/types/PitchCorrectionQuality.h>
+#include <audioapi/libs/signalsmith-stretch/signalsmith-stretch.h>
+#include <audioapi/utils/MpscQueue.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace audioapi {
+
+using SignalsmithStretch = signalsmith::stretch::SignalsmithStretch<float>;
+
+/// Recycles pitch correction stretchers between source nodes of a context.
+/// Configuring a stretcher allocates its STFT buffers, so instances are created
+/// ahead of time per channel count, sample rate and quality and handed out on demand.
+/// Every node reserves the stretcher it may use, so a group holds one per reservation
+/// whether it is in use or not, up to the capacity of a group.
+class StretcherPool {
+ public:
+  struct Latency {
+    int input = 0;
+    int output = 0;
+  };
+
+  /// Stretchers of a single configuration, owned by the pool.
+  class Group {
+   public:
+    Group();
+
+    /// @brief Takes a reset stretcher off the free list.
+    /// @return nullptr when every stretcher of the group is in use.
+    /// @note Lock-free and never allocates.
+    /// @note Should be only used from the audio thread
+    SignalsmithStretch *acquire();
+    /// @brief Puts a stretcher back on the free list, any thread.
+    /// @note Lock-free and never allocates.
+    void release(SignalsmithStretch *stretch);
+
+    [[nodiscard]] Latency getLatency() const;
+
+   private:
+    friend class StretcherPool;
+
+    // every stretcher is either in use or on the free list, which has room for all of them
+    channels::mpsc::Queue<SignalsmithStretch *> freeStretchers_;
+
+    // guarded by the pool mutex
+    std::vector<std::unique_ptr<SignalsmithStretch>> stretchers_;
+    size_t reservedCount_ = 0;
+    Latency latency_;
+  };
+
+  /// @brief Adds count reservations to the group of given configuration and returns it.
+  /// The group holds a stretcher for each of its reservations, up to the capacity of a group.
+  /// @note Allocates, should not be used from the audio thread.
+  Group *reserve(
+      int numberOfChannels,
+      float sampleRate,
+      PitchCorrectionQuality quality,
+      size_t count);
+  /// @brief Gives back reservations of the group, its stretchers are kept for later ones.
+  void unreserve(Group *group, size_t count);
+
+  /// Latency in frames of stretchers with given configuration.
+  Latency getLatency(int numberOfChannels, float sampleRate, PitchCorrectionQuality quality);
+
+  /// @brief Number of stretchers of a single configuration the pool can hold.
+  [[nodiscard]] static size_t getCapacity();
+
+ private:
+  static constexpr size_t kCapacity = 64;
+
+  using Key = std::tuple<int, float, PitchCorrectionQuality>;
+
+  std::mutex mutex_;
+  // groups are never removed, so nodes keep pointers to them
+  std::map<Key, std::unique_ptr<Group>> groups_;
+
+  Group *getGroup(int numberOfChannels, float sampleRate, PitchCorrectionQuality quality);
+
+  static std::unique_ptr<SignalsmithStretch>
+  createStretch(int numberOfChannels, float sampleRate, PitchCorrectionQuality quality);
+};
+
+} // namespace audioapi
@@ -0,0 +1,169 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/Interpolation.h>
+#include <audioapi/dsp/VectorMath.h>
+
+#include <cmath>
+#include <vector>
+
+namespace audioapi::dsp {
+
+// windowed-sinc kernel, SINC_TAPS frames centered around the read position
+// and SINC_PHASES + 1 precomputed fractional offsets.
+static constexpr int SINC_TAPS = 16;
+static constexpr int SINC_TAPS_BEFORE = SINC_TAPS / 2 - 1;
+static constexpr int SINC_PHASES = 256;
+// cutoff relative to the nyquist frequency, leaves room for the transition band.
+static constexpr double SINC_CUTOFF = 0.9;
+
+static const std::vector<float> &getSincTable() {
+  static const std::vector<float> table = [] {
+    std::vector<float> coefficients((SINC_PHASES + 1) * SINC_TAPS);
+    auto halfWidth = static_cast<double>(SINC_TAPS) / 2;
+
+    for (int phase = 0; phase <= SINC_PHASES; phase++) {
+      auto fraction = static_cast<double>(phase) / SINC_PHASES;
+      auto *row = coefficients.data() + phase * SINC_TAPS;
+      double sum = 0;
+
+      for (int k = 0; k < SINC_TAPS; k++) {
+        // distance between the tap and the read position.
+        auto x = static_cast<double>(k - SINC_TAPS_BEFORE) - fraction;
+        auto argument = PI * SINC_CUTOFF * x;
+        auto sinc = std::abs(argument) < 1e-9 ? 1.0 : std::sin(argument) / argument;
+
+        // https://en.wikipedia.org/wiki/Window_function#Blackman_window
+        auto n = x / halfWidth;
+        auto window = std::abs(n) >= 1.0
+            ? 0.0
+            : 0.42 + 0.5 * std::cos(PI * n) + 0.08 * std::cos(2.0 * PI * n);
+
+        row[k] = static_cast<float>(sinc * window);
+        sum += row[k];
+      }
+
+      // unity gain at DC for every phase.
+      for (int k = 0; k < SINC_TAPS; k++) {
+        row[k] = static_cast<float>(row[k] / sum);
+      }
+    }
+
+    return coefficients;
+  }();
+
+  return table;
+}
+
+int getInterpolationTapsBefore(InterpolationType type) {
+  switch (type) {
+    case InterpolationType::CUBIC:
+      return 1;
+    case InterpolationType::SINC:
+      return SINC_TAPS_BEFORE;
+    case InterpolationType::LINEAR:
+    default:
+      return 0;
+  }
+}
+
+int getInterpolationTapsAfter(InterpolationType type) {
+  switch (type) {
+    case InterpolationType::CUBIC:
+      return 2;
+    case InterpolationType::SINC:
+      return SINC_TAPS - SINC_TAPS_BEFORE - 1;
+    case InterpolationType::LINEAR:
+    default:
+      return 1;
+  }
+}
+
+void prepareInterpolation(InterpolationType type) {
+  if (type == InterpolationType::SINC) {
+    getSincTable();
+  }
+}
+
+static void interpolateLinear(
+    const float *source,
+    const size_t *indices,
+    const float *fractions,
+    float *outputVector,
+    size_t framesToProcess) {
+  for (size_t i = 0; i < framesToProcess; i++) {
+    auto x0 = source[indices[i]];
+    auto x1 = source[indices[i] + 1];
+    outputVector[i] = x0 + fractions[i] * (x1 - x0);
+  }
+}
+
+// https://en.wikipedia.org/wiki/Cubic_Hermite_spline#Catmull%E2%80%93Rom_spline
+static void interpolateCubic(
+    const float *source,
+    const size_t *indices,
+    const float *fractions,
+    float *outputVector,
+    size_t framesToProcess) {
+  for (size_t i = 0; i < framesToProcess; i++) {
+    const float *x = source + indices[i];
+    auto t = fractions[i];
+
+    auto c1 = 0.5f * (x[1] - x[-1]);
+    auto c2 = x[-1] - 2.5f * x[0] + 2.0f * x[1] - 0.5f * x[2];
+    auto c3 = 0.5f * (x[2] - x[-1]) + 1.5f * (x[0] - x[1]);
+
+    outputVector[i] = ((c3 * t + c2) * t + c1) * t + x[0];
+  }
+}
+
+static void interpolateSinc(
+    const float *source,
+    const size_t *indices,
+    const float *fractions,
+    float *outputVector,
+    size_t framesToProcess) {
+  const float *table = getSincTable().data();
+
+  for (size_t i = 0; i < framesToProcess; i++) {
+    const float *x = source + indices[i] - SINC_TAPS_BEFORE;
+
+    auto position = fractions[i] * SINC_PHASES;
+    auto phase = static_cast<int>(position);
+    auto factor = position - static_cast<float>(phase);
+
+    // a fraction just below 1 can round up to 1.0f, which selects the last row as the lower one
+    if (phase >= SINC_PHASES) {
+      phase = SINC_PHASES - 1;
+      factor = 1.0f;
+    }
+
+    // the filter is linear in its coefficients, so interpolating between
+    // two adjacent phases is the same as interpolating their outputs.
+    auto lower = dotProduct(table + phase * SINC_TAPS, x, SINC_TAPS);
+    auto higher = dotProduct(table + (phase + 1) * SINC_TAPS, x, SINC_TAPS);
+
+    outputVector[i] = lower + factor * (higher - lower);
+  }
+}
+
+void interpolate(
+    InterpolationType type,
+    const float *source,
+    const size_t *indices,
+    const float *fractions,
+    float *outputVector,
+    size_t framesToProcess) {
+  switch (type) {
+    case InterpolationType::CUBIC:
+      interpolateCubic(source, indices, fractions, outputVector, framesToProcess);
+      break;
+    case InterpolationType::SINC:
+      interpolateSinc(source, indices, fractions, outputVector, framesToProcess);
+      break;
+    case InterpolationType::LINEAR:
+    default:
+      interpolateLinear(source, indices, fractions, outputVector, framesToProcess);
+      break;
+  }
+}
+
+} // namespace audioapi::dsp
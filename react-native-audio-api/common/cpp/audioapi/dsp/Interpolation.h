@@ -0,0 +1,34 @@
+#pragma once
+
+#include <audioapi/core/types/InterpolationType.h>
+
+#include <cstddef>
+
+namespace audioapi::dsp {
+
+// Number of source frames the kernel reads before the read index.
+int getInterpolationTapsBefore(InterpolationType type);
+// Number of source frames the kernel reads after the read index.
+int getInterpolationTapsAfter(InterpolationType type);
+
+// Builds lookup tables used by the given kernel, so the first call from
+// the audio thread does not allocate. Safe to call multiple times.
+void prepareInterpolation(InterpolationType type);
+
+// Computes outputVector[i] as the source signal evaluated at
+// indices[i] + fractions[i] for framesToProcess positions.
+// Positions are computed once per block by the caller and shared across
+// channels. Every tap read by the kernel has to be a valid index of source.
+// The sinc kernel has a fixed cutoff just below the source nyquist frequency,
+// it is not narrowed for positions advancing faster than one frame per output
+// frame, so content above the output nyquist frequency aliases when playing
+// faster than the original rate.
+void interpolate(
+    InterpolationType type,
+    const float *source,
+    const size_t *indices,
+    const float *fractions,
+    float *outputVector,
+    size_t framesToProcess);
+
+} // namespace audioapi::dsp
@@ -0,0 +1,88 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/PolyBlep.h>
+
+#include <cmath>
+
+namespace audioapi::dsp {
+
+static inline float wrapPhase(float phase) {
+  return phase - std::floor(phase);
+}
+
+float polyBlep(float phase, float phaseIncrement) {
+  auto dt = std::fabs(phaseIncrement);
+
+  if (phase < dt) {
+    auto x = phase / dt;
+    return x + x - x * x - 1.0f;
+  }
+
+  if (phase > 1.0f - dt) {
+    auto x = (phase - 1.0f) / dt;
+    return x * x + x + x + 1.0f;
+  }
+
+  return 0.0f;
+}
+
+float polyBlamp(float phase, float phaseIncrement) {
+  auto dt = std::fabs(phaseIncrement);
+
+  if (phase < dt) {
+    auto x = phase / dt - 1.0f;
+    return -x * x * x / 3.0f;
+  }
+
+  if (phase > 1.0f - dt) {
+    auto x = (phase - 1.0f) / dt + 1.0f;
+    return x * x * x / 3.0f;
+  }
+
+  return 0.0f;
+}
+
+float polyBlepSample(OscillatorType type, float phase, float phaseIncrement) {
+  auto dt = std::fabs(phaseIncrement);
+
+  switch (type) {
+    case OscillatorType::SQUARE: {
+      // +1 in the first half of the period, -1 in the second one.
+      auto sample = phase < 0.5f ? 1.0f : -1.0f;
+      return sample + polyBlep(phase, dt) - polyBlep(wrapPhase(phase + 0.5f), dt);
+    }
+    case OscillatorType::SAWTOOTH: {
+      // Starts at 0 rising, the falling edge is in the middle of the period.
+      auto shiftedPhase = wrapPhase(phase + 0.5f);
+      return 2.0f * shiftedPhase - 1.0f - polyBlep(shiftedPhase, dt);
+    }
+    case OscillatorType::TRIANGLE: {
+      // Starts at 0 rising, peaks at 1/4 and reaches the minimum at 3/4 of the
+      // period. Slope changes by 8 at both corners.
+      auto shiftedPhase = wrapPhase(phase + 0.25f);
+      auto sample = 1.0f - 4.0f * std::fabs(shiftedPhase - 0.5f);
+      return sample +
+          4.0f * dt * (polyBlamp(shiftedPhase, dt) - polyBlamp(wrapPhase(shiftedPhase + 0.5f), dt));
+    }
+    case OscillatorType::SINE:
+    default:
+      return std::sin(2.0f * PI * phase);
+  }
+}
+
+void processPolyBlep(
+    OscillatorType type,
+    float *outputVector,
+    size_t framesToProcess,
+    float phaseIncrement,
+    float &phase) {
+  for (size_t i = 0; i < framesToProcess; i += 1) {
+    outputVector[i] = polyBlepSample(type, phase, phaseIncrement);
+
+    phase += phaseIncrement;
+    if (phase >= 1.0f || phase < 0.0f) {
+      phase = wrapPhase(phase);
+    }
+  }
+}
+
+} // namespace audioapi::dsp
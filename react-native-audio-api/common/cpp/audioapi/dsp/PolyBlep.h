@@ -0,0 +1,32 @@
+#pragma once
+
+#include <audioapi/core/types/OscillatorType.h>
+
+#include <cstddef>
+
+namespace audioapi::dsp {
+
+// Analytic band-limited oscillator based on polynomial band-limited step
+// (polyBLEP) and ramp (polyBLAMP) residuals. Waveforms match the shapes of
+// the PeriodicWave basic waveforms, no wave tables are needed.
+// Phase is normalized to [0, 1) and phaseIncrement is frequency / sampleRate.
+
+// Residual that smooths a step discontinuity of height 2 located at phase 0.
+float polyBlep(float phase, float phaseIncrement);
+
+// Residual that smooths a slope discontinuity located at phase 0.
+float polyBlamp(float phase, float phaseIncrement);
+
+// Returns a single sample of the band-limited waveform.
+float polyBlepSample(OscillatorType type, float phase, float phaseIncrement);
+
+// Renders framesToProcess samples with constant phase increment,
+// phase is advanced in place.
+void processPolyBlep(
+    OscillatorType type,
+    float *outputVector,
+    size_t framesToProcess,
+    float phaseIncrement,
+    float &phase);
+
+} // namespace audioapi::dsp
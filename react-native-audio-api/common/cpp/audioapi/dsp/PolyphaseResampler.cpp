@@ -0,0 +1,360 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/PolyphaseResampler.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/dsp/Windows.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace audioapi {
+
+namespace {
+
+struct QualityPreset {
+  // half of the filter length at the input rate, scaled up when downsampling
+  size_t halfTaps;
+  // passband edge relative to the lower nyquist frequency
+  float rolloff;
+  float kaiserBeta;
+  size_t interpolatedPhases;
+};
+
+// roughly 60, 80 and 100 dB of stopband attenuation
+QualityPreset getQualityPreset(ResamplerQuality quality) {
+  switch (quality) {
+    case ResamplerQuality::LOW:
+      return {8, 0.85f, 6.0f, 64};
+    case ResamplerQuality::HIGH:
+      return {32, 0.94f, 10.0f, 256};
+    case ResamplerQuality::MEDIUM:
+    default:
+      return {16, 0.9f, 8.0f, 128};
+  }
+}
+
+constexpr size_t MAX_HALF_TAPS = 256;
+
+} // namespace
+
+/// Phase p of the bank interpolates the input at p / phases of a sample
+/// past the center of the filter window. It holds phases + 1 rows, so that
+/// interpolated banks can blend the last phase with the next sample.
+struct PolyphaseResampler::FilterBank {
+  size_t phases;
+  size_t taps;
+  std::vector<float> coefficients;
+
+  [[nodiscard]] const float *getPhase(size_t phase) const {
+    return coefficients.data() + phase * taps;
+  }
+};
+
+PolyphaseResampler::PolyphaseResampler(
+    int numberOfChannels,
+    float inputSampleRate,
+    float outputSampleRate,
+    ResamplerQuality quality,
+    size_t maxInputFrames,
+    bool isVariableRatio)
+    : numberOfChannels_(numberOfChannels),
+      inputSampleRate_(inputSampleRate),
+      outputSampleRate_(outputSampleRate),
+      maxInputFrames_(maxInputFrames),
+      isExact_(false),
+      exactStep_(0),
+      baseStep_(static_cast<double>(inputSampleRate) / outputSampleRate),
+      step_(baseStep_),
+      bufferedFrames_(0),
+      readIndex_(0),
+      phase_(0),
+      fraction_(0.0),
+      totalInputFrames_(0),
+      totalOutputFrames_(0) {
+  auto preset = getQualityPreset(quality);
+  auto cutoff = preset.rolloff * std::min(1.0f, outputSampleRate / inputSampleRate);
+  auto phases = preset.interpolatedPhases;
+
+  if (!isVariableRatio && std::floor(inputSampleRate) == inputSampleRate &&
+      std::floor(outputSampleRate) == outputSampleRate) {
+    auto inputRate = static_cast<size_t>(inputSampleRate);
+    auto outputRate = static_cast<size_t>(outputSampleRate);
+    auto divisor = std::gcd(inputRate, outputRate);
+
+    if (outputRate / divisor <= MAX_EXACT_PHASES) {
+      isExact_ = true;
+      phases = outputRate / divisor;
+      exactStep_ = inputRate / divisor;
+    }
+  }
+
+  bank_ = getFilterBank(phases, cutoff, quality);
+  kernel_.resize(bank_->taps);
+  inputBus_ =
+      std::make_unique<AudioBus>(maxInputFrames_ + bank_->taps, numberOfChannels, inputSampleRate);
+  reset();
+}
+
+PolyphaseResampler::~PolyphaseResampler() = default;
+
+size_t PolyphaseResampler::process(
+    const float *const *input,
+    size_t &inputFrames,
+    float *const *output,
+    size_t outputCapacity) {
+  size_t framesConsumed = 0;
+  size_t framesWritten = 0;
+
+  while (true) {
+    framesWritten += render(output, framesWritten, outputCapacity);
+    if (framesConsumed == inputFrames || framesWritten == outputCapacity) {
+      break;
+    }
+
+    auto framesAppended = append(input, framesConsumed, inputFrames - framesConsumed);
+    if (framesAppended == 0) {
+      break;
+    }
+
+    framesConsumed += framesAppended;
+    totalInputFrames_ += framesAppended;
+  }
+
+  inputFrames = framesConsumed;
+  return framesWritten;
+}
+
+size_t PolyphaseResampler::flush(float *const *output, size_t outputCapacity) {
+  auto expectedOutputFrames = getExpectedOutputFrames(totalInputFrames_);
+  size_t framesWritten = 0;
+
+  while (true) {
+    auto outputEnd =
+        std::min(outputCapacity, framesWritten + expectedOutputFrames - totalOutputFrames_);
+    framesWritten += render(output, framesWritten, outputEnd);
+    if (totalOutputFrames_ >= expectedOutputFrames || framesWritten == outputCapacity) {
+      break;
+    }
+
+    // trailing silence moves the filter window past the last input sample,
+    // it does not count as input
+    if (append(nullptr, 0, bank_->taps) == 0) {
+      break;
+    }
+  }
+
+  return framesWritten;
+}
+
+void PolyphaseResampler::reset() {
+  inputBus_->zero();
+  // the window starts centered on the first input sample
+  bufferedFrames_ = bank_->taps / 2 - 1;
+  readIndex_ = 0;
+  phase_ = 0;
+  fraction_ = 0.0;
+  totalInputFrames_ = 0;
+  totalOutputFrames_ = 0;
+}
+
+void PolyphaseResampler::setRatioAdjustment(double adjustment) {
+  step_ = baseStep_ * adjustment;
+}
+
+size_t PolyphaseResampler::getMaxOutputFrames(size_t inputFrames) const {
+  return static_cast<size_t>(std::ceil(static_cast<double>(inputFrames + bank_->taps) / step_)) +
+      1;
+}
+
+int PolyphaseResampler::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+float PolyphaseResampler::getInputSampleRate() const {
+  return inputSampleRate_;
+}
+
+float PolyphaseResampler::getOutputSampleRate() const {
+  return outputSampleRate_;
+}
+
+std::shared_ptr<AudioBus> PolyphaseResampler::resample(
+    const AudioBus &audioBus,
+    float outputSampleRate,
+    ResamplerQuality quality) {
+  if (audioBus.getSize() == 0 || audioBus.getSampleRate() <= 0 || outputSampleRate <= 0) {
+    return nullptr;
+  }
+
+  auto numberOfChannels = audioBus.getNumberOfChannels();
+  PolyphaseResampler resampler(
+      numberOfChannels, audioBus.getSampleRate(), outputSampleRate, quality);
+
+  std::vector<const float *> input(numberOfChannels);
+  for (int ch = 0; ch < numberOfChannels; ch += 1) {
+    input[ch] = audioBus.getChannel(ch)->getData();
+  }
+
+  auto inputFrames = audioBus.getSize();
+  auto length = resampler.getExpectedOutputFrames(inputFrames);
+
+  auto resampledBus = std::make_shared<AudioBus>(length, numberOfChannels, outputSampleRate);
+  std::vector<float *> output(numberOfChannels);
+  for (int ch = 0; ch < numberOfChannels; ch += 1) {
+    output[ch] = resampledBus->getChannel(ch)->getData();
+  }
+
+  auto framesWritten = resampler.process(input.data(), inputFrames, output.data(), length);
+  for (int ch = 0; ch < numberOfChannels; ch += 1) {
+    output[ch] += framesWritten;
+  }
+  resampler.flush(output.data(), length - framesWritten);
+
+  return resampledBus;
+}
+
+size_t PolyphaseResampler::append(const float *const *input, size_t inputOffset, size_t frames) {
+  // [ UNUSED | WINDOW ] -> [ WINDOW | EMPTY ]
+  auto framesToKeep = bufferedFrames_ - readIndex_;
+  if (readIndex_ > 0) {
+    for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+      auto *channelData = inputBus_->getChannel(ch)->getData();
+      std::memmove(channelData, channelData + readIndex_, framesToKeep * sizeof(float));
+    }
+    bufferedFrames_ = framesToKeep;
+    readIndex_ = 0;
+  }
+
+  auto framesToCopy = std::min(inputBus_->getSize() - bufferedFrames_, frames);
+  for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+    auto *channelData = inputBus_->getChannel(ch)->getData() + bufferedFrames_;
+    if (input == nullptr) {
+      std::memset(channelData, 0, framesToCopy * sizeof(float));
+    } else {
+      std::memcpy(channelData, input[ch] + inputOffset, framesToCopy * sizeof(float));
+    }
+  }
+
+  bufferedFrames_ += framesToCopy;
+  return framesToCopy;
+}
+
+size_t PolyphaseResampler::render(float *const *output, size_t outputOffset, size_t outputEnd) {
+  auto taps = bank_->taps;
+  auto outputIndex = outputOffset;
+
+  while (outputIndex < outputEnd && readIndex_ + taps <= bufferedFrames_) {
+    renderFrame(output, outputIndex);
+    advance();
+    outputIndex += 1;
+  }
+
+  totalOutputFrames_ += outputIndex - outputOffset;
+  return outputIndex - outputOffset;
+}
+
+void PolyphaseResampler::renderFrame(float *const *output, size_t outputIndex) {
+  auto taps = bank_->taps;
+  const float *kernel = nullptr;
+
+  if (isExact_) {
+    kernel = bank_->getPhase(phase_);
+  } else {
+    auto position = fraction_ * static_cast<double>(bank_->phases);
+    auto phase = static_cast<size_t>(position);
+    auto weight = static_cast<float>(position - static_cast<double>(phase));
+
+    kernel = kernel_.data();
+    dsp::multiplyByScalar(bank_->getPhase(phase), 1.0f - weight, kernel_.data(), taps);
+    dsp::multiplyByScalarThenAddToOutput(bank_->getPhase(phase + 1), weight, kernel_.data(), taps);
+  }
+
+  for (int ch = 0; ch < numberOfChannels_; ch += 1) {
+    output[ch][outputIndex] =
+        dsp::dotProduct(inputBus_->getChannel(ch)->getData() + readIndex_, kernel, taps);
+  }
+}
+
+void PolyphaseResampler::advance() {
+  if (isExact_) {
+    phase_ += exactStep_;
+    readIndex_ += phase_ / bank_->phases;
+    phase_ %= bank_->phases;
+    return;
+  }
+
+  fraction_ += step_;
+  auto wholeFrames = std::floor(fraction_);
+  readIndex_ += static_cast<size_t>(wholeFrames);
+  fraction_ -= wholeFrames;
+}
+
+size_t PolyphaseResampler::getExpectedOutputFrames(size_t inputFrames) const {
+  if (isExact_) {
+    return (inputFrames * bank_->phases + exactStep_ - 1) / exactStep_;
+  }
+
+  return static_cast<size_t>(std::ceil(static_cast<double>(inputFrames) / step_));
+}
+
+std::shared_ptr<const PolyphaseResampler::FilterBank>
+PolyphaseResampler::getFilterBank(size_t phases, float cutoff, ResamplerQuality quality) {
+  // a handful of rate pairs is used in practice, so banks are never evicted
+  static std::mutex mutex;
+  static std::map<std::tuple<size_t, float, ResamplerQuality>, std::shared_ptr<const FilterBank>>
+      banks;
+
+  std::lock_guard lock(mutex);
+  auto key = std::make_tuple(phases, cutoff, quality);
+  if (auto it = banks.find(key); it != banks.end()) {
+    return it->second;
+  }
+
+  auto preset = getQualityPreset(quality);
+  // lower cutoff needs a proportionally longer filter for the same transition band
+  auto halfTaps = std::min(
+      static_cast<size_t>(std::ceil(static_cast<float>(preset.halfTaps) * preset.rolloff / cutoff)),
+      MAX_HALF_TAPS);
+  // keeps the length a multiple of the SIMD width
+  halfTaps = (halfTaps + 1) / 2 * 2;
+
+  auto bank = std::make_shared<FilterBank>();
+  bank->phases = phases;
+  bank->taps = 2 * halfTaps;
+  bank->coefficients.resize((phases + 1) * bank->taps);
+
+  auto window = dsp::Kaiser(preset.kaiserBeta);
+  for (size_t phase = 0; phase <= phases; phase += 1) {
+    auto *coefficients = bank->coefficients.data() + phase * bank->taps;
+    auto fraction = static_cast<double>(phase) / static_cast<double>(phases);
+    double sum = 0.0;
+
+    for (size_t tap = 0; tap < bank->taps; tap += 1) {
+      // distance from the interpolated position, in input samples
+      auto x = static_cast<double>(tap) - static_cast<double>(halfTaps - 1) - fraction;
+      auto arg = PI * cutoff * x;
+      auto sinc = std::abs(arg) < 1e-9 ? 1.0 : std::sin(arg) / arg;
+      auto value =
+          sinc * window.getValue(static_cast<float>(x / static_cast<double>(halfTaps)));
+
+      coefficients[tap] = static_cast<float>(value);
+      sum += value;
+    }
+
+    // unity gain at DC for every phase
+    dsp::multiplyByScalar(coefficients, static_cast<float>(1.0 / sum), coefficients, bank->taps);
+  }
+
+  banks.emplace(key, bank);
+  return bank;
+}
+
+} // namespace audioapi
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <audioapi/core/types/ResamplerQuality.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// Streaming sample rate converter for arbitrary ratios.
+/// Every output sample is a windowed sinc interpolation of the input,
+/// evaluated with one phase of a polyphase filter bank:
+///  - integer rate pairs with a small reduced ratio (44.1 <-> 48 kHz,
+///    16 -> 48 kHz, ...) use a bank holding every phase, so the
+///    conversion is exact,
+///  - other ratios interpolate linearly between two adjacent phases of
+///    a densely sampled bank.
+/// Banks depend only on the rates and the quality, they are computed once
+/// and shared by all resamplers. Processing does not allocate.
+class PolyphaseResampler {
+ public:
+  /// @param maxInputFrames Number of input frames buffered at once, larger
+  /// inputs are consumed in several steps.
+  /// @param isVariableRatio Always uses an interpolated bank, so that the
+  /// ratio can be fine-tuned with setRatioAdjustment.
+  PolyphaseResampler(
+      int numberOfChannels,
+      float inputSampleRate,
+      float outputSampleRate,
+      ResamplerQuality quality = ResamplerQuality::MEDIUM,
+      size_t maxInputFrames = DEFAULT_MAX_INPUT_FRAMES,
+      bool isVariableRatio = false);
+  ~PolyphaseResampler();
+
+  /// Converts planar input, stops early when output is full.
+  /// @param inputFrames Number of input frames, set to the number of
+  /// frames consumed.
+  /// @return Number of output frames written.
+  size_t process(
+      const float *const *input,
+      size_t &inputFrames,
+      float *const *output,
+      size_t outputCapacity);
+  /// Writes the output still held back by the filter latency, the total
+  /// output length matches the total input length converted to the output
+  /// rate. Can be called repeatedly while it fills the whole output, the
+  /// resampler has to be reset before it is given new input.
+  /// @return Number of output frames written.
+  size_t flush(float *const *output, size_t outputCapacity);
+  void reset();
+  /// Scales the number of input frames consumed per output frame, values
+  /// above 1 drain the input faster. Ignored by exact banks.
+  void setRatioAdjustment(double adjustment);
+
+  /// Upper bound of output frames produced for inputFrames input frames.
+  [[nodiscard]] size_t getMaxOutputFrames(size_t inputFrames) const;
+  [[nodiscard]] int getNumberOfChannels() const;
+  [[nodiscard]] float getInputSampleRate() const;
+  [[nodiscard]] float getOutputSampleRate() const;
+
+  /// Converts a whole bus in one go.
+  /// @return nullptr if the bus is empty or the sample rate is not positive.
+  static std::shared_ptr<AudioBus> resample(
+      const AudioBus &audioBus,
+      float outputSampleRate,
+      ResamplerQuality quality = ResamplerQuality::HIGH);
+
+ private:
+  struct FilterBank;
+
+  static constexpr size_t DEFAULT_MAX_INPUT_FRAMES = 4096;
+  static constexpr int MAX_EXACT_PHASES = 512;
+
+  int numberOfChannels_;
+  float inputSampleRate_;
+  float outputSampleRate_;
+  size_t maxInputFrames_;
+
+  std::shared_ptr<const FilterBank> bank_;
+  // phases blended by interpolated banks
+  std::vector<float> kernel_;
+  // reduced ratio of exact banks, output time advances by step / phases
+  // input samples
+  bool isExact_;
+  size_t exactStep_;
+  // input samples per output sample for interpolated banks
+  double baseStep_;
+  double step_;
+
+  // [ HISTORY | NEW DATA ] of every channel
+  std::unique_ptr<AudioBus> inputBus_;
+  size_t bufferedFrames_;
+  // first input sample of the current filter window and the fractional
+  // position of the output sample within it
+  size_t readIndex_;
+  size_t phase_;
+  double fraction_;
+
+  size_t totalInputFrames_;
+  size_t totalOutputFrames_;
+
+  /// Appends up to frames input frames, zeros when input is nullptr.
+  /// @return Number of frames appended.
+  size_t append(const float *const *input, size_t inputOffset, size_t frames);
+  /// Renders every output frame whose window is buffered, up to outputEnd.
+  /// @return Number of frames rendered.
+  size_t render(float *const *output, size_t outputOffset, size_t outputEnd);
+  void renderFrame(float *const *output, size_t outputIndex);
+  void advance();
+  [[nodiscard]] size_t getExpectedOutputFrames(size_t inputFrames) const;
+
+  static std::shared_ptr<const FilterBank>
+  getFilterBank(size_t phases, float cutoff, ResamplerQuality quality);
+};
+
+} // namespace audioapi
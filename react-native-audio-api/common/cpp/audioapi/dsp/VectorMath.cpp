@@ -89,6 +89,20 @@ float maximumMagnitude(const float *inputVector, size_t numberOfElementsToProces
   return maximumValue;
 }
 
+float dotProduct(
+    const float *inputVector1,
+    const float *inputVector2,
+    size_t numberOfElementsToProcess) {
+  float result = 0;
+  vDSP_dotpr(inputVector1, 1, inputVector2, 1, &result, numberOfElementsToProcess);
+  return result;
+}
+
+void reverse(const float *inputVector, float *outputVector, size_t numberOfElementsToProcess) {
+  std::copy(inputVector, inputVector + numberOfElementsToProcess, outputVector);
+  vDSP_vrvrs(outputVector, 1, numberOfElementsToProcess);
+}
+
 void multiplyByScalarThenAddToOutput(
     const float *inputVector,
     float scalar,
@@ -97,6 +111,23 @@ void multiplyByScalarThenAddToOutput(
   vDSP_vsma(inputVector, 1, &scalar, outputVector, 1, outputVector, 1, numberOfElementsToProcess);
 }
 
+void multiplyThenAddToOutput(
+    const float *inputVector1,
+    const float *inputVector2,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+  vDSP_vma(
+      inputVector1,
+      1,
+      inputVector2,
+      1,
+      outputVector,
+      1,
+      outputVector,
+      1,
+      numberOfElementsToProcess);
+}
+
 #else
 
 #if defined(HAVE_X86_SSE2)
@@ -585,6 +616,94 @@ float maximumMagnitude(const float *inputVector, size_t numberOfElementsToProces
   return max;
 }
 
+float dotProduct(
+    const float *inputVector1,
+    const float *inputVector2,
+    size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+  float sum = 0;
+
+#if defined(HAVE_X86_SSE2)
+  size_t tailFrames = n % 4;
+  const float *endP = inputVector1 + n - tailFrames;
+  __m128 mSum = _mm_setzero_ps();
+
+  while (inputVector1 < endP) {
+    __m128 source1 = _mm_loadu_ps(inputVector1);
+    __m128 source2 = _mm_loadu_ps(inputVector2);
+    mSum = _mm_add_ps(mSum, _mm_mul_ps(source1, source2));
+
+    inputVector1 += 4;
+    inputVector2 += 4;
+  }
+
+  // Sum the SSE results.
+  const float *groupSumP = reinterpret_cast<float *>(&mSum);
+  sum = groupSumP[0] + groupSumP[1] + groupSumP[2] + groupSumP[3];
+
+  n = tailFrames;
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  size_t tailFrames = n % 4;
+  const float *endP = inputVector1 + n - tailFrames;
+  float32x4_t fourSum = vdupq_n_f32(0);
+
+  while (inputVector1 < endP) {
+    float32x4_t source1 = vld1q_f32(inputVector1);
+    float32x4_t source2 = vld1q_f32(inputVector2);
+    fourSum = vmlaq_f32(fourSum, source1, source2);
+
+    inputVector1 += 4;
+    inputVector2 += 4;
+  }
+  float32x2_t twoSum = vadd_f32(vget_low_f32(fourSum), vget_high_f32(fourSum));
+  sum = vget_lane_f32(vpadd_f32(twoSum, twoSum), 0);
+
+  n = tailFrames;
+#endif
+  while (n--) {
+    sum += *inputVector1 * *inputVector2;
+    ++inputVector1;
+    ++inputVector2;
+  }
+
+  return sum;
+}
+
+void reverse(const float *inputVector, float *outputVector, size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+  const float *sourceP = inputVector + n;
+
+#if defined(HAVE_X86_SSE2)
+  size_t tailFrames = n % 4;
+  const float *endP = outputVector + n - tailFrames;
+
+  while (outputVector < endP) {
+    sourceP -= 4;
+    __m128 source = _mm_loadu_ps(sourceP);
+    _mm_storeu_ps(outputVector, _mm_shuffle_ps(source, source, _MM_SHUFFLE(0, 1, 2, 3)));
+    outputVector += 4;
+  }
+  n = tailFrames;
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  size_t tailFrames = n % 4;
+  const float *endP = outputVector + n - tailFrames;
+
+  while (outputVector < endP) {
+    sourceP -= 4;
+    // reverse within 64-bit halves, then swap the halves.
+    float32x4_t source = vrev64q_f32(vld1q_f32(sourceP));
+    vst1q_f32(outputVector, vcombine_f32(vget_high_f32(source), vget_low_f32(source)));
+    outputVector += 4;
+  }
+  n = tailFrames;
+#endif
+  while (n--) {
+    --sourceP;
+    *outputVector = *sourceP;
+    ++outputVector;
+  }
+}
+
 void multiplyByScalarThenAddToOutput(
     const float *inputVector,
     float scalar,
@@ -654,7 +773,177 @@ void multiplyByScalarThenAddToOutput(
   }
 }
 
+void multiplyThenAddToOutput(
+    const float *inputVector1,
+    const float *inputVector2,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+
+#if defined(HAVE_X86_SSE2)
+  size_t tailFrames = n % 4;
+  const float *endP = outputVector + n - tailFrames;
+
+  // unaligned loads, the vectors are rarely aligned the same way
+  while (outputVector < endP) {
+    __m128 source1 = _mm_loadu_ps(inputVector1);
+    __m128 source2 = _mm_loadu_ps(inputVector2);
+    __m128 dest = _mm_loadu_ps(outputVector);
+    _mm_storeu_ps(outputVector, _mm_add_ps(dest, _mm_mul_ps(source1, source2)));
+
+    inputVector1 += 4;
+    inputVector2 += 4;
+    outputVector += 4;
+  }
+  n = tailFrames;
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  size_t tailFrames = n % 4;
+  const float *endP = outputVector + n - tailFrames;
+
+  while (outputVector < endP) {
+    float32x4_t source1 = vld1q_f32(inputVector1);
+    float32x4_t source2 = vld1q_f32(inputVector2);
+    float32x4_t dest = vld1q_f32(outputVector);
+    vst1q_f32(outputVector, vmlaq_f32(dest, source1, source2));
+
+    inputVector1 += 4;
+    inputVector2 += 4;
+    outputVector += 4;
+  }
+  n = tailFrames;
 #endif
+  while (n--) {
+    *outputVector += *inputVector1 * *inputVector2;
+    ++inputVector1;
+    ++inputVector2;
+    ++outputVector;
+  }
+}
+
+#endif
+
+void int16ToFloat(
+    const int16_t *inputVector,
+    size_t inputStride,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+  constexpr float scale = 1.0f / 32768.0f;
+
+#if defined(HAVE_ACCELERATE)
+  vDSP_vflt16(inputVector, inputStride, outputVector, 1, n);
+  vDSP_vsmul(outputVector, 1, &scale, outputVector, 1, n);
+  n = 0;
+#elif defined(HAVE_X86_SSE2)
+  __m128 mScale = _mm_set_ps1(scale);
+
+  if (inputStride == 1) {
+    while (n >= 8) {
+      __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inputVector));
+      // sign extend by moving samples to the upper halves and shifting them back
+      __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(source, source), 16);
+      __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(source, source), 16);
+      _mm_storeu_ps(outputVector, _mm_mul_ps(_mm_cvtepi32_ps(low), mScale));
+      _mm_storeu_ps(outputVector + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), mScale));
+
+      inputVector += 8;
+      outputVector += 8;
+      n -= 8;
+    }
+  } else if (inputStride == 2) {
+    // the whole last pair is loaded, it has to be in bounds for either channel
+    while (n > 4) {
+      __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inputVector));
+      __m128i samples = _mm_srai_epi32(_mm_slli_epi32(source, 16), 16);
+      _mm_storeu_ps(outputVector, _mm_mul_ps(_mm_cvtepi32_ps(samples), mScale));
+
+      inputVector += 8;
+      outputVector += 4;
+      n -= 4;
+    }
+  }
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  if (inputStride == 1) {
+    while (n >= 8) {
+      int16x8_t source = vld1q_s16(inputVector);
+      float32x4_t low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(source)));
+      float32x4_t high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(source)));
+      vst1q_f32(outputVector, vmulq_n_f32(low, scale));
+      vst1q_f32(outputVector + 4, vmulq_n_f32(high, scale));
+
+      inputVector += 8;
+      outputVector += 8;
+      n -= 8;
+    }
+  } else if (inputStride == 2) {
+    // the whole last pair is loaded, it has to be in bounds for either channel
+    while (n > 8) {
+      int16x8_t source = vld2q_s16(inputVector).val[0];
+      float32x4_t low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(source)));
+      float32x4_t high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(source)));
+      vst1q_f32(outputVector, vmulq_n_f32(low, scale));
+      vst1q_f32(outputVector + 4, vmulq_n_f32(high, scale));
+
+      inputVector += 16;
+      outputVector += 8;
+      n -= 8;
+    }
+  }
+#endif
+  while (n--) {
+    *outputVector = static_cast<float>(*inputVector) * scale;
+    inputVector += inputStride;
+    ++outputVector;
+  }
+}
+
+void copyWithStride(
+    const float *inputVector,
+    size_t inputStride,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+
+  if (inputStride == 1) {
+    std::copy(inputVector, inputVector + n, outputVector);
+    return;
+  }
+
+#if defined(HAVE_ACCELERATE)
+  // a single column of a matrix with inputStride columns
+  vDSP_mmov(inputVector, outputVector, 1, n, inputStride, 1);
+  n = 0;
+#elif defined(HAVE_X86_SSE2)
+  if (inputStride == 2) {
+    // the whole last pair is loaded, it has to be in bounds for either channel
+    while (n > 4) {
+      __m128 first = _mm_loadu_ps(inputVector);
+      __m128 second = _mm_loadu_ps(inputVector + 4);
+      _mm_storeu_ps(outputVector, _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+
+      inputVector += 8;
+      outputVector += 4;
+      n -= 4;
+    }
+  }
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  if (inputStride == 2) {
+    // the whole last pair is loaded, it has to be in bounds for either channel
+    while (n > 4) {
+      vst1q_f32(outputVector, vld2q_f32(inputVector).val[0]);
+
+      inputVector += 8;
+      outputVector += 4;
+      n -= 4;
+    }
+  }
+#endif
+  while (n--) {
+    *outputVector = *inputVector;
+    inputVector += inputStride;
+    ++outputVector;
+  }
+}
 
 void linearToDecibels(
     const float *inputVector,
@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 
 namespace audioapi::dsp {
 
@@ -40,6 +41,13 @@ void multiplyByScalarThenAddToOutput(
     float *outputVector,
     size_t numberOfElementsToProcess);
 
+// Adds the element-wise product of two float vectors to outputVector.
+void multiplyThenAddToOutput(
+    const float *inputVector1,
+    const float *inputVector2,
+    float *outputVector,
+    size_t numberOfElementsToProcess);
+
 void multiplyByScalar(
     const float *inputVector,
     float scalar,
@@ -66,9 +74,33 @@ void multiply(
     float *outputVector,
     size_t numberOfElementsToProcess);
 
+// Returns the sum of products of two float vectors.
+float dotProduct(
+    const float *inputVector1,
+    const float *inputVector2,
+    size_t numberOfElementsToProcess);
+
+// Copies inputVector into outputVector in reverse order, vectors must not overlap.
+void reverse(const float *inputVector, float *outputVector, size_t numberOfElementsToProcess);
+
 // Finds the maximum magnitude of a float vector.
 float maximumMagnitude(const float *inputVector, size_t numberOfElementsToProcess);
 
+// Converts 16-bit PCM samples taken every inputStride elements to floats in [-1, 1).
+void int16ToFloat(
+    const int16_t *inputVector,
+    size_t inputStride,
+    float *outputVector,
+    size_t numberOfElementsToProcess);
+
+// Gathers elements taken every inputStride elements into a contiguous vector,
+// which deinterleaves a single channel.
+void copyWithStride(
+    const float *inputVector,
+    size_t inputStride,
+    float *outputVector,
+    size_t numberOfElementsToProcess);
+
 void linearToDecibels(
     const float *inputVector,
     float *outputVector,
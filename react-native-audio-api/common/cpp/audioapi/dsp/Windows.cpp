@@ -44,6 +44,11 @@ void Kaiser::apply(float *data, int size) const {
   }
 }
 
+float Kaiser::getValue(float r) const {
+  auto arg = std::sqrt(std::max(1 - r * r, 0.0f));
+  return bessel0(beta_ * arg) * invB0_ * amplitude_;
+}
+
 float Kaiser::bandwidthToBeta(float bandwidth, bool heuristicOptimal) {
   if (heuristicOptimal) { // Heuristic based on numerical search
     return bandwidth + 8.0f / (bandwidth + 3.0f) * (bandwidth + 3.0f) +
@@ -50,6 +50,8 @@ class Kaiser : public WindowFunction {
   }
 
   void apply(float *data, int size) const override;
+  // value at r in [-1, 1], for windows sampled at arbitrary points
+  [[nodiscard]] float getValue(float r) const;
 
  private:
   // beta = pi * alpha
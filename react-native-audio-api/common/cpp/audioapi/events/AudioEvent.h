@@ -0,0 +1,26 @@
+#pragma once
+
+#include <audioapi/core/types/AudioEventType.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace audioapi {
+
+/// Fixed-layout record of an event raised on the audio thread. It is copied
+/// through a preallocated queue and turned into a JS object on the JS thread.
+struct AudioEvent {
+  AudioEventType type;
+  uint64_t listenerId;
+  /// Position or queued duration in seconds.
+  double value = 0.0;
+  /// Set for "ended" events of queued buffers only.
+  bool hasBufferId = false;
+  size_t bufferId = 0;
+  bool isLast = false;
+  /// Set for "audioReady" events of recorders which reuse buffers only.
+  uint32_t batch = 0;
+  uint32_t chunkCount = 0;
+  uint32_t numFrames = 0;
+};
+
+} // namespace audioapi
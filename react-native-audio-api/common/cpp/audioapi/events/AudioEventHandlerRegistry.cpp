@@ -1,5 +1,6 @@
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
+#include <exception>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -20,9 +21,21 @@ AudioEventHandlerRegistry::AudioEventHandlerRegistry(
   for (const auto &eventName : AUDIO_API_EVENT_NAMES) {
     eventHandlers_[std::string(eventName)] = {};
   }
+
+  if (callInvoker_ != nullptr && runtime_ != nullptr) {
+    drainedEvents_.reserve(AUDIO_EVENT_QUEUE_CAPACITY);
+    dispatcherThread_ = std::thread(&AudioEventHandlerRegistry::runDispatcher, this);
+  }
 }
 
 AudioEventHandlerRegistry::~AudioEventHandlerRegistry() {
+  drainState_.store(DrainState::STOPPED, std::memory_order_release);
+  drainState_.notify_one();
+
+  if (dispatcherThread_.joinable()) {
+    dispatcherThread_.join();
+  }
+
   eventHandlers_.clear();
 }
 
@@ -86,10 +99,10 @@ void AudioEventHandlerRegistry::invokeHandlerWithEventBody(
       return;
     }
 
-    auto handlersMap = it->second;
+    const auto &handlersMap = it->second;
 
     for (const auto &pair : handlersMap) {
-      auto handler = pair.second;
+      const auto &handler = pair.second;
 
       if (!handler || !handler->isFunction(*runtime_)) {
         // If the handler is not valid, we can skip it
@@ -186,6 +199,143 @@ void AudioEventHandlerRegistry::invokeHandlerWithEventBody(
   });
 }
 
+bool AudioEventHandlerRegistry::dispatchAudioEvent(const AudioEvent &event) {
+  if (callInvoker_ == nullptr || runtime_ == nullptr) {
+    return false;
+  }
+
+  // when the queue is full JS is far behind, the event is dropped
+  if (!audioEvents_.try_send(event)) {
+    return false;
+  }
+
+  // pairs with the fence in drainAudioEvents, either the event is drained already
+  // or this call sees the drain finished and schedules another one
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto expected = DrainState::IDLE;
+  if (drainState_.compare_exchange_strong(
+          expected, DrainState::PENDING, std::memory_order_acq_rel)) {
+    drainState_.notify_one();
+  }
+
+  return true;
+}
+
+void AudioEventHandlerRegistry::runDispatcher() {
+  while (true) {
+    auto state = drainState_.load(std::memory_order_acquire);
+
+    if (state == DrainState::STOPPED) {
+      return;
+    }
+
+    if (state != DrainState::PENDING) {
+      drainState_.wait(state, std::memory_order_acquire);
+      continue;
+    }
+
+    auto expected = DrainState::PENDING;
+    if (!drainState_.compare_exchange_strong(
+            expected, DrainState::SCHEDULED, std::memory_order_acq_rel)) {
+      continue;
+    }
+
+    callInvoker_->invokeAsync([this]() { drainAudioEvents(); });
+    std::this_thread::sleep_for(AUDIO_EVENT_BATCH_INTERVAL);
+  }
+}
+
+void AudioEventHandlerRegistry::drainAudioEvents() {
+  // events queued from now on schedule another drain
+  auto expected = DrainState::SCHEDULED;
+  if (drainState_.compare_exchange_strong(expected, DrainState::IDLE, std::memory_order_acq_rel)) {
+    drainState_.notify_one();
+  }
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  drainedEvents_.clear();
+  latestPositions_.clear();
+
+  AudioEvent event{};
+  while (audioEvents_.try_receive(event)) {
+    if (event.type == AudioEventType::POSITION_CHANGED) {
+      latestPositions_[event.listenerId] = drainedEvents_.size();
+    }
+    drainedEvents_.push_back(event);
+  }
+
+  // drained events are gone from the queue, so a throwing handler does not stop the batch,
+  // the first error is rethrown once every event is delivered
+  std::exception_ptr firstError;
+
+  for (size_t i = 0; i < drainedEvents_.size(); i++) {
+    const auto &drainedEvent = drainedEvents_[i];
+
+    // only the latest position of every listener is worth reporting
+    if (drainedEvent.type == AudioEventType::POSITION_CHANGED &&
+        latestPositions_[drainedEvent.listenerId] != i) {
+      continue;
+    }
+
+    try {
+      invokeHandlerWithAudioEvent(drainedEvent);
+    } catch (...) {
+      if (firstError == nullptr) {
+        firstError = std::current_exception();
+      }
+    }
+  }
+
+  if (firstError != nullptr) {
+    std::rethrow_exception(firstError);
+  }
+}
+
+void AudioEventHandlerRegistry::invokeHandlerWithAudioEvent(const AudioEvent &event) {
+  auto it = eventHandlers_.find(getEventName(event.type));
+
+  if (it == eventHandlers_.end()) {
+    return;
+  }
+
+  auto handlerIt = it->second.find(event.listenerId);
+
+  if (handlerIt == it->second.end() || !handlerIt->second ||
+      !handlerIt->second->isFunction(*runtime_)) {
+    return;
+  }
+
+  try {
+    handlerIt->second->call(*runtime_, createEventObject(event));
+  } catch (const std::exception &e) {
+    // re-throw the exception to be handled by the caller
+    // std::exception is safe to parse by the rn bridge
+    throw;
+  } catch (...) {
+    printf(
+        "Unknown exception occurred while invoking handler for event: %s\n",
+        getEventName(event.type));
+  }
+}
+
+const char *AudioEventHandlerRegistry::getEventName(AudioEventType type) {
+  switch (type) {
+    case AudioEventType::ENDED:
+      return "ended";
+    case AudioEventType::LOOP_ENDED:
+      return "loopEnded";
+    case AudioEventType::POSITION_CHANGED:
+      return "positionChanged";
+    case AudioEventType::BUFFER_QUEUE_LOW:
+      return "bufferQueueLow";
+    case AudioEventType::AUDIO_READY:
+      return "audioReady";
+  }
+
+  return "";
+}
+
 jsi::Object AudioEventHandlerRegistry::createEventObject(
     const std::unordered_map<std::string, EventValue> &body) {
   auto eventObject = jsi::Object(*runtime_);
@@ -222,4 +372,30 @@ jsi::Object AudioEventHandlerRegistry::createEventObject(
   return eventObject;
 }
 
+jsi::Object AudioEventHandlerRegistry::createEventObject(const AudioEvent &event) {
+  auto eventObject = jsi::Object(*runtime_);
+
+  switch (event.type) {
+    case AudioEventType::ENDED:
+      if (event.hasBufferId) {
+        eventObject.setProperty(*runtime_, "bufferId", std::to_string(event.bufferId));
+        eventObject.setProperty(*runtime_, "isLast", event.isLast);
+      }
+      break;
+    case AudioEventType::POSITION_CHANGED:
+    case AudioEventType::BUFFER_QUEUE_LOW:
+      eventObject.setProperty(*runtime_, "value", event.value);
+      break;
+    case AudioEventType::AUDIO_READY:
+      eventObject.setProperty(*runtime_, "batch", static_cast<int>(event.batch));
+      eventObject.setProperty(*runtime_, "chunkCount", static_cast<int>(event.chunkCount));
+      eventObject.setProperty(*runtime_, "numFrames", static_cast<int>(event.numFrames));
+      break;
+    case AudioEventType::LOOP_ENDED:
+      break;
+  }
+
+  return eventObject;
+}
+
 } // namespace audioapi
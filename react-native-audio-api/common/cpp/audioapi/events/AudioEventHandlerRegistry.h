@@ -1,14 +1,19 @@
 #pragma once
 
 #include <ReactCommon/CallInvoker.h>
+#include <audioapi/events/AudioEvent.h>
 #include <audioapi/events/IAudioEventHandlerRegistry.h>
+#include <audioapi/utils/MpscQueue.hpp>
 #include <jsi/jsi.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 namespace audioapi {
 using namespace facebook;
@@ -36,7 +41,15 @@ class AudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
       uint64_t listenerId,
       const std::unordered_map<std::string, EventValue> &body) override;
 
+  bool dispatchAudioEvent(const AudioEvent &event) override;
+
  private:
+  enum class DrainState { IDLE, PENDING, SCHEDULED, STOPPED };
+
+  static constexpr size_t AUDIO_EVENT_QUEUE_CAPACITY = 4096;
+  // queued events are delivered at most once per frame
+  static constexpr auto AUDIO_EVENT_BATCH_INTERVAL = std::chrono::milliseconds(16);
+
   std::atomic<uint64_t> listenerIdCounter_{1}; // Atomic counter for listener IDs
 
   std::shared_ptr<react::CallInvoker> callInvoker_;
@@ -44,6 +57,14 @@ class AudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
   std::unordered_map<std::string, std::unordered_map<uint64_t, std::shared_ptr<jsi::Function>>>
       eventHandlers_;
 
+  channels::mpsc::Queue<AudioEvent> audioEvents_{AUDIO_EVENT_QUEUE_CAPACITY};
+  std::atomic<DrainState> drainState_{DrainState::IDLE};
+  std::thread dispatcherThread_;
+
+  // reused between drains on the JS thread
+  std::vector<AudioEvent> drainedEvents_;
+  std::unordered_map<uint64_t, size_t> latestPositions_;
+
   static constexpr std::array<std::string_view, 15> SYSTEM_EVENT_NAMES = {
       "remotePlay",
       "remotePause",
@@ -62,13 +83,28 @@ class AudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
       "volumeChange",
   };
 
-  static constexpr std::array<std::string_view, 6> AUDIO_API_EVENT_NAMES =
-      {"ended", "loopEnded", "audioReady", "positionChanged", "audioError", "systemStateChanged"};
+  static constexpr std::array<std::string_view, 8> AUDIO_API_EVENT_NAMES = {
+      "ended",
+      "loopEnded",
+      "audioReady",
+      "positionChanged",
+      "bufferQueueLow",
+      "stretchProgress",
+      "audioError",
+      "systemStateChanged"};
 
   jsi::Object createEventObject(const std::unordered_map<std::string, EventValue> &body);
+  jsi::Object createEventObject(const AudioEvent &event);
   jsi::Object createEventObject(
       const std::unordered_map<std::string, EventValue> &body,
       size_t memoryPressure);
+
+  /// Schedules a drain of the audio event queue on the JS thread whenever events are
+  /// pending, waiting a frame between drains so that they are delivered in batches.
+  void runDispatcher();
+  void drainAudioEvents();
+  void invokeHandlerWithAudioEvent(const AudioEvent &event);
+  static const char *getEventName(AudioEventType type);
 };
 
 } // namespace audioapi
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ReactCommon/CallInvoker.h>
+#include <audioapi/events/AudioEvent.h>
 #include <jsi/jsi.h>
 #include <memory>
 #include <string>
@@ -28,6 +29,11 @@ class IAudioEventHandlerRegistry {
       const std::string &eventName,
       uint64_t listenerId,
       const std::unordered_map<std::string, EventValue> &body) = 0;
+
+  /// Realtime safe, queues the event without allocating or locking. Queued events
+  /// are delivered to JS in batches, keeping only the latest position per listener.
+  /// @return false when the event is dropped, e.g. because JS is far behind.
+  virtual bool dispatchAudioEvent(const AudioEvent &event) = 0;
 };
 
 } // namespace audioapi
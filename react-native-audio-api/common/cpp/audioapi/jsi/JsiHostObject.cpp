@@ -1,6 +1,9 @@
 #include <audioapi/jsi/JsiHostObject.h>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -35,7 +38,8 @@ JsiHostObject::JsiHostObject() {
 JsiHostObject::JsiHostObject(JsiHostObject &&other) noexcept
     : getters_(std::move(other.getters_)),
       functions_(std::move(other.functions_)),
-      setters_(std::move(other.setters_)) {
+      setters_(std::move(other.setters_)),
+      dispatchTable_(other.dispatchTable_.load(std::memory_order_acquire)) {
 #if JSI_DEBUG_ALLOCATIONS
   auto it = std::find(objects.begin(), objects.end(), &other);
   if (it != objects.end()) {
@@ -50,6 +54,8 @@ JsiHostObject &JsiHostObject::operator=(JsiHostObject &&other) noexcept {
     getters_ = std::move(other.getters_);
     functions_ = std::move(other.functions_);
     setters_ = std::move(other.setters_);
+    dispatchTable_.store(
+        other.dispatchTable_.load(std::memory_order_acquire), std::memory_order_release);
 
 #if JSI_DEBUG_ALLOCATIONS
     auto it = std::find(objects.begin(), objects.end(), &other);
@@ -73,70 +79,113 @@ JsiHostObject::~JsiHostObject() {
 }
 
 std::vector<jsi::PropNameID> JsiHostObject::getPropertyNames(jsi::Runtime &rt) {
+  const auto &dispatchTable = getDispatchTable();
+
   std::vector<jsi::PropNameID> propertyNames;
-  propertyNames.reserve(getters_->size() + functions_->size() + setters_->size());
+  propertyNames.reserve(dispatchTable.properties.size());
 
-  for (const auto &it : *getters_) {
+  for (const auto &it : dispatchTable.properties) {
     propertyNames.push_back(jsi::PropNameID::forUtf8(rt, it.first));
   }
 
-  for (const auto &it : *functions_) {
-    propertyNames.push_back(jsi::PropNameID::forAscii(rt, it.first));
-  }
-
-  for (const auto &it : *setters_) {
-    propertyNames.push_back(jsi::PropNameID::forAscii(rt, it.first));
-  }
-
   return propertyNames;
 }
 
 jsi::Value JsiHostObject::get(jsi::Runtime &runtime, const jsi::PropNameID &name) {
-  auto nameAsString = name.utf8(runtime);
-  auto &hostFunctionCache = hostFunctionCache_.get(runtime);
+  const auto &dispatchTable = getDispatchTable();
+
+  // stable JSI cannot hash a PropNameID, so every lookup converts the name, which allocates
+  // once it outgrows the small-string buffer (15 characters in libstdc++, 22 in libc++),
+  // e.g. for linearRampToValueAtTime
+  auto property = dispatchTable.properties.find(name.utf8(runtime));
+  if (property == dispatchTable.properties.end()) {
+    return jsi::Value::undefined();
+  }
 
-  auto cachedFunction = hostFunctionCache.find(nameAsString);
-  if (cachedFunction != hostFunctionCache.end()) {
-    return cachedFunction->second.asFunction(runtime);
+  const auto &entry = property->second;
+  if (entry.getter != nullptr) {
+    return (this->*entry.getter)(runtime);
   }
 
-  auto getter = getters_->find(nameAsString);
-  if (getter != getters_->end()) {
-    auto dispatcher = std::bind(getter->second, this, std::placeholders::_1);
+  if (entry.function == nullptr) {
+    return jsi::Value::undefined();
+  }
 
-    return dispatcher(runtime);
+  auto &hostFunctions = hostFunctionCache_.get(runtime);
+  if (hostFunctions.empty()) {
+    hostFunctions.resize(dispatchTable.functionCount);
   }
 
-  auto function = functions_->find(nameAsString);
-  if (function != functions_->end()) {
-    auto dispatcher = std::bind(
-        function->second,
-        reinterpret_cast<JsiHostObject *>(this),
-        std::placeholders::_1,
-        std::placeholders::_2,
-        std::placeholders::_3,
-        std::placeholders::_4);
-
-    return hostFunctionCache
-        .emplace(nameAsString, jsi::Function::createFromHostFunction(runtime, name, 0, dispatcher))
-        .first->second.asFunction(runtime);
+  auto &hostFunction = hostFunctions[entry.functionIndex];
+  if (!hostFunction.has_value()) {
+    auto function = entry.function;
+    hostFunction = jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        0,
+        [this, function](
+            jsi::Runtime &rt, const jsi::Value &thisValue, const jsi::Value *args, size_t count) {
+          return (this->*function)(rt, thisValue, args, count);
+        });
   }
 
-  return jsi::Value::undefined();
+  return {runtime, *hostFunction};
 }
 
 void JsiHostObject::set(
     jsi::Runtime &runtime,
     const jsi::PropNameID &name,
     const jsi::Value &value) {
-  auto nameAsString = name.utf8(runtime);
+  const auto &properties = getDispatchTable().properties;
 
-  auto setter = setters_->find(nameAsString);
+  auto property = properties.find(name.utf8(runtime));
+  if (property != properties.end() && property->second.setter != nullptr) {
+    (this->*property->second.setter)(runtime, value);
+  }
+}
+
+const JsiHostObject::DispatchTable &JsiHostObject::getDispatchTable() {
+  const auto *dispatchTable = dispatchTable_.load(std::memory_order_acquire);
+  if (dispatchTable != nullptr) {
+    return *dispatchTable;
+  }
 
-  if (setter != setters_->end()) {
-    auto dispatcher = std::bind(setter->second, this, std::placeholders::_1, std::placeholders::_2);
+  // tables are never removed, so references to them stay valid after the lock is released
+  static std::mutex tablesMutex;
+  static std::unordered_map<std::type_index, std::unique_ptr<const DispatchTable>> tables;
 
-    return dispatcher(runtime, value);
+  std::lock_guard<std::mutex> lock(tablesMutex);
+  auto &table = tables[std::type_index(typeid(*this))];
+  if (table == nullptr) {
+    table = std::make_unique<const DispatchTable>(buildDispatchTable(*this));
   }
+
+  getters_.reset();
+  functions_.reset();
+  setters_.reset();
+  dispatchTable_.store(table.get(), std::memory_order_release);
+  return *table;
+}
+
+JsiHostObject::DispatchTable JsiHostObject::buildDispatchTable(const JsiHostObject &hostObject) {
+  DispatchTable dispatchTable;
+  dispatchTable.properties.reserve(
+      hostObject.getters_->size() + hostObject.functions_->size() + hostObject.setters_->size());
+
+  for (const auto &[name, getter] : *hostObject.getters_) {
+    dispatchTable.properties[name].getter = getter;
+  }
+
+  for (const auto &[name, function] : *hostObject.functions_) {
+    auto &entry = dispatchTable.properties[name];
+    entry.function = function;
+    entry.functionIndex = dispatchTable.functionCount++;
+  }
+
+  for (const auto &[name, setter] : *hostObject.setters_) {
+    dispatchTable.properties[name].setter = setter;
+  }
+
+  return dispatchTable;
 }
 } // namespace audioapi
@@ -3,8 +3,9 @@
 #include <audioapi/jsi/RuntimeAwareCache.h>
 
 #include <jsi/jsi.h>
-#include <map>
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -72,6 +73,8 @@ class JsiHostObject : public jsi::HostObject {
   }
 
  protected:
+  // properties registered by the constructors, they are merged into the dispatch table of the
+  // class and released on the first property access, so they can be only modified in constructors
   std::unique_ptr<std::unordered_map<std::string, jsi::Value (JsiHostObject::*)(jsi::Runtime &)>>
       getters_;
 
@@ -86,7 +89,33 @@ class JsiHostObject : public jsi::HostObject {
       setters_;
 
  private:
-  RuntimeAwareCache<std::map<std::string, jsi::Function>> hostFunctionCache_;
+  using Getter = jsi::Value (JsiHostObject::*)(jsi::Runtime &);
+  using Setter = void (JsiHostObject::*)(jsi::Runtime &, const jsi::Value &);
+  using Function =
+      jsi::Value (JsiHostObject::*)(jsi::Runtime &, const jsi::Value &, const jsi::Value *, size_t);
+
+  struct PropertyEntry {
+    Getter getter = nullptr;
+    Setter setter = nullptr;
+    Function function = nullptr;
+    // slot of the function in the host function cache
+    size_t functionIndex = 0;
+  };
+
+  /// @brief Properties of a host object class, resolved to member pointers by name.
+  /// @note Every instance of a class registers the same properties, so the table is built once
+  /// per class, from its first instance, and is shared by all instances for the program lifetime.
+  struct DispatchTable {
+    std::unordered_map<std::string, PropertyEntry> properties;
+    size_t functionCount = 0;
+  };
+
+  std::atomic<const DispatchTable *> dispatchTable_{nullptr};
+  // host functions bound to this object, indexed by the function index of their entry
+  RuntimeAwareCache<std::vector<std::optional<jsi::Function>>> hostFunctionCache_;
+
+  const DispatchTable &getDispatchTable();
+  static DispatchTable buildDispatchTable(const JsiHostObject &hostObject);
 };
 
 } // namespace audioapi
@@ -37,16 +37,16 @@ class RuntimeAwareCache : public RuntimeLifecycleListener {
   }
 
   T &get(jsi::Runtime &rt) {
-    if (runtimeCaches_.count(&rt) == 0) {
-      // This is the first time this Runtime has been accessed.
-      // We set up a `onRuntimeDestroyed` listener for it and
-      // initialize the cache map.
-      RuntimeLifecycleMonitor::addListener(rt, this);
-
-      T cache;
-      runtimeCaches_.emplace(&rt, std::move(cache));
+    auto cache = runtimeCaches_.find(&rt);
+    if (cache != runtimeCaches_.end()) {
+      return cache->second;
     }
-    return runtimeCaches_.at(&rt);
+
+    // This is the first time this Runtime has been accessed.
+    // We set up a `onRuntimeDestroyed` listener for it and
+    // initialize the cache map.
+    RuntimeLifecycleMonitor::addListener(rt, this);
+    return runtimeCaches_.emplace(&rt, T{}).first->second;
   }
 
  private:
@@ -61,8 +61,7 @@ void convertFrameToBuffer(
     SwrContext *swr,
     AVFrame *frame,
     int output_channel_count,
-    std::vector<float> &buffer,
-    size_t &framesRead,
+    PlanarAudioStore &store,
     uint8_t **&resampled_data,
     int &max_resampled_samples) {
   const int out_samples = swr_get_out_samples(swr, frame->nb_samples);
@@ -90,32 +89,24 @@ void convertFrameToBuffer(
       frame->nb_samples);
 
   if (converted_samples > 0) {
-    const size_t current_size = buffer.size();
-    const size_t new_samples =
-        static_cast<size_t>(converted_samples) * output_channel_count;
-    buffer.resize(current_size + new_samples);
-    memcpy(
-        buffer.data() + current_size,
-        resampled_data[0],
-        new_samples * sizeof(float));
-    framesRead += converted_samples;
+    store.appendInterleaved(
+        reinterpret_cast<const float *>(resampled_data[0]),
+        static_cast<size_t>(converted_samples));
   }
 }
 
-std::vector<float> readAllPcmFrames(
+void readAllPcmFrames(
     AVFormatContext *fmt_ctx,
     AVCodecContext *codec_ctx,
     int out_sample_rate,
     int output_channel_count,
     int audio_stream_index,
-    size_t &framesRead) {
-  framesRead = 0;
-  std::vector<float> buffer;
+    PlanarAudioStore &store) {
   auto swr = std::unique_ptr<SwrContext, std::function<void(SwrContext *)>>(
       swr_alloc(), [](SwrContext *ctx) { swr_free(&ctx); });
 
   if (swr == nullptr)
-    return buffer;
+    return;
 
   av_opt_set_chlayout(swr.get(), "in_chlayout", &codec_ctx->ch_layout, 0);
   av_opt_set_int(swr.get(), "in_sample_rate", codec_ctx->sample_rate, 0);
@@ -129,7 +120,7 @@ std::vector<float> readAllPcmFrames(
 
   if (swr_init(swr.get()) < 0) {
     av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+    return;
   }
 
   auto packet = std::unique_ptr<AVPacket, std::function<void(AVPacket *)>>(
@@ -139,7 +130,7 @@ std::vector<float> readAllPcmFrames(
 
   if (packet == nullptr || frame == nullptr) {
     av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+    return;
   }
 
   // Allocate buffer for resampled data
@@ -153,7 +144,7 @@ std::vector<float> readAllPcmFrames(
           AV_SAMPLE_FMT_FLT,
           0) < 0) {
     av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+    return;
   }
 
   while (av_read_frame(fmt_ctx, packet.get()) >= 0) {
@@ -164,8 +155,7 @@ std::vector<float> readAllPcmFrames(
               swr.get(),
               frame.get(),
               output_channel_count,
-              buffer,
-              framesRead,
+              store,
               resampled_data,
               max_resampled_samples);
         }
@@ -181,8 +171,7 @@ std::vector<float> readAllPcmFrames(
         swr.get(),
         frame.get(),
         output_channel_count,
-        buffer,
-        framesRead,
+        store,
         resampled_data,
         max_resampled_samples);
   }
@@ -190,8 +179,6 @@ std::vector<float> readAllPcmFrames(
   av_freep(&resampled_data[0]);
   av_freep(&resampled_data);
   av_channel_layout_uninit(&out_ch_layout);
-
-  return buffer;
 }
 
 inline int findAudioStreamIndex(AVFormatContext *fmt_ctx) {
@@ -240,33 +227,36 @@ std::shared_ptr<AudioBuffer> decodeAudioFrames(
     AVCodecContext *codec_ctx,
     int audio_stream_index,
     int sample_rate) {
-  size_t framesRead = 0;
   int output_sample_rate =
       (sample_rate > 0) ? sample_rate : codec_ctx->sample_rate;
   int output_channel_count = codec_ctx->ch_layout.nb_channels;
 
-  std::vector<float> decoded_buffer = readAllPcmFrames(
+  // duration of the stream, when the container knows it, sizes the output
+  // upfront
+  AVStream *stream = fmt_ctx->streams[audio_stream_index];
+  size_t expected_length = 0;
+  if (stream->duration != AV_NOPTS_VALUE && stream->duration > 0) {
+    expected_length = static_cast<size_t>(av_rescale_q(
+        stream->duration, stream->time_base, AVRational{1, output_sample_rate}));
+  }
+
+  PlanarAudioStore store(
+      output_channel_count,
+      static_cast<float>(output_sample_rate),
+      expected_length);
+  readAllPcmFrames(
       fmt_ctx,
       codec_ctx,
       output_sample_rate,
       output_channel_count,
       audio_stream_index,
-      framesRead);
+      store);
 
-  if (framesRead == 0 || decoded_buffer.empty()) {
+  auto audioBus = store.finish();
+  if (audioBus == nullptr) {
     return nullptr;
   }
 
-  auto outputFrames = decoded_buffer.size() / output_channel_count;
-  auto audioBus = std::make_shared<AudioBus>(
-      outputFrames, output_channel_count, output_sample_rate);
-
-  for (int ch = 0; ch < output_channel_count; ++ch) {
-    auto channelData = audioBus->getChannel(ch)->getData();
-    for (int i = 0; i < outputFrames; ++i) {
-      channelData[i] = decoded_buffer[i * output_channel_count + ch];
-    }
-  }
   return std::make_shared<AudioBuffer>(audioBus);
 }
 
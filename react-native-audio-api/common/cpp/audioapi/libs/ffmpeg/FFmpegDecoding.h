@@ -8,6 +8,7 @@
  * FFmpeg, you must comply with the terms of the LGPL for FFmpeg itself.
  */
 
+#include <audioapi/core/utils/PlanarAudioStore.h>
 #include <audioapi/utils/AudioBus.h>
 #include <iostream>
 #include <memory>
@@ -38,20 +39,19 @@ struct AudioStreamContext {
 int read_packet(void *opaque, uint8_t *buf, int buf_size);
 int64_t seek_packet(void *opaque, int64_t offset, int whence);
 inline int findAudioStreamIndex(AVFormatContext *fmt_ctx);
-std::vector<float> readAllPcmFrames(
+void readAllPcmFrames(
     AVFormatContext *fmt_ctx,
     AVCodecContext *codec_ctx,
     int out_sample_rate,
     int output_channel_count,
     int audio_stream_index,
-    size_t &framesRead);
+    PlanarAudioStore &store);
 
 void convertFrameToBuffer(
     SwrContext *swr,
     AVFrame *frame,
     int output_channel_count,
-    std::vector<float> &buffer,
-    size_t &framesRead,
+    PlanarAudioStore &store,
     uint8_t **&resampled_data,
     int &max_resampled_samples);
 bool setupDecoderContext(
@@ -69,6 +69,10 @@ void AudioArray::resize(size_t size) {
   zero(0, size_);
 }
 
+void AudioArray::truncate(size_t size) {
+  size_ = std::min(size, size_);
+}
+
 void AudioArray::scale(float value) {
   dsp::multiplyByScalar(data_, value, data_, size_);
 }
@@ -27,6 +27,8 @@ class AudioArray {
 
   void normalize();
   void resize(size_t size);
+  /// @brief Shortens the array to size samples, the storage is not reallocated.
+  void truncate(size_t size);
   void scale(float value);
   [[nodiscard]] float getMaxAbsValue() const;
 
@@ -24,6 +24,12 @@ AudioBus::AudioBus(size_t size, int numberOfChannels, float sampleRate)
   createChannels();
 }
 
+AudioBus::AudioBus(std::vector<std::shared_ptr<AudioArray>> channels, float sampleRate)
+    : channels_(std::move(channels)),
+      numberOfChannels_(static_cast<int>(channels_.size())),
+      sampleRate_(sampleRate),
+      size_(channels_.empty() ? 0 : channels_[0]->getSize()) {}
+
 AudioBus::AudioBus(const AudioBus &other) {
   numberOfChannels_ = other.numberOfChannels_;
   sampleRate_ = other.sampleRate_;
@@ -26,6 +26,8 @@ class AudioBus {
 
   explicit AudioBus() = default;
   explicit AudioBus(size_t size, int numberOfChannels, float sampleRate);
+  /// Takes over already filled channels of equal size.
+  explicit AudioBus(std::vector<std::shared_ptr<AudioArray>> channels, float sampleRate);
   AudioBus(const AudioBus &other);
   AudioBus(AudioBus &&other) noexcept;
   AudioBus &operator=(const AudioBus &other);
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace audioapi {
+
+struct FrameRange {
+  size_t start;
+  size_t length;
+};
+
+/// @brief Splits length frames into at most maxRanges consecutive ranges, none of them
+/// shorter than minRangeLength unless the whole length is.
+/// @note Used to split decoding and time stretching between worker threads.
+[[nodiscard]] inline std::vector<FrameRange>
+splitIntoRanges(size_t length, size_t maxRanges, size_t minRangeLength) {
+  auto rangeCount = std::max<size_t>(
+      std::min(maxRanges, minRangeLength > 0 ? length / minRangeLength : maxRanges), 1);
+  auto rangeLength = length / rangeCount;
+
+  std::vector<FrameRange> ranges;
+  ranges.reserve(rangeCount);
+  for (size_t i = 0; i < rangeCount; i += 1) {
+    auto start = i * rangeLength;
+    ranges.push_back({start, i + 1 == rangeCount ? length - start : rangeLength});
+  }
+
+  return ranges;
+}
+
+} // namespace audioapi
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace audioapi::channels::mpsc {
+
+/// @brief Bounded multi-producer, single-consumer queue of fixed-layout records.
+/// Every slot carries a sequence number telling whether it is free for the
+/// producer of a given turn or filled for the consumer, so producers only
+/// contend on a single fetch of the enqueue cursor.
+/// @note try_send and try_receive are lock-free and never allocate.
+/// @tparam T Trivially copyable record type
+template <typename T>
+class Queue {
+  static_assert(std::is_trivially_copyable_v<T>, "records are copied between threads as is");
+
+ public:
+  /// @param capacity The minimum capacity, rounded up to the closest power of two.
+  explicit Queue(size_t capacity)
+      : capacity_(std::bit_ceil(std::max(capacity, static_cast<size_t>(2)))),
+        mask_(capacity_ - 1),
+        slots_(std::make_unique<Slot[]>(capacity_)) {
+    for (size_t i = 0; i < capacity_; i++) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  Queue(const Queue &) = delete;
+  Queue &operator=(const Queue &) = delete;
+
+  /// @brief Try to push a record, any thread.
+  /// @return false when the queue is full.
+  bool try_send(const T &value) noexcept {
+    auto position = enqueueCursor_.load(std::memory_order_relaxed);
+
+    while (true) {
+      auto &slot = slots_[position & mask_];
+      auto sequence = slot.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+      if (difference == 0) {
+        if (enqueueCursor_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = enqueueCursor_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// @brief Try to pop the oldest record, consumer thread only.
+  /// @return false when the queue is empty.
+  bool try_receive(T &value) noexcept {
+    auto &slot = slots_[dequeueCursor_ & mask_];
+    auto sequence = slot.sequence.load(std::memory_order_acquire);
+
+    if (sequence != dequeueCursor_ + 1) {
+      return false;
+    }
+
+    value = slot.value;
+    slot.sequence.store(dequeueCursor_ + capacity_, std::memory_order_release);
+    dequeueCursor_ += 1;
+    return true;
+  }
+
+  [[nodiscard]] size_t getCapacity() const noexcept {
+    return capacity_;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  size_t capacity_;
+  size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+
+  alignas(64) std::atomic<size_t> enqueueCursor_ = 0;
+  alignas(64) size_t dequeueCursor_ = 0;
+};
+
+} // namespace audioapi::channels::mpsc
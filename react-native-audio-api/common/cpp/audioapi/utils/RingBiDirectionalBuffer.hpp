@@ -121,6 +121,13 @@ class RingBiDirectionalBuffer {
     return buffer_[prevIndex(tailIndex_)];
   }
 
+  /// @brief Peek at the element at the given position counted from the front of the buffer.
+  /// @param index The position of the element, must be lower than size().
+  /// @return A const reference to the element.
+  const inline T &peekAt(size_t index) const noexcept {
+    return buffer_[(headIndex_ + index) & (capacity_ - 1)];
+  }
+
   /// @brief Peek at the front of the buffer.
   /// @return A mutable reference to the front element of the buffer.
   inline T &peekFrontMut() noexcept {
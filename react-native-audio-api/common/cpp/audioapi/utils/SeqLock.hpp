@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace audioapi {
+
+/// @brief Publishes a small record from a single writer thread to any number of readers.
+/// The writer never waits, readers retry while a write is in progress, so the
+/// audio thread can publish state every render quantum for JS to poll.
+/// The record is kept in atomic words, so that torn reads are detected instead
+/// of being undefined behaviour.
+/// @tparam T Trivially copyable record type
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable_v<T>, "records are copied word by word");
+
+ public:
+  explicit SeqLock(const T &value = T{}) {
+    store(value);
+  }
+
+  SeqLock(const SeqLock &) = delete;
+  SeqLock &operator=(const SeqLock &) = delete;
+
+  /// @brief Writer thread only, wait-free.
+  void store(const T &value) noexcept {
+    // records may have default member initializers, so they are not copied as raw memory
+    auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+    std::array<uint64_t, WORD_COUNT> words{};
+    std::memcpy(words.data(), bytes.data(), sizeof(T));
+
+    auto sequence = sequence_.load(std::memory_order_relaxed);
+    // odd sequence marks a write in progress
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < WORD_COUNT; i++) {
+      words_[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  /// @brief Any thread, returns the latest record written as a whole.
+  [[nodiscard]] T load() const noexcept {
+    std::array<uint64_t, WORD_COUNT> words{};
+
+    while (true) {
+      auto sequence = sequence_.load(std::memory_order_acquire);
+
+      for (size_t i = 0; i < WORD_COUNT; i++) {
+        words[i] = words_[i].load(std::memory_order_relaxed);
+      }
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if ((sequence & 1) == 0 && sequence == sequence_.load(std::memory_order_relaxed)) {
+        break;
+      }
+    }
+
+    std::array<std::byte, sizeof(T)> bytes{};
+    std::memcpy(bytes.data(), words.data(), sizeof(T));
+    return std::bit_cast<T>(bytes);
+  }
+
+ private:
+  static constexpr size_t WORD_COUNT = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  std::atomic<uint32_t> sequence_ = 0;
+  std::array<std::atomic<uint64_t>, WORD_COUNT> words_{};
+};
+
+} // namespace audioapi
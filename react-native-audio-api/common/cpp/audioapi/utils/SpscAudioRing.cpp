@@ -0,0 +1,112 @@
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/SpscAudioRing.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace audioapi {
+
+SpscAudioRing::SpscAudioRing(size_t capacity, int numberOfChannels, float sampleRate)
+    : bus_(std::make_unique<AudioBus>(capacity, numberOfChannels, sampleRate)),
+      capacity_(capacity) {}
+
+SpscAudioRing::~SpscAudioRing() = default;
+
+size_t SpscAudioRing::write(const float *const *data, size_t frames) {
+  auto framesToWrite = reserve(frames);
+  auto writeIndex = writePosition_.load(std::memory_order_relaxed) % capacity_;
+  auto firstPart = std::min(framesToWrite, capacity_ - writeIndex);
+
+  for (int ch = 0; ch < bus_->getNumberOfChannels(); ch += 1) {
+    auto *channelData = bus_->getChannel(ch)->getData();
+    std::memcpy(channelData + writeIndex, data[ch], firstPart * sizeof(float));
+    std::memcpy(channelData, data[ch] + firstPart, (framesToWrite - firstPart) * sizeof(float));
+  }
+
+  commit(framesToWrite);
+  return framesToWrite;
+}
+
+size_t SpscAudioRing::writeInterleaved(const float *data, size_t frames) {
+  auto framesToWrite = reserve(frames);
+  auto writeIndex = writePosition_.load(std::memory_order_relaxed) % capacity_;
+  auto firstPart = std::min(framesToWrite, capacity_ - writeIndex);
+  auto numberOfChannels = static_cast<size_t>(bus_->getNumberOfChannels());
+
+  for (size_t ch = 0; ch < numberOfChannels; ch += 1) {
+    auto *channelData = bus_->getChannel(static_cast<int>(ch))->getData();
+    dsp::copyWithStride(data + ch, numberOfChannels, channelData + writeIndex, firstPart);
+    dsp::copyWithStride(
+        data + firstPart * numberOfChannels + ch,
+        numberOfChannels,
+        channelData,
+        framesToWrite - firstPart);
+  }
+
+  commit(framesToWrite);
+  return framesToWrite;
+}
+
+size_t SpscAudioRing::read(AudioBus *bus, size_t offset, size_t frames) {
+  auto readPosition = readPosition_.load(std::memory_order_relaxed);
+  auto framesToRead =
+      std::min(frames, writePosition_.load(std::memory_order_acquire) - readPosition);
+  auto readIndex = readPosition % capacity_;
+  auto firstPart = std::min(framesToRead, capacity_ - readIndex);
+
+  bus->copy(bus_.get(), readIndex, offset, firstPart);
+  bus->copy(bus_.get(), 0, offset + firstPart, framesToRead - firstPart);
+
+  readPosition_.store(readPosition + framesToRead, std::memory_order_release);
+  return framesToRead;
+}
+
+size_t SpscAudioRing::skip(size_t frames) {
+  auto readPosition = readPosition_.load(std::memory_order_relaxed);
+  auto framesToSkip =
+      std::min(frames, writePosition_.load(std::memory_order_acquire) - readPosition);
+
+  readPosition_.store(readPosition + framesToSkip, std::memory_order_release);
+  return framesToSkip;
+}
+
+size_t SpscAudioRing::getAvailableFrames() const {
+  // read position first, so that the difference never underflows
+  auto readPosition = readPosition_.load(std::memory_order_acquire);
+  return writePosition_.load(std::memory_order_acquire) - readPosition;
+}
+
+size_t SpscAudioRing::getCapacity() const {
+  return capacity_;
+}
+
+int SpscAudioRing::getNumberOfChannels() const {
+  return bus_->getNumberOfChannels();
+}
+
+size_t SpscAudioRing::getDroppedFrames() const {
+  return droppedFrames_.load(std::memory_order_relaxed);
+}
+
+size_t SpscAudioRing::reserve(size_t frames) {
+  auto freeFrames = capacity_ -
+      (writePosition_.load(std::memory_order_relaxed) -
+       readPosition_.load(std::memory_order_acquire));
+  auto framesToWrite = std::min(frames, freeFrames);
+
+  if (framesToWrite < frames) {
+    droppedFrames_.fetch_add(frames - framesToWrite, std::memory_order_relaxed);
+  }
+
+  return framesToWrite;
+}
+
+void SpscAudioRing::commit(size_t frames) {
+  writePosition_.store(
+      writePosition_.load(std::memory_order_relaxed) + frames, std::memory_order_release);
+}
+
+} // namespace audioapi
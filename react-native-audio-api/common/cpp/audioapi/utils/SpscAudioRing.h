@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// Planar ring buffer shared by all channels, passing frames from a single
+/// producer thread to a single consumer thread without locks.
+/// Both sides are wait-free, frames which do not fit are dropped by the
+/// producer instead of overwriting frames the consumer may be reading.
+class SpscAudioRing {
+ public:
+  SpscAudioRing(size_t capacity, int numberOfChannels, float sampleRate);
+  ~SpscAudioRing();
+
+  /// Producer side, copies planar samples of every channel.
+  /// @return Number of frames written.
+  size_t write(const float *const *data, size_t frames);
+  /// Producer side, deinterleaves samples of every channel.
+  /// @return Number of frames written.
+  size_t writeInterleaved(const float *data, size_t frames);
+
+  /// Consumer side, copies up to frames frames to bus at offset.
+  /// @return Number of frames read.
+  size_t read(AudioBus *bus, size_t offset, size_t frames);
+  /// Consumer side, drops up to frames of the oldest frames.
+  /// @return Number of frames dropped.
+  size_t skip(size_t frames);
+
+  [[nodiscard]] size_t getAvailableFrames() const;
+  [[nodiscard]] size_t getCapacity() const;
+  [[nodiscard]] int getNumberOfChannels() const;
+  /// Number of frames the producer dropped because the ring was full.
+  [[nodiscard]] size_t getDroppedFrames() const;
+
+ private:
+  std::unique_ptr<AudioBus> bus_;
+  size_t capacity_;
+
+  // total number of frames written and read, the difference is the number
+  // of frames in the ring
+  std::atomic<size_t> writePosition_ = 0;
+  std::atomic<size_t> readPosition_ = 0;
+  std::atomic<size_t> droppedFrames_ = 0;
+
+  /// Producer side, number of frames to write after dropping the overflow.
+  size_t reserve(size_t frames);
+  /// Producer side, publishes frames written at the write position.
+  void commit(size_t frames);
+};
+
+} // namespace audioapi
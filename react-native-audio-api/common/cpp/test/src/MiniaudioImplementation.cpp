@@ -0,0 +1,6 @@
+/// Miniaudio implementation for the tests, which do not link platform code.
+/// Only the decoders are needed, so the device backends are left out.
+#define MINIAUDIO_IMPLEMENTATION
+#define MA_NO_DEVICE_IO
+#include <audioapi/libs/miniaudio/miniaudio.h>
+#include <audioapi/core/utils/Mp3SeekTable.h>
@@ -0,0 +1,138 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/effects/MixerNode.h>
+#include <audioapi/core/sources/ConstantSourceNode.h>
+#include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+using namespace audioapi;
+
+class MixerTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  std::shared_ptr<AudioBus> bus;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_shared<OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+    bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 2, sampleRate);
+  }
+
+  std::shared_ptr<ConstantSourceNode> createSource(
+      const std::shared_ptr<MixerNode> &mixer,
+      int input,
+      float offset) {
+    auto source = context->createConstantSource();
+    source->getOffsetParam()->setValue(offset);
+    source->start(0.0);
+    source->connect(mixer, input);
+    return source;
+  }
+
+  std::shared_ptr<AudioBus> render(const std::shared_ptr<MixerNode> &mixer) {
+    context->getNodeManager()->preProcessGraph();
+    return mixer->processAudio(bus, RENDER_QUANTUM_SIZE, false);
+  }
+};
+
+TEST_F(MixerTest, MixerCanBeCreated) {
+  auto mixer = context->createMixer(4, 2);
+  ASSERT_NE(mixer, nullptr);
+  EXPECT_EQ(mixer->getNumberOfInputs(), 4);
+  EXPECT_THROW(mixer->getGainParam(4), std::out_of_range);
+}
+
+TEST_F(MixerTest, AppliesGainOfEachInput) {
+  auto mixer = context->createMixer(2, 2);
+  auto first = createSource(mixer, 0, 1.0f);
+  auto second = createSource(mixer, 1, 1.0f);
+  mixer->getGainParam(0)->setValue(0.5f);
+  mixer->getGainParam(1)->setValue(0.25f);
+
+  auto result = render(mixer);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_NEAR((*result->getChannel(0))[i], 0.75f, 1e-6f);
+    EXPECT_NEAR((*result->getChannel(1))[i], 0.75f, 1e-6f);
+  }
+}
+
+TEST_F(MixerTest, PansEachInputIndependently) {
+  auto mixer = context->createMixer(2, 2);
+  auto left = createSource(mixer, 0, 1.0f);
+  auto right = createSource(mixer, 1, 0.5f);
+  mixer->getPanParam(0)->setValue(-1.0f);
+  mixer->getPanParam(1)->setValue(1.0f);
+
+  auto result = render(mixer);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    // a stereo input panned hard to one side folds the other channel into it
+    EXPECT_NEAR((*result->getChannel(0))[i], 2.0f, 1e-6f);
+    EXPECT_NEAR((*result->getChannel(1))[i], 1.0f, 1e-6f);
+  }
+}
+
+TEST_F(MixerTest, FadesOutMutedInput) {
+  auto mixer = context->createMixer(1, 2);
+  auto source = createSource(mixer, 0, 1.0f);
+  render(mixer);
+
+  mixer->setMuted(0, true);
+  auto result = render(mixer);
+  auto &channel = *result->getChannel(0);
+  EXPECT_GT(channel[0], 0.9f);
+  EXPECT_NEAR(channel[RENDER_QUANTUM_SIZE - 1], 0.0f, 1e-6f);
+  for (size_t i = 1; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_LE(channel[i], channel[i - 1]);
+  }
+
+  result = render(mixer);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], 0.0f);
+  }
+}
+
+TEST_F(MixerTest, FeedsOneSourceToSeveralInputs) {
+  auto mixer = context->createMixer(2, 2);
+  auto source = createSource(mixer, 0, 1.0f);
+  source->connect(mixer, 1);
+  mixer->getGainParam(0)->setValue(0.5f);
+  mixer->getGainParam(1)->setValue(0.25f);
+
+  auto result = render(mixer);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_NEAR((*result->getChannel(0))[i], 0.75f, 1e-6f);
+    EXPECT_NEAR((*result->getChannel(1))[i], 0.75f, 1e-6f);
+  }
+
+  source->disconnect(mixer, 1);
+  result = render(mixer);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_NEAR((*result->getChannel(0))[i], 0.5f, 1e-6f);
+    EXPECT_NEAR((*result->getChannel(1))[i], 0.5f, 1e-6f);
+  }
+
+  source->disconnect(mixer);
+  result = render(mixer);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], 0.0f);
+  }
+}
+
+TEST_F(MixerTest, RejectsInvalidInput) {
+  auto mixer = context->createMixer(2, 2);
+  auto source = context->createConstantSource();
+  EXPECT_THROW(source->connect(mixer, 2), std::out_of_range);
+  EXPECT_THROW(source->connect(mixer, -1), std::out_of_range);
+  EXPECT_THROW(source->disconnect(mixer, 2), std::out_of_range);
+}
@@ -10,6 +10,10 @@ using namespace audioapi;
 
 using EventMap = std::unordered_map<std::string, EventValue>;
 
+MATCHER_P2(IsAudioEvent, type, listenerId, "") {
+  return arg.type == type && arg.listenerId == listenerId;
+}
+
 class MockAudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
  public:
   MOCK_METHOD(
@@ -29,4 +33,5 @@ class MockAudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
   MOCK_METHOD3(
       invokeHandlerWithEventBody,
       void(const std::string &eventName, uint64_t listenerId, const EventMap &body));
+  MOCK_METHOD(bool, dispatchAudioEvent, (const AudioEvent &event), (override));
 };
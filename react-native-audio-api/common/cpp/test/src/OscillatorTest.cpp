@@ -3,7 +3,10 @@
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
 #include <gtest/gtest.h>
 #include <test/src/MockAudioEventHandlerRegistry.h>
+#include <cmath>
 #include <memory>
+#include <string>
+#include <vector>
 
 using namespace audioapi;
 
@@ -20,7 +23,125 @@ class OscillatorTest : public ::testing::Test {
   }
 };
 
+class TestableOscillatorNode : public OscillatorNode {
+ public:
+  explicit TestableOscillatorNode(std::shared_ptr<BaseAudioContext> context)
+      : OscillatorNode(context) {}
+
+  std::vector<float> renderConstant(size_t frames, float frequency) {
+    std::vector<float> output(frames);
+    processConstantFrequency(output.data(), frames, frequency);
+    return output;
+  }
+
+  std::vector<float> renderAutomated(size_t frames, float frequency) {
+    std::vector<float> output(frames);
+    std::vector<float> frequencyValues(frames, frequency);
+    std::vector<float> detuneValues(frames, 0.0f);
+    processAutomatedFrequency(output.data(), frequencyValues.data(), detuneValues.data(), frames);
+    return output;
+  }
+};
+
 TEST_F(OscillatorTest, OscillatorCanBeCreated) {
   auto osc = context->createOscillator();
   ASSERT_NE(osc, nullptr);
 }
+
+TEST_F(OscillatorTest, OscillatorModeCanBeChanged) {
+  auto osc = context->createOscillator();
+  EXPECT_EQ(osc->getMode(), "wavetable");
+
+  osc->setMode("polyblep");
+  EXPECT_EQ(osc->getMode(), "polyblep");
+
+  EXPECT_THROW(osc->setMode("unknown"), std::invalid_argument);
+}
+
+TEST_F(OscillatorTest, BlockPathMatchesPerSamplePath) {
+  static constexpr size_t FRAMES = 4 * 128;
+  static constexpr float frequency = 440.0f;
+
+  for (const auto *mode : {"wavetable", "polyblep"}) {
+    for (const auto *type : {"sine", "square", "sawtooth", "triangle"}) {
+      SCOPED_TRACE(std::string(mode) + " " + type);
+      auto block = TestableOscillatorNode(context);
+      auto perSample = TestableOscillatorNode(context);
+      for (auto *osc : {&block, &perSample}) {
+        osc->setType(type);
+        osc->setMode(mode);
+      }
+
+      // rendered in quanta, so the phase carried between blocks is covered too
+      std::vector<float> blockOutput;
+      std::vector<float> perSampleOutput;
+      for (size_t i = 0; i < FRAMES; i += 128) {
+        auto blockQuantum = block.renderConstant(128, frequency);
+        auto perSampleQuantum = perSample.renderAutomated(128, frequency);
+        blockOutput.insert(blockOutput.end(), blockQuantum.begin(), blockQuantum.end());
+        perSampleOutput.insert(
+            perSampleOutput.end(), perSampleQuantum.begin(), perSampleQuantum.end());
+      }
+
+      for (size_t i = 0; i < FRAMES; i += 1) {
+        EXPECT_NEAR(blockOutput[i], perSampleOutput[i], 1e-3f) << "frame " << i;
+      }
+    }
+  }
+}
+
+TEST_F(OscillatorTest, PolyBlepSquareHasExpectedShape) {
+  // a period of exactly 441 frames, the falling edge is at 220.5
+  static constexpr size_t PERIOD = 441;
+  auto osc = TestableOscillatorNode(context);
+  osc.setType("square");
+  osc.setMode("polyblep");
+
+  auto output = osc.renderConstant(2 * PERIOD, static_cast<float>(sampleRate) / PERIOD);
+
+  for (size_t i = 0; i < 2 * PERIOD; i += 1) {
+    auto phase = static_cast<float>(i % PERIOD) / PERIOD;
+    auto edgeDistance = std::min(
+        {std::fabs(phase - 0.5f), std::fabs(phase), std::fabs(1.0f - phase)});
+
+    if (edgeDistance > 2.0f / PERIOD) {
+      EXPECT_NEAR(output[i], phase < 0.5f ? 1.0f : -1.0f, 1e-4f) << "frame " << i;
+    } else {
+      // the band-limited edge never overshoots
+      EXPECT_LE(std::fabs(output[i]), 1.0f) << "frame " << i;
+    }
+  }
+
+  // the edges are smoothed over the samples next to them
+  EXPECT_GT(output[220], -1.0f);
+  EXPECT_LT(output[220], 1.0f);
+  EXPECT_GT(output[221], -1.0f);
+  EXPECT_LT(output[221], 1.0f);
+  EXPECT_GT(output[220], output[221]);
+}
+
+TEST_F(OscillatorTest, PolyBlepSawtoothHasExpectedShape) {
+  // a period of exactly 441 frames, the falling edge is at 220.5
+  static constexpr size_t PERIOD = 441;
+  auto osc = TestableOscillatorNode(context);
+  osc.setType("sawtooth");
+  osc.setMode("polyblep");
+
+  auto output = osc.renderConstant(2 * PERIOD, static_cast<float>(sampleRate) / PERIOD);
+
+  for (size_t i = 0; i < 2 * PERIOD; i += 1) {
+    auto phase = static_cast<float>(i % PERIOD) / PERIOD;
+
+    if (std::fabs(phase - 0.5f) > 2.0f / PERIOD) {
+      // starts at 0 and rises linearly, wrapping from 1 to -1 in the middle of the period
+      auto shiftedPhase = phase + 0.5f - std::floor(phase + 0.5f);
+      EXPECT_NEAR(output[i], 2.0f * shiftedPhase - 1.0f, 1e-4f) << "frame " << i;
+    } else {
+      EXPECT_LE(std::fabs(output[i]), 1.0f) << "frame " << i;
+    }
+  }
+
+  EXPECT_GT(output[220], output[221]);
+  EXPECT_LT(output[220], 1.0f);
+  EXPECT_GT(output[221], -1.0f);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <audioapi/core/utils/PcmStorage.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace test {
+
+/// Mono 16-bit storage which records the frames it is asked to prefetch.
+class PrefetchRecordingStorage : public audioapi::PcmStorage {
+ public:
+  using Range = std::pair<size_t, size_t>;
+
+  PrefetchRecordingStorage(std::vector<int16_t> samples, float sampleRate)
+      : PcmStorage(
+            reinterpret_cast<const uint8_t *>(samples.data()),
+            audioapi::PcmSampleFormat::INT16,
+            1,
+            sampleRate,
+            samples.size(),
+            sizeof(int16_t),
+            sizeof(int16_t)),
+        samples_(std::move(samples)) {}
+
+  [[nodiscard]] size_t getAllocatedSizeInBytes() const override {
+    return samples_.size() * sizeof(int16_t);
+  }
+
+  void prefetch(size_t start, size_t frames) const override {
+    std::lock_guard lock(mutex_);
+    ranges_.emplace_back(start, frames);
+    condition_.notify_all();
+  }
+
+  /// Waits until count prefetches were made, from any thread.
+  [[nodiscard]] std::vector<Range> waitForPrefetches(size_t count) const {
+    std::unique_lock lock(mutex_);
+    condition_.wait_for(lock, std::chrono::seconds(5), [&] { return ranges_.size() >= count; });
+    return ranges_;
+  }
+
+ private:
+  // moving the vector keeps its data where the base class points to
+  std::vector<int16_t> samples_;
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  mutable std::vector<Range> ranges_;
+};
+
+} // namespace test
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace test {
+
+inline void appendUint16(std::vector<uint8_t> &bytes, uint16_t value) {
+  bytes.push_back(static_cast<uint8_t>(value));
+  bytes.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+inline void appendUint32(std::vector<uint8_t> &bytes, uint32_t value) {
+  appendUint16(bytes, static_cast<uint16_t>(value));
+  appendUint16(bytes, static_cast<uint16_t>(value >> 16));
+}
+
+/// Writes a canonical WAV file holding already encoded interleaved samples.
+inline void writeWavFile(
+    const std::string &path,
+    uint16_t formatTag,
+    uint16_t numberOfChannels,
+    uint32_t sampleRate,
+    uint16_t bitsPerSample,
+    const std::vector<uint8_t> &samples) {
+  std::vector<uint8_t> bytes;
+  uint16_t blockAlign = numberOfChannels * bitsPerSample / 8;
+
+  bytes.insert(bytes.end(), {'R', 'I', 'F', 'F'});
+  appendUint32(bytes, static_cast<uint32_t>(36 + samples.size()));
+  bytes.insert(bytes.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+  appendUint32(bytes, 16);
+  appendUint16(bytes, formatTag);
+  appendUint16(bytes, numberOfChannels);
+  appendUint32(bytes, sampleRate);
+  appendUint32(bytes, sampleRate * blockAlign);
+  appendUint16(bytes, blockAlign);
+  appendUint16(bytes, bitsPerSample);
+  bytes.insert(bytes.end(), {'d', 'a', 't', 'a'});
+  appendUint32(bytes, static_cast<uint32_t>(samples.size()));
+  bytes.insert(bytes.end(), samples.begin(), samples.end());
+
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+/// Encodes samples as little-endian 16-bit integers.
+inline std::vector<uint8_t> encodeInt16(const std::vector<int16_t> &samples) {
+  std::vector<uint8_t> bytes;
+  for (auto sample : samples) {
+    appendUint16(bytes, static_cast<uint16_t>(sample));
+  }
+  return bytes;
+}
+
+} // namespace test
@@ -0,0 +1,297 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/effects/GainNode.h>
+#include <audioapi/core/effects/StereoPannerNode.h>
+#include <audioapi/core/sources/AudioBufferSourceNode.h>
+#include <audioapi/core/sources/ConstantSourceNode.h>
+#include <audioapi/core/sources/OscillatorNode.h>
+#include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace audioapi;
+
+class AudioNodeManagerTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_shared<OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+  }
+
+  std::shared_ptr<ConstantSourceNode> createStartedSource() {
+    auto source = context->createConstantSource();
+    source->start(0.0);
+    return source;
+  }
+
+  // renders the node after applying pending graph changes, a connected source makes it audible
+  float renderFirstSample(const std::shared_ptr<AudioNode> &node) {
+    context->getNodeManager()->preProcessGraph();
+    auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 2, sampleRate);
+    return (*node->processAudio(bus, RENDER_QUANTUM_SIZE, false)->getChannel(0))[0];
+  }
+
+  // nodes are destroyed on the destructor thread, so it is given a moment to catch up
+  bool isDestroyed(const std::weak_ptr<AudioNode> &node) {
+    for (int i = 0; i < 100 && !node.expired(); i += 1) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      context->getNodeManager()->preProcessGraph();
+    }
+    return node.expired();
+  }
+};
+
+TEST_F(AudioNodeManagerTest, AppliesTransactionAtOnce) {
+  auto source = createStartedSource();
+  auto gain = context->createGain();
+
+  context->getNodeManager()->beginTransaction();
+  source->connect(gain);
+
+  // nothing is applied before the commit
+  EXPECT_FLOAT_EQ(renderFirstSample(gain), 0.0f);
+
+  context->getNodeManager()->commitTransaction();
+  EXPECT_FLOAT_EQ(renderFirstSample(gain), 1.0f);
+}
+
+TEST_F(AudioNodeManagerTest, AppliesNestedTransactionsWithOutermostCommit) {
+  auto source = createStartedSource();
+  auto gain = context->createGain();
+
+  context->getNodeManager()->beginTransaction();
+  context->getNodeManager()->beginTransaction();
+  source->connect(gain);
+  context->getNodeManager()->commitTransaction();
+  EXPECT_FLOAT_EQ(renderFirstSample(gain), 0.0f);
+
+  source->disconnect(gain);
+  source->connect(gain);
+  context->getNodeManager()->commitTransaction();
+  EXPECT_FLOAT_EQ(renderFirstSample(gain), 1.0f);
+
+  // an unmatched commit is ignored and changes are sent right away again
+  context->getNodeManager()->commitTransaction();
+  source->disconnect(gain);
+  EXPECT_FLOAT_EQ(renderFirstSample(gain), 0.0f);
+}
+
+TEST_F(AudioNodeManagerTest, MovesEventPayloadBetweenPayloadTypes) {
+  using Event = AudioNodeManager::Event;
+  using EventPayloadType = AudioNodeManager::EventPayloadType;
+
+  auto from = context->createGain();
+  auto to = context->createGain();
+  auto fromUseCount = from.use_count();
+  AudioNodeManager::ChangeSet changeSet;
+
+  Event nodesEvent;
+  nodesEvent.payloadType = EventPayloadType::NODES;
+  nodesEvent.payload.nodes.from = from;
+  nodesEvent.payload.nodes.to = to;
+
+  Event movedNodesEvent(std::move(nodesEvent));
+  EXPECT_EQ(movedNodesEvent.payloadType, EventPayloadType::NODES);
+  EXPECT_EQ(movedNodesEvent.payload.nodes.from, from);
+  EXPECT_EQ(movedNodesEvent.payload.nodes.to, to);
+  EXPECT_EQ(nodesEvent.payload.nodes.from, nullptr);
+  EXPECT_EQ(from.use_count(), fromUseCount + 1);
+
+  Event changeSetEvent;
+  changeSetEvent.type = AudioNodeManager::ConnectionType::APPLY_CHANGE_SET;
+  changeSetEvent.payloadType = EventPayloadType::CHANGE_SET;
+  changeSetEvent.payload.changeSet = &changeSet;
+
+  // the nodes are released when the change set replaces them
+  movedNodesEvent = std::move(changeSetEvent);
+  EXPECT_EQ(movedNodesEvent.payloadType, EventPayloadType::CHANGE_SET);
+  EXPECT_EQ(movedNodesEvent.payload.changeSet, &changeSet);
+  EXPECT_EQ(from.use_count(), fromUseCount);
+
+  // and constructed in place when they replace the change set
+  Event otherNodesEvent;
+  otherNodesEvent.payloadType = EventPayloadType::NODES;
+  otherNodesEvent.payload.nodes.from = to;
+  otherNodesEvent.payload.nodes.to = from;
+  movedNodesEvent = std::move(otherNodesEvent);
+  EXPECT_EQ(movedNodesEvent.payloadType, EventPayloadType::NODES);
+  EXPECT_EQ(movedNodesEvent.payload.nodes.from, to);
+  EXPECT_EQ(movedNodesEvent.payload.nodes.to, from);
+  EXPECT_EQ(from.use_count(), fromUseCount + 1);
+}
+
+TEST_F(AudioNodeManagerTest, ReclaimsReleasedChainOfNodes) {
+  auto gain = context->createGain();
+  auto panner = context->createStereoPanner();
+  gain->connect(panner);
+  panner->connect(context->getDestination());
+  context->getNodeManager()->preProcessGraph();
+
+  std::weak_ptr<AudioNode> weakGain = gain;
+  std::weak_ptr<AudioNode> weakPanner = panner;
+  // the panner stays connected to the destination, but nothing feeds it once the gain is gone
+  panner->release();
+  panner.reset();
+  gain->release();
+  gain.reset();
+
+  EXPECT_TRUE(isDestroyed(weakGain));
+  EXPECT_TRUE(isDestroyed(weakPanner));
+}
+
+TEST_F(AudioNodeManagerTest, KeepsNodesReferencedByTheGraph) {
+  auto gain = context->createGain();
+  auto panner = context->createStereoPanner();
+  gain->connect(panner);
+  context->getNodeManager()->preProcessGraph();
+
+  std::weak_ptr<AudioNode> weakPanner = panner;
+  panner->release();
+  panner.reset();
+
+  EXPECT_FALSE(isDestroyed(weakPanner));
+
+  gain->disconnect();
+  EXPECT_TRUE(isDestroyed(weakPanner));
+}
+
+TEST_F(AudioNodeManagerTest, KeepsNodesOfUncommittedTransaction) {
+  auto gain = context->createGain();
+  auto panner = context->createStereoPanner();
+  context->getNodeManager()->preProcessGraph();
+
+  std::weak_ptr<AudioNode> weakPanner = panner;
+  context->getNodeManager()->beginTransaction();
+  gain->connect(panner);
+  panner->release();
+  panner.reset();
+
+  // nothing is applied before the commit, so the panner is only kept alive by the change set
+  context->getNodeManager()->preProcessGraph();
+  EXPECT_FALSE(weakPanner.expired());
+
+  context->getNodeManager()->commitTransaction();
+  EXPECT_FALSE(isDestroyed(weakPanner));
+
+  gain->disconnect();
+  EXPECT_TRUE(isDestroyed(weakPanner));
+}
+
+TEST_F(AudioNodeManagerTest, RecyclesReleasedOscillator) {
+  auto oscillator = context->createOscillator();
+  auto *recycledNode = oscillator.get();
+  oscillator->getFrequencyParam()->setValue(100.0f);
+  oscillator->setType("square");
+  context->getNodeManager()->preProcessGraph();
+
+  oscillator->release();
+  oscillator.reset();
+  context->getNodeManager()->preProcessGraph();
+
+  // the node is reset to its defaults instead of being destroyed
+  oscillator = context->createOscillator();
+  EXPECT_EQ(oscillator.get(), recycledNode);
+  EXPECT_FLOAT_EQ(oscillator->getFrequencyParam()->getValue(), 444.0f);
+  EXPECT_EQ(oscillator->getType(), "sine");
+  EXPECT_TRUE(oscillator->isUnscheduled());
+}
+
+TEST_F(AudioNodeManagerTest, DoesNotRecycleNodesWithReferencedParams) {
+  auto bufferSource = context->createBufferSource(false);
+  auto playbackRate = bufferSource->getPlaybackRateParam();
+  std::weak_ptr<AudioNode> weakBufferSource = bufferSource;
+  context->getNodeManager()->preProcessGraph();
+
+  bufferSource->release();
+  bufferSource.reset();
+
+  EXPECT_TRUE(isDestroyed(weakBufferSource));
+  EXPECT_EQ(context->getNodeManager()->getNodePool()->getBufferSourceCount(), 0);
+}
+
+TEST_F(AudioNodeManagerTest, DoesNotRecycleNodesConnectedToParams) {
+  auto oscillator = context->createOscillator();
+  auto gain = context->createGain();
+  std::weak_ptr<AudioNode> weakOscillator = oscillator;
+  oscillator->connect(gain->getGainParam());
+  context->getNodeManager()->preProcessGraph();
+
+  oscillator->release();
+  oscillator.reset();
+
+  // the gain param still points at the oscillator, so it must not come back from the pool
+  EXPECT_TRUE(isDestroyed(weakOscillator));
+  EXPECT_EQ(context->getNodeManager()->getNodePool()->getOscillatorCount(), 0);
+}
+
+TEST_F(AudioNodeManagerTest, PrewarmedNodesAreReused) {
+  context->prewarmBufferSources(3);
+  auto *nodePool = context->getNodeManager()->getNodePool();
+  EXPECT_EQ(nodePool->getBufferSourceCount(), 3);
+
+  auto bufferSource = context->createBufferSource(false);
+  EXPECT_EQ(nodePool->getBufferSourceCount(), 2);
+
+  // pitch corrected sources are never pooled
+  auto pitchCorrectedSource = context->createBufferSource(true);
+  EXPECT_EQ(nodePool->getBufferSourceCount(), 2);
+
+  context->prewarmBufferSources(2 * AudioNodePool::getCapacity());
+  EXPECT_EQ(nodePool->getBufferSourceCount(), AudioNodePool::getCapacity());
+}
+
+TEST_F(AudioNodeManagerTest, ReleasesNodesWithoutWaitingForAudioThread) {
+  // more releases than the event channel holds, while the graph is not rendered
+  constexpr size_t nodeCount = 1500;
+  std::vector<std::shared_ptr<GainNode>> nodes;
+  std::vector<std::weak_ptr<AudioNode>> weakNodes;
+
+  for (size_t i = 0; i < nodeCount; i += 1) {
+    nodes.push_back(context->createGain());
+    weakNodes.push_back(nodes.back());
+    if (i % 500 == 0) {
+      context->getNodeManager()->preProcessGraph();
+    }
+  }
+  context->getNodeManager()->preProcessGraph();
+
+  for (auto &node : nodes) {
+    node->release();
+  }
+  nodes.clear();
+
+  // releases which did not fit are reclaimed by the sweep
+  for (auto &weakNode : weakNodes) {
+    EXPECT_TRUE(isDestroyed(weakNode));
+  }
+}
+
+TEST_F(AudioNodeManagerTest, CleanupDropsPendingEvents) {
+  auto gain = context->createGain();
+  auto panner = context->createStereoPanner();
+  std::weak_ptr<AudioNode> weakGain = gain;
+  std::weak_ptr<AudioNode> weakPanner = panner;
+
+  gain->connect(panner);
+  gain.reset();
+  panner.reset();
+
+  context->getNodeManager()->cleanup();
+  EXPECT_TRUE(weakGain.expired());
+  EXPECT_TRUE(weakPanner.expired());
+}
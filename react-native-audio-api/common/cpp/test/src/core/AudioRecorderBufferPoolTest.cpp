@@ -0,0 +1,148 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/AudioRecorderBufferPool.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/SpscAudioRing.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+using ::testing::_;
+using ::testing::Return;
+
+MATCHER_P3(IsAudioReadyEvent, batch, chunkCount, numFrames, "") {
+  return arg.type == AudioEventType::AUDIO_READY && arg.listenerId == 7 && arg.batch == batch &&
+      arg.chunkCount == chunkCount && arg.numFrames == numFrames;
+}
+
+class AudioRecorderBufferPoolTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 8000;
+  static constexpr size_t bufferLength = 4;
+  static constexpr int channelCount = 2;
+  static constexpr size_t batchSize = 2;
+
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<AudioRecorderBufferPool> pool;
+  std::unique_ptr<SpscAudioRing> ring;
+  float nextSample = 1.0f;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    pool = std::make_unique<AudioRecorderBufferPool>(
+        eventRegistry, sampleRate, bufferLength, channelCount, 7, batchSize);
+    ring = std::make_unique<SpscAudioRing>(64, channelCount, sampleRate);
+  }
+
+  // writes an increasing ramp, the second channel is negated
+  void record(size_t frames) {
+    std::vector<float> left(frames);
+    std::vector<float> right(frames);
+    for (size_t i = 0; i < frames; i++) {
+      left[i] = nextSample;
+      right[i] = -nextSample;
+      nextSample += 1.0f;
+    }
+
+    const float *data[] = {left.data(), right.data()};
+    ring->write(data, frames);
+  }
+
+  [[nodiscard]] const float *getChannelData(size_t buffer, int channel) const {
+    return pool->getBuffers()[buffer]->getChannelData(channel);
+  }
+};
+
+TEST_F(AudioRecorderBufferPoolTest, AllocatesEveryBatchUpFront) {
+  ASSERT_EQ(pool->getBuffers().size(), AudioRecorderBufferPool::BATCH_POOL_SIZE * batchSize);
+
+  for (const auto &buffer : pool->getBuffers()) {
+    EXPECT_EQ(buffer->getNumberOfChannels(), channelCount);
+    EXPECT_EQ(buffer->getLength(), bufferLength);
+  }
+}
+
+TEST_F(AudioRecorderBufferPoolTest, DispatchesCompleteBatches) {
+  EXPECT_CALL(*eventRegistry, dispatchAudioEvent(IsAudioReadyEvent(0u, 2u, 4u)))
+      .WillOnce(Return(true));
+
+  // a single chunk does not complete the batch
+  record(bufferLength);
+  pool->emit(*ring, false);
+  record(bufferLength + 1);
+  pool->emit(*ring, false);
+
+  EXPECT_EQ(ring->getAvailableFrames(), 1);
+  for (size_t i = 0; i < bufferLength; i++) {
+    EXPECT_FLOAT_EQ(getChannelData(0, 0)[i], 1.0f + i);
+    EXPECT_FLOAT_EQ(getChannelData(0, 1)[i], -1.0f - i);
+    EXPECT_FLOAT_EQ(getChannelData(1, 0)[i], 5.0f + i);
+  }
+}
+
+TEST_F(AudioRecorderBufferPoolTest, FlushDispatchesIncompleteBatch) {
+  EXPECT_CALL(*eventRegistry, dispatchAudioEvent(IsAudioReadyEvent(0u, 1u, 3u)))
+      .WillOnce(Return(true));
+
+  record(3);
+  pool->emit(*ring, true);
+
+  EXPECT_EQ(ring->getAvailableFrames(), 0);
+  EXPECT_FLOAT_EQ(getChannelData(0, 0)[2], 3.0f);
+  EXPECT_FLOAT_EQ(getChannelData(0, 0)[3], 0.0f);
+}
+
+TEST_F(AudioRecorderBufferPoolTest, WaitsUntilBatchIsReleased) {
+  EXPECT_CALL(*eventRegistry, dispatchAudioEvent(_)).WillRepeatedly(Return(true));
+
+  record(AudioRecorderBufferPool::BATCH_POOL_SIZE * batchSize * bufferLength + bufferLength);
+  pool->emit(*ring, false);
+
+  // JS holds every batch, so the last chunk stays in the ring
+  EXPECT_EQ(ring->getAvailableFrames(), bufferLength);
+
+  pool->releaseBatch(2);
+  EXPECT_CALL(*eventRegistry, dispatchAudioEvent(IsAudioReadyEvent(2u, 2u, 4u)))
+      .WillOnce(Return(true));
+  record(bufferLength);
+  pool->emit(*ring, false);
+
+  EXPECT_EQ(ring->getAvailableFrames(), 0);
+  EXPECT_FLOAT_EQ(getChannelData(2 * batchSize, 0)[0], 33.0f);
+}
+
+TEST_F(AudioRecorderBufferPoolTest, RefillsBatchWhenEventIsDropped) {
+  {
+    ::testing::InSequence sequence;
+    EXPECT_CALL(*eventRegistry, dispatchAudioEvent(IsAudioReadyEvent(0u, 2u, 4u)))
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*eventRegistry, dispatchAudioEvent(IsAudioReadyEvent(1u, 2u, 4u)))
+        .WillOnce(Return(true));
+  }
+
+  // JS never releases a batch it was not told about
+  record(3 * batchSize * bufferLength);
+  pool->emit(*ring, false);
+
+  EXPECT_FLOAT_EQ(getChannelData(0, 0)[0], 9.0f);
+  EXPECT_FLOAT_EQ(getChannelData(batchSize, 0)[0], 17.0f);
+}
+
+TEST_F(AudioRecorderBufferPoolTest, WritesThroughChannelDataExposedToJs) {
+  EXPECT_CALL(*eventRegistry, dispatchAudioEvent(_)).WillRepeatedly(Return(true));
+
+  // e.g. a Float32Array returned by getChannelData in JS
+  auto exposedChannel = pool->getBuffers()[0]->getSharedChannel(0);
+  auto bus = pool->getBuffers()[0]->acquireBus();
+
+  record(batchSize * bufferLength);
+  pool->emit(*ring, false);
+
+  EXPECT_FLOAT_EQ(exposedChannel->getData()[0], 1.0f);
+  EXPECT_EQ(exposedChannel->getData(), getChannelData(0, 0));
+  // source nodes read a snapshot, which is not written to
+  EXPECT_FLOAT_EQ(bus->getChannel(0)->getData()[0], 0.0f);
+}
@@ -0,0 +1,96 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/AudioStretcher.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+class AudioStretcherTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 16000.0f;
+  static constexpr float frequency = 440.0f;
+
+  static std::shared_ptr<AudioBuffer> createSine(size_t length, int numberOfChannels) {
+    auto buffer = std::make_shared<AudioBuffer>(numberOfChannels, length, sampleRate);
+    std::vector<float> data(length);
+    for (size_t i = 0; i < length; i += 1) {
+      data[i] = 0.5f * std::sin(2.0f * PI * frequency * static_cast<float>(i) / sampleRate);
+    }
+    for (int ch = 0; ch < numberOfChannels; ch += 1) {
+      buffer->copyToChannel(data.data(), length, ch, 0);
+    }
+    return buffer;
+  }
+
+  static float rms(const float *data, size_t length) {
+    double sum = 0.0;
+    for (size_t i = 0; i < length; i += 1) {
+      sum += data[i] * data[i];
+    }
+    return static_cast<float>(std::sqrt(sum / static_cast<double>(length)));
+  }
+
+  static float largestStep(const float *data, size_t length) {
+    float step = 0.0f;
+    for (size_t i = 1; i < length; i += 1) {
+      step = std::max(step, std::abs(data[i] - data[i - 1]));
+    }
+    return step;
+  }
+};
+
+TEST_F(AudioStretcherTest, RejectsInvalidSpeed) {
+  auto buffer = createSine(1000, 1);
+  EXPECT_EQ(AudioStretcher::changePlaybackSpeed(*buffer, 0.0f), nullptr);
+  EXPECT_EQ(AudioStretcher::changePlaybackSpeed(*buffer, -1.0f), nullptr);
+}
+
+TEST_F(AudioStretcherTest, TdhsKeepsChannelsInLockstep) {
+  auto buffer = createSine(static_cast<size_t>(sampleRate), 2);
+  std::vector<float> reported;
+
+  auto result = AudioStretcher::changePlaybackSpeed(
+      *buffer, 2.0f, StretchAlgorithm::TDHS, [&](float progress) { reported.push_back(progress); });
+  ASSERT_NE(result, nullptr);
+  EXPECT_NEAR(static_cast<float>(result->getLength()), sampleRate / 2.0f, sampleRate * 0.02f);
+
+  for (size_t i = 0; i < result->getLength(); i += 1) {
+    ASSERT_NEAR(result->getChannelData(0)[i], result->getChannelData(1)[i], 1e-3f);
+  }
+
+  ASSERT_FALSE(reported.empty());
+  EXPECT_FLOAT_EQ(reported.back(), 1.0f);
+  for (size_t i = 1; i < reported.size(); i += 1) {
+    EXPECT_GT(reported[i], reported[i - 1]);
+  }
+}
+
+TEST_F(AudioStretcherTest, SignalsmithStitchesSegmentsSmoothly) {
+  // long enough to be split into several segments
+  auto length = static_cast<size_t>(12 * sampleRate);
+  auto buffer = createSine(length, 1);
+  float lastProgress = 0.0f;
+
+  auto result = AudioStretcher::changePlaybackSpeed(
+      *buffer, 0.5f, StretchAlgorithm::SIGNALSMITH, [&](float progress) {
+        EXPECT_GT(progress, lastProgress);
+        lastProgress = progress;
+      });
+  ASSERT_NE(result, nullptr);
+  EXPECT_EQ(result->getLength(), 2 * length);
+  EXPECT_FLOAT_EQ(lastProgress, 1.0f);
+
+  // skips the fade in and out at both ends of the buffer
+  auto data = result->getChannelData(0) + static_cast<size_t>(sampleRate);
+  auto steadyLength = result->getLength() - 2 * static_cast<size_t>(sampleRate);
+  EXPECT_NEAR(rms(data, steadyLength), 0.5f / std::sqrt(2.0f), 0.05f);
+
+  // a 440 Hz sine of 0.5 amplitude never moves by more than ~0.09 per frame
+  EXPECT_LT(largestStep(data, steadyLength), 0.12f);
+}
@@ -0,0 +1,78 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/CompactPcmStorage.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+class CompactPcmStorageTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 44100.0f;
+
+  static std::shared_ptr<AudioBus> createBus(const std::vector<float> &samples) {
+    auto bus = std::make_shared<AudioBus>(samples.size(), 2, sampleRate);
+    for (size_t i = 0; i < samples.size(); i += 1) {
+      bus->getChannel(0)->getData()[i] = samples[i];
+      bus->getChannel(1)->getData()[i] = -samples[i];
+    }
+    return bus;
+  }
+};
+
+TEST_F(CompactPcmStorageTest, Int16RoundsAndClips) {
+  auto bus = createBus({0.0f, 0.5f, 1.0f, -1.5f, 0.25f / 32768.0f});
+  auto storage = CompactPcmStorage::create(*bus, PcmSampleFormat::INT16);
+  EXPECT_EQ(storage->getAllocatedSizeInBytes(), 5 * 2 * sizeof(int16_t));
+
+  std::vector<float> samples(5);
+  storage->read(0, 0, 5, samples.data());
+  EXPECT_FLOAT_EQ(samples[0], 0.0f);
+  EXPECT_FLOAT_EQ(samples[1], 0.5f);
+  EXPECT_FLOAT_EQ(samples[2], 32767.0f / 32768.0f);
+  EXPECT_FLOAT_EQ(samples[3], -1.0f);
+  EXPECT_FLOAT_EQ(samples[4], 0.0f);
+
+  storage->read(1, 1, 2, samples.data());
+  EXPECT_FLOAT_EQ(samples[0], -0.5f);
+  EXPECT_FLOAT_EQ(samples[1], -1.0f);
+}
+
+TEST_F(CompactPcmStorageTest, HalfFloatKeepsRepresentableValues) {
+  auto infinity = std::numeric_limits<float>::infinity();
+  auto bus = createBus({0.5f, -0.375f, 0x1.0p-20f, 65504.0f, 70000.0f, 1.0f + 0x1.0p-12f});
+  auto storage = CompactPcmStorage::create(*bus, PcmSampleFormat::FLOAT16);
+
+  std::vector<float> samples(6);
+  storage->read(0, 0, 6, samples.data());
+  EXPECT_FLOAT_EQ(samples[0], 0.5f);
+  EXPECT_FLOAT_EQ(samples[1], -0.375f);
+  // subnormal half
+  EXPECT_FLOAT_EQ(samples[2], 0x1.0p-20f);
+  EXPECT_FLOAT_EQ(samples[3], 65504.0f);
+  EXPECT_EQ(samples[4], infinity);
+  // halfway between two halves, rounded to the even one
+  EXPECT_FLOAT_EQ(samples[5], 1.0f);
+
+  storage->read(1, 4, 1, samples.data());
+  EXPECT_EQ(samples[0], -infinity);
+}
+
+TEST_F(CompactPcmStorageTest, CompactBufferIsExpandedForChannelData) {
+  auto buffer = std::make_shared<AudioBuffer>(createBus({0.5f, 0.25f, -0.125f}));
+  buffer->compact(PcmSampleFormat::FLOAT16);
+  ASSERT_NE(buffer->getPcmStorage(), nullptr);
+  EXPECT_EQ(buffer->getLength(), 3);
+  EXPECT_EQ(buffer->getNumberOfChannels(), 2);
+
+  float sample;
+  buffer->copyFromChannel(&sample, 1, 1, 2);
+  EXPECT_FLOAT_EQ(sample, 0.125f);
+
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[1], 0.25f);
+  EXPECT_EQ(buffer->getPcmStorage(), nullptr);
+}
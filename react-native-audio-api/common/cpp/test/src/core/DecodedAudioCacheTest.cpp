@@ -0,0 +1,166 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/DecodedAudioCache.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+class DecodedAudioCacheTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 44100.0f;
+  static constexpr size_t bufferLength = 1000;
+  static constexpr size_t bufferSize = bufferLength * sizeof(float);
+  std::vector<std::string> paths;
+  std::atomic<int> decodeCount = 0;
+
+  void SetUp() override {
+    for (int i = 0; i < 3; i += 1) {
+      paths.push_back(::testing::TempDir() + "decoded_audio_cache_test_" + std::to_string(i));
+      std::ofstream(paths.back()) << "audio";
+    }
+  }
+
+  void TearDown() override {
+    for (const auto &path : paths) {
+      std::remove(path.c_str());
+    }
+  }
+
+  DecodedAudioCache::Decoder decoder(float value = 0.5f) {
+    return [this, value]() {
+      decodeCount += 1;
+      auto buffer = std::make_shared<AudioBuffer>(1, bufferLength, sampleRate);
+      std::vector<float> data(bufferLength, value);
+      buffer->copyToChannel(data.data(), bufferLength, 0, 0);
+      return buffer;
+    };
+  }
+};
+
+TEST_F(DecodedAudioCacheTest, DecodesFileOncePerSampleRate) {
+  auto cache = DecodedAudioCache(10 * bufferSize);
+
+  auto first = cache.getOrDecode(paths[0], sampleRate, decoder());
+  auto second = cache.getOrDecode(paths[0], sampleRate, decoder());
+  EXPECT_EQ(decodeCount, 1);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first->getChannelData(0), second->getChannelData(0));
+
+  cache.getOrDecode(paths[0], 48000.0f, decoder());
+  EXPECT_EQ(decodeCount, 2);
+  EXPECT_EQ(cache.getSize(), 2 * bufferSize);
+}
+
+TEST_F(DecodedAudioCacheTest, WritesDoNotReachCachedBuffer) {
+  auto cache = DecodedAudioCache(10 * bufferSize);
+
+  auto buffer = cache.getOrDecode(paths[0], sampleRate, decoder(0.5f));
+  std::vector<float> ones(bufferLength, 1.0f);
+  buffer->copyToChannel(ones.data(), bufferLength, 0, 0);
+
+  auto cached = cache.getOrDecode(paths[0], sampleRate, decoder());
+  EXPECT_FLOAT_EQ(cached->getChannelData(0)[0], 0.5f);
+}
+
+TEST_F(DecodedAudioCacheTest, ChangedFileIsDecodedAgain) {
+  auto cache = DecodedAudioCache(10 * bufferSize);
+  cache.getOrDecode(paths[0], sampleRate, decoder(0.5f));
+
+  std::ofstream(paths[0]) << "changed audio";
+  auto buffer = cache.getOrDecode(paths[0], sampleRate, decoder(0.25f));
+  EXPECT_EQ(decodeCount, 2);
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[0], 0.25f);
+  EXPECT_EQ(cache.getSize(), bufferSize);
+}
+
+TEST_F(DecodedAudioCacheTest, EvictsLeastRecentlyUsed) {
+  auto cache = DecodedAudioCache(2 * bufferSize);
+  cache.getOrDecode(paths[0], sampleRate, decoder());
+  cache.getOrDecode(paths[1], sampleRate, decoder());
+  cache.getOrDecode(paths[0], sampleRate, decoder());
+  cache.getOrDecode(paths[2], sampleRate, decoder());
+  EXPECT_EQ(decodeCount, 3);
+  EXPECT_EQ(cache.getSize(), 2 * bufferSize);
+
+  cache.getOrDecode(paths[0], sampleRate, decoder());
+  EXPECT_EQ(decodeCount, 3);
+  cache.getOrDecode(paths[1], sampleRate, decoder());
+  EXPECT_EQ(decodeCount, 4);
+
+  cache.setBudget(0);
+  EXPECT_EQ(cache.getSize(), 0);
+}
+
+TEST_F(DecodedAudioCacheTest, ConcurrentRequestsShareDecode) {
+  auto cache = DecodedAudioCache(10 * bufferSize);
+  auto slowDecoder = [this]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return decoder()();
+  };
+
+  std::vector<std::shared_ptr<AudioBuffer>> results(4);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < results.size(); i += 1) {
+    threads.emplace_back(
+        [&, i]() { results[i] = cache.getOrDecode(paths[0], sampleRate, slowDecoder); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(decodeCount, 1);
+  for (const auto &result : results) {
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->getChannelData(0), results[0]->getChannelData(0));
+  }
+}
+
+TEST_F(DecodedAudioCacheTest, FailedDecodeIsNotCached) {
+  auto cache = DecodedAudioCache(10 * bufferSize);
+  auto failingDecoder = [this]() -> std::shared_ptr<AudioBuffer> {
+    decodeCount += 1;
+    return nullptr;
+  };
+
+  EXPECT_EQ(cache.getOrDecode(paths[0], sampleRate, failingDecoder), nullptr);
+  EXPECT_EQ(cache.getOrDecode(paths[0], sampleRate, failingDecoder), nullptr);
+  EXPECT_EQ(decodeCount, 2);
+}
+
+TEST_F(DecodedAudioCacheTest, ThrowingDecodeReleasesWaitingRequests) {
+  auto cache = DecodedAudioCache(10 * bufferSize);
+  auto throwingDecoder = [this]() -> std::shared_ptr<AudioBuffer> {
+    decodeCount += 1;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    throw std::runtime_error("corrupted file");
+  };
+
+  std::atomic<int> errorCount = 0;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i += 1) {
+    threads.emplace_back([&]() {
+      try {
+        cache.getOrDecode(paths[0], sampleRate, throwingDecoder);
+      } catch (const std::runtime_error &) {
+        errorCount += 1;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(errorCount, 4);
+  // the failed decode is not in flight anymore
+  auto failedDecodeCount = decodeCount.load();
+  EXPECT_NE(cache.getOrDecode(paths[0], sampleRate, decoder()), nullptr);
+  EXPECT_EQ(decodeCount, failedDecodeCount + 1);
+}
@@ -0,0 +1,111 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/MappedPcmStorage.h>
+#include <gtest/gtest.h>
+#include <test/src/TestWavFile.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace audioapi;
+
+class MappedPcmStorageTest : public ::testing::Test {
+ protected:
+  static constexpr uint32_t sampleRate = 44100;
+  std::string path;
+
+  void SetUp() override {
+    path = ::testing::TempDir() + "mapped_pcm_storage_test.wav";
+  }
+
+  void TearDown() override {
+    std::remove(path.c_str());
+  }
+};
+
+TEST_F(MappedPcmStorageTest, ReadsInterleavedInt16Channels) {
+  test::writeWavFile(path, 1, 2, sampleRate, 16, test::encodeInt16({0, 16384, -16384, -32768}));
+
+  auto storage = MappedPcmStorage::openWav(path);
+  ASSERT_NE(storage, nullptr);
+  EXPECT_EQ(storage->getNumberOfChannels(), 2);
+  EXPECT_EQ(storage->getLength(), 2);
+  EXPECT_FLOAT_EQ(storage->getSampleRate(), static_cast<float>(sampleRate));
+
+  float left[2];
+  float right[2];
+  storage->read(0, 0, 2, left);
+  storage->read(1, 0, 2, right);
+  EXPECT_FLOAT_EQ(left[0], 0.0f);
+  EXPECT_FLOAT_EQ(left[1], -0.5f);
+  EXPECT_FLOAT_EQ(right[0], 0.5f);
+  EXPECT_FLOAT_EQ(right[1], -1.0f);
+
+  size_t indices[] = {1, 0};
+  storage->gather(1, indices, 2, right);
+  EXPECT_FLOAT_EQ(right[0], -1.0f);
+  EXPECT_FLOAT_EQ(right[1], 0.5f);
+}
+
+TEST_F(MappedPcmStorageTest, ReadsInt24AndFloatSamples) {
+  test::writeWavFile(path, 1, 1, sampleRate, 24, {0x00, 0x00, 0xC0, 0x00, 0x00, 0x40});
+
+  auto storage = MappedPcmStorage::openWav(path);
+  ASSERT_NE(storage, nullptr);
+  float samples[2];
+  storage->read(0, 0, 2, samples);
+  EXPECT_FLOAT_EQ(samples[0], -0.5f);
+  EXPECT_FLOAT_EQ(samples[1], 0.5f);
+
+  float value = 0.25f;
+  std::vector<uint8_t> bytes(sizeof(value));
+  std::memcpy(bytes.data(), &value, sizeof(value));
+  test::writeWavFile(path, 3, 1, sampleRate, 32, bytes);
+
+  storage = MappedPcmStorage::openWav(path);
+  ASSERT_NE(storage, nullptr);
+  EXPECT_EQ(storage->getSampleFormat(), PcmSampleFormat::FLOAT32);
+  storage->read(0, 0, 1, samples);
+  EXPECT_FLOAT_EQ(samples[0], 0.25f);
+}
+
+TEST_F(MappedPcmStorageTest, RejectsUnsupportedEncodings) {
+  test::writeWavFile(path, 1, 1, sampleRate, 8, {0x80, 0x80});
+  EXPECT_EQ(MappedPcmStorage::openWav(path), nullptr);
+
+  std::ofstream(path, std::ios::binary) << "not a wave file";
+  EXPECT_EQ(MappedPcmStorage::openWav(path), nullptr);
+  EXPECT_EQ(MappedPcmStorage::openWav(path + ".missing"), nullptr);
+}
+
+TEST_F(MappedPcmStorageTest, ReadsRawPcm) {
+  auto bytes = test::encodeInt16({16384, -16384, 8192});
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+  // the trailing sample does not make a full frame
+  auto storage = MappedPcmStorage::openRaw(path, PcmSampleFormat::INT16, 2, sampleRate);
+  ASSERT_NE(storage, nullptr);
+  EXPECT_EQ(storage->getLength(), 1);
+  EXPECT_EQ(storage->getAllocatedSizeInBytes(), 0);
+
+  float right;
+  storage->read(1, 0, 1, &right);
+  EXPECT_FLOAT_EQ(right, -0.5f);
+}
+
+TEST_F(MappedPcmStorageTest, BufferIsExpandedOnlyForChannelData) {
+  test::writeWavFile(path, 1, 1, sampleRate, 16, test::encodeInt16({0, 8192, 16384}));
+  auto buffer = std::make_shared<AudioBuffer>(MappedPcmStorage::openWav(path));
+
+  float samples[2];
+  buffer->copyFromChannel(samples, 2, 0, 1);
+  EXPECT_FLOAT_EQ(samples[0], 0.25f);
+  EXPECT_NE(buffer->getPcmStorage(), nullptr);
+
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[2], 0.5f);
+  EXPECT_EQ(buffer->getPcmStorage(), nullptr);
+  EXPECT_EQ(buffer->getLength(), 3);
+}
@@ -0,0 +1,100 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/ParallelAudioDecoder.h>
+#include <audioapi/dsp/PolyphaseResampler.h>
+#include <audioapi/libs/miniaudio/miniaudio.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <test/src/TestWavFile.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace audioapi;
+
+class ParallelWavDecodeTest : public ::testing::Test {
+ protected:
+  static constexpr uint32_t sampleRate = 8000;
+  static constexpr int channelCount = 2;
+  // long enough for two ranges of at least five seconds
+  static constexpr size_t length = 12 * sampleRate + 37;
+
+  std::string path;
+  ParallelAudioDecoder::DecoderFactory createDecoder;
+
+  void SetUp() override {
+    path = ::testing::TempDir() + "parallel_audio_decoder_test.wav";
+    std::vector<int16_t> samples(length * channelCount);
+    for (size_t i = 0; i < samples.size(); i += 1) {
+      samples[i] = static_cast<int16_t>((i * 7919) % 65536 - 32768);
+    }
+    test::writeWavFile(path, 1, channelCount, sampleRate, 16, test::encodeInt16(samples));
+
+    createDecoder = [this](const ma_decoder_config *config, ma_decoder *decoder) {
+      return ma_decoder_init_file(path.c_str(), config, decoder);
+    };
+  }
+
+  void TearDown() override {
+    std::remove(path.c_str());
+  }
+
+  [[nodiscard]] std::shared_ptr<AudioBus> decodeSequentially() const {
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
+    ma_decoder decoder;
+    if (ma_decoder_init_file(path.c_str(), &config, &decoder) != MA_SUCCESS) {
+      return nullptr;
+    }
+
+    std::vector<float> interleaved(length * channelCount);
+    ma_uint64 framesRead = 0;
+    ma_decoder_read_pcm_frames(&decoder, interleaved.data(), length, &framesRead);
+    ma_decoder_uninit(&decoder);
+
+    auto bus = std::make_shared<AudioBus>(framesRead, channelCount, sampleRate);
+    for (int ch = 0; ch < channelCount; ch += 1) {
+      for (size_t i = 0; i < framesRead; i += 1) {
+        bus->getChannel(ch)->getData()[i] = interleaved[i * channelCount + ch];
+      }
+    }
+    return bus;
+  }
+
+  static void expectSameSamples(const AudioBuffer &buffer, const AudioBus &expected) {
+    ASSERT_EQ(buffer.getLength(), expected.getSize());
+    ASSERT_EQ(buffer.getNumberOfChannels(), expected.getNumberOfChannels());
+    for (int ch = 0; ch < expected.getNumberOfChannels(); ch += 1) {
+      for (size_t i = 0; i < expected.getSize(); i += 1) {
+        ASSERT_EQ(buffer.getChannelData(ch)[i], expected.getChannel(ch)->getData()[i])
+            << "channel " << ch << " frame " << i;
+      }
+    }
+  }
+};
+
+TEST_F(ParallelWavDecodeTest, MatchesSequentialDecode) {
+  auto expected = decodeSequentially();
+  ASSERT_NE(expected, nullptr);
+  ASSERT_EQ(expected->getSize(), length);
+
+  auto buffer = ParallelAudioDecoder::decode(AudioFormat::WAV, createDecoder, 0, 2);
+  ASSERT_NE(buffer, nullptr);
+
+  expectSameSamples(*buffer, *expected);
+}
+
+TEST_F(ParallelWavDecodeTest, MatchesSequentialDecodeResampledAsWhole) {
+  constexpr float outputSampleRate = 11025.0f;
+  auto decoded = decodeSequentially();
+  ASSERT_NE(decoded, nullptr);
+  auto expected = PolyphaseResampler::resample(*decoded, outputSampleRate);
+
+  auto buffer = ParallelAudioDecoder::decode(AudioFormat::WAV, createDecoder, outputSampleRate, 2);
+  ASSERT_NE(buffer, nullptr);
+
+  EXPECT_EQ(buffer->getSampleRate(), outputSampleRate);
+  expectSameSamples(*buffer, *expected);
+}
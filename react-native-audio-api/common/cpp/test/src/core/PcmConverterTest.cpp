@@ -0,0 +1,146 @@
+#include <audioapi/core/utils/PcmConverter.h>
+#include <audioapi/dsp/PolyphaseResampler.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+class PcmConverterTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 16000.0f;
+  // long enough for the vectorized loops and their tails
+  static constexpr size_t length = 37;
+
+  static int16_t sampleAt(int channel, size_t frame) {
+    return static_cast<int16_t>((channel + 1) * 1000 - static_cast<int>(frame) * 97);
+  }
+};
+
+TEST_F(PcmConverterTest, ConvertsInterleavedInt16) {
+  for (int numberOfChannels = 1; numberOfChannels <= 3; numberOfChannels += 1) {
+    std::vector<int16_t> data(length * numberOfChannels);
+    for (size_t i = 0; i < length; i += 1) {
+      for (int channel = 0; channel < numberOfChannels; channel += 1) {
+        data[i * numberOfChannels + channel] = sampleAt(channel, i);
+      }
+    }
+
+    auto bus = PcmConverter::toAudioBus(
+        data.data(),
+        data.size() * sizeof(int16_t),
+        PcmSampleFormat::INT16,
+        numberOfChannels,
+        sampleRate,
+        true);
+    ASSERT_NE(bus, nullptr);
+    EXPECT_EQ(bus->getSize(), length);
+    EXPECT_EQ(bus->getSampleRate(), sampleRate);
+
+    for (int channel = 0; channel < numberOfChannels; channel += 1) {
+      for (size_t i = 0; i < length; i += 1) {
+        EXPECT_FLOAT_EQ(
+            (*bus->getChannel(channel))[i], static_cast<float>(sampleAt(channel, i)) / 32768.0f);
+      }
+    }
+  }
+}
+
+TEST_F(PcmConverterTest, ConvertsPlanarFloat32) {
+  std::vector<float> data(2 * length);
+  for (size_t i = 0; i < length; i += 1) {
+    data[i] = static_cast<float>(i) / length;
+    data[length + i] = -static_cast<float>(i) / length;
+  }
+
+  auto bus = PcmConverter::toAudioBus(
+      data.data(), data.size() * sizeof(float), PcmSampleFormat::FLOAT32, 2, sampleRate, false);
+  ASSERT_NE(bus, nullptr);
+
+  for (size_t i = 0; i < length; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], data[i]);
+    EXPECT_FLOAT_EQ((*bus->getChannel(1))[i], data[length + i]);
+  }
+}
+
+TEST_F(PcmConverterTest, DeinterleavesStereoFloat32) {
+  std::vector<float> data(2 * length);
+  for (size_t i = 0; i < length; i += 1) {
+    data[2 * i] = static_cast<float>(i);
+    data[2 * i + 1] = -static_cast<float>(i);
+  }
+
+  // a partial trailing frame is ignored
+  auto bus = PcmConverter::toAudioBus(
+      data.data(), data.size() * sizeof(float) + 1, PcmSampleFormat::FLOAT32, 2, sampleRate, true);
+  ASSERT_NE(bus, nullptr);
+  EXPECT_EQ(bus->getSize(), length);
+
+  for (size_t i = 0; i < length; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], static_cast<float>(i));
+    EXPECT_FLOAT_EQ((*bus->getChannel(1))[i], -static_cast<float>(i));
+  }
+}
+
+TEST_F(PcmConverterTest, RejectsInvalidInput) {
+  std::vector<int16_t> data(8);
+  auto size = data.size() * sizeof(int16_t);
+
+  EXPECT_EQ(
+      PcmConverter::toAudioBus(data.data(), size, PcmSampleFormat::INT24, 1, sampleRate, true),
+      nullptr);
+  EXPECT_EQ(
+      PcmConverter::toAudioBus(data.data(), size, PcmSampleFormat::INT16, 0, sampleRate, true),
+      nullptr);
+  EXPECT_EQ(
+      PcmConverter::toAudioBus(data.data(), 1, PcmSampleFormat::INT16, 1, sampleRate, true),
+      nullptr);
+
+  auto misaligned = reinterpret_cast<const uint8_t *>(data.data()) + 1;
+  EXPECT_EQ(
+      PcmConverter::toAudioBus(misaligned, size - 1, PcmSampleFormat::INT16, 1, sampleRate, true),
+      nullptr);
+}
+
+TEST_F(PcmConverterTest, ResamplesInChunksLikeWholeBus) {
+  constexpr int numberOfChannels = 2;
+  constexpr size_t longLength = 10000;
+  constexpr float outputSampleRate = 44100.0f;
+
+  std::vector<int16_t> data(longLength * numberOfChannels);
+  for (size_t i = 0; i < longLength; i += 1) {
+    for (int channel = 0; channel < numberOfChannels; channel += 1) {
+      data[i * numberOfChannels + channel] = sampleAt(channel, i);
+    }
+  }
+
+  auto nativeBus = PcmConverter::toAudioBus(
+      data.data(),
+      data.size() * sizeof(int16_t),
+      PcmSampleFormat::INT16,
+      numberOfChannels,
+      sampleRate,
+      true);
+  auto expected = PolyphaseResampler::resample(*nativeBus, outputSampleRate);
+  auto bus = PcmConverter::toAudioBus(
+      data.data(),
+      data.size() * sizeof(int16_t),
+      PcmSampleFormat::INT16,
+      numberOfChannels,
+      sampleRate,
+      true,
+      outputSampleRate);
+
+  ASSERT_NE(bus, nullptr);
+  ASSERT_EQ(bus->getSize(), expected->getSize());
+  EXPECT_EQ(bus->getSampleRate(), outputSampleRate);
+  for (int channel = 0; channel < numberOfChannels; channel += 1) {
+    for (size_t i = 0; i < bus->getSize(); i += 1) {
+      ASSERT_EQ(bus->getChannel(channel)->getData()[i], expected->getChannel(channel)->getData()[i])
+          << "channel " << channel << " frame " << i;
+    }
+  }
+}
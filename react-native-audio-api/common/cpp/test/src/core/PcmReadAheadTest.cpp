@@ -0,0 +1,52 @@
+#include <audioapi/core/utils/PcmReadAhead.h>
+#include <gtest/gtest.h>
+#include <test/src/TestPcmStorage.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+TEST(PcmReadAheadTest, PrefetchesRequestedFramesOnWorkerThread) {
+  auto readAhead = PcmReadAhead();
+  auto storage =
+      std::make_shared<test::PrefetchRecordingStorage>(std::vector<int16_t>(1000), 8000.0f);
+
+  EXPECT_TRUE(readAhead.request(storage, 100, 200));
+  EXPECT_TRUE(readAhead.request(storage, 300, 200));
+
+  auto ranges = storage->waitForPrefetches(2);
+  ASSERT_EQ(ranges.size(), 2);
+  EXPECT_EQ(ranges[0], test::PrefetchRecordingStorage::Range(100, 200));
+  EXPECT_EQ(ranges[1], test::PrefetchRecordingStorage::Range(300, 200));
+}
+
+TEST(PcmReadAheadTest, DropsStorageOnceRequestIsServed) {
+  auto readAhead = PcmReadAhead();
+  auto storage =
+      std::make_shared<test::PrefetchRecordingStorage>(std::vector<int16_t>(1000), 8000.0f);
+  std::weak_ptr<test::PrefetchRecordingStorage> weakStorage = storage;
+
+  ASSERT_TRUE(readAhead.request(storage, 0, 1000));
+  // e.g. the buffer is released while the request is queued
+  auto ranges = storage->waitForPrefetches(1);
+  storage.reset();
+
+  EXPECT_EQ(ranges.size(), 1);
+  // the worker drops the last reference once it is done
+  for (int i = 0; i < 1000 && !weakStorage.expired(); i += 1) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_TRUE(weakStorage.expired());
+}
+
+TEST(PcmReadAheadTest, IgnoresEmptyRequests) {
+  auto readAhead = PcmReadAhead();
+  auto storage =
+      std::make_shared<test::PrefetchRecordingStorage>(std::vector<int16_t>(1000), 8000.0f);
+
+  EXPECT_FALSE(readAhead.request(nullptr, 0, 100));
+  EXPECT_FALSE(readAhead.request(storage, 0, 0));
+}
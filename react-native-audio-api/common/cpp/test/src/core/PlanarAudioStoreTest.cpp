@@ -0,0 +1,147 @@
+#include <audioapi/core/utils/PlanarAudioStore.h>
+#include <audioapi/dsp/PolyphaseResampler.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+class PlanarAudioStoreTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 44100.0f;
+
+  // interleaved stereo frames, the right channel is the negated left one
+  static std::vector<float> stereoRamp(size_t start, size_t length) {
+    std::vector<float> data(2 * length);
+    for (size_t i = 0; i < length; i += 1) {
+      data[2 * i] = static_cast<float>(start + i);
+      data[2 * i + 1] = -static_cast<float>(start + i);
+    }
+    return data;
+  }
+
+  static void appendInChunks(PlanarAudioStore &store, size_t length, size_t chunkSize) {
+    for (size_t start = 0; start < length; start += chunkSize) {
+      auto frames = std::min(chunkSize, length - start);
+      auto data = stereoRamp(start, frames);
+      store.appendInterleaved(data.data(), frames);
+    }
+  }
+
+  static void expectRamp(const AudioBus &bus, size_t length) {
+    ASSERT_EQ(bus.getSize(), length);
+    ASSERT_EQ(bus.getNumberOfChannels(), 2);
+    for (size_t i = 0; i < length; i += 1) {
+      ASSERT_FLOAT_EQ((*bus.getChannel(0))[i], static_cast<float>(i));
+      ASSERT_FLOAT_EQ((*bus.getChannel(1))[i], -static_cast<float>(i));
+    }
+  }
+};
+
+TEST_F(PlanarAudioStoreTest, FillsKnownLengthInPlace) {
+  constexpr size_t length = 10000;
+  auto store = PlanarAudioStore(2, sampleRate, length);
+  appendInChunks(store, length, 4096);
+
+  auto bus = store.finish();
+  ASSERT_NE(bus, nullptr);
+  expectRamp(*bus, length);
+  EXPECT_FLOAT_EQ(bus->getSampleRate(), sampleRate);
+}
+
+TEST_F(PlanarAudioStoreTest, CutsOffOverestimatedLength) {
+  auto store = PlanarAudioStore(2, sampleRate, 10000);
+  appendInChunks(store, 9000, 4096);
+
+  auto bus = store.finish();
+  ASSERT_NE(bus, nullptr);
+  expectRamp(*bus, 9000);
+}
+
+TEST_F(PlanarAudioStoreTest, GrowsPastUnknownOrUnderestimatedLength) {
+  constexpr size_t length = 200000;
+
+  auto unknown = PlanarAudioStore(2, sampleRate, 0);
+  appendInChunks(unknown, length, 4096);
+  EXPECT_EQ(unknown.getLength(), length);
+  auto bus = unknown.finish();
+  ASSERT_NE(bus, nullptr);
+  expectRamp(*bus, length);
+
+  auto underestimated = PlanarAudioStore(2, sampleRate, 1000);
+  appendInChunks(underestimated, length, 4096);
+  bus = underestimated.finish();
+  ASSERT_NE(bus, nullptr);
+  expectRamp(*bus, length);
+}
+
+TEST_F(PlanarAudioStoreTest, EmptyStoreHasNoAudio) {
+  auto store = PlanarAudioStore(2, sampleRate, 1000);
+  EXPECT_EQ(store.finish(), nullptr);
+}
+
+class ResamplingPlanarAudioStoreTest : public PlanarAudioStoreTest {
+ protected:
+  static constexpr size_t length = 30000;
+
+  static std::shared_ptr<AudioBus> createInput() {
+    auto bus = std::make_shared<AudioBus>(length, 2, sampleRate);
+    for (size_t i = 0; i < length; i += 1) {
+      (*bus->getChannel(0))[i] = std::sin(static_cast<float>(i) * 0.01f);
+      (*bus->getChannel(1))[i] = std::cos(static_cast<float>(i) * 0.003f);
+    }
+    return bus;
+  }
+
+  static void expectEqual(const AudioBus &bus, const AudioBus &expected) {
+    ASSERT_EQ(bus.getSize(), expected.getSize());
+    EXPECT_FLOAT_EQ(bus.getSampleRate(), expected.getSampleRate());
+    for (int ch = 0; ch < 2; ch += 1) {
+      for (size_t i = 0; i < bus.getSize(); i += 1) {
+        ASSERT_FLOAT_EQ((*bus.getChannel(ch))[i], (*expected.getChannel(ch))[i]);
+      }
+    }
+  }
+};
+
+TEST_F(ResamplingPlanarAudioStoreTest, ResamplesInterleavedChunksLikeWholeBus) {
+  auto input = createInput();
+  auto expected = PolyphaseResampler::resample(*input, 48000.0f);
+
+  auto store = PlanarAudioStore(2, sampleRate, length, 48000.0f);
+  std::vector<float> interleaved(2 * 1000);
+  for (size_t start = 0; start < length; start += 1000) {
+    for (size_t i = 0; i < 1000; i += 1) {
+      interleaved[2 * i] = (*input->getChannel(0))[start + i];
+      interleaved[2 * i + 1] = (*input->getChannel(1))[start + i];
+    }
+    store.appendInterleaved(interleaved.data(), 1000);
+  }
+
+  auto bus = store.finish();
+  ASSERT_NE(bus, nullptr);
+  expectEqual(*bus, *expected);
+}
+
+TEST_F(ResamplingPlanarAudioStoreTest, ResamplesPlanarChunksOfUnknownLength) {
+  // an odd rate uses an interpolated filter bank
+  constexpr float outputSampleRate = 22050.5f;
+  constexpr size_t chunkSize = 7000;
+  auto input = createInput();
+  auto expected = PolyphaseResampler::resample(*input, outputSampleRate);
+
+  auto store = PlanarAudioStore(2, sampleRate, 0, outputSampleRate);
+  for (size_t start = 0; start < length; start += chunkSize) {
+    const float *channels[] = {
+        input->getChannel(0)->getData() + start, input->getChannel(1)->getData() + start};
+    store.appendPlanar(channels, std::min(chunkSize, length - start));
+  }
+
+  auto bus = store.finish();
+  ASSERT_NE(bus, nullptr);
+  expectEqual(*bus, *expected);
+}
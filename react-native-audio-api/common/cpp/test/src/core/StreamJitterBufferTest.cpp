@@ -0,0 +1,182 @@
+#include <audioapi/core/utils/StreamJitterBuffer.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+class StreamJitterBufferTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 44100.0f;
+  static constexpr size_t chunkSize = 64;
+  std::atomic<bool> stop = false;
+
+  static std::vector<float> ramp(size_t start, size_t length) {
+    std::vector<float> data(length);
+    for (size_t i = 0; i < length; i += 1) {
+      data[i] = static_cast<float>(start + i);
+    }
+    return data;
+  }
+};
+
+TEST_F(StreamJitterBufferTest, WaitsForPrebufferBeforePlayback) {
+  auto jitterBuffer = StreamJitterBuffer(1, sampleRate, chunkSize, 4, 128);
+  auto bus = std::make_shared<AudioBus>(100, 1, sampleRate);
+
+  auto data = ramp(0, 100);
+  const float *planes[] = {data.data()};
+  ASSERT_TRUE(jitterBuffer.write(planes, 100, stop));
+
+  // only the first chunk is published, it is below the prebuffer
+  EXPECT_EQ(jitterBuffer.read(bus.get(), 0, 100), 0);
+  EXPECT_TRUE(jitterBuffer.isPrebuffering());
+  EXPECT_EQ(jitterBuffer.getUnderrunCount(), 0);
+
+  auto more = ramp(100, 100);
+  planes[0] = more.data();
+  ASSERT_TRUE(jitterBuffer.write(planes, 100, stop));
+  EXPECT_EQ(jitterBuffer.getBufferedFrames(), 192);
+
+  EXPECT_EQ(jitterBuffer.read(bus.get(), 0, 100), 100);
+  for (size_t i = 0; i < 100; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], static_cast<float>(i));
+  }
+  EXPECT_EQ(jitterBuffer.getBufferedFrames(), 92);
+}
+
+TEST_F(StreamJitterBufferTest, CountsUnderrunAndPrebuffersAgain) {
+  auto jitterBuffer = StreamJitterBuffer(1, sampleRate, chunkSize, 4, chunkSize);
+  auto bus = std::make_shared<AudioBus>(100, 1, sampleRate);
+
+  auto data = ramp(0, chunkSize);
+  const float *planes[] = {data.data()};
+  ASSERT_TRUE(jitterBuffer.write(planes, chunkSize, stop));
+
+  EXPECT_EQ(jitterBuffer.read(bus.get(), 0, 100), chunkSize);
+  for (size_t i = chunkSize; i < 100; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], 0.0f);
+  }
+  EXPECT_EQ(jitterBuffer.getUnderrunCount(), 1);
+  EXPECT_TRUE(jitterBuffer.isPrebuffering());
+}
+
+TEST_F(StreamJitterBufferTest, FinishPlaysRemainingFramesWithoutUnderrun) {
+  auto jitterBuffer = StreamJitterBuffer(1, sampleRate, chunkSize, 4, 4 * chunkSize);
+  auto bus = std::make_shared<AudioBus>(100, 1, sampleRate);
+
+  auto data = ramp(0, 10);
+  const float *planes[] = {data.data()};
+  ASSERT_TRUE(jitterBuffer.write(planes, 10, stop));
+  jitterBuffer.finish();
+
+  EXPECT_EQ(jitterBuffer.read(bus.get(), 0, 100), 10);
+  EXPECT_EQ(jitterBuffer.getUnderrunCount(), 0);
+}
+
+TEST_F(StreamJitterBufferTest, ReserveWritesInPlace) {
+  auto jitterBuffer = StreamJitterBuffer(2, sampleRate, chunkSize, 2, 0);
+  auto bus = std::make_shared<AudioBus>(chunkSize, 2, sampleRate);
+
+  size_t writeOffset = 0;
+  auto *chunk = jitterBuffer.reserve(40, writeOffset, stop);
+  ASSERT_NE(chunk, nullptr);
+  EXPECT_EQ(writeOffset, 0);
+  chunk->getChannel(1)->getData()[0] = 1.0f;
+  jitterBuffer.commit(40);
+
+  // does not fit in the rest of the chunk, so the partial one is published
+  chunk = jitterBuffer.reserve(40, writeOffset, stop);
+  ASSERT_NE(chunk, nullptr);
+  EXPECT_EQ(writeOffset, 0);
+  EXPECT_EQ(jitterBuffer.getBufferedFrames(), 40);
+  EXPECT_EQ(jitterBuffer.reserve(chunkSize + 1, writeOffset, stop), nullptr);
+
+  EXPECT_EQ(jitterBuffer.read(bus.get(), 0, 40), 40);
+  EXPECT_FLOAT_EQ((*bus->getChannel(1))[0], 1.0f);
+}
+
+TEST_F(StreamJitterBufferTest, ProducerWaitsForChunksAndStops) {
+  auto jitterBuffer = StreamJitterBuffer(1, sampleRate, chunkSize, 2, 0);
+  auto bus = std::make_shared<AudioBus>(chunkSize, 1, sampleRate);
+  constexpr size_t totalFrames = 16 * chunkSize;
+
+  auto data = ramp(0, totalFrames);
+  auto producer = std::thread([&]() {
+    const float *planes[] = {data.data()};
+    EXPECT_TRUE(jitterBuffer.write(planes, totalFrames, stop));
+    jitterBuffer.finish();
+  });
+
+  size_t framesRead = 0;
+  while (framesRead < totalFrames) {
+    auto read = jitterBuffer.read(bus.get(), 0, chunkSize);
+    for (size_t i = 0; i < read; i += 1) {
+      EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], static_cast<float>(framesRead + i));
+    }
+    framesRead += read;
+  }
+  producer.join();
+
+  // the pool is exhausted once nothing is read anymore
+  const float *planes[] = {data.data()};
+  ASSERT_TRUE(jitterBuffer.write(planes, 2 * chunkSize, stop));
+  auto blocked = std::thread([&]() { EXPECT_FALSE(jitterBuffer.write(planes, chunkSize, stop)); });
+  stop.store(true);
+  blocked.join();
+}
+
+TEST_F(StreamJitterBufferTest, ReadAtDropsChunksDecodedBeforeSeek) {
+  auto jitterBuffer = StreamJitterBuffer(1, sampleRate, chunkSize, 4, 0);
+  auto bus = std::make_shared<AudioBus>(chunkSize, 1, sampleRate);
+
+  auto data = ramp(0, chunkSize);
+  const float *planes[] = {data.data()};
+  ASSERT_TRUE(jitterBuffer.write(planes, chunkSize, stop));
+
+  jitterBuffer.seekWrite(1000);
+  auto seeked = ramp(1000, chunkSize);
+  planes[0] = seeked.data();
+  ASSERT_TRUE(jitterBuffer.write(planes, chunkSize, stop));
+
+  bool isOutOfSync = false;
+  EXPECT_EQ(jitterBuffer.readAt(bus.get(), 0, 16, 1010, isOutOfSync), 16);
+  EXPECT_TRUE(isOutOfSync);
+  for (size_t i = 0; i < 16; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], static_cast<float>(1010 + i));
+  }
+  EXPECT_EQ(jitterBuffer.getBufferedFrames(), chunkSize - 26);
+
+  // nothing is left for a position outside of the buffered range
+  EXPECT_EQ(jitterBuffer.readAt(bus.get(), 0, 16, 0, isOutOfSync), 0);
+  EXPECT_TRUE(isOutOfSync);
+  EXPECT_EQ(jitterBuffer.getBufferedFrames(), 0);
+  EXPECT_EQ(jitterBuffer.getUnderrunCount(), 0);
+}
+
+TEST_F(StreamJitterBufferTest, SeekWritePublishesPartialChunk) {
+  auto jitterBuffer = StreamJitterBuffer(1, sampleRate, chunkSize, 4, 0);
+  auto bus = std::make_shared<AudioBus>(chunkSize, 1, sampleRate);
+
+  auto data = ramp(0, 10);
+  const float *planes[] = {data.data()};
+  ASSERT_TRUE(jitterBuffer.write(planes, 10, stop));
+  jitterBuffer.finish();
+  EXPECT_TRUE(jitterBuffer.isFinished());
+
+  // looping back to the start of the stream
+  jitterBuffer.seekWrite(0);
+  EXPECT_FALSE(jitterBuffer.isFinished());
+  ASSERT_TRUE(jitterBuffer.write(planes, 10, stop));
+  jitterBuffer.seekWrite(0);
+
+  bool isOutOfSync = false;
+  EXPECT_EQ(jitterBuffer.readAt(bus.get(), 0, 10, 0, isOutOfSync), 10);
+  EXPECT_EQ(jitterBuffer.readAt(bus.get(), 0, 10, 0, isOutOfSync), 10);
+  EXPECT_FALSE(isOutOfSync);
+  EXPECT_FLOAT_EQ((*bus->getChannel(0))[9], 9.0f);
+}
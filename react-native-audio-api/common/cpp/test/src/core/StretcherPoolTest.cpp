@@ -0,0 +1,137 @@
+#include <audioapi/core/utils/StretcherPool.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+TEST(StretcherPoolTest, ReleasedStretcherIsReused) {
+  auto pool = StretcherPool();
+  auto *group = pool.reserve(2, 44100, PitchCorrectionQuality::HIGH, 1);
+
+  auto *stretch = group->acquire();
+  ASSERT_NE(stretch, nullptr);
+  group->release(stretch);
+
+  EXPECT_EQ(group->acquire(), stretch);
+}
+
+TEST(StretcherPoolTest, StretchersAreKeyedByConfiguration) {
+  auto pool = StretcherPool();
+  auto *group = pool.reserve(2, 44100, PitchCorrectionQuality::HIGH, 1);
+
+  EXPECT_EQ(pool.reserve(2, 44100, PitchCorrectionQuality::HIGH, 1), group);
+  EXPECT_NE(pool.reserve(1, 44100, PitchCorrectionQuality::HIGH, 1), group);
+  EXPECT_NE(pool.reserve(2, 48000, PitchCorrectionQuality::HIGH, 1), group);
+  EXPECT_NE(pool.reserve(2, 44100, PitchCorrectionQuality::LOW, 1), group);
+}
+
+TEST(StretcherPoolTest, LowQualityHasLowerLatency) {
+  auto pool = StretcherPool();
+
+  auto high = pool.getLatency(2, 44100, PitchCorrectionQuality::HIGH);
+  auto low = pool.getLatency(2, 44100, PitchCorrectionQuality::LOW);
+
+  EXPECT_GT(high.input, 0);
+  EXPECT_LT(low.input, high.input);
+  EXPECT_EQ(pool.reserve(2, 44100, PitchCorrectionQuality::LOW, 0)->getLatency().input, low.input);
+}
+
+TEST(StretcherPoolTest, AcquireReturnsNullWhenEveryStretcherIsInUse) {
+  auto pool = StretcherPool();
+  auto *group = pool.reserve(1, 44100, PitchCorrectionQuality::LOW, 2);
+
+  auto *first = group->acquire();
+  auto *second = group->acquire();
+  EXPECT_NE(first, nullptr);
+  EXPECT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+
+  // the audio thread never creates stretchers on its own
+  EXPECT_EQ(group->acquire(), nullptr);
+
+  group->release(second);
+  EXPECT_EQ(group->acquire(), second);
+}
+
+TEST(StretcherPoolTest, IdleReservationsDoNotShareStretcher) {
+  auto pool = StretcherPool();
+  pool.reserve(1, 44100, PitchCorrectionQuality::LOW, 1);
+  auto *group = pool.reserve(1, 44100, PitchCorrectionQuality::LOW, 1);
+
+  auto *first = group->acquire();
+  auto *second = group->acquire();
+  EXPECT_NE(first, nullptr);
+  EXPECT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+}
+
+TEST(StretcherPoolTest, UnreservedStretchersAreKeptForLaterReservations) {
+  auto pool = StretcherPool();
+  auto *group = pool.reserve(1, 44100, PitchCorrectionQuality::LOW, 2);
+  pool.unreserve(group, 2);
+  pool.reserve(1, 44100, PitchCorrectionQuality::LOW, 1);
+
+  std::set<SignalsmithStretch *> stretchers;
+  while (auto *stretch = group->acquire()) {
+    stretchers.insert(stretch);
+  }
+
+  EXPECT_EQ(stretchers.size(), 2);
+}
+
+TEST(StretcherPoolTest, ReserveCountsStretchersInUse) {
+  auto pool = StretcherPool();
+  auto *group = pool.reserve(1, 44100, PitchCorrectionQuality::LOW, 1);
+  auto *stretch = group->acquire();
+  ASSERT_NE(stretch, nullptr);
+  ASSERT_EQ(group->acquire(), nullptr);
+
+  pool.reserve(1, 44100, PitchCorrectionQuality::LOW, 1);
+  auto *reserved = group->acquire();
+  EXPECT_NE(reserved, nullptr);
+  EXPECT_NE(reserved, stretch);
+}
+
+TEST(StretcherPoolTest, ReserveIsLimitedByCapacity) {
+  auto pool = StretcherPool();
+  auto *group =
+      pool.reserve(1, 8000, PitchCorrectionQuality::LOW, 2 * StretcherPool::getCapacity());
+
+  std::set<SignalsmithStretch *> stretchers;
+  while (auto *stretch = group->acquire()) {
+    stretchers.insert(stretch);
+  }
+
+  EXPECT_EQ(stretchers.size(), StretcherPool::getCapacity());
+}
+
+TEST(StretcherPoolTest, StretchersReleasedFromOtherThreadsAreReused) {
+  constexpr size_t count = 8;
+  auto pool = StretcherPool();
+  auto *group = pool.reserve(1, 8000, PitchCorrectionQuality::LOW, count);
+
+  std::vector<SignalsmithStretch *> acquired;
+  for (size_t i = 0; i < count; i += 1) {
+    acquired.push_back(group->acquire());
+    ASSERT_NE(acquired.back(), nullptr);
+  }
+
+  // e.g. a buffer change on the JS thread and a node destroyed on the destructor thread
+  std::vector<std::thread> threads;
+  for (auto *stretch : acquired) {
+    threads.emplace_back([group, stretch] { group->release(stretch); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::set<SignalsmithStretch *> reacquired;
+  while (auto *stretch = group->acquire()) {
+    reacquired.insert(stretch);
+  }
+
+  EXPECT_EQ(reacquired, std::set<SignalsmithStretch *>(acquired.begin(), acquired.end()));
+}
@@ -0,0 +1,123 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/sources/AudioBufferQueueSourceNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+using ::testing::NiceMock;
+
+class AudioBufferQueueSourceTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<NiceMock<MockAudioEventHandlerRegistry>> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+  static constexpr size_t chunkLength = 100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<NiceMock<MockAudioEventHandlerRegistry>>();
+    context = std::make_shared<OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+  }
+
+  std::shared_ptr<AudioBuffer> createChunk(float value) {
+    auto buffer = std::make_shared<AudioBuffer>(1, chunkLength, sampleRate);
+    std::vector<float> data(chunkLength, value);
+    buffer->copyToChannel(data.data(), chunkLength, 0, 0);
+    return buffer;
+  }
+};
+
+class TestableAudioBufferQueueSourceNode : public AudioBufferQueueSourceNode {
+ public:
+  explicit TestableAudioBufferQueueSourceNode(std::shared_ptr<BaseAudioContext> context)
+      : AudioBufferQueueSourceNode(context, false) {}
+
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override {
+    return AudioBufferQueueSourceNode::processNode(processingBus, framesToProcess);
+  }
+};
+
+TEST_F(AudioBufferQueueSourceTest, PlaysChunksGaplessly) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferQueueSourceNode(context);
+  source.enqueueBuffer(createChunk(0.25f));
+  source.enqueueBuffer(createChunk(0.5f));
+  source.start(0.0);
+
+  auto result = source.processNode(bus, RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], i < chunkLength ? 0.25f : 0.5f);
+  }
+}
+
+TEST_F(AudioBufferQueueSourceTest, DequeueRemovesPendingChunk) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferQueueSourceNode(context);
+  source.enqueueBuffer(createChunk(0.25f));
+  auto bufferId = source.enqueueBuffer(createChunk(0.5f));
+  source.enqueueBuffer(createChunk(0.75f));
+  source.dequeueBuffer(std::stoull(bufferId));
+  source.start(0.0);
+
+  auto result = source.processNode(bus, RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], i < chunkLength ? 0.25f : 0.75f);
+  }
+}
+
+TEST_F(AudioBufferQueueSourceTest, PlayedChunkCanBeRefilledInPlace) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferQueueSourceNode(context);
+  auto chunk = createChunk(0.25f);
+  source.enqueueBuffer(chunk);
+  source.enqueueBuffer(createChunk(0.5f));
+  source.start(0.0);
+  source.processNode(bus, RENDER_QUANTUM_SIZE);
+
+  // the node does not hold the played chunk anymore, so the refill
+  // writes to the very same storage instead of cloning it.
+  const float *storage = chunk->getChannelData(0);
+  std::vector<float> data(chunkLength, 1.0f);
+  chunk->copyToChannel(data.data(), chunkLength, 0, 0);
+  EXPECT_EQ(chunk->getChannelData(0), storage);
+}
+
+TEST_F(AudioBufferQueueSourceTest, LowWaterMarkIsEdgeTriggered) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferQueueSourceNode(context);
+  source.setLowWaterMark(static_cast<double>(chunkLength) / sampleRate);
+  source.setOnBufferQueueLowCallbackId(1);
+
+  for (int i = 0; i < 4; i += 1) {
+    source.enqueueBuffer(createChunk(0.5f));
+  }
+  source.start(0.0);
+
+  EXPECT_CALL(*eventRegistry, dispatchAudioEvent(IsAudioEvent(AudioEventType::BUFFER_QUEUE_LOW, 1)))
+      .Times(1);
+  // 272 and 144 frames are left after the first quanta, 16 after the third one,
+  // the queue then stays low until it is refilled.
+  for (int i = 0; i < 3; i += 1) {
+    source.processNode(bus, RENDER_QUANTUM_SIZE);
+  }
+  ::testing::Mock::VerifyAndClearExpectations(eventRegistry.get());
+
+  for (int i = 0; i < 4; i += 1) {
+    source.enqueueBuffer(createChunk(0.5f));
+  }
+  EXPECT_CALL(*eventRegistry, dispatchAudioEvent(IsAudioEvent(AudioEventType::BUFFER_QUEUE_LOW, 1)))
+      .Times(1);
+  for (int i = 0; i < 4; i += 1) {
+    source.processNode(bus, RENDER_QUANTUM_SIZE);
+  }
+}
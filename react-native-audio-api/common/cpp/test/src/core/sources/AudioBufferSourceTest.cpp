@@ -0,0 +1,328 @@
+#include <audioapi/core/AudioParam.h>
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/sources/AudioBufferSourceNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/MappedPcmStorage.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <test/src/TestPcmStorage.h>
+#include <test/src/TestWavFile.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace audioapi;
+
+class AudioBufferSourceTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  std::shared_ptr<AudioBuffer> buffer;
+  static constexpr int sampleRate = 44100;
+  static constexpr size_t bufferLength = 1000;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_shared<OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+
+    buffer = std::make_shared<AudioBuffer>(1, bufferLength, sampleRate);
+    std::vector<float> ramp(bufferLength);
+    for (size_t i = 0; i < bufferLength; ++i) {
+      ramp[i] = static_cast<float>(i) / bufferLength;
+    }
+    buffer->copyToChannel(ramp.data(), bufferLength, 0, 0);
+  }
+};
+
+class TestableAudioBufferSourceNode : public AudioBufferSourceNode {
+ public:
+  explicit TestableAudioBufferSourceNode(
+      std::shared_ptr<BaseAudioContext> context,
+      bool pitchCorrection = false)
+      : AudioBufferSourceNode(context, pitchCorrection) {}
+
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override {
+    return AudioBufferSourceNode::processNode(processingBus, framesToProcess);
+  }
+
+  [[nodiscard]] bool hasStretcher() const {
+    return stretch_ != nullptr;
+  }
+
+  [[nodiscard]] size_t getLatencyFrames() const {
+    return getPitchCorrectionLatencyFrames();
+  }
+};
+
+TEST_F(AudioBufferSourceTest, PlaysBufferContent) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context);
+  source.setBuffer(buffer);
+  source.start(0.0, 0.0);
+
+  auto result = source.processNode(bus, RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], buffer->getChannelData(0)[i]);
+  }
+}
+
+TEST_F(AudioBufferSourceTest, LaterWritesDoNotAffectPlayback) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context);
+  source.setBuffer(buffer);
+  source.start(0.0, 0.0);
+
+  std::vector<float> ones(bufferLength, 1.0f);
+  buffer->copyToChannel(ones.data(), bufferLength, 0, 0);
+
+  auto result = source.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_FLOAT_EQ((*result->getChannel(0))[10], 10.0f / bufferLength);
+}
+
+TEST_F(AudioBufferSourceTest, PlaysBackwardsWithNegativeRate) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context);
+  source.setBuffer(buffer);
+  source.getPlaybackRateParam()->setValue(-1.0f);
+  source.start(0.0, static_cast<double>(bufferLength - 1) / sampleRate);
+
+  auto result = source.processNode(bus, RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], buffer->getChannelData(0)[bufferLength - 1 - i]);
+  }
+}
+
+TEST_F(AudioBufferSourceTest, PitchCorrectionTailIsSilent) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context, true);
+  source.setBuffer(buffer);
+  source.start(0.0, 0.0);
+
+  // render past the end of the buffer, the latency tail is read as silence
+  for (int i = 0; i < 100; ++i) {
+    source.processNode(bus, RENDER_QUANTUM_SIZE);
+  }
+
+  EXPECT_TRUE(source.isFinished());
+}
+
+TEST_F(AudioBufferSourceTest, PitchCorrectionIsBypassedAtNeutralSettings) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context, true);
+  source.setBuffer(buffer);
+  source.start(0.0, 0.0);
+
+  auto latency = source.getLatencyFrames();
+  ASSERT_GT(latency, 0);
+
+  std::vector<float> output;
+  while (output.size() < latency + bufferLength) {
+    auto result = source.processNode(bus, RENDER_QUANTUM_SIZE);
+    output.insert(
+        output.end(),
+        result->getChannel(0)->getData(),
+        result->getChannel(0)->getData() + RENDER_QUANTUM_SIZE);
+    EXPECT_FALSE(source.hasStretcher());
+  }
+
+  // passthrough is delayed by the stretcher latency
+  for (size_t i = 0; i < bufferLength; ++i) {
+    EXPECT_FLOAT_EQ(output[latency + i], buffer->getChannelData(0)[i]);
+  }
+}
+
+TEST_F(AudioBufferSourceTest, StretcherIsAttachedWhenRateDeviates) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context, true);
+  source.setBuffer(buffer);
+  source.start(0.0, 0.0);
+
+  source.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_FALSE(source.hasStretcher());
+
+  source.getPlaybackRateParam()->setValue(1.5f);
+  source.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_TRUE(source.hasStretcher());
+}
+
+TEST_F(AudioBufferSourceTest, ConcurrentNodesEachStretchAtDeviatingRate) {
+  constexpr size_t length = sampleRate;
+  auto sine = std::make_shared<AudioBuffer>(1, length, sampleRate);
+  std::vector<float> samples(length);
+  for (size_t i = 0; i < length; ++i) {
+    samples[i] = std::sin(2.0f * PI * 440.0f * static_cast<float>(i) / sampleRate);
+  }
+  sine->copyToChannel(samples.data(), length, 0, 0);
+
+  auto firstBus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto secondBus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto first = TestableAudioBufferSourceNode(context, true);
+  auto second = TestableAudioBufferSourceNode(context, true);
+  for (auto *source : {&first, &second}) {
+    source->setBuffer(sine);
+    source->getPlaybackRateParam()->setValue(1.5f);
+    source->start(0.0, 0.0);
+  }
+
+  float energy = 0.0f;
+  for (size_t frame = 0; frame < 2 * first.getLatencyFrames(); frame += RENDER_QUANTUM_SIZE) {
+    auto firstResult = first.processNode(firstBus, RENDER_QUANTUM_SIZE);
+    auto secondResult = second.processNode(secondBus, RENDER_QUANTUM_SIZE);
+    ASSERT_TRUE(first.hasStretcher());
+    ASSERT_TRUE(second.hasStretcher());
+
+    // both nodes are stretched the same way, neither falls back to the passthrough
+    for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+      auto sample = (*firstResult->getChannel(0))[i];
+      ASSERT_FLOAT_EQ((*secondResult->getChannel(0))[i], sample);
+      energy += sample * sample;
+    }
+  }
+
+  EXPECT_GT(energy, 0.0f);
+}
+
+TEST_F(AudioBufferSourceTest, KeepsPaceAtDeviatingRateWithoutFreeStretcher) {
+  // long enough to play through the stretcher latency at the doubled rate
+  constexpr size_t length = sampleRate;
+  auto ramp = std::make_shared<AudioBuffer>(1, length, sampleRate);
+  std::vector<float> samples(length);
+  for (size_t i = 0; i < length; ++i) {
+    samples[i] = static_cast<float>(i) / length;
+  }
+  ramp->copyToChannel(samples.data(), length, 0, 0);
+
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context, true);
+  source.setBuffer(ramp);
+  source.getPlaybackRateParam()->setValue(2.0f);
+  source.start(0.0, 0.0);
+
+  // e.g. more nodes stretching than the pool can hold
+  auto *group =
+      context->getStretcherPool()->reserve(1, sampleRate, PitchCorrectionQuality::HIGH, 0);
+  std::vector<SignalsmithStretch *> stretchers;
+  while (auto *stretch = group->acquire()) {
+    stretchers.push_back(stretch);
+  }
+
+  auto latency = source.getLatencyFrames();
+  std::vector<float> output;
+  while (output.size() < latency + bufferLength) {
+    auto result = source.processNode(bus, RENDER_QUANTUM_SIZE);
+    output.insert(
+        output.end(),
+        result->getChannel(0)->getData(),
+        result->getChannel(0)->getData() + RENDER_QUANTUM_SIZE);
+    EXPECT_FALSE(source.hasStretcher());
+  }
+
+  // the input is resampled, so the buffer is played twice as fast
+  for (size_t i = 0; i < bufferLength; ++i) {
+    EXPECT_FLOAT_EQ(output[latency + i], samples[2 * i]);
+  }
+
+  for (auto *stretch : stretchers) {
+    group->release(stretch);
+  }
+}
+
+TEST_F(AudioBufferSourceTest, PlaysMappedStorageLikeExpandedBuffer) {
+  auto path = ::testing::TempDir() + "audio_buffer_source_test.wav";
+  std::vector<int16_t> samples(bufferLength);
+  for (size_t i = 0; i < bufferLength; ++i) {
+    samples[i] = static_cast<int16_t>((i * 97) % 65536 - 32768);
+  }
+  test::writeWavFile(path, 1, 1, sampleRate, 16, test::encodeInt16(samples));
+
+  auto storage = MappedPcmStorage::openWav(path);
+  ASSERT_NE(storage, nullptr);
+  auto expanded = std::make_shared<AudioBuffer>(storage);
+  // expands the storage to float
+  ASSERT_NE(expanded->getChannelData(0), nullptr);
+
+  for (auto playbackRate : {1.0f, 0.7f, -1.0f}) {
+    auto mappedBus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+    auto expandedBus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+    auto mappedSource = TestableAudioBufferSourceNode(context);
+    auto expandedSource = TestableAudioBufferSourceNode(context);
+    mappedSource.setBuffer(std::make_shared<AudioBuffer>(storage));
+    expandedSource.setBuffer(expanded);
+
+    for (auto *source : {&mappedSource, &expandedSource}) {
+      source->setInterpolation("sinc");
+      source->setLoop(true);
+      source->getPlaybackRateParam()->setValue(playbackRate);
+      source->start(0.0, 100.0 / sampleRate);
+    }
+
+    // the loop wraps within the rendered quanta
+    for (int quantum = 0; quantum < 10; quantum += 1) {
+      mappedSource.processNode(mappedBus, RENDER_QUANTUM_SIZE);
+      expandedSource.processNode(expandedBus, RENDER_QUANTUM_SIZE);
+      for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+        ASSERT_FLOAT_EQ((*mappedBus->getChannel(0))[i], (*expandedBus->getChannel(0))[i]);
+      }
+    }
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST_F(AudioBufferSourceTest, ReadsStorageAheadOfPlayHead) {
+  auto storage = std::make_shared<test::PrefetchRecordingStorage>(
+      std::vector<int16_t>(4 * sampleRate), static_cast<float>(sampleRate));
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context);
+  source.setBuffer(std::make_shared<AudioBuffer>(storage));
+  source.start(0.0, 0.0);
+
+  // the first second is loaded when playback starts
+  auto ranges = storage->waitForPrefetches(1);
+  ASSERT_EQ(ranges.size(), 1);
+  EXPECT_EQ(ranges[0], test::PrefetchRecordingStorage::Range(0, sampleRate));
+
+  // render two seconds, the worker is asked for the next window every half a second
+  for (size_t frame = 0; frame < 2 * sampleRate; frame += RENDER_QUANTUM_SIZE) {
+    source.processNode(bus, RENDER_QUANTUM_SIZE);
+  }
+
+  ranges = storage->waitForPrefetches(4);
+  ASSERT_EQ(ranges.size(), 4);
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    EXPECT_GT(ranges[i].first, ranges[i - 1].first);
+    EXPECT_LE(
+        ranges[i].first, ranges[i - 1].first + ranges[i - 1].second / 2 + RENDER_QUANTUM_SIZE);
+    EXPECT_EQ(ranges[i].second, sampleRate);
+  }
+}
+
+TEST_F(AudioBufferSourceTest, InterpolatesReadPositionJustBelowNextFrame) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto source = TestableAudioBufferSourceNode(context);
+  source.setBuffer(buffer);
+  source.setInterpolation("sinc");
+  source.getPlaybackRateParam()->setValue(0.5f);
+
+  // the fraction of every other read position rounds to 1.0f in single precision
+  constexpr double startFrame = 100.0;
+  source.start(0.0, (startFrame - 1e-9) / sampleRate);
+
+  auto result = source.processNode(bus, RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    // the buffer is a ramp, so the expected sample is proportional to the read position
+    auto expected = static_cast<float>((startFrame + 0.5 * static_cast<double>(i)) / bufferLength);
+    EXPECT_NEAR((*result->getChannel(0))[i], expected, 1e-4f);
+  }
+}
@@ -0,0 +1,89 @@
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+class AudioBufferTest : public ::testing::Test {
+ protected:
+  static constexpr int sampleRate = 44100;
+  static constexpr size_t length = 16;
+
+  std::shared_ptr<AudioBuffer> buffer;
+
+  void SetUp() override {
+    buffer = std::make_shared<AudioBuffer>(2, length, sampleRate);
+    std::vector<float> ramp(length);
+    for (size_t i = 0; i < length; ++i) {
+      ramp[i] = static_cast<float>(i);
+    }
+    buffer->copyToChannel(ramp.data(), length, 0, 0);
+  }
+};
+
+TEST_F(AudioBufferTest, AcquiredStorageIsShared) {
+  auto first = buffer->acquireBus();
+  auto second = buffer->acquireBus();
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(first->getChannel(0)->getData(), buffer->getChannelData(0));
+}
+
+TEST_F(AudioBufferTest, CopyToChannelDoesNotAffectAcquiredStorage) {
+  auto acquired = buffer->acquireBus();
+  std::vector<float> ones(length, 1.0f);
+
+  buffer->copyToChannel(ones.data(), length, 0, 0);
+
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[3], 1.0f);
+  EXPECT_FLOAT_EQ((*acquired->getChannel(0))[3], 3.0f);
+}
+
+TEST_F(AudioBufferTest, ExposedChannelIsNotSharedWithReaders) {
+  auto acquired = buffer->acquireBus();
+  auto channel = buffer->getSharedChannel(0);
+
+  // storage shared with a reader is copied before being exposed
+  channel->getData()[3] = -1.0f;
+  EXPECT_FLOAT_EQ((*acquired->getChannel(0))[3], 3.0f);
+
+  // while the channel is exposed, readers get a snapshot
+  auto snapshot = buffer->acquireBus();
+  channel->getData()[4] = -1.0f;
+  EXPECT_FLOAT_EQ((*snapshot->getChannel(0))[3], -1.0f);
+  EXPECT_FLOAT_EQ((*snapshot->getChannel(0))[4], 4.0f);
+
+  channel.reset();
+  EXPECT_EQ(buffer->acquireBus(), buffer->acquireBus());
+}
+
+TEST_F(AudioBufferTest, SnapshotIsCopiedOnlyAfterChannelsChange) {
+  auto channel = buffer->getSharedChannel(0);
+
+  // readers share a snapshot until the channels are written to
+  auto first = buffer->acquireBus();
+  EXPECT_EQ(buffer->acquireBus(), first);
+  EXPECT_NE(first->getChannel(0)->getData(), channel->getData());
+
+  // e.g. getChannelData(0)[5] = -1 in JS, which exposes the channel again
+  buffer->getSharedChannel(0)->getData()[5] = -1.0f;
+  auto second = buffer->acquireBus();
+  EXPECT_NE(second, first);
+  EXPECT_FLOAT_EQ((*second->getChannel(0))[5], -1.0f);
+  EXPECT_FLOAT_EQ((*first->getChannel(0))[5], 5.0f);
+  EXPECT_EQ(buffer->acquireBus(), second);
+
+  float value = -2.0f;
+  buffer->copyToChannel(&value, 1, 0, 6);
+  auto third = buffer->acquireBus();
+  EXPECT_NE(third, second);
+  EXPECT_FLOAT_EQ((*third->getChannel(0))[6], -2.0f);
+
+  // writes by another thread, e.g. the recorder, are marked explicitly
+  channel->getData()[7] = -3.0f;
+  buffer->markChannelsWritten();
+  EXPECT_FLOAT_EQ((*buffer->acquireBus()->getChannel(0))[7], -3.0f);
+}
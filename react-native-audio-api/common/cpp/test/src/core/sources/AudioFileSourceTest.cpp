@@ -0,0 +1,175 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/AudioFileSourceNode.h>
+#include <audioapi/core/utils/AudioStreamReader.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using namespace audioapi;
+using ::testing::NiceMock;
+
+class RampStreamReader : public AudioStreamReader {
+ public:
+  RampStreamReader(size_t length, float sampleRate, bool isLengthKnown)
+      : length_(length), sampleRate_(sampleRate), isLengthKnown_(isLengthKnown) {}
+
+  [[nodiscard]] int getNumberOfChannels() const override {
+    return 1;
+  }
+
+  [[nodiscard]] float getSampleRate() const override {
+    return sampleRate_;
+  }
+
+  [[nodiscard]] size_t getLengthInFrames() const override {
+    return isLengthKnown_ ? length_ : 0;
+  }
+
+  size_t read(AudioBus *bus, size_t offset, size_t frames) override {
+    auto framesRead = std::min(frames, length_ - std::min(position_, length_));
+    for (size_t i = 0; i < framesRead; i += 1) {
+      bus->getChannel(0)->getData()[offset + i] = static_cast<float>(position_ + i);
+    }
+    position_ += framesRead;
+    return framesRead;
+  }
+
+  bool seek(size_t frame) override {
+    position_ = frame;
+    return true;
+  }
+
+ private:
+  size_t length_;
+  float sampleRate_;
+  bool isLengthKnown_;
+  size_t position_ = 0;
+};
+
+class TestableAudioFileSourceNode : public AudioFileSourceNode {
+ public:
+  TestableAudioFileSourceNode(
+      std::shared_ptr<BaseAudioContext> context,
+      std::unique_ptr<AudioStreamReader> reader)
+      : AudioFileSourceNode(context, std::move(reader), 0.1) {}
+
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override {
+    return AudioFileSourceNode::processNode(processingBus, framesToProcess);
+  }
+
+  bool isNodeFinished() {
+    return isFinished();
+  }
+};
+
+class AudioFileSourceTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<NiceMock<MockAudioEventHandlerRegistry>> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  std::shared_ptr<AudioBus> bus;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<NiceMock<MockAudioEventHandlerRegistry>>();
+    context = std::make_shared<OfflineAudioContext>(
+        1, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+    bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  }
+
+  std::unique_ptr<TestableAudioFileSourceNode> createSource(
+      size_t length,
+      bool isLengthKnown = true) {
+    return std::make_unique<TestableAudioFileSourceNode>(
+        context, std::make_unique<RampStreamReader>(length, sampleRate, isLengthKnown));
+  }
+
+  // The decoding thread is asynchronous, it is given time to fill the buffer
+  // before every quantum, rendering is retried until anything is played.
+  size_t renderQuantum(TestableAudioFileSourceNode &source) {
+    for (int attempt = 0; attempt < 100; attempt += 1) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      auto before = source.getPosition();
+      source.processNode(bus, RENDER_QUANTUM_SIZE);
+      auto played = static_cast<size_t>((source.getPosition() - before) * sampleRate + 0.5);
+      if (played > 0 || source.isNodeFinished()) {
+        return played;
+      }
+    }
+    return 0;
+  }
+};
+
+TEST_F(AudioFileSourceTest, PlaysFileSequentially) {
+  auto source = createSource(sampleRate);
+  source->start(0.0);
+
+  EXPECT_EQ(renderQuantum(*source), RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], static_cast<float>(i));
+  }
+  EXPECT_DOUBLE_EQ(source->getDuration(), 1.0);
+}
+
+TEST_F(AudioFileSourceTest, SeekIsSampleAccurate) {
+  auto source = createSource(sampleRate);
+  source->start(0.0);
+  renderQuantum(*source);
+
+  // the seek is applied on the audio thread, the decoder catches up afterwards
+  source->seek(0.5);
+  source->processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_DOUBLE_EQ(source->getPosition(), 0.5);
+  renderQuantum(*source);
+
+  auto expected = static_cast<float>(sampleRate / 2);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], expected + static_cast<float>(i));
+  }
+}
+
+TEST_F(AudioFileSourceTest, LoopsBetweenLoopPoints) {
+  auto source = createSource(sampleRate);
+  source->setLoop(true);
+  source->setLoopStart(100.0 / sampleRate);
+  source->setLoopEnd(200.0 / sampleRate);
+  source->seek(150.0 / sampleRate);
+  source->start(0.0);
+
+  // 50 frames up to the loop end, then the loop start again
+  renderQuantum(*source);
+  for (size_t i = 0; i < 50; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], static_cast<float>(150 + i));
+  }
+  EXPECT_FLOAT_EQ((*bus->getChannel(0))[50], 100.0f);
+
+  for (int i = 0; i < 8; i += 1) {
+    renderQuantum(*source);
+  }
+  EXPECT_GE(source->getPosition() * sampleRate, 100.0);
+  EXPECT_LT(source->getPosition() * sampleRate, 200.0);
+}
+
+TEST_F(AudioFileSourceTest, EndsAtEndOfFileOfUnknownLength) {
+  constexpr size_t length = RENDER_QUANTUM_SIZE + 10;
+  auto source = createSource(length, false);
+  EXPECT_DOUBLE_EQ(source->getDuration(), 0.0);
+  source->start(0.0);
+
+  EXPECT_EQ(renderQuantum(*source), RENDER_QUANTUM_SIZE);
+  EXPECT_EQ(renderQuantum(*source), 10);
+  EXPECT_FLOAT_EQ((*bus->getChannel(0))[9], static_cast<float>(length - 1));
+  EXPECT_FLOAT_EQ((*bus->getChannel(0))[10], 0.0f);
+
+  EXPECT_TRUE(source->isNodeFinished());
+  EXPECT_DOUBLE_EQ(source->getDuration(), static_cast<double>(length) / sampleRate);
+}
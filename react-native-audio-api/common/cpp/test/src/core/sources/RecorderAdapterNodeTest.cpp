@@ -0,0 +1,155 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/RecorderAdapterNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/SpscAudioRing.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+class RecorderAdapterNodeTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  static constexpr int sampleRate = 48000;
+  static constexpr size_t recorderBufferSize = 480;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_shared<OfflineAudioContext>(
+        1, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+  }
+};
+
+class TestableRecorderAdapterNode : public RecorderAdapterNode {
+ public:
+  explicit TestableRecorderAdapterNode(std::shared_ptr<BaseAudioContext> context)
+      : RecorderAdapterNode(context) {}
+
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override {
+    return RecorderAdapterNode::processNode(processingBus, framesToProcess);
+  }
+};
+
+TEST_F(RecorderAdapterNodeTest, RingWrapsAroundAndDropsOverflow) {
+  auto ring = SpscAudioRing(8, 2, sampleRate);
+  auto bus = std::make_shared<AudioBus>(8, 2, sampleRate);
+
+  // interleaved [0, 100], [1, 101], ...
+  std::vector<float> data(20);
+  for (size_t i = 0; i < 10; i += 1) {
+    data[2 * i] = static_cast<float>(i);
+    data[2 * i + 1] = static_cast<float>(100 + i);
+  }
+
+  EXPECT_EQ(ring.writeInterleaved(data.data(), 6), 6);
+  EXPECT_EQ(ring.read(bus.get(), 0, 4), 4);
+  // only 6 of the 10 frames fit in the ring
+  EXPECT_EQ(ring.writeInterleaved(data.data(), 10), 6);
+  EXPECT_EQ(ring.getDroppedFrames(), 4);
+  EXPECT_EQ(ring.getAvailableFrames(), 8);
+
+  EXPECT_EQ(ring.read(bus.get(), 0, 8), 8);
+  const float expected[] = {4, 5, 0, 1, 2, 3, 4, 5};
+  for (size_t i = 0; i < 8; i += 1) {
+    EXPECT_FLOAT_EQ((*bus->getChannel(0))[i], expected[i]);
+    EXPECT_FLOAT_EQ((*bus->getChannel(1))[i], 100 + expected[i]);
+  }
+  EXPECT_EQ(ring.read(bus.get(), 0, 1), 0);
+}
+
+TEST_F(RecorderAdapterNodeTest, PlaysSilenceUntilPrebuffered) {
+  auto node = TestableRecorderAdapterNode(context);
+  node.init(recorderBufferSize, 1, sampleRate);
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+
+  std::vector<float> data(recorderBufferSize, 1.0f);
+  node.writeInterleaved(data.data(), recorderBufferSize);
+  node.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_FLOAT_EQ((*bus->getChannel(0))[RENDER_QUANTUM_SIZE - 1], 0.0f);
+
+  node.writeInterleaved(data.data(), recorderBufferSize);
+  node.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_NEAR((*bus->getChannel(0))[RENDER_QUANTUM_SIZE - 1], 1.0f, 1e-3);
+}
+
+TEST_F(RecorderAdapterNodeTest, AbsorbsClockDrift) {
+  // the microphone clock runs 0.1% faster or slower than the output clock
+  for (auto drift : {0.001, -0.001}) {
+    auto node = TestableRecorderAdapterNode(context);
+    node.init(recorderBufferSize, 1, sampleRate);
+    auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+    std::vector<float> data(recorderBufferSize, 1.0f);
+
+    double recorderFrames = 0.0;
+    size_t silentFrames = 0;
+    size_t maxBufferedFrames = 0;
+
+    // about 50 seconds
+    for (int quantum = 0; quantum < 20000; quantum += 1) {
+      recorderFrames += RENDER_QUANTUM_SIZE * (1.0 + drift);
+      while (recorderFrames >= recorderBufferSize) {
+        node.writeInterleaved(data.data(), recorderBufferSize);
+        recorderFrames -= recorderBufferSize;
+      }
+
+      bus->zero();
+      node.processNode(bus, RENDER_QUANTUM_SIZE);
+      if (quantum < 100) {
+        continue;
+      }
+
+      for (size_t i = 0; i < RENDER_QUANTUM_SIZE; i += 1) {
+        silentFrames += (*bus->getChannel(0))[i] < 0.5f ? 1 : 0;
+      }
+      maxBufferedFrames = std::max(maxBufferedFrames, node.getBufferedFrames());
+    }
+
+    EXPECT_EQ(silentFrames, 0) << "drift " << drift;
+    EXPECT_LT(maxBufferedFrames, 2 * (recorderBufferSize + RENDER_QUANTUM_SIZE))
+        << "drift " << drift;
+  }
+}
+
+TEST_F(RecorderAdapterNodeTest, ConvertsRecorderSampleRate) {
+  auto node = TestableRecorderAdapterNode(context);
+  node.init(441, 1, 44100.0f);
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+
+  // 441 frames at 44.1 kHz last 10 ms, as do 480 frames at 48 kHz
+  std::vector<float> data(441);
+  size_t written = 0;
+  size_t read = 0;
+  float maxError = 0.0f;
+
+  for (int quantum = 0; quantum < 400; quantum += 1) {
+    while (written * sampleRate < (read + 4 * RENDER_QUANTUM_SIZE) * 44100) {
+      for (size_t i = 0; i < data.size(); i += 1) {
+        data[i] = std::sin(2.0f * PI * 440.0f * static_cast<float>(written + i) / 44100.0f);
+      }
+      node.writeInterleaved(data.data(), data.size());
+      written += data.size();
+    }
+
+    bus->zero();
+    node.processNode(bus, RENDER_QUANTUM_SIZE);
+    read += RENDER_QUANTUM_SIZE;
+
+    // the phase is unknown, but consecutive samples of a 440 Hz sine at
+    // 48 kHz differ by at most 2 * pi * 440 / 48000
+    for (size_t i = 1; quantum > 10 && i < RENDER_QUANTUM_SIZE; i += 1) {
+      auto step = std::abs((*bus->getChannel(0))[i] - (*bus->getChannel(0))[i - 1]);
+      maxError = std::max(maxError, step);
+    }
+  }
+
+  EXPECT_LT(maxError, 2.0f * PI * 440.0f / sampleRate * 1.05f);
+}
@@ -0,0 +1,188 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/sources/SamplerNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace audioapi;
+
+class SamplerNodeTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  std::shared_ptr<AudioBuffer> buffer;
+  static constexpr int sampleRate = 44100;
+  static constexpr size_t bufferLength = 1000;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_shared<OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+
+    buffer = std::make_shared<AudioBuffer>(1, bufferLength, sampleRate);
+    std::vector<float> ramp(bufferLength);
+    for (size_t i = 0; i < bufferLength; ++i) {
+      ramp[i] = static_cast<float>(i) / bufferLength;
+    }
+    buffer->copyToChannel(ramp.data(), bufferLength, 0, 0);
+  }
+};
+
+class TestableSamplerNode : public SamplerNode {
+ public:
+  explicit TestableSamplerNode(
+      std::shared_ptr<BaseAudioContext> context,
+      size_t maxPolyphony = 8,
+      VoiceStealingPolicy voiceStealing = VoiceStealingPolicy::OLDEST)
+      : SamplerNode(context, maxPolyphony, voiceStealing) {}
+
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override {
+    return SamplerNode::processNode(processingBus, framesToProcess);
+  }
+
+  void setRegion(const std::shared_ptr<AudioBuffer> &buffer) {
+    SamplerRegion region;
+    region.buffer = buffer;
+    region.rootNote = 60;
+    setRegions({region});
+    // voices start at full level and stop right after their note-off
+    setAttack(0.0f);
+    setRelease(0.0f);
+  }
+};
+
+TEST_F(SamplerNodeTest, PlaysRegionAtRootNote) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 2, sampleRate);
+  auto sampler = TestableSamplerNode(context);
+  sampler.setRegion(buffer);
+  sampler.noteOn(60, 1.0f, 0.0, 0.0f);
+
+  auto result = sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    // the mono buffer is played on both channels
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], buffer->getChannelData(0)[i]);
+    EXPECT_FLOAT_EQ((*result->getChannel(1))[i], buffer->getChannelData(0)[i]);
+  }
+}
+
+TEST_F(SamplerNodeTest, TransposesByDistanceFromRootNote) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto sampler = TestableSamplerNode(context);
+  sampler.setRegion(buffer);
+  sampler.noteOn(72, 0.5f, 0.0, 0.0f);
+
+  auto result = sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_NEAR((*result->getChannel(0))[i], 0.5f * buffer->getChannelData(0)[2 * i], 1e-5f);
+  }
+}
+
+TEST_F(SamplerNodeTest, PlaysPcmStorageWithoutExpandingBuffer) {
+  auto compacted = std::make_shared<AudioBuffer>(*buffer);
+  compacted->compact(PcmSampleFormat::INT16);
+  // same samples as float, the copy is expanded on its own
+  auto expanded = std::make_shared<AudioBuffer>(*compacted);
+  ASSERT_NE(expanded->getChannelData(0), nullptr);
+
+  auto storageSampler = TestableSamplerNode(context);
+  auto floatSampler = TestableSamplerNode(context);
+  storageSampler.setRegion(compacted);
+  floatSampler.setRegion(expanded);
+  // a fractional playback rate interpolates between frames
+  storageSampler.noteOn(67, 1.0f, 0.0, 0.0f);
+  floatSampler.noteOn(67, 1.0f, 0.0, 0.0f);
+
+  auto storageResult = storageSampler.processNode(
+      std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 2, sampleRate), RENDER_QUANTUM_SIZE);
+  auto floatResult = floatSampler.processNode(
+      std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 2, sampleRate), RENDER_QUANTUM_SIZE);
+
+  EXPECT_NE(compacted->getPcmStorage(), nullptr);
+  for (int channel = 0; channel < 2; ++channel) {
+    for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+      EXPECT_FLOAT_EQ(
+          (*storageResult->getChannel(channel))[i], (*floatResult->getChannel(channel))[i]);
+    }
+  }
+  EXPECT_GT((*storageResult->getChannel(0))[RENDER_QUANTUM_SIZE - 1], 0.0f);
+}
+
+TEST_F(SamplerNodeTest, StartsNoteAtScheduledFrame) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto sampler = TestableSamplerNode(context);
+  sampler.setRegion(buffer);
+
+  constexpr size_t startFrame = 10;
+  sampler.noteOn(60, 1.0f, static_cast<double>(startFrame) / sampleRate, 0.0f);
+
+  auto result = sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  for (size_t i = 0; i < startFrame; ++i) {
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], 0.0f);
+  }
+  for (size_t i = startFrame; i < RENDER_QUANTUM_SIZE; ++i) {
+    EXPECT_FLOAT_EQ((*result->getChannel(0))[i], buffer->getChannelData(0)[i - startFrame]);
+  }
+}
+
+TEST_F(SamplerNodeTest, StealsOldestVoice) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto sampler = TestableSamplerNode(context, 2, VoiceStealingPolicy::OLDEST);
+  sampler.setRegion(buffer);
+  sampler.noteOn(60, 1.0f, 0.0, 0.0f);
+  sampler.noteOn(61, 1.0f, 0.0, 0.0f);
+  sampler.noteOn(62, 1.0f, 0.0, 0.0f);
+  sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_EQ(sampler.getActiveVoiceCount(), 2);
+
+  // the first note was stolen, so releasing it does not stop any voice
+  sampler.noteOff(60, 0.0);
+  sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_EQ(sampler.getActiveVoiceCount(), 2);
+
+  sampler.noteOff(61, 0.0);
+  sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_EQ(sampler.getActiveVoiceCount(), 1);
+}
+
+TEST_F(SamplerNodeTest, DropsNotesWhenStealingIsDisabled) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto sampler = TestableSamplerNode(context, 1, VoiceStealingPolicy::NONE);
+  sampler.setRegion(buffer);
+  sampler.noteOn(60, 1.0f, 0.0, 0.0f);
+  sampler.noteOn(61, 1.0f, 0.0, 0.0f);
+
+  sampler.noteOff(61, 0.0);
+  sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_EQ(sampler.getActiveVoiceCount(), 1);
+
+  sampler.noteOff(60, 0.0);
+  sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_EQ(sampler.getActiveVoiceCount(), 0);
+}
+
+TEST_F(SamplerNodeTest, ThrowsWhenEventQueueIsFull) {
+  auto bus = std::make_shared<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  auto sampler = TestableSamplerNode(context);
+  sampler.setRegion(buffer);
+
+  // far in the future, so the audio thread keeps every received event
+  for (size_t i = 0; i < SamplerNode::kEventCapacity; ++i) {
+    sampler.noteOn(60, 1.0f, 4.0, 0.0f);
+  }
+  EXPECT_THROW(sampler.noteOn(60, 1.0f, 4.0, 0.0f), std::runtime_error);
+  EXPECT_THROW(sampler.noteOff(60, 4.0), std::runtime_error);
+
+  // received events free the queue
+  sampler.processNode(bus, RENDER_QUANTUM_SIZE);
+  EXPECT_NO_THROW(sampler.noteOff(60, 4.0));
+}
@@ -0,0 +1,72 @@
+#include <audioapi/dsp/Interpolation.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+using namespace audioapi;
+
+class InterpolationTest : public ::testing::TestWithParam<InterpolationType> {
+ protected:
+  static constexpr size_t SOURCE_SIZE = 1024;
+  static constexpr double FREQUENCY = 0.02; // cycles per sample
+
+  std::vector<float> source = std::vector<float>(SOURCE_SIZE);
+
+  void SetUp() override {
+    for (size_t i = 0; i < SOURCE_SIZE; ++i) {
+      source[i] = static_cast<float>(std::sin(2.0 * M_PI * FREQUENCY * static_cast<double>(i)));
+    }
+  }
+};
+
+TEST_P(InterpolationTest, ReproducesSourceAtIntegerPositions) {
+  auto type = GetParam();
+  std::vector<size_t> indices = {100, 101, 102, 103};
+  std::vector<float> fractions(indices.size(), 0.0f);
+  std::vector<float> output(indices.size());
+
+  dsp::interpolate(
+      type, source.data(), indices.data(), fractions.data(), output.data(), indices.size());
+
+  for (size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_NEAR(output[i], source[indices[i]], 1e-3);
+  }
+}
+
+TEST_P(InterpolationTest, FollowsSignalBetweenSamples) {
+  auto type = GetParam();
+  std::vector<size_t> indices;
+  std::vector<float> fractions;
+
+  for (double position = 100.25; position < 400.0; position += 1.37) {
+    indices.push_back(static_cast<size_t>(position));
+    fractions.push_back(static_cast<float>(position - std::floor(position)));
+  }
+
+  std::vector<float> output(indices.size());
+  dsp::interpolate(
+      type, source.data(), indices.data(), fractions.data(), output.data(), indices.size());
+
+  for (size_t i = 0; i < indices.size(); ++i) {
+    auto position = static_cast<double>(indices[i]) + fractions[i];
+    EXPECT_NEAR(output[i], std::sin(2.0 * M_PI * FREQUENCY * position), 5e-3);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Kernels,
+    InterpolationTest,
+    ::testing::Values(
+        InterpolationType::LINEAR, InterpolationType::CUBIC, InterpolationType::SINC));
+
+TEST(VectorMathTest, ReverseCopiesInReverseOrder) {
+  std::vector<float> input = {1, 2, 3, 4, 5, 6, 7};
+  std::vector<float> output(input.size());
+
+  dsp::reverse(input.data(), output.data(), input.size());
+
+  for (size_t i = 0; i < input.size(); ++i) {
+    EXPECT_FLOAT_EQ(output[i], input[input.size() - 1 - i]);
+  }
+}
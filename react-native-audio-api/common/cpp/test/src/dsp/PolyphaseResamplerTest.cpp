@@ -0,0 +1,120 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/PolyphaseResampler.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+class PolyphaseResamplerTest : public ::testing::Test {
+ protected:
+  static std::shared_ptr<AudioBus>
+  createSine(float frequency, float sampleRate, size_t length, int numberOfChannels = 1) {
+    auto bus = std::make_shared<AudioBus>(length, numberOfChannels, sampleRate);
+    for (int ch = 0; ch < numberOfChannels; ch += 1) {
+      auto *data = bus->getChannel(ch)->getData();
+      for (size_t i = 0; i < length; i += 1) {
+        data[i] = 0.5f * std::sin(2.0f * PI * frequency * static_cast<float>(i) / sampleRate);
+      }
+    }
+    return bus;
+  }
+
+  // largest difference from the ideal sine, skipping the filter tails
+  static float maxSineError(const AudioBus &bus, float frequency, size_t margin) {
+    auto *data = bus.getChannel(0)->getData();
+    auto sampleRate = bus.getSampleRate();
+    float maxError = 0.0f;
+    for (size_t i = margin; i < bus.getSize() - margin; i += 1) {
+      auto expected =
+          0.5 * std::sin(2.0 * PI * frequency * static_cast<double>(i) / sampleRate);
+      maxError = std::max(maxError, static_cast<float>(std::abs(data[i] - expected)));
+    }
+    return maxError;
+  }
+};
+
+TEST_F(PolyphaseResamplerTest, ConvertsCommonRatiosExactly) {
+  const float rates[][2] = {{44100.0f, 48000.0f}, {48000.0f, 44100.0f}, {16000.0f, 48000.0f}};
+
+  for (const auto &rate : rates) {
+    auto input = createSine(1000.0f, rate[0], 4410);
+    auto output = PolyphaseResampler::resample(*input, rate[1], ResamplerQuality::HIGH);
+    ASSERT_NE(output, nullptr);
+
+    auto expectedLength = static_cast<size_t>(std::ceil(4410.0 * rate[1] / rate[0]));
+    EXPECT_EQ(output->getSize(), expectedLength);
+    EXPECT_EQ(output->getSampleRate(), rate[1]);
+    EXPECT_LT(maxSineError(*output, 1000.0f, 200), 1e-3f);
+  }
+}
+
+TEST_F(PolyphaseResamplerTest, InterpolatesArbitraryRatio) {
+  auto input = createSine(440.0f, 44100.0f, 8000);
+  auto output = PolyphaseResampler::resample(*input, 47999.5f, ResamplerQuality::MEDIUM);
+  ASSERT_NE(output, nullptr);
+
+  EXPECT_EQ(output->getSize(), static_cast<size_t>(std::ceil(8000.0 * 47999.5 / 44100.0)));
+  EXPECT_LT(maxSineError(*output, 440.0f, 200), 1e-3f);
+}
+
+TEST_F(PolyphaseResamplerTest, StreamingMatchesWholeBufferConversion) {
+  constexpr size_t length = 5000;
+  auto input = createSine(300.0f, 44100.0f, length, 2);
+  auto expected = PolyphaseResampler::resample(*input, 48000.0f, ResamplerQuality::MEDIUM);
+
+  auto resampler =
+      PolyphaseResampler(2, 44100.0f, 48000.0f, ResamplerQuality::MEDIUM, RENDER_QUANTUM_SIZE);
+  auto output = std::make_shared<AudioBus>(expected->getSize(), 2, 48000.0f);
+  size_t framesRead = 0;
+  size_t framesWritten = 0;
+
+  // odd chunk sizes and a tiny output to exercise partial consumption
+  while (framesRead < length) {
+    size_t inputFrames = std::min<size_t>(333, length - framesRead);
+    const float *in[] = {
+        input->getChannel(0)->getData() + framesRead,
+        input->getChannel(1)->getData() + framesRead};
+    float *out[] = {
+        output->getChannel(0)->getData() + framesWritten,
+        output->getChannel(1)->getData() + framesWritten};
+    framesWritten += resampler.process(in, inputFrames, out, 100);
+    framesRead += inputFrames;
+  }
+
+  while (true) {
+    float *out[] = {
+        output->getChannel(0)->getData() + framesWritten,
+        output->getChannel(1)->getData() + framesWritten};
+    auto flushed = resampler.flush(out, std::min<size_t>(100, expected->getSize() - framesWritten));
+    if (flushed == 0) {
+      break;
+    }
+    framesWritten += flushed;
+  }
+
+  ASSERT_EQ(framesWritten, expected->getSize());
+  for (int ch = 0; ch < 2; ch += 1) {
+    for (size_t i = 0; i < framesWritten; i += 1) {
+      EXPECT_FLOAT_EQ((*output->getChannel(ch))[i], (*expected->getChannel(ch))[i]);
+    }
+  }
+}
+
+TEST_F(PolyphaseResamplerTest, DownsamplingRemovesContentAboveNyquist) {
+  auto input = createSine(12000.0f, 48000.0f, 9600);
+  auto output = PolyphaseResampler::resample(*input, 16000.0f, ResamplerQuality::MEDIUM);
+  ASSERT_NE(output, nullptr);
+
+  float energy = 0.0f;
+  auto *data = output->getChannel(0)->getData();
+  for (size_t i = 200; i < output->getSize() - 200; i += 1) {
+    energy += data[i] * data[i];
+  }
+  auto rms = std::sqrt(energy / static_cast<float>(output->getSize() - 400));
+  EXPECT_LT(rms, 1e-3f);
+}
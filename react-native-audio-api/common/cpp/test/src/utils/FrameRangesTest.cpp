@@ -0,0 +1,31 @@
+#include <audioapi/utils/FrameRanges.hpp>
+#include <gtest/gtest.h>
+#include <cstddef>
+
+using namespace audioapi;
+
+TEST(FrameRangesTest, RangesCoverWholeLengthContiguously) {
+  constexpr size_t length = 1000003;
+  auto ranges = splitIntoRanges(length, 4, 1000);
+
+  ASSERT_EQ(ranges.size(), 4);
+  size_t position = 0;
+  for (const auto &range : ranges) {
+    EXPECT_EQ(range.start, position);
+    position += range.length;
+  }
+  EXPECT_EQ(position, length);
+}
+
+TEST(FrameRangesTest, RangesAreNotShorterThanMinimum) {
+  auto ranges = splitIntoRanges(2500, 8, 1000);
+
+  ASSERT_EQ(ranges.size(), 2);
+  EXPECT_EQ(ranges[0].length, 1250);
+  EXPECT_EQ(ranges[1].length, 1250);
+
+  ranges = splitIntoRanges(500, 8, 1000);
+  ASSERT_EQ(ranges.size(), 1);
+  EXPECT_EQ(ranges[0].start, 0);
+  EXPECT_EQ(ranges[0].length, 500);
+}
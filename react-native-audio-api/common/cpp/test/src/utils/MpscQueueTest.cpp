@@ -0,0 +1,72 @@
+#include <audioapi/utils/MpscQueue.hpp>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace audioapi::channels;
+
+struct Record {
+  size_t producer;
+  size_t sequence;
+};
+
+TEST(MpscQueueTest, RejectsRecordsWhenFull) {
+  auto queue = mpsc::Queue<Record>(3);
+  EXPECT_EQ(queue.getCapacity(), 4);
+
+  for (size_t i = 0; i < 4; i += 1) {
+    EXPECT_TRUE(queue.try_send(Record{0, i}));
+  }
+  EXPECT_FALSE(queue.try_send(Record{0, 4}));
+
+  Record record{};
+  for (size_t i = 0; i < 4; i += 1) {
+    ASSERT_TRUE(queue.try_receive(record));
+    EXPECT_EQ(record.sequence, i);
+  }
+  EXPECT_FALSE(queue.try_receive(record));
+
+  // slots are reused after wrapping around
+  EXPECT_TRUE(queue.try_send(Record{0, 5}));
+  ASSERT_TRUE(queue.try_receive(record));
+  EXPECT_EQ(record.sequence, 5);
+}
+
+TEST(MpscQueueTest, KeepsOrderOfEveryProducer) {
+  constexpr size_t producers = 4;
+  constexpr size_t recordsPerProducer = 20000;
+  auto queue = mpsc::Queue<Record>(64);
+
+  std::vector<std::thread> threads;
+  for (size_t p = 0; p < producers; p += 1) {
+    threads.emplace_back([&queue, p]() {
+      for (size_t i = 0; i < recordsPerProducer; i += 1) {
+        while (!queue.try_send(Record{p, i})) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<size_t> nextSequence(producers, 0);
+  size_t received = 0;
+  Record record{};
+
+  while (received < producers * recordsPerProducer) {
+    if (!queue.try_receive(record)) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    ASSERT_LT(record.producer, producers);
+    EXPECT_EQ(record.sequence, nextSequence[record.producer]);
+    nextSequence[record.producer] = record.sequence + 1;
+    received += 1;
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_FALSE(queue.try_receive(record));
+}
@@ -0,0 +1,52 @@
+#include <audioapi/utils/SeqLock.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+using namespace audioapi;
+
+struct Snapshot {
+  double position;
+  double bufferedDuration;
+  int state;
+};
+
+TEST(SeqLockTest, LoadsLatestStore) {
+  auto lock = SeqLock<Snapshot>(Snapshot{1.0, 2.0, 3});
+  auto snapshot = lock.load();
+  EXPECT_DOUBLE_EQ(snapshot.position, 1.0);
+  EXPECT_DOUBLE_EQ(snapshot.bufferedDuration, 2.0);
+  EXPECT_EQ(snapshot.state, 3);
+
+  lock.store(Snapshot{4.0, 5.0, 6});
+  snapshot = lock.load();
+  EXPECT_DOUBLE_EQ(snapshot.position, 4.0);
+  EXPECT_DOUBLE_EQ(snapshot.bufferedDuration, 5.0);
+  EXPECT_EQ(snapshot.state, 6);
+}
+
+TEST(SeqLockTest, ReadersNeverSeeTornRecords) {
+  auto lock = SeqLock<Snapshot>();
+  std::atomic<bool> isDone{false};
+
+  auto writer = std::thread([&]() {
+    for (int i = 1; i <= 100000; i += 1) {
+      auto value = static_cast<double>(i);
+      lock.store(Snapshot{value, -value, i});
+    }
+    isDone.store(true, std::memory_order_release);
+  });
+
+  int lastState = 0;
+  while (!isDone.load(std::memory_order_acquire)) {
+    auto snapshot = lock.load();
+    // every field comes from the same store, and stores are seen in order
+    ASSERT_DOUBLE_EQ(snapshot.position, static_cast<double>(snapshot.state));
+    ASSERT_DOUBLE_EQ(snapshot.bufferedDuration, -snapshot.position);
+    ASSERT_GE(snapshot.state, lastState);
+    lastState = snapshot.state;
+  }
+
+  writer.join();
+  EXPECT_EQ(lock.load().state, 100000);
+}
@@ -48,7 +48,9 @@ class IOSAudioRecorder : public AudioRecorder {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId) override;
+      uint64_t callbackId,
+      bool reuseBuffers,
+      size_t batchSize) override;
   void clearOnAudioReadyCallback() override;
 
  protected:
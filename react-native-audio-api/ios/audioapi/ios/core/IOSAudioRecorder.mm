@@ -3,6 +3,7 @@
 #import <AudioSessionManager.h>
 #import <Foundation/Foundation.h>
 
+#include <array>
 #include <unordered_map>
 
 #include <audioapi/core/sources/RecorderAdapterNode.h>
@@ -19,7 +20,6 @@
 #include <audioapi/utils/AudioBus.h>
 #include <audioapi/utils/AudioFileProperties.h>
 #include <audioapi/utils/CircularAudioArray.h>
-#include <audioapi/utils/CircularOverflowableAudioArray.h>
 #include <audioapi/utils/Result.hpp>
 
 namespace audioapi {
@@ -50,11 +50,12 @@ IOSAudioRecorder::IOSAudioRecorder(
 
     if (isConnected()) {
       if (auto lock = Locker::tryLock(adapterNodeMutex_)) {
-        for (size_t channel = 0; channel < adapterNode_->channelCount_; ++channel) {
-          float *channelData = (float *)inputBuffer->mBuffers[channel].mData;
-
-          adapterNode_->buff_[channel]->write(channelData, numFrames);
+        std::array<const float *, MAX_CHANNEL_COUNT> channelData{};
+        for (int channel = 0; channel < adapterNode_->getChannelCount(); ++channel) {
+          channelData[channel] = (const float *)inputBuffer->mBuffers[channel].mData;
         }
+
+        adapterNode_->write(channelData.data(), numFrames);
       }
     }
   };
@@ -125,8 +126,7 @@ Result<std::string, std::string> IOSAudioRecorder::start(const std::string &file
   }
 
   if (isConnected()) {
-    // TODO: pass sample rate, in case conversion is necessary
-    adapterNode_->init(maxInputBufferLength, inputFormat.channelCount);
+    adapterNode_->init(maxInputBufferLength, inputFormat.channelCount, inputFormat.sampleRate);
   }
 
   [nativeRecorder_ start];
@@ -226,8 +226,9 @@ void IOSAudioRecorder::connect(const std::shared_ptr<RecorderAdapterNode> &node)
   adapterNode_ = node;
 
   if (!isIdle()) {
+    AVAudioFormat *inputFormat = [nativeRecorder_ getInputFormat];
     adapterNode_->init(
-        [nativeRecorder_ getBufferSize], [nativeRecorder_ getInputFormat].channelCount);
+        [nativeRecorder_ getBufferSize], inputFormat.channelCount, inputFormat.sampleRate);
   }
 
   isConnected_.store(true, std::memory_order_release);
@@ -308,17 +309,27 @@ bool IOSAudioRecorder::isIdle() const
 /// @param bufferLength Desired buffer length in frames for the callback audio data.
 /// @param channelCount Number of channels for the callback audio data.
 /// @param callbackId Identifier for the JS callback to be invoked.
+/// @param reuseBuffers Whether the callback buffers are recycled instead of allocated.
+/// @param batchSize Number of buffers delivered in a single event when buffers are recycled.
 /// @returns Success status or Error status with message.
 Result<NoneType, std::string> IOSAudioRecorder::setOnAudioReadyCallback(
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId)
+    uint64_t callbackId,
+    bool reuseBuffers,
+    size_t batchSize)
 {
   std::scoped_lock lock(callbackMutex_, errorCallbackMutex_);
 
   dataCallback_ = std::make_shared<IOSRecorderCallback>(
-      audioEventHandlerRegistry_, sampleRate, bufferLength, channelCount, callbackId);
+      audioEventHandlerRegistry_,
+      sampleRate,
+      bufferLength,
+      channelCount,
+      callbackId,
+      reuseBuffers,
+      batchSize);
 
   if (!isIdle()) {
     auto result = std::static_pointer_cast<IOSRecorderCallback>(dataCallback_)
@@ -6,6 +6,10 @@
 
 #include <audioapi/core/sources/AudioBuffer.h>
 #include <audioapi/core/utils/AudioDecoder.h>
+#include <audioapi/core/utils/Mp3SeekTable.h>
+#include <audioapi/core/utils/ParallelAudioDecoder.h>
+#include <audioapi/core/utils/PcmConverter.h>
+#include <audioapi/core/utils/PlanarAudioStore.h>
 #include <audioapi/dsp/VectorMath.h>
 #include <audioapi/libs/audio-stretch/stretch.h>
 #include <audioapi/libs/base64/base64.h>
@@ -17,14 +21,23 @@
 
 namespace audioapi {
 
-// Decoding audio in fixed-size chunks because total frame count can't be
-// determined in advance. Note: ma_decoder_get_length_in_pcm_frames() always
-// returns 0 for Vorbis decoders.
-std::vector<float> AudioDecoder::readAllPcmFrames(ma_decoder &decoder, int outputChannels)
+// Decoding audio in fixed-size chunks straight into planar channels. The
+// channels are allocated upfront when the length is known, note that
+// ma_decoder_get_length_in_pcm_frames() always returns 0 for Vorbis decoders.
+// Decoders run at the native rate, every decoded chunk is resampled as it is stored.
+std::shared_ptr<AudioBuffer> AudioDecoder::readAllPcmFrames(ma_decoder &decoder, float sampleRate)
 {
-  std::vector<float> buffer;
+  auto outputSampleRate = static_cast<float>(decoder.outputSampleRate);
+  auto outputChannels = static_cast<int>(decoder.outputChannels);
+
+  ma_uint64 expectedLength = 0;
+  if (ma_decoder_get_length_in_pcm_frames(&decoder, &expectedLength) != MA_SUCCESS) {
+    expectedLength = 0;
+  }
+
+  PlanarAudioStore store(
+      outputChannels, outputSampleRate, static_cast<size_t>(expectedLength), sampleRate);
   std::vector<float> temp(CHUNK_SIZE * outputChannels);
-  ma_uint64 outFramesRead = 0;
 
   while (true) {
     ma_uint64 tempFramesDecoded = 0;
@@ -33,35 +46,15 @@ std::vector<float> AudioDecoder::readAllPcmFrames(ma_decoder &decoder, int outpu
       break;
     }
 
-    buffer.insert(buffer.end(), temp.data(), temp.data() + tempFramesDecoded * outputChannels);
-    outFramesRead += tempFramesDecoded;
+    store.appendInterleaved(temp.data(), static_cast<size_t>(tempFramesDecoded));
   }
 
-  if (outFramesRead == 0) {
+  auto audioBus = store.finish();
+  if (audioBus == nullptr) {
     NSLog(@"Failed to decode");
-  }
-  return buffer;
-}
-
-std::shared_ptr<AudioBuffer> AudioDecoder::makeAudioBufferFromFloatBuffer(
-    const std::vector<float> &buffer,
-    float outputSampleRate,
-    int outputChannels)
-{
-  if (buffer.empty()) {
     return nullptr;
   }
 
-  auto outputFrames = buffer.size() / outputChannels;
-  auto audioBus = std::make_shared<AudioBus>(outputFrames, outputChannels, outputSampleRate);
-
-  for (int ch = 0; ch < outputChannels; ++ch) {
-    auto channelData = audioBus->getChannel(ch)->getData();
-    for (int i = 0; i < outputFrames; ++i) {
-      channelData[i] = buffer[i * outputChannels + ch];
-    }
-  }
-
   return std::make_shared<AudioBuffer>(audioBus);
 }
 
@@ -82,8 +75,27 @@ std::shared_ptr<AudioBuffer> AudioDecoder::decodeWithFilePath(
     return nullptr;
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
   }
+
+  auto format = AudioFormat::UNKNOWN;
+  if (AudioDecoder::pathHasExtension(path, {".wav"})) {
+    format = AudioFormat::WAV;
+  } else if (AudioDecoder::pathHasExtension(path, {".flac"})) {
+    format = AudioFormat::FLAC;
+  } else if (AudioDecoder::pathHasExtension(path, {".mp3"})) {
+    format = AudioFormat::MP3;
+  }
+  auto parallelBuffer = ParallelAudioDecoder::decode(
+      format,
+      [&path](const ma_decoder_config *config, ma_decoder *decoder) {
+        return ma_decoder_init_file(path.c_str(), config, decoder);
+      },
+      sampleRate);
+  if (parallelBuffer != nullptr) {
+    return parallelBuffer;
+  }
+
   ma_decoder decoder;
-  ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, static_cast<int>(sampleRate));
+  ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
   ma_decoding_backend_vtable *customBackends[] = {
       ma_decoding_backend_libvorbis, ma_decoding_backend_libopus};
 
@@ -96,12 +108,9 @@ std::shared_ptr<AudioBuffer> AudioDecoder::decodeWithFilePath(
     return nullptr;
   }
 
-  auto outputSampleRate = static_cast<float>(decoder.outputSampleRate);
-  auto outputChannels = static_cast<int>(decoder.outputChannels);
-
-  std::vector<float> buffer = readAllPcmFrames(decoder, outputChannels);
+  auto buffer = readAllPcmFrames(decoder, sampleRate);
   ma_decoder_uninit(&decoder);
-  return makeAudioBufferFromFloatBuffer(buffer, outputSampleRate, outputChannels);
+  return buffer;
 }
 
 std::shared_ptr<AudioBuffer>
@@ -121,8 +130,19 @@ AudioDecoder::decodeWithMemoryBlock(const void *data, size_t size, float sampleR
     return nullptr;
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
   }
+
+  auto parallelBuffer = ParallelAudioDecoder::decode(
+      format,
+      [data, size](const ma_decoder_config *config, ma_decoder *decoder) {
+        return ma_decoder_init_memory(data, size, config, decoder);
+      },
+      sampleRate);
+  if (parallelBuffer != nullptr) {
+    return parallelBuffer;
+  }
+
   ma_decoder decoder;
-  ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, static_cast<int>(sampleRate));
+  ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
 
   ma_decoding_backend_vtable *customBackends[] = {
       ma_decoding_backend_libvorbis, ma_decoding_backend_libopus};
@@ -136,12 +156,9 @@ AudioDecoder::decodeWithMemoryBlock(const void *data, size_t size, float sampleR
     return nullptr;
   }
 
-  auto outputSampleRate = static_cast<float>(decoder.outputSampleRate);
-  auto outputChannels = static_cast<int>(decoder.outputChannels);
-
-  std::vector<float> buffer = readAllPcmFrames(decoder, outputChannels);
+  auto buffer = readAllPcmFrames(decoder, sampleRate);
   ma_decoder_uninit(&decoder);
-  return makeAudioBufferFromFloatBuffer(buffer, outputSampleRate, outputChannels);
+  return buffer;
 }
 
 std::shared_ptr<AudioBuffer> AudioDecoder::decodeWithPCMInBase64(
@@ -175,4 +192,23 @@ std::shared_ptr<AudioBuffer> AudioDecoder::decodeWithPCMInBase64(
   return std::make_shared<AudioBuffer>(audioBus);
 }
 
+std::shared_ptr<AudioBuffer> AudioDecoder::decodeWithPCMData(
+    const void *data,
+    size_t size,
+    PcmSampleFormat format,
+    float inputSampleRate,
+    int inputChannelCount,
+    bool interleaved,
+    float outputSampleRate)
+{
+  auto audioBus = PcmConverter::toAudioBus(
+      data, size, format, inputChannelCount, inputSampleRate, interleaved, outputSampleRate);
+  if (audioBus == nullptr) {
+    NSLog(@"Failed to convert PCM data");
+    return nullptr;
+  }
+
+  return std::make_shared<AudioBuffer>(audioBus);
+}
+
 } // namespace audioapi
@@ -14,7 +14,6 @@ typedef struct objc_object AVAudioConverter;
 namespace audioapi {
 
 class AudioBus;
-class CircularAudioArray;
 class AudioEventHandlerRegistry;
 
 class IOSRecorderCallback : public AudioRecorderCallback {
@@ -24,7 +23,9 @@ class IOSRecorderCallback : public AudioRecorderCallback {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId);
+      uint64_t callbackId,
+      bool reuseBuffers,
+      size_t batchSize);
   ~IOSRecorderCallback();
 
   Result<NoneType, std::string> prepare(AVAudioFormat *bufferFormat, size_t maxInputBufferLength);
@@ -8,9 +8,10 @@
 #include <audioapi/ios/core/utils/IOSRecorderCallback.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
-#include <audioapi/utils/CircularAudioArray.h>
+#include <audioapi/utils/SpscAudioRing.h>
 #include <audioapi/utils/Result.hpp>
 #include <algorithm>
+#include <array>
 
 namespace audioapi {
 
@@ -19,13 +20,17 @@ IOSRecorderCallback::IOSRecorderCallback(
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId)
+    uint64_t callbackId,
+    bool reuseBuffers,
+    size_t batchSize)
     : AudioRecorderCallback(
           audioEventHandlerRegistry,
           sampleRate,
           bufferLength,
           channelCount,
-          callbackId)
+          callbackId,
+          reuseBuffers,
+          batchSize)
 {
 }
 
@@ -37,10 +42,6 @@ IOSRecorderCallback::~IOSRecorderCallback()
     callbackFormat_ = nil;
     converterInputBuffer_ = nil;
     converterOutputBuffer_ = nil;
-
-    for (int i = 0; i < channelCount_; ++i) {
-      circularBus_[i]->zero();
-    }
   }
 }
 
@@ -97,7 +98,7 @@ Result<NoneType, std::string> IOSRecorderCallback::prepare(
 void IOSRecorderCallback::cleanup()
 {
   @autoreleasepool {
-    if (circularBus_[0]->getNumberOfAvailableFrames() > 0) {
+    if (ring_->getAvailableFrames() > 0) {
       emitAudioData(true);
     }
 
@@ -106,14 +107,10 @@ void IOSRecorderCallback::cleanup()
     callbackFormat_ = nil;
     converterInputBuffer_ = nil;
     converterOutputBuffer_ = nil;
-
-    for (int i = 0; i < channelCount_; ++i) {
-      circularBus_[i]->zero();
-    }
   }
 }
 
-/// @brief Receives audio data from the recorder, processes it, and stores it in the circular buffer.
+/// @brief Receives audio data from the recorder, processes it, and stores it in the ring buffer.
 /// The data is converted using AVAudioConverter if the input format differs from the user desired callback format.
 /// This method runs on the audio thread.
 /// @param inputBuffer Pointer to the AudioBufferList containing the incoming audio data.
@@ -129,13 +126,14 @@ void IOSRecorderCallback::receiveAudioData(const AudioBufferList *inputBuffer, i
 
     if (bufferFormat_.sampleRate == sampleRate_ && bufferFormat_.channelCount == channelCount_ &&
         !bufferFormat_.isInterleaved) {
-      // Directly write to circular buffer
+      // Directly write to ring buffer
+      std::array<const float *, MAX_CHANNEL_COUNT> inputChannels{};
       for (int i = 0; i < channelCount_; ++i) {
-        auto *inputChannel = static_cast<float *>(inputBuffer->mBuffers[i].mData);
-        circularBus_[i]->push_back(inputChannel, numFrames);
+        inputChannels[i] = static_cast<const float *>(inputBuffer->mBuffers[i].mData);
       }
+      ring_->write(inputChannels.data(), numFrames);
 
-      if (circularBus_[0]->getNumberOfAvailableFrames() >= bufferLength_) {
+      if (ring_->getAvailableFrames() >= bufferLength_) {
         emitAudioData();
       }
       return;
@@ -176,13 +174,14 @@ void IOSRecorderCallback::receiveAudioData(const AudioBufferList *inputBuffer, i
       return;
     }
 
+    std::array<const float *, MAX_CHANNEL_COUNT> outputChannels{};
     for (int i = 0; i < channelCount_; ++i) {
-      auto *inputChannel =
-          static_cast<float *>(converterOutputBuffer_.audioBufferList->mBuffers[i].mData);
-      circularBus_[i]->push_back(inputChannel, outputFrameCount);
+      outputChannels[i] =
+          static_cast<const float *>(converterOutputBuffer_.audioBufferList->mBuffers[i].mData);
     }
+    ring_->write(outputChannels.data(), outputFrameCount);
 
-    if (circularBus_[0]->getNumberOfAvailableFrames() >= bufferLength_) {
+    if (ring_->getAvailableFrames() >= bufferLength_) {
       emitAudioData();
     }
   }
@@ -5,8 +5,16 @@ export { default as AudioBuffer } from './core/AudioBuffer';
 export { default as AudioBufferQueueSourceNode } from './core/AudioBufferQueueSourceNode';
 export { default as AudioBufferSourceNode } from './core/AudioBufferSourceNode';
 export { default as AudioContext } from './core/AudioContext';
-export { decodeAudioData, decodePCMInBase64 } from './core/AudioDecoder';
+export {
+  clearDecodedAudioCache,
+  decodeAudioData,
+  decodePCMData,
+  decodePCMInBase64,
+  prefetchAudioData,
+  setDecodedAudioCacheBudget,
+} from './core/AudioDecoder';
 export { default as AudioDestinationNode } from './core/AudioDestinationNode';
+export { default as AudioFileSourceNode } from './core/AudioFileSourceNode';
 export { default as AudioNode } from './core/AudioNode';
 export { default as AudioParam } from './core/AudioParam';
 export { default as AudioRecorder } from './core/AudioRecorder';
@@ -18,10 +26,12 @@ export { default as ConstantSourceNode } from './core/ConstantSourceNode';
 export { default as ConvolverNode } from './core/ConvolverNode';
 export { default as DelayNode } from './core/DelayNode';
 export { default as GainNode } from './core/GainNode';
+export { default as MixerNode } from './core/MixerNode';
 export { default as OfflineAudioContext } from './core/OfflineAudioContext';
 export { default as OscillatorNode } from './core/OscillatorNode';
 export { default as PeriodicWave } from './core/PeriodicWave';
 export { default as RecorderAdapterNode } from './core/RecorderAdapterNode';
+export { default as SamplerNode } from './core/SamplerNode';
 export { default as StereoPannerNode } from './core/StereoPannerNode';
 export { default as StreamerNode } from './core/StreamerNode';
 export { default as WaveShaperNode } from './core/WaveShaperNode';
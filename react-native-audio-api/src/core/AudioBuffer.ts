@@ -1,5 +1,6 @@
 import { IAudioBuffer } from '../interfaces';
 import { IndexSizeError } from '../errors';
+import { CompactSampleFormat } from '../types';
 
 export default class AudioBuffer {
   readonly length: number;
@@ -17,6 +18,11 @@ export default class AudioBuffer {
     this.numberOfChannels = buffer.numberOfChannels;
   }
 
+  /**
+   * Returns the samples of a channel, writes to them change the buffer.
+   * Playing or enqueueing the buffer takes its content at that moment, call
+   * `getChannelData` again before writing new content for a later one.
+   */
   public getChannelData(channel: number): Float32Array {
     if (channel < 0 || channel >= this.numberOfChannels) {
       throw new IndexSizeError(
@@ -65,4 +71,14 @@ export default class AudioBuffer {
 
     this.buffer.copyToChannel(source, channelNumber, startInChannel);
   }
+
+  /**
+   * Stores the samples as 16-bit integers or half floats, halving the memory
+   * used by the buffer. Samples are converted back to float while playing,
+   * `getChannelData` restores float storage. Arrays returned by
+   * `getChannelData` before are no longer connected to the buffer.
+   */
+  public compact(sampleFormat: CompactSampleFormat = 'int16'): void {
+    this.buffer.compact(sampleFormat);
+  }
 }
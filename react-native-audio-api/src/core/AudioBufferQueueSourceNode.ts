@@ -2,8 +2,53 @@ import { IAudioBufferQueueSourceNode } from '../interfaces';
 import AudioBufferBaseSourceNode from './AudioBufferBaseSourceNode';
 import AudioBuffer from './AudioBuffer';
 import { RangeError } from '../errors';
+import { AudioEventSubscription } from '../events';
+import { EventTypeWithValue } from '../events/types';
 
 export default class AudioBufferQueueSourceNode extends AudioBufferBaseSourceNode {
+  private onBufferQueueLowSubscription?: AudioEventSubscription;
+  private onBufferQueueLowCallback?: (event: EventTypeWithValue) => void;
+
+  public get lowWaterMark(): number {
+    return (this.node as IAudioBufferQueueSourceNode).lowWaterMark;
+  }
+
+  public set lowWaterMark(value: number) {
+    if (value < 0) {
+      throw new RangeError(
+        `lowWaterMark must be a finite non-negative number: ${value}`
+      );
+    }
+
+    (this.node as IAudioBufferQueueSourceNode).lowWaterMark = value;
+  }
+
+  public get onBufferQueueLow():
+    | ((event: EventTypeWithValue) => void)
+    | undefined {
+    return this.onBufferQueueLowCallback;
+  }
+
+  public set onBufferQueueLow(
+    callback: ((event: EventTypeWithValue) => void) | null
+  ) {
+    if (!callback) {
+      (this.node as IAudioBufferQueueSourceNode).onBufferQueueLow = '0';
+      this.onBufferQueueLowSubscription?.remove();
+      this.onBufferQueueLowSubscription = undefined;
+      this.onBufferQueueLowCallback = undefined;
+
+      return;
+    }
+
+    this.onBufferQueueLowCallback = callback;
+    this.onBufferQueueLowSubscription =
+      this.audioEventEmitter.addAudioEventListener('bufferQueueLow', callback);
+
+    (this.node as IAudioBufferQueueSourceNode).onBufferQueueLow =
+      this.onBufferQueueLowSubscription.subscriptionId;
+  }
+
   public enqueueBuffer(buffer: AudioBuffer): string {
     return (this.node as IAudioBufferQueueSourceNode).enqueueBuffer(
       buffer.buffer
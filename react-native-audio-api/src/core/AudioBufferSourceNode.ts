@@ -4,6 +4,7 @@ import AudioBuffer from './AudioBuffer';
 import { InvalidStateError, RangeError } from '../errors';
 import { EventEmptyType } from '../events/types';
 import { AudioEventSubscription } from '../events';
+import { InterpolationType } from '../types';
 
 export default class AudioBufferSourceNode extends AudioBufferBaseSourceNode {
   private onLoopEndedSubscription?: AudioEventSubscription;
@@ -58,6 +59,14 @@ export default class AudioBufferSourceNode extends AudioBufferBaseSourceNode {
     (this.node as IAudioBufferSourceNode).loopEnd = value;
   }
 
+  public get interpolation(): InterpolationType {
+    return (this.node as IAudioBufferSourceNode).interpolation;
+  }
+
+  public set interpolation(value: InterpolationType) {
+    (this.node as IAudioBufferSourceNode).interpolation = value;
+  }
+
   public start(when: number = 0, offset: number = 0, duration?: number): void {
     if (when < 0) {
       throw new RangeError(
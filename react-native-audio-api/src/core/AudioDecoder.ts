@@ -1,8 +1,8 @@
 import { Image } from 'react-native';
 
-import { AudioApiError } from '../errors';
+import { AudioApiError, InvalidAccessError, RangeError } from '../errors';
 import { IAudioDecoder } from '../interfaces';
-import { DecodeDataInput } from '../types';
+import { DecodeDataInput, PCMDataInput, PCMDataOptions } from '../types';
 import {
   isBase64Source,
   isDataBlobString,
@@ -10,6 +10,10 @@ import {
 } from '../utils/paths';
 import AudioBuffer from './AudioBuffer';
 
+function toFilePath(source: string): string {
+  return source.startsWith('file://') ? source.replace('file://', '') : source;
+}
+
 class AudioDecoder {
   private static instance: AudioDecoder | null = null;
   protected readonly decoder: IAudioDecoder;
@@ -66,13 +70,8 @@ class AudioDecoder {
       throw new TypeError('Input must be a module, uri or ArrayBuffer');
     }
 
-    // Local file path
-    const filePath = stringSource.startsWith('file://')
-      ? stringSource.replace('file://', '')
-      : stringSource;
-
     const buffer = await this.decoder.decodeWithFilePath(
-      filePath,
+      toFilePath(stringSource),
       sampleRate ?? 0
     );
 
@@ -105,6 +104,48 @@ class AudioDecoder {
     return audioBuffer;
   }
 
+  public async prefetchInstance(
+    inputs: Array<string | number>,
+    sampleRate?: number
+  ): Promise<boolean[]> {
+    return Promise.all(
+      inputs.map((input) => {
+        const source =
+          typeof input === 'number'
+            ? Image.resolveAssetSource(input).uri
+            : input;
+
+        // only local files are cached
+        if (
+          isBase64Source(source) ||
+          isDataBlobString(source) ||
+          isRemoteSource(source)
+        ) {
+          return Promise.resolve(false);
+        }
+
+        return this.decoder.prefetchWithFilePath(
+          toFilePath(source),
+          sampleRate ?? 0
+        );
+      })
+    );
+  }
+
+  public setCacheBudgetInstance(bytes: number): void {
+    if (!Number.isFinite(bytes) || bytes < 0) {
+      throw new RangeError(
+        `The cache budget must be a finite non-negative number: ${bytes}`
+      );
+    }
+
+    this.decoder.setCacheBudget(bytes);
+  }
+
+  public clearCacheInstance(): void {
+    this.decoder.clearCache();
+  }
+
   public async decodePCMInBase64Instance(
     base64String: string,
     inputSampleRate: number,
@@ -119,6 +160,50 @@ class AudioDecoder {
     );
     return new AudioBuffer(buffer);
   }
+
+  public async decodePCMDataInstance(
+    input: PCMDataInput,
+    options: PCMDataOptions,
+    outputSampleRate?: number
+  ): Promise<AudioBuffer> {
+    const sampleFormat =
+      options.sampleFormat ??
+      (input instanceof Float32Array ? 'float32' : 'int16');
+    const bytesPerSample = sampleFormat === 'float32' ? 4 : 2;
+
+    if (options.numberOfChannels < 1 || options.numberOfChannels > 32) {
+      throw new RangeError(
+        `The number of channels must be in [1, 32] range: ${options.numberOfChannels}`
+      );
+    }
+
+    if (options.sampleRate <= 0) {
+      throw new RangeError(
+        `The sample rate must be greater than 0: ${options.sampleRate}`
+      );
+    }
+
+    const data =
+      input instanceof ArrayBuffer
+        ? new Uint8Array(input)
+        : new Uint8Array(input.buffer, input.byteOffset, input.byteLength);
+
+    if (data.byteOffset % bytesPerSample !== 0) {
+      throw new InvalidAccessError(
+        `The samples must be aligned to ${bytesPerSample} bytes: ${data.byteOffset}`
+      );
+    }
+
+    const buffer = await this.decoder.decodeWithPCMData(
+      data,
+      sampleFormat,
+      options.sampleRate,
+      options.numberOfChannels,
+      options.interleaved ?? true,
+      outputSampleRate ?? 0
+    );
+    return new AudioBuffer(buffer);
+  }
 }
 
 export async function decodeAudioData(
@@ -146,3 +231,50 @@ export async function decodePCMInBase64(
     isInterleaved
   );
 }
+
+/**
+ * Converts raw int16 or float32 samples into an AudioBuffer without a base64
+ * round trip. The samples are read in place and must not be modified until
+ * the returned promise settles.
+ *
+ * @param outputSampleRate Rate to resample to, the input rate is kept when
+ * it is not provided.
+ */
+export async function decodePCMData(
+  input: PCMDataInput,
+  options: PCMDataOptions,
+  outputSampleRate?: number
+): Promise<AudioBuffer> {
+  return AudioDecoder.getInstance().decodePCMDataInstance(
+    input,
+    options,
+    outputSampleRate
+  );
+}
+
+/**
+ * Decodes local files into the process-wide cache used by `decodeAudioData`
+ * on background threads, so that later decodes resolve without decoding.
+ * The sample rate has to match the one later passed to `decodeAudioData`,
+ * contexts pass their own sample rate. Remote sources are not cached.
+ *
+ * @returns For every input, whether it was decoded.
+ */
+export async function prefetchAudioData(
+  inputs: Array<string | number>,
+  sampleRate?: number
+): Promise<boolean[]> {
+  return AudioDecoder.getInstance().prefetchInstance(inputs, sampleRate);
+}
+
+/**
+ * Sets the number of bytes of decoded audio kept by the cache, least
+ * recently used files are evicted first. 0 disables the cache.
+ */
+export function setDecodedAudioCacheBudget(bytes: number): void {
+  AudioDecoder.getInstance().setCacheBudgetInstance(bytes);
+}
+
+export function clearDecodedAudioCache(): void {
+  AudioDecoder.getInstance().clearCacheInstance();
+}
@@ -0,0 +1,59 @@
+import { IAudioFileSourceNode } from '../interfaces';
+import AudioScheduledSourceNode from './AudioScheduledSourceNode';
+import { RangeError } from '../errors';
+
+export default class AudioFileSourceNode extends AudioScheduledSourceNode {
+  public get loop(): boolean {
+    return (this.node as IAudioFileSourceNode).loop;
+  }
+
+  public set loop(value: boolean) {
+    (this.node as IAudioFileSourceNode).loop = value;
+  }
+
+  public get loopStart(): number {
+    return (this.node as IAudioFileSourceNode).loopStart;
+  }
+
+  public set loopStart(value: number) {
+    (this.node as IAudioFileSourceNode).loopStart = value;
+  }
+
+  public get loopEnd(): number {
+    return (this.node as IAudioFileSourceNode).loopEnd;
+  }
+
+  public set loopEnd(value: number) {
+    (this.node as IAudioFileSourceNode).loopEnd = value;
+  }
+
+  public get duration(): number {
+    return (this.node as IAudioFileSourceNode).duration;
+  }
+
+  public get position(): number {
+    return (this.node as IAudioFileSourceNode).position;
+  }
+
+  public get readAhead(): number {
+    return (this.node as IAudioFileSourceNode).readAhead;
+  }
+
+  public get bufferedDuration(): number {
+    return (this.node as IAudioFileSourceNode).bufferedDuration;
+  }
+
+  public get underrunCount(): number {
+    return (this.node as IAudioFileSourceNode).underrunCount;
+  }
+
+  public seek(position: number): void {
+    if (position < 0) {
+      throw new RangeError(
+        `position must be a finite non-negative number: ${position}`
+      );
+    }
+
+    (this.node as IAudioFileSourceNode).seek(position);
+  }
+}
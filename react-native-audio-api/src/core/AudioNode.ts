@@ -2,7 +2,7 @@ import { IAudioNode } from '../interfaces';
 import AudioParam from './AudioParam';
 import { ChannelCountMode, ChannelInterpretation } from '../types';
 import BaseAudioContext from './BaseAudioContext';
-import { InvalidAccessError } from '../errors';
+import { IndexSizeError, InvalidAccessError } from '../errors';
 
 export default class AudioNode {
   readonly context: BaseAudioContext;
@@ -23,26 +23,59 @@ export default class AudioNode {
     this.channelInterpretation = this.node.channelInterpretation;
   }
 
-  public connect(destination: AudioNode): AudioNode;
-  public connect(destination: AudioParam): void;
-  public connect(destination: AudioNode | AudioParam): AudioNode | void {
+  public connect(
+    destination: AudioNode,
+    output?: number,
+    input?: number
+  ): AudioNode;
+  public connect(destination: AudioParam, output?: number): void;
+  public connect(
+    destination: AudioNode | AudioParam,
+    output: number = 0,
+    input: number = 0
+  ): AudioNode | void {
     if (this.context !== destination.context) {
       throw new InvalidAccessError(
         'Source and destination are from different BaseAudioContexts'
       );
     }
 
+    if (output < 0 || output >= Math.max(this.numberOfOutputs, 1)) {
+      throw new IndexSizeError(`The output index ${output} is out of range`);
+    }
+
     if (destination instanceof AudioParam) {
       this.node.connect(destination.audioParam);
     } else {
-      this.node.connect(destination.node);
+      if (input < 0 || input >= Math.max(destination.numberOfInputs, 1)) {
+        throw new IndexSizeError(`The input index ${input} is out of range`);
+      }
+
+      this.node.connect(destination.node, output, input);
       return destination;
     }
   }
 
-  public disconnect(destination?: AudioNode | AudioParam): void {
+  public disconnect(
+    destination?: AudioNode | AudioParam,
+    output?: number,
+    input?: number
+  ): void {
+    if (output !== undefined) {
+      if (output < 0 || output >= Math.max(this.numberOfOutputs, 1)) {
+        throw new IndexSizeError(`The output index ${output} is out of range`);
+      }
+    }
+
     if (destination instanceof AudioParam) {
       this.node.disconnect(destination.audioParam);
+    } else if (destination !== undefined && input !== undefined) {
+      // only the connection to this input, others to the same node are kept
+      if (input < 0 || input >= Math.max(destination.numberOfInputs, 1)) {
+        throw new IndexSizeError(`The input index ${input} is out of range`);
+      }
+
+      this.node.disconnect(destination.node, output ?? 0, input);
     } else {
       this.node.disconnect(destination?.node);
     }
@@ -154,21 +154,53 @@ export default class AudioRecorder {
       this.onAudioReadySubscription = null;
     }
 
-    this.onAudioReadySubscription =
-      this.audioEventEmitter.addAudioEventListener('audioReady', (event) => {
-        const audioBuffer = new AudioBuffer(event.buffer);
-        callback({
-          ...event,
-          buffer: audioBuffer,
-        });
-      });
-
-    return this.recorder.setOnAudioReady({
+    const reuseBuffers = options.reuseBuffers ?? false;
+    const batchSize = options.batchSize ?? 1;
+    let pooledBuffers: AudioBuffer[] = [];
+
+    const subscription = this.audioEventEmitter.addAudioEventListener(
+      'audioReady',
+      (event) => {
+        if (!('batch' in event)) {
+          callback({ ...event, buffer: new AudioBuffer(event.buffer) });
+          return;
+        }
+
+        try {
+          for (let i = 0; i < event.chunkCount; i++) {
+            const isLast = i === event.chunkCount - 1;
+            callback({
+              buffer: pooledBuffers[event.batch * batchSize + i],
+              numFrames: isLast ? event.numFrames : options.bufferLength,
+            } as OnAudioReadyEventType);
+          }
+        } finally {
+          this.recorder.releaseAudioReadyBatch(
+            subscription.subscriptionId,
+            event.batch
+          );
+        }
+      }
+    );
+    this.onAudioReadySubscription = subscription;
+
+    const result = this.recorder.setOnAudioReady({
       sampleRate: options.sampleRate,
       bufferLength: options.bufferLength,
       channelCount: options.channelCount,
-      callbackId: this.onAudioReadySubscription.subscriptionId,
+      reuseBuffers,
+      batchSize,
+      callbackId: subscription.subscriptionId,
     });
+
+    if (reuseBuffers && result.status === 'success') {
+      // wrapped once, the same buffers are refilled for every batch
+      pooledBuffers = this.recorder
+        .getAudioReadyBuffers()
+        .map((buffer) => new AudioBuffer(buffer));
+    }
+
+    return result;
   }
 
   /**
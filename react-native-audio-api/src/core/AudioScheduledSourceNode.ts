@@ -3,6 +3,7 @@ import AudioNode from './AudioNode';
 import { InvalidStateError, RangeError } from '../errors';
 import { OnEndedEventType } from '../events/types';
 import { AudioEventEmitter, AudioEventSubscription } from '../events';
+import { PlaybackSnapshot } from '../types';
 
 export default class AudioScheduledSourceNode extends AudioNode {
   protected hasBeenStarted: boolean = false;
@@ -44,6 +45,14 @@ export default class AudioScheduledSourceNode extends AudioNode {
     (this.node as IAudioScheduledSourceNode).stop(when);
   }
 
+  /**
+   * State, position and buffered duration of the source, read in a single call
+   * and all taken at the same render quantum.
+   */
+  public get playbackSnapshot(): PlaybackSnapshot {
+    return (this.node as IAudioScheduledSourceNode).playbackSnapshot;
+  }
+
   public get onEnded(): ((event: OnEndedEventType) => void) | undefined {
     return this.onEndedCallback;
   }
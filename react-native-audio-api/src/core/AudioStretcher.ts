@@ -1,13 +1,17 @@
 import { IAudioStretcher } from '../interfaces';
 import AudioBuffer from './AudioBuffer';
 import { AudioApiError } from '../errors';
+import { AudioEventEmitter } from '../events';
+import { ChangePlaybackSpeedOptions } from '../types';
 
 class AudioStretcher {
   private static instance: AudioStretcher | null = null;
   protected readonly stretcher: IAudioStretcher;
+  protected readonly audioEventEmitter: AudioEventEmitter;
 
   private constructor() {
     this.stretcher = global.createAudioStretcher();
+    this.audioEventEmitter = new AudioEventEmitter(global.AudioEventEmitter);
   }
 
   public static getInstance(): AudioStretcher {
@@ -19,26 +23,42 @@ class AudioStretcher {
 
   public async changePlaybackSpeedInstance(
     input: AudioBuffer,
-    playbackSpeed: number
+    playbackSpeed: number,
+    options: ChangePlaybackSpeedOptions
   ): Promise<AudioBuffer> {
-    const buffer = await this.stretcher.changePlaybackSpeed(
-      input.buffer,
-      playbackSpeed
-    );
+    const progressSubscription = options.onProgress
+      ? this.audioEventEmitter.addAudioEventListener(
+          'stretchProgress',
+          options.onProgress
+        )
+      : undefined;
 
-    if (!buffer) {
-      throw new AudioApiError('Failed to change playback speed');
+    try {
+      const buffer = await this.stretcher.changePlaybackSpeed(
+        input.buffer,
+        playbackSpeed,
+        options.algorithm ?? 'tdhs',
+        progressSubscription?.subscriptionId ?? '0'
+      );
+
+      if (!buffer) {
+        throw new AudioApiError('Failed to change playback speed');
+      }
+      return new AudioBuffer(buffer);
+    } finally {
+      progressSubscription?.remove();
     }
-    return new AudioBuffer(buffer);
   }
 }
 
 export default async function changePlaybackSpeed(
   input: AudioBuffer,
-  playbackSpeed: number
+  playbackSpeed: number,
+  options: ChangePlaybackSpeedOptions = {}
 ): Promise<AudioBuffer> {
   return AudioStretcher.getInstance().changePlaybackSpeedInstance(
     input,
-    playbackSpeed
+    playbackSpeed,
+    options
   );
 }
@@ -3,33 +3,48 @@ import {
   InvalidAccessError,
   InvalidStateError,
   NotSupportedError,
+  RangeError,
 } from '../errors';
 import { IBaseAudioContext } from '../interfaces';
 import {
   AudioBufferBaseSourceNodeOptions,
+  AudioFileSourceNodeOptions,
   AudioWorkletRuntime,
   ContextState,
   ConvolverNodeOptions,
   DecodeDataInput,
   IIRFilterNodeOptions,
+  MappedBufferOptions,
+  PCMDataInput,
+  PCMDataOptions,
   PeriodicWaveConstraints,
+  PooledNodeType,
+  MixerNodeOptions,
+  SamplerNodeOptions,
 } from '../types';
 import { assertWorkletsEnabled } from '../utils';
 import AnalyserNode from './AnalyserNode';
 import AudioBuffer from './AudioBuffer';
 import AudioBufferQueueSourceNode from './AudioBufferQueueSourceNode';
 import AudioBufferSourceNode from './AudioBufferSourceNode';
-import { decodeAudioData, decodePCMInBase64 } from './AudioDecoder';
+import {
+  decodeAudioData,
+  decodePCMData,
+  decodePCMInBase64,
+} from './AudioDecoder';
 import AudioDestinationNode from './AudioDestinationNode';
+import AudioFileSourceNode from './AudioFileSourceNode';
 import BiquadFilterNode from './BiquadFilterNode';
 import ConstantSourceNode from './ConstantSourceNode';
 import ConvolverNode from './ConvolverNode';
 import DelayNode from './DelayNode';
 import GainNode from './GainNode';
 import IIRFilterNode from './IIRFilterNode';
+import MixerNode from './MixerNode';
 import OscillatorNode from './OscillatorNode';
 import PeriodicWave from './PeriodicWave';
 import RecorderAdapterNode from './RecorderAdapterNode';
+import SamplerNode from './SamplerNode';
 import StereoPannerNode from './StereoPannerNode';
 import StreamerNode from './StreamerNode';
 import WaveShaperNode from './WaveShaperNode';
@@ -77,6 +92,14 @@ export default class BaseAudioContext {
     );
   }
 
+  /** Converts raw samples and resamples them to the context sample rate. */
+  public async decodePCMData(
+    input: PCMDataInput,
+    options: PCMDataOptions
+  ): Promise<AudioBuffer> {
+    return await decodePCMData(input, options, this.sampleRate);
+  }
+
   createWorkletNode(
     callback: (audioData: Array<Float32Array>, channelCount: number) => void,
     bufferLength: number,
@@ -209,10 +232,49 @@ export default class BaseAudioContext {
     return new StreamerNode(this, streamer);
   }
 
+  createFileSource(
+    path: string,
+    options?: AudioFileSourceNodeOptions
+  ): AudioFileSourceNode {
+    const readAhead = options?.readAhead ?? 0.5;
+
+    if (readAhead < 0) {
+      throw new RangeError(
+        `readAhead must be a finite non-negative number: ${readAhead}`
+      );
+    }
+
+    const filePath = path.startsWith('file://')
+      ? path.replace('file://', '')
+      : path;
+    const fileSource = this.context.createFileSource(filePath, readAhead);
+    if (!fileSource) {
+      throw new NotSupportedError(`Unable to open audio file: ${path}`);
+    }
+
+    return new AudioFileSourceNode(this, fileSource);
+  }
+
   createConstantSource(): ConstantSourceNode {
     return new ConstantSourceNode(this, this.context.createConstantSource());
   }
 
+  createSampler(options?: SamplerNodeOptions): SamplerNode {
+    const maxPolyphony = options?.maxPolyphony ?? 32;
+    const voiceStealing = options?.voiceStealing ?? 'oldest';
+
+    if (!Number.isInteger(maxPolyphony) || maxPolyphony < 1) {
+      throw new RangeError(
+        `maxPolyphony must be a positive integer: ${maxPolyphony}`
+      );
+    }
+
+    return new SamplerNode(
+      this,
+      this.context.createSampler(maxPolyphony, voiceStealing)
+    );
+  }
+
   createGain(): GainNode {
     return new GainNode(this, this.context.createGain());
   }
@@ -226,6 +288,28 @@ export default class BaseAudioContext {
     return new StereoPannerNode(this, this.context.createStereoPanner());
   }
 
+  createMixer(options?: MixerNodeOptions): MixerNode {
+    const numberOfInputs = options?.numberOfInputs ?? 8;
+    const channelCount = options?.channelCount ?? 2;
+
+    if (!Number.isInteger(numberOfInputs) || numberOfInputs < 1) {
+      throw new RangeError(
+        `numberOfInputs must be a positive integer: ${numberOfInputs}`
+      );
+    }
+
+    if (!Number.isInteger(channelCount) || channelCount < 2) {
+      throw new RangeError(
+        `channelCount must be an integer not less than 2: ${channelCount}`
+      );
+    }
+
+    return new MixerNode(
+      this,
+      this.context.createMixer(numberOfInputs, channelCount)
+    );
+  }
+
   createBiquadFilter(): BiquadFilterNode {
     return new BiquadFilterNode(this, this.context.createBiquadFilter());
   }
@@ -266,10 +350,11 @@ export default class BaseAudioContext {
     options?: AudioBufferBaseSourceNodeOptions
   ): AudioBufferSourceNode {
     const pitchCorrection = options?.pitchCorrection ?? false;
+    const pitchCorrectionQuality = options?.pitchCorrectionQuality ?? 'high';
 
     return new AudioBufferSourceNode(
       this,
-      this.context.createBufferSource(pitchCorrection)
+      this.context.createBufferSource(pitchCorrection, pitchCorrectionQuality)
     );
   }
 
@@ -277,10 +362,14 @@ export default class BaseAudioContext {
     options?: AudioBufferBaseSourceNodeOptions
   ): AudioBufferQueueSourceNode {
     const pitchCorrection = options?.pitchCorrection ?? false;
+    const pitchCorrectionQuality = options?.pitchCorrectionQuality ?? 'high';
 
     return new AudioBufferQueueSourceNode(
       this,
-      this.context.createBufferQueueSource(pitchCorrection)
+      this.context.createBufferQueueSource(
+        pitchCorrection,
+        pitchCorrectionQuality
+      )
     );
   }
 
@@ -312,6 +401,36 @@ export default class BaseAudioContext {
     );
   }
 
+  createMappedBuffer(path: string, options?: MappedBufferOptions): AudioBuffer {
+    const sampleFormat = options?.sampleFormat;
+    const numberOfChannels = options?.numberOfChannels ?? 1;
+
+    if (
+      sampleFormat !== undefined &&
+      (numberOfChannels < 1 || numberOfChannels >= 32)
+    ) {
+      throw new NotSupportedError(
+        `The number of channels provided (${numberOfChannels}) is outside the range [1, 32]`
+      );
+    }
+
+    const filePath = path.startsWith('file://')
+      ? path.replace('file://', '')
+      : path;
+    const buffer = this.context.createMappedBuffer(
+      filePath,
+      sampleFormat,
+      numberOfChannels
+    );
+    if (!buffer) {
+      throw new NotSupportedError(
+        `Unable to map audio file: ${path}, only 16-bit, 24-bit integer and 32-bit float PCM at the context sample rate (${this.sampleRate}) is supported`
+      );
+    }
+
+    return new AudioBuffer(buffer);
+  }
+
   createPeriodicWave(
     real: Float32Array,
     imag: Float32Array,
@@ -358,4 +477,32 @@ export default class BaseAudioContext {
   createWaveShaper(): WaveShaperNode {
     return new WaveShaperNode(this, this.context.createWaveShaper());
   }
+
+  /**
+   * Creates nodes of the given type ahead of time, e.g. while a level loads.
+   * Finished nodes of these types are recycled as well, so firing many
+   * one-shot sounds does not allocate new nodes.
+   * Buffer sources with pitch correction are not pooled.
+   */
+  prewarmNodes(type: PooledNodeType, count: number): void {
+    if (!Number.isInteger(count) || count < 0) {
+      throw new RangeError(`count must be a non-negative integer: ${count}`);
+    }
+
+    this.context.prewarmNodes(type, count);
+  }
+
+  /**
+   * Applies every node creation, connect and disconnect made by the callback at
+   * once, on the same render quantum, so a partially rebuilt graph is never heard.
+   * Transactions can be nested, the outermost one applies the changes.
+   */
+  transaction<T>(callback: () => T): T {
+    this.context.beginTransaction();
+    try {
+      return callback();
+    } finally {
+      this.context.commitTransaction();
+    }
+  }
 }
@@ -0,0 +1,53 @@
+import { IndexSizeError } from '../errors';
+import { IMixerNode } from '../interfaces';
+import AudioNode from './AudioNode';
+import AudioParam from './AudioParam';
+import BaseAudioContext from './BaseAudioContext';
+
+export class MixerInput {
+  readonly index: number;
+  readonly gain: AudioParam;
+  readonly pan: AudioParam;
+  private readonly node: IMixerNode;
+
+  constructor(context: BaseAudioContext, node: IMixerNode, index: number) {
+    this.index = index;
+    this.node = node;
+    this.gain = new AudioParam(node.getGain(index), context);
+    this.pan = new AudioParam(node.getPan(index), context);
+  }
+
+  public get muted(): boolean {
+    return this.node.getMuted(this.index);
+  }
+
+  public set muted(value: boolean) {
+    this.node.setMuted(this.index, value);
+  }
+}
+
+export default class MixerNode extends AudioNode {
+  readonly inputs: ReadonlyArray<MixerInput>;
+
+  constructor(context: BaseAudioContext, node: IMixerNode) {
+    super(context, node);
+
+    const inputs: MixerInput[] = [];
+    for (let index = 0; index < node.numberOfInputs; index++) {
+      inputs.push(new MixerInput(context, node, index));
+    }
+    this.inputs = inputs;
+  }
+
+  public input(index: number): MixerInput {
+    const input = this.inputs[index];
+
+    if (input === undefined) {
+      throw new IndexSizeError(
+        `The input index ${index} is out of range [0, ${this.inputs.length})`
+      );
+    }
+
+    return input;
+  }
+}
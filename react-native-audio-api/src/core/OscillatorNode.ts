@@ -1,5 +1,5 @@
 import { IOscillatorNode } from '../interfaces';
-import { OscillatorType } from '../types';
+import { OscillatorMode, OscillatorType } from '../types';
 import AudioScheduledSourceNode from './AudioScheduledSourceNode';
 import AudioParam from './AudioParam';
 import BaseAudioContext from './BaseAudioContext';
@@ -32,6 +32,14 @@ export default class OscillatorNode extends AudioScheduledSourceNode {
     (this.node as IOscillatorNode).type = value;
   }
 
+  public get mode(): OscillatorMode {
+    return (this.node as IOscillatorNode).mode;
+  }
+
+  public set mode(value: OscillatorMode) {
+    (this.node as IOscillatorNode).mode = value;
+  }
+
   public setPeriodicWave(wave: PeriodicWave): void {
     (this.node as IOscillatorNode).setPeriodicWave(wave.periodicWave);
   }
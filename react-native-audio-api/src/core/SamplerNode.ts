@@ -0,0 +1,107 @@
+import { RangeError } from '../errors';
+import { ISamplerNode } from '../interfaces';
+import { SamplerRegion, VoiceStealingPolicy } from '../types';
+import AudioNode from './AudioNode';
+import BaseAudioContext from './BaseAudioContext';
+
+export default class SamplerNode extends AudioNode {
+  constructor(context: BaseAudioContext, node: ISamplerNode) {
+    super(context, node);
+  }
+
+  public get maxPolyphony(): number {
+    return (this.node as ISamplerNode).maxPolyphony;
+  }
+
+  public get voiceStealing(): VoiceStealingPolicy {
+    return (this.node as ISamplerNode).voiceStealing;
+  }
+
+  public get activeVoiceCount(): number {
+    return (this.node as ISamplerNode).activeVoiceCount;
+  }
+
+  public get attack(): number {
+    return (this.node as ISamplerNode).attack;
+  }
+
+  public set attack(value: number) {
+    SamplerNode.assertNonNegative('attack', value);
+    (this.node as ISamplerNode).attack = value;
+  }
+
+  public get decay(): number {
+    return (this.node as ISamplerNode).decay;
+  }
+
+  public set decay(value: number) {
+    SamplerNode.assertNonNegative('decay', value);
+    (this.node as ISamplerNode).decay = value;
+  }
+
+  public get sustain(): number {
+    return (this.node as ISamplerNode).sustain;
+  }
+
+  public set sustain(value: number) {
+    if (!(value >= 0 && value <= 1)) {
+      throw new RangeError(`sustain must be in range [0, 1]: ${value}`);
+    }
+
+    (this.node as ISamplerNode).sustain = value;
+  }
+
+  public get release(): number {
+    return (this.node as ISamplerNode).release;
+  }
+
+  public set release(value: number) {
+    SamplerNode.assertNonNegative('release', value);
+    (this.node as ISamplerNode).release = value;
+  }
+
+  public setRegions(regions: SamplerRegion[]): void {
+    (this.node as ISamplerNode).setRegions(
+      regions.map((region) => ({
+        buffer: region.buffer.buffer,
+        rootNote: region.rootNote,
+        lowNote: region.lowNote ?? 0,
+        highNote: region.highNote ?? 127,
+        lowVelocity: region.lowVelocity ?? 0,
+        highVelocity: region.highVelocity ?? 1,
+        gain: region.gain ?? 1,
+        loop: region.loop ?? false,
+        loopStart: region.loopStart ?? 0,
+        loopEnd: region.loopEnd ?? 0,
+      }))
+    );
+  }
+
+  public noteOn(
+    note: number,
+    velocity: number = 1,
+    when: number = 0,
+    detune: number = 0
+  ): void {
+    SamplerNode.assertNonNegative('when', when);
+    (this.node as ISamplerNode).noteOn(note, velocity, when, detune);
+  }
+
+  public noteOff(note: number, when: number = 0): void {
+    SamplerNode.assertNonNegative('when', when);
+    (this.node as ISamplerNode).noteOff(note, when);
+  }
+
+  public allNotesOff(when: number = 0): void {
+    SamplerNode.assertNonNegative('when', when);
+    (this.node as ISamplerNode).allNotesOff(when);
+  }
+
+  private static assertNonNegative(name: string, value: number): void {
+    if (!Number.isFinite(value) || value < 0) {
+      throw new RangeError(
+        `${name} must be a finite non-negative number: ${value}`
+      );
+    }
+  }
+}
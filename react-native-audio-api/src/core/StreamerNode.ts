@@ -1,8 +1,31 @@
 import { IStreamerNode } from '../interfaces';
 import AudioScheduledSourceNode from './AudioScheduledSourceNode';
+import { RangeError } from '../errors';
 
 export default class StreamerNode extends AudioScheduledSourceNode {
   public initialize(streamPath: string): boolean {
     return (this.node as IStreamerNode).initialize(streamPath);
   }
+
+  public get prebufferDuration(): number {
+    return (this.node as IStreamerNode).prebufferDuration;
+  }
+
+  public set prebufferDuration(value: number) {
+    if (value < 0) {
+      throw new RangeError(
+        `prebufferDuration must be a finite non-negative number: ${value}`
+      );
+    }
+
+    (this.node as IStreamerNode).prebufferDuration = value;
+  }
+
+  public get bufferedDuration(): number {
+    return (this.node as IStreamerNode).bufferedDuration;
+  }
+
+  public get underrunCount(): number {
+    return (this.node as IStreamerNode).underrunCount;
+  }
 }
@@ -82,11 +82,29 @@ export interface OnAudioReadyEventType {
   when: number;
 }
 
+/**
+ * Native payload of the `audioReady` event when the recorder reuses its
+ * buffers. It refers to a batch of buffers instead of carrying them, the
+ * buffers of every batch are fetched once when the callback is registered.
+ */
+export interface OnAudioReadyBatchEventType {
+  /** Index of the batch, to be released once the buffers are processed. */
+  batch: number;
+
+  /** Number of buffers filled in the batch. */
+  chunkCount: number;
+
+  /** Number of frames in the last buffer of the batch. */
+  numFrames: number;
+}
+
 interface AudioAPIEvents {
   ended: OnEndedEventType;
   loopEnded: EventEmptyType;
-  audioReady: OnAudioReadyEventType;
+  audioReady: OnAudioReadyEventType | OnAudioReadyBatchEventType;
   positionChanged: EventTypeWithValue;
+  bufferQueueLow: EventTypeWithValue;
+  stretchProgress: EventTypeWithValue;
   audioError: EventEmptyType; // to change
   systemStateChanged: EventEmptyType; // to change
   recorderError: OnRecorderErrorEventType;
@@ -5,11 +5,20 @@ import type {
   BiquadFilterType,
   ChannelCountMode,
   ChannelInterpretation,
+  CompactSampleFormat,
   ContextState,
   FileInfo,
+  InterpolationType,
+  OscillatorMode,
   OscillatorType,
   OverSampleType,
+  PcmSampleFormat,
+  PitchCorrectionQuality,
+  PlaybackSnapshot,
+  PooledNodeType,
   Result,
+  StretchAlgorithm,
+  VoiceStealingPolicy,
   WindowType,
 } from './types';
 
@@ -64,23 +73,40 @@ export interface IBaseAudioContext {
   ): IWorkletProcessingNode;
   createOscillator(): IOscillatorNode;
   createConstantSource(): IConstantSourceNode;
+  createSampler(
+    maxPolyphony: number,
+    voiceStealing: VoiceStealingPolicy
+  ): ISamplerNode;
   createGain(): IGainNode;
   createDelay(maxDelayTime: number): IDelayNode;
   createStereoPanner(): IStereoPannerNode;
+  createMixer(
+    numberOfInputs: number,
+    numberOfOutputChannels: number
+  ): IMixerNode;
   createBiquadFilter: () => IBiquadFilterNode;
   createIIRFilter: (
     feedforward: number[],
     feedback: number[]
   ) => IIIRFilterNode;
-  createBufferSource: (pitchCorrection: boolean) => IAudioBufferSourceNode;
+  createBufferSource: (
+    pitchCorrection: boolean,
+    pitchCorrectionQuality: PitchCorrectionQuality
+  ) => IAudioBufferSourceNode;
   createBufferQueueSource: (
-    pitchCorrection: boolean
+    pitchCorrection: boolean,
+    pitchCorrectionQuality: PitchCorrectionQuality
   ) => IAudioBufferQueueSourceNode;
   createBuffer: (
     channels: number,
     length: number,
     sampleRate: number
   ) => IAudioBuffer;
+  createMappedBuffer: (
+    path: string,
+    sampleFormat?: PcmSampleFormat,
+    numberOfChannels?: number
+  ) => IAudioBuffer | undefined; // undefined when the file can not be mapped
   createPeriodicWave: (
     real: Float32Array,
     imag: Float32Array,
@@ -92,7 +118,14 @@ export interface IBaseAudioContext {
     disableNormalization: boolean
   ) => IConvolverNode;
   createStreamer: () => IStreamerNode | null; // null when FFmpeg is not enabled
+  createFileSource: (
+    path: string,
+    readAhead: number
+  ) => IAudioFileSourceNode | undefined; // undefined when the file can not be opened
   createWaveShaper: () => IWaveShaperNode;
+  beginTransaction: () => void;
+  commitTransaction: () => void;
+  prewarmNodes: (type: PooledNodeType, count: number) => void;
 }
 
 export interface IAudioContext extends IBaseAudioContext {
@@ -115,8 +148,16 @@ export interface IAudioNode {
   readonly channelCountMode: ChannelCountMode;
   readonly channelInterpretation: ChannelInterpretation;
 
-  connect: (destination: IAudioNode | IAudioParam) => void;
-  disconnect: (destination?: IAudioNode | IAudioParam) => void;
+  connect: (
+    destination: IAudioNode | IAudioParam,
+    output?: number,
+    input?: number
+  ) => void;
+  disconnect: (
+    destination?: IAudioNode | IAudioParam,
+    output?: number,
+    input?: number
+  ) => void;
 }
 
 export interface IDelayNode extends IAudioNode {
@@ -132,6 +173,13 @@ export interface IStereoPannerNode extends IAudioNode {
   readonly pan: IAudioParam;
 }
 
+export interface IMixerNode extends IAudioNode {
+  getGain: (input: number) => IAudioParam;
+  getPan: (input: number) => IAudioParam;
+  getMuted: (input: number) => boolean;
+  setMuted: (input: number, muted: boolean) => void;
+}
+
 export interface IBiquadFilterNode extends IAudioNode {
   readonly frequency: AudioParam;
   readonly detune: AudioParam;
@@ -160,6 +208,9 @@ export interface IAudioScheduledSourceNode extends IAudioNode {
   start(when: number): void;
   stop: (when: number) => void;
 
+  // consistent state published by the audio thread every render quantum
+  readonly playbackSnapshot: PlaybackSnapshot;
+
   // passing subscriptionId(uint_64 in cpp, string in js) to the cpp
   onEnded: string;
 }
@@ -181,24 +232,79 @@ export interface IOscillatorNode extends IAudioScheduledSourceNode {
   readonly frequency: IAudioParam;
   readonly detune: IAudioParam;
   type: OscillatorType;
+  mode: OscillatorMode;
 
   setPeriodicWave(periodicWave: IPeriodicWave): void;
 }
 
 export interface IStreamerNode extends IAudioNode {
+  // seconds of audio buffered before playback starts or resumes after an underrun
+  prebufferDuration: number;
+  readonly bufferedDuration: number;
+  readonly underrunCount: number;
+
   initialize(streamPath: string): boolean;
 }
 
+export interface IAudioFileSourceNode extends IAudioScheduledSourceNode {
+  loop: boolean;
+  loopStart: number;
+  loopEnd: number;
+  // 0 until the length of the file is known
+  readonly duration: number;
+  readonly position: number;
+  // seconds of audio decoded ahead of the playback position
+  readonly readAhead: number;
+  readonly bufferedDuration: number;
+  readonly underrunCount: number;
+
+  seek(position: number): void;
+}
+
 export interface IConstantSourceNode extends IAudioScheduledSourceNode {
   readonly offset: IAudioParam;
 }
 
+export interface ISamplerRegion {
+  buffer: IAudioBuffer;
+  rootNote: number;
+  lowNote: number;
+  highNote: number;
+  lowVelocity: number;
+  highVelocity: number;
+  gain: number;
+  loop: boolean;
+  loopStart: number;
+  loopEnd: number;
+}
+
+export interface ISamplerNode extends IAudioNode {
+  readonly maxPolyphony: number;
+  readonly voiceStealing: VoiceStealingPolicy;
+  readonly activeVoiceCount: number;
+  attack: number;
+  decay: number;
+  sustain: number;
+  release: number;
+
+  setRegions: (regions: ISamplerRegion[]) => void;
+  noteOn: (
+    note: number,
+    velocity: number,
+    when: number,
+    detune: number
+  ) => void;
+  noteOff: (note: number, when: number) => void;
+  allNotesOff: (when: number) => void;
+}
+
 export interface IAudioBufferSourceNode extends IAudioBufferBaseSourceNode {
   buffer: IAudioBuffer | null;
   loop: boolean;
   loopSkip: boolean;
   loopStart: number;
   loopEnd: number;
+  interpolation: InterpolationType;
 
   start: (when?: number, offset?: number, duration?: number) => void;
   setBuffer: (audioBuffer: IAudioBuffer | null) => void;
@@ -209,6 +315,10 @@ export interface IAudioBufferSourceNode extends IAudioBufferBaseSourceNode {
 
 export interface IAudioBufferQueueSourceNode
   extends IAudioBufferBaseSourceNode {
+  // remaining queued duration (in seconds) below which bufferQueueLow is sent
+  lowWaterMark: number;
+  onBufferQueueLow: string;
+
   dequeueBuffer: (bufferId: number) => void;
   clearBuffers: () => void;
 
@@ -242,6 +352,7 @@ export interface IAudioBuffer {
     channelNumber: number,
     startInChannel: number
   ): void;
+  compact(sampleFormat: CompactSampleFormat): void;
 }
 
 export interface IAudioParam {
@@ -298,7 +409,7 @@ export interface IWaveShaperNode extends IAudioNode {
   setCurve(curve: Float32Array | null): void;
 }
 export interface IAudioRecorderCallbackOptions
-  extends AudioRecorderCallbackOptions {
+  extends Required<AudioRecorderCallbackOptions> {
   callbackId: string;
 }
 
@@ -324,6 +435,8 @@ export interface IAudioRecorder {
 
   setOnAudioReady: (options: IAudioRecorderCallbackOptions) => Result<void>;
   clearOnAudioReady: () => void;
+  getAudioReadyBuffers: () => IAudioBuffer[];
+  releaseAudioReadyBatch: (callbackId: string, batch: number) => void;
 
   setOnError: (options: { callbackId: string }) => void;
   clearOnError: () => void;
@@ -347,12 +460,31 @@ export interface IAudioDecoder {
     inputChannelCount: number,
     interleaved?: boolean
   ) => Promise<IAudioBuffer>;
+  // data is read in place, outputSampleRate of 0 keeps inputSampleRate
+  decodeWithPCMData: (
+    data: Uint8Array,
+    sampleFormat: 'int16' | 'float32',
+    inputSampleRate: number,
+    inputChannelCount: number,
+    interleaved: boolean,
+    outputSampleRate: number
+  ) => Promise<IAudioBuffer>;
+  // resolves to false when the file can not be decoded
+  prefetchWithFilePath: (
+    sourcePath: string,
+    sampleRate?: number
+  ) => Promise<boolean>;
+  setCacheBudget: (bytes: number) => void;
+  clearCache: () => void;
 }
 
 export interface IAudioStretcher {
   changePlaybackSpeed: (
     arrayBuffer: IAudioBuffer,
-    playbackSpeed: number
+    playbackSpeed: number,
+    algorithm: StretchAlgorithm,
+    // '0' when progress is not reported
+    progressCallbackId: string
   ) => Promise<IAudioBuffer>;
 }
 
@@ -1,4 +1,5 @@
 import AudioBuffer from './core/AudioBuffer';
+import type { EventTypeWithValue } from './events/types';
 
 export type Result<T> =
   | ({ status: 'success' } & T)
@@ -29,6 +30,12 @@ export type OscillatorType =
   | 'triangle'
   | 'custom';
 
+export type OscillatorMode = 'wavetable' | 'polyblep';
+
+export type InterpolationType = 'linear' | 'cubic' | 'sinc';
+
+export type PitchCorrectionQuality = 'high' | 'low';
+
 export interface PeriodicWaveConstraints {
   disableNormalization: boolean;
 }
@@ -110,8 +117,77 @@ export interface FileInfo {
 
 export type WindowType = 'blackman' | 'hann';
 
+export type PooledNodeType = 'bufferSource' | 'oscillator';
+
+export type PlaybackState =
+  | 'unscheduled'
+  | 'scheduled'
+  | 'playing'
+  | 'stopScheduled'
+  | 'finished';
+
+export interface PlaybackSnapshot {
+  state: PlaybackState;
+  // playback position in seconds, 0 for sources without a buffer
+  position: number;
+  // seconds of audio left to play from the buffer or the queue
+  bufferedDuration: number;
+  // context time at which the snapshot was taken
+  contextTime: number;
+}
+
 export interface AudioBufferBaseSourceNodeOptions {
   pitchCorrection: boolean;
+  pitchCorrectionQuality?: PitchCorrectionQuality;
+}
+
+export interface AudioFileSourceNodeOptions {
+  /**
+   * Seconds of audio decoded ahead of the playback position, it bounds the
+   * memory used by the node regardless of the length of the file.
+   */
+  readAhead?: number;
+}
+
+export type PcmSampleFormat = 'int16' | 'int24' | 'float32';
+
+export type CompactSampleFormat = 'int16' | 'float16';
+
+export interface MappedBufferOptions {
+  /**
+   * Format of a headerless PCM file of interleaved little-endian samples,
+   * the file is read as WAV when it is not provided.
+   */
+  sampleFormat?: PcmSampleFormat;
+  /** Number of interleaved channels of a headerless PCM file. */
+  numberOfChannels?: number;
+}
+
+export type StretchAlgorithm = 'tdhs' | 'signalsmith';
+
+export interface ChangePlaybackSpeedOptions {
+  /**
+   * 'tdhs' is a fast time domain method working on 16-bit samples,
+   * 'signalsmith' keeps float samples and a higher quality. Defaults to 'tdhs'.
+   */
+  algorithm?: StretchAlgorithm;
+  /** Receives the processed fraction of the buffer in the value field. */
+  onProgress?: (event: EventTypeWithValue) => void;
+}
+
+export type PCMDataInput = ArrayBuffer | Int16Array | Float32Array;
+
+export interface PCMDataOptions {
+  /** Rate the samples were recorded at. */
+  sampleRate: number;
+  numberOfChannels: number;
+  /**
+   * Format of the samples, taken from the typed array when it is not
+   * provided. ArrayBuffer input defaults to 'int16'.
+   */
+  sampleFormat?: 'int16' | 'float32';
+  /** Whether frames are stored one after another, defaults to true. */
+  interleaved?: boolean;
 }
 
 export type ProcessorMode = 'processInPlace' | 'processThrough';
@@ -121,6 +197,37 @@ export interface ConvolverNodeOptions {
   disableNormalization?: boolean;
 }
 
+export type VoiceStealingPolicy = 'none' | 'oldest' | 'quietest';
+
+export interface SamplerNodeOptions {
+  // number of notes playing at the same time, 32 by default
+  maxPolyphony?: number;
+  // voice taken over by a note played while every voice is busy, 'oldest' by default
+  voiceStealing?: VoiceStealingPolicy;
+}
+
+export interface SamplerRegion {
+  buffer: AudioBuffer;
+  // note at which the buffer plays at its original pitch
+  rootNote: number;
+  lowNote?: number;
+  highNote?: number;
+  lowVelocity?: number;
+  highVelocity?: number;
+  gain?: number;
+  loop?: boolean;
+  // in seconds, a loop end of 0 loops up to the end of the buffer
+  loopStart?: number;
+  loopEnd?: number;
+}
+
+export interface MixerNodeOptions {
+  // number of inputs, each with its own gain, pan and mute, 8 by default
+  numberOfInputs?: number;
+  // number of channels of the output, 2 by default
+  channelCount?: number;
+}
+
 export type OverSampleType = 'none' | '2x' | '4x';
 
 export interface AudioRecorderCallbackOptions {
@@ -143,6 +250,23 @@ export interface AudioRecorderCallbackOptions {
    * for stereo recordings.
    */
   channelCount: number;
+
+  /**
+   * When enabled, the buffers passed to the callback come from a small pool
+   * and are handed back to the recorder as soon as the callback returns, so
+   * that recording does not allocate memory for every buffer. The buffer must
+   * not be used after the callback returns, copy the data to keep it.
+   * Defaults to false.
+   */
+  reuseBuffers?: boolean;
+
+  /**
+   * The number of buffers delivered to JS at once when `reuseBuffers` is
+   * enabled. The callback is still invoked for every buffer, but larger
+   * batches reduce the per-buffer overhead at the cost of latency.
+   * Defaults to 1.
+   */
+  batchSize?: number;
 }
 
 export interface IIRFilterNodeOptions {
@@ -1,4 +1,5 @@
 import { IndexSizeError } from '../errors';
+import { CompactSampleFormat } from '../types';
 
 export default class AudioBuffer {
   readonly length: number;
@@ -66,4 +67,7 @@ export default class AudioBuffer {
 
     this.buffer.copyToChannel(source, channelNumber, startInChannel);
   }
+
+  /** Browsers always store float samples, kept for API compatibility. */
+  public compact(_sampleFormat: CompactSampleFormat = 'int16'): void {}
 }